@@ -0,0 +1,462 @@
+/*!
+ * \file kernel_benchmarks.cpp
+ * \brief Throughput and thread scaling of the core kernels of the finite volume solvers on synthetic box meshes.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../Common/include/geometry/CPhysicalGeometry.hpp"
+#include "../Common/include/linear_algebra/CSysMatrix.hpp"
+#include "../Common/include/linear_algebra/CSysVector.hpp"
+#include "../Common/include/toolboxes/graph_toolbox.hpp"
+#include "../SU2_CFD/include/solvers/CSolver.hpp"
+#include "../SU2_CFD/include/fluid/CIdealGas.hpp"
+#include "../SU2_CFD/include/variables/CEulerVariable.hpp"
+#include "../SU2_CFD/include/numerics_simd/CNumericsSIMD.hpp"
+#include "../SU2_CFD/include/gradients/computeGradientsGreenGauss.hpp"
+#include "../SU2_CFD/include/gradients/computeGradientsLeastSquares.hpp"
+#include "../SU2_CFD/include/limiters/computeLimiters.hpp"
+#include "../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+#include "CLI11.hpp"
+
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <sstream>
+
+constexpr size_t OMP_MIN_SIZE = 32; /*!< \brief Minimum chunk size of the edge and point loops. */
+
+/*!
+ * \brief Kernel to benchmark.
+ */
+struct Kernel {
+  std::string name;           /*!< \brief Name in the report. */
+  passivedouble bytes;        /*!< \brief Estimate of the minimum memory traffic of one call on this rank. */
+  bool threaded;              /*!< \brief False for kernels that are not thread-parallel (run once). */
+  std::function<void()> run;  /*!< \brief Called by all threads of a parallel region (work-sharing). */
+  std::function<void()> setup; /*!< \brief Optional untimed preparation, called like "run". */
+};
+
+/*!
+ * \brief Silence the (very verbose) console output of the setup on all ranks.
+ */
+class CSilentScope {
+  std::streambuf* const buffer;
+ public:
+  CSilentScope() : buffer(cout.rdbuf()) { cout.rdbuf(nullptr); }
+  ~CSilentScope() { cout.rdbuf(buffer); }
+};
+
+/*!
+ * \brief Configuration of an inviscid box, implicit with MUSCL reconstruction, limiter, and ILU.
+ * \param[in] size - Number of points in each direction.
+ * \param[in] scheme - Convective scheme, e.g. "ROE" or "JST".
+ * \param[in] pointOrdering - Renumbering of the points, e.g. "RCM" or "HILBERT".
+ * \param[in] edgeOrdering - Order of the edges, "NATURAL" or "BLOCKED".
+ */
+std::unique_ptr<CConfig> CreateConfig(unsigned long size, const std::string& scheme, const std::string& pointOrdering,
+                                      const std::string& edgeOrdering) {
+  std::stringstream options;
+  options << "SOLVER= EULER\n"
+          << "MATH_PROBLEM= DIRECT\n"
+          << "MESH_FORMAT= BOX\n"
+          << "MESH_BOX_SIZE= " << size << ", " << size << ", " << size << "\n"
+          << "MESH_BOX_LENGTH= 1, 1, 1\n"
+          << "MESH_BOX_OFFSET= 0, 0, 0\n"
+          << "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+          << "CONV_NUM_METHOD_FLOW= " << scheme << "\n"
+          << "MUSCL_FLOW= " << (scheme == "JST" ? "NO" : "YES") << "\n"
+          << "SLOPE_LIMITER_FLOW= VENKATAKRISHNAN\n"
+          << "NUM_METHOD_GRAD= WEIGHTED_LEAST_SQUARES\n"
+          << "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+          << "LINEAR_SOLVER_PREC= ILU\n"
+          << "POINT_ORDERING= " << pointOrdering << "\n"
+          << "EDGE_ORDERING= " << edgeOrdering << "\n";
+
+  CSilentScope silent;
+  return std::unique_ptr<CConfig>(new CConfig(options, SU2_COMPONENT::SU2_CFD, false));
+}
+
+/*!
+ * \brief Partition and preprocess the box mesh as the driver does for the finest grid of a FVM solver.
+ */
+std::unique_ptr<CGeometry> CreateGeometry(CConfig* config) {
+  CSilentScope silent;
+  std::unique_ptr<CGeometry> geometry;
+  {
+    std::unique_ptr<CGeometry> aux(new CPhysicalGeometry(config, 0, 1));
+    aux->SetColorGrid_Parallel(config);
+    geometry.reset(new CPhysicalGeometry(aux.get(), config));
+  }
+  geometry->SetSendReceive(config);
+  geometry->SetBoundaries(config);
+  geometry->SetPoint_Connectivity();
+  geometry->SetPoint_Ordering(config);
+  geometry->SetPoint_Connectivity();
+  geometry->SetElement_Connectivity();
+  geometry->SetBoundVolume();
+  geometry->Check_IntElem_Orientation(config);
+  geometry->Check_BoundElem_Orientation(config);
+  geometry->SetEdges();
+  geometry->SetEdge_Ordering(config->GetKind_EdgeOrdering());
+  geometry->SetVertex(config);
+  SU2_OMP_PARALLEL {
+    geometry->SetControlVolume(config, ALLOCATE);
+    geometry->SetBoundControlVolume(config, ALLOCATE);
+  }
+  END_SU2_OMP_PARALLEL
+  geometry->FindNormal_Neighbor(config);
+  geometry->SetGlobal_to_Local_Point();
+  geometry->PreprocessP2PComms(geometry.get(), config);
+  return geometry;
+}
+
+/*!
+ * \brief Flow variables of a smooth perturbation of a uniform flow, with consistent primitive variables.
+ */
+std::unique_ptr<CEulerVariable> CreateFlowVariables(const CGeometry& geometry, const CConfig& config,
+                                                    CFluidModel& fluidModel) {
+  const auto nDim = geometry.GetnDim();
+  const unsigned long nVar = nDim + 2;
+  const su2double gamma = 1.4, density = 1.2, pressure = 101325.0, velocity[] = {100.0, 10.0, 0.0};
+  const su2double energy = pressure / (density * (gamma - 1)) + 0.5 * GeometryToolbox::SquaredNorm(nDim, velocity);
+
+  std::unique_ptr<CEulerVariable> nodes(
+      new CEulerVariable(density, velocity, energy, geometry.GetnPoint(), nDim, nVar, &config));
+
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPoint(); ++iPoint) {
+    const auto coord = geometry.nodes->GetCoord(iPoint);
+    const su2double factor = 1.0 + 0.05 * sin(6.0 * coord[0]) * cos(4.0 * coord[1]) * cos(2.0 * coord[2]);
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      nodes->SetSolution(iPoint, iVar, factor * nodes->GetSolution(iPoint, iVar));
+    }
+    nodes->SetPrimVar(iPoint, &fluidModel);
+  }
+  nodes->NonPhysicalEdgeCounter.resize(geometry.GetnEdge()) = 0;
+  return nodes;
+}
+
+/*!
+ * \brief Apply "edgeFunc" to packs of edges of each color, in parallel (as CFVMFlowSolverBase::ColorLoopSIMD).
+ */
+template <class EdgeFunc>
+void ColorLoopSIMD(const std::vector<GridColor<> >& coloring, const EdgeFunc& edgeFunc) {
+  for (const auto& color : coloring) {
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k + j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k + j * in];
+      }
+      edgeFunc(iEdge, mask);
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+/*!
+ * \brief Time the kernels for 1, 2, 4, ..., maxThreads threads per rank and report throughput and scaling.
+ * \param[in] size - Number of points in each direction of the box mesh.
+ * \param[in] repetitions - Number of timed calls of each kernel.
+ * \param[in] maxThreads - Maximum number of threads.
+ * \param[in] pointOrdering - Renumbering of the points.
+ * \param[in] edgeOrdering - Order of the edges.
+ * \param[in] csvFileName - If not empty, the results are also written to this file.
+ */
+void RunBenchmarks(unsigned long size, unsigned long repetitions, int maxThreads, const std::string& pointOrdering,
+                   const std::string& edgeOrdering, const std::string& csvFileName) {
+  const auto comm = SU2_MPI::GetComm();
+  const int rank = SU2_MPI::GetRank();
+  const int nRank = SU2_MPI::GetSize();
+
+  /*--- Setup of the mesh and of the data that does not depend on the number of threads. The edge coloring is built
+   * for the maximum number of threads, with a single thread it is only slightly less efficient than the natural
+   * coloring that the solver would use. ---*/
+
+  if (rank == MASTER_NODE) cout << "Generating a " << size << "^3 box mesh." << endl;
+
+  auto config = CreateConfig(size, "ROE", pointOrdering, edgeOrdering);
+  auto configJST = CreateConfig(size, "JST", pointOrdering, edgeOrdering);
+  auto geometry = CreateGeometry(config.get());
+
+  const auto nDim = geometry->GetnDim();
+  const auto nVar = nDim + 2;
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  const auto nEdge = geometry->GetnEdge();
+  const auto nnz = geometry->GetSparsePattern(ConnectivityType::FiniteVolume, 0).getNumNonZeros();
+
+  CIdealGas fluidModel(1.4, 287.058);
+  auto nodes = CreateFlowVariables(*geometry, *config, fluidModel);
+  auto nodesJST = CreateFlowVariables(*geometry, *configJST, fluidModel);
+  const unsigned long nPrimVar = nDim + 9, nPrimVarGrad = nDim + 4;
+
+  std::unique_ptr<CNumericsSIMD> roe(CNumericsSIMD::CreateNumerics(*config, nDim, MESH_0));
+  std::unique_ptr<CNumericsSIMD> jst(CNumericsSIMD::CreateNumerics(*configJST, nDim, MESH_0));
+
+  std::vector<GridColor<> > edgeColoring;
+  {
+    const auto& coloring = geometry->GetEdgeColoring();
+    for (auto iColor = 0ul; iColor < coloring.getOuterSize(); ++iColor) {
+      edgeColoring.emplace_back(coloring.innerIdx(iColor), coloring.getNumNonZeros(iColor),
+                                geometry->GetEdgeColorGroupSize());
+    }
+  }
+
+  /*--- Pseudo time term (CFL 10 based on the freestream spectral radius) to make the Jacobian diagonally dominant,
+   * as it would be in an implicit solver. ---*/
+  su2passivevector pseudoTime(nPoint);
+  pseudoTime = 0.0;
+  for (auto iEdge = 0ul; iEdge < nEdge; ++iEdge) {
+    const su2double area = GeometryToolbox::Norm(nDim, geometry->edges->GetNormal(iEdge));
+    for (auto iNode = 0u; iNode < 2u; ++iNode) {
+      pseudoTime(geometry->edges->GetNode(iEdge, iNode)) += SU2_TYPE::GetValue(area) * 450.0 / 10.0;
+    }
+  }
+
+  const vector<string> fieldNames = {"x", "y", "z", "Density", "Momentum_x", "Momentum_y", "Momentum_z", "Energy"};
+  CFVMDataSorter sorter(config.get(), geometry.get(), fieldNames);
+
+  /*--- Counts used to convert times into throughput. ---*/
+
+  unsigned long nPointGlobal = 0;
+  SU2_MPI::Allreduce(&nPointDomain, &nPointGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
+
+  unsigned long bandwidth = 0;
+  passivedouble edgeGap = 0.0;
+  geometry->GetOrdering_Metrics(bandwidth, edgeGap);
+
+  constexpr passivedouble real = sizeof(su2double), mixed = sizeof(su2mixedfloat), index = sizeof(unsigned long);
+  const passivedouble pointState = nPrimVar + nPrimVarGrad * (nDim + 1) + nDim;
+
+  std::vector<int> threadCounts;
+  for (int n = 1; n < maxThreads; n *= 2) threadCounts.push_back(n);
+  threadCounts.push_back(maxThreads);
+
+  if (rank == MASTER_NODE) {
+    cout << "Points: " << nPointGlobal << ", ranks: " << nRank << ", SIMD width: " << Double::Size
+         << ", mixed precision: " << (sizeof(su2mixedfloat) < sizeof(su2double) ? "yes" : "no") << "\n"
+         << "Point ordering: " << pointOrdering << ", edge ordering: " << edgeOrdering << ", bandwidth: " << bandwidth
+         << ", average edge index gap: " << edgeGap << "\n\n"
+         << std::setw(14) << "Kernel" << std::setw(9) << "Threads" << std::setw(14) << "Time/call[ms]"
+         << std::setw(12) << "MPoints/s" << std::setw(10) << "GB/s" << std::setw(10) << "Speedup" << std::setw(12)
+         << "Efficiency" << endl;
+  }
+  std::ofstream csv;
+  if (rank == MASTER_NODE && !csvFileName.empty()) {
+    csv.open(csvFileName);
+    csv << "\"Kernel\",\"Ranks\",\"Threads\",\"Points\",\"Time_Per_Call\",\"MPoints_Per_Second\",\"GB_Per_Second\","
+           "\"Speedup\",\"Efficiency\"\n";
+  }
+
+  std::map<std::string, passivedouble> serialTime;
+
+  for (const int nThreads : threadCounts) {
+    omp_set_num_threads(nThreads);
+
+    /*--- The matrix partitions (ILU) and loop chunk sizes depend on the number of threads. ---*/
+
+    SparseMatrixType jacobian;
+    jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry.get(), config.get());
+    CSysVector<su2double> residual(nPoint, nPointDomain, nVar, 0.0);
+    CSysVector<su2mixedfloat> x(nPoint, nPointDomain, nVar, 1.0), y(nPoint, nPointDomain, nVar, 0.0);
+
+    std::vector<Kernel> kernels;
+
+    kernels.push_back({"Gradient_GG",
+                       nPoint * (nPrimVarGrad * (1 + nDim) + 1) * real + nEdge * (nDim * real + 4 * index), true,
+                       [&]() {
+                         computeGradientsGreenGauss(nullptr, PRIMITIVE_GRADIENT, PERIODIC_NONE, *geometry, *config,
+                                                    nodes->GetPrimitive(), 0, nPrimVarGrad,
+                                                    nodes->GetGradient_Primitive());
+                       }});
+
+    for (const bool weighted : {false, true}) {
+      kernels.push_back({weighted ? "Gradient_WLS" : "Gradient_LS",
+                         nPoint * (nPrimVarGrad * (1 + nDim) + nDim + nDim * nDim) * real + nEdge * 4 * index, true,
+                         [&, weighted]() {
+                           computeGradientsLeastSquares(nullptr, PRIMITIVE_GRADIENT, PERIODIC_NONE, *geometry,
+                                                        *config, weighted, nodes->GetPrimitive(), 0, nPrimVarGrad,
+                                                        nodes->GetGradient_Primitive(), nodes->GetRmatrix());
+                         }});
+    }
+
+    kernels.push_back({"Limiter_Venkat", nPoint * (nPrimVarGrad * (nDim + 4) + nDim) * real + nEdge * 4 * index, true,
+                       [&]() {
+                         computeLimiters(LIMITER::VENKATAKRISHNAN, nullptr, PRIMITIVE_LIMITER, PERIODIC_LIM_PRIM_1,
+                                         PERIODIC_LIM_PRIM_2, *geometry, *config, 0, nPrimVarGrad,
+                                         nodes->GetPrimitive(), nodes->GetGradient_Reconstruction(),
+                                         nodes->GetSolution_Min(), nodes->GetSolution_Max(),
+                                         nodes->GetLimiter_Primitive());
+                       }});
+
+    /*--- Fluxes read the point states and edge normals, and update the residual and the Jacobian. ---*/
+    const passivedouble fluxUpdates = 2 * nPoint * nVar * real + 2 * nnz * nVar * nVar * mixed;
+
+    kernels.push_back({"Flux_Roe", nPoint * pointState * real + nEdge * (nDim * real + 2 * index) + fluxUpdates, true,
+                       [&]() {
+                         ColorLoopSIMD(edgeColoring, [&](const Int& iEdge, const Double& mask) {
+                           roe->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, residual,
+                                            jacobian);
+                         });
+                       }});
+
+    kernels.push_back({"Flux_JST", nPoint * (nPrimVar + 2 * nVar + 3 + nDim) * real + nEdge * (nDim * real + 2 * index) +
+                       fluxUpdates, true,
+                       [&]() {
+                         ColorLoopSIMD(edgeColoring, [&](const Int& iEdge, const Double& mask) {
+                           jst->ComputeFlux(iEdge, *configJST, *geometry, *nodesJST, UpdateType::COLORING, mask,
+                                            residual, jacobian);
+                         });
+                       }});
+
+    /*--- Linear algebra on the Jacobian assembled by one pass of the Roe kernel. ---*/
+    const passivedouble matrixBytes = nnz * (nVar * nVar * mixed + index) + (nPointDomain + 1) * index;
+
+    auto assemble = [&]() {
+      jacobian.SetValZero();
+      ColorLoopSIMD(edgeColoring, [&](const Int& iEdge, const Double& mask) {
+        roe->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, residual, jacobian);
+      });
+      SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
+      for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+        jacobian.AddVal2Diag(iPoint, pseudoTime(iPoint));
+      }
+      END_SU2_OMP_FOR
+    };
+    kernels.push_back({"SpMV", matrixBytes + 2 * nPoint * nVar * mixed, true,
+                       [&]() { jacobian.MatrixVectorProduct(x, y, geometry.get(), config.get()); }, assemble});
+
+    kernels.push_back({"ILU_Build", 2 * matrixBytes, true, [&]() { jacobian.BuildILUPreconditioner(); }});
+
+    kernels.push_back({"ILU_Apply", matrixBytes + 3 * nPoint * nVar * mixed, true,
+                       [&]() { jacobian.ComputeILUPreconditioner(x, y, geometry.get(), config.get()); }});
+
+    kernels.push_back({"Sort_Output", 3 * nPointDomain * fieldNames.size() * real + 2 * nPointDomain * index, false,
+                       [&]() {
+                         for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+                           for (auto iField = 0u; iField < fieldNames.size(); ++iField) {
+                             const su2double value = iField < nDim ? geometry->nodes->GetCoord(iPoint, iField)
+                                                                   : nodes->GetSolution(iPoint, iField - nDim);
+                             sorter.SetUnsortedData(iPoint, iField, value);
+                           }
+                         }
+                         sorter.SortOutputData();
+                       }});
+
+    for (const auto& kernel : kernels) {
+      if (!kernel.threaded && nThreads != threadCounts.front()) continue;
+
+      /*--- One untimed call to warm up caches and page in memory, then time all calls together on every rank. The
+       * time of the slowest rank is reported. ---*/
+
+      auto runKernel = [&](unsigned long nCalls) {
+        if (!kernel.threaded) {
+          for (auto iCall = 0ul; iCall < nCalls; ++iCall) kernel.run();
+          return;
+        }
+        SU2_OMP_PARALLEL {
+          for (auto iCall = 0ul; iCall < nCalls; ++iCall) kernel.run();
+        }
+        END_SU2_OMP_PARALLEL
+      };
+      if (kernel.setup) {
+        SU2_OMP_PARALLEL
+        kernel.setup();
+        END_SU2_OMP_PARALLEL
+      }
+      runKernel(1);
+
+      SU2_MPI::Barrier(comm);
+      const passivedouble start = SU2_MPI::Wtime();
+      runKernel(repetitions);
+      const passivedouble localTime = (SU2_MPI::Wtime() - start) / repetitions;
+
+      passivedouble time = 0.0, bytes = 0.0;
+      SU2_MPI::Allreduce(&localTime, &time, 1, MPI_DOUBLE, MPI_MAX, comm);
+      SU2_MPI::Allreduce(&kernel.bytes, &bytes, 1, MPI_DOUBLE, MPI_SUM, comm);
+
+      if (nThreads == threadCounts.front()) serialTime[kernel.name] = time;
+      const passivedouble speedup = serialTime[kernel.name] / time;
+      const passivedouble mpoints = 1e-6 * nPointGlobal / time;
+      const passivedouble gbytes = 1e-9 * bytes / time;
+      const passivedouble efficiency = speedup / nThreads;
+
+      if (rank != MASTER_NODE) continue;
+
+      cout << std::setw(14) << kernel.name << std::setw(9) << nThreads << std::fixed << std::setprecision(3)
+           << std::setw(14) << 1e3 * time << std::setw(12) << std::setprecision(2) << mpoints << std::setw(10)
+           << gbytes << std::setw(10) << speedup << std::setw(12) << efficiency << endl;
+
+      if (csv.is_open()) {
+        csv << '"' << kernel.name << "\"," << nRank << ',' << nThreads << ',' << nPointGlobal << ','
+            << std::scientific << time << ',' << std::fixed << mpoints << ',' << gbytes << ',' << speedup << ','
+            << efficiency << '\n';
+      }
+    }
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "\nGB/s are estimates of the minimum memory traffic, the edge kernels and the gradients do not include "
+            "halo communications." << endl;
+  }
+}
+
+int main(int argc, char* argv[]) {
+  unsigned long size = 48;
+  unsigned long repetitions = 10;
+  int maxThreads = omp_get_max_threads();
+  std::string pointOrdering = "RCM";
+  std::string edgeOrdering = "NATURAL";
+  std::string csvFileName;
+
+  CLI::App app{"SU2 kernel benchmarks"};
+  app.add_option("-s,--size", size, "Number of points in each direction of the box mesh.");
+  app.add_option("-r,--repetitions", repetitions, "Number of timed calls of each kernel.");
+  app.add_option("-t,--threads", maxThreads, "Maximum number of OpenMP threads per MPI rank.");
+  app.add_option("-p,--point-ordering", pointOrdering, "Renumbering of the points (NONE, RCM, HILBERT, MORTON).");
+  app.add_option("-e,--edge-ordering", edgeOrdering, "Order of the edges (NATURAL, BLOCKED).");
+  app.add_option("-o,--output", csvFileName, "Write the results to this CSV file.");
+
+  CLI11_PARSE(app, argc, argv)
+
+  omp_set_num_threads(maxThreads);
+
+#if defined(HAVE_OMP) && defined(HAVE_MPI)
+  int provided;
+  SU2_MPI::Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+#else
+  SU2_MPI::Init(&argc, &argv);
+#endif
+
+  RunBenchmarks(size, repetitions, maxThreads, pointOrdering, edgeOrdering, csvFileName);
+
+  SU2_MPI::Finalize();
+  omp_finalize();
+
+  return EXIT_SUCCESS;
+}
@@ -418,6 +418,9 @@ private:
   bool NewtonKrylov;           /*!< \brief Use a coupled Newton method to solve the flow equations. */
   array<unsigned short,3> NK_IntParam{{20, 3, 2}}; /*!< \brief Integer parameters for NK method. */
   array<su2double,4> NK_DblParam{{-2.0, 0.1, -3.0, 1e-4}}; /*!< \brief Floating-point parameters for NK method. */
+  unsigned short NK_PrecondLag;   /*!< \brief Maximum number of NK iterations that reuse the preconditioner. */
+  array<su2double,2> NK_PrecondRefresh{{1.5, 1.0}}; /*!< \brief Criteria for an early refresh of a lagged NK preconditioner. */
+  bool NK_PrecondFirstOrder;      /*!< \brief Build the NK preconditioner from a first-order Jacobian. */
 
   unsigned short nMGLevels;    /*!< \brief Number of multigrid levels (coarse levels). */
   unsigned short nCFL;         /*!< \brief Number of CFL, one for each multigrid level. */
@@ -524,6 +527,13 @@ private:
   ENUM_DATADRIVEN_METHOD Kind_DataDriven_Method;       /*!< \brief Method used for datset regression in data-driven fluid models. */
 
   su2double DataDriven_Relaxation_Factor; /*!< \brief Relaxation factor for Newton solvers in data-driven fluid models. */
+  bool LUT_Binary_Cache;                  /*!< \brief Use and create memory-mappable binary versions of look-up tables. */
+
+  bool CoolProp_Tabulation;               /*!< \brief Evaluate CoolProp through a table built at startup. */
+  su2double CoolProp_Table_Density[2],    /*!< \brief Density range of the CoolProp table. */
+  CoolProp_Table_Energy[2];               /*!< \brief Static energy range of the CoolProp table. */
+  unsigned short CoolProp_Table_Size[2];  /*!< \brief Number of density and energy nodes of the CoolProp table. */
+  string CoolProp_Table_FileName;         /*!< \brief Disk cache of the CoolProp table. */
 
   STRUCT_TIME_INT Kind_TimeIntScheme_FEA;    /*!< \brief Time integration for the FEA equations. */
   STRUCT_SPACE_ITE Kind_SpaceIteScheme_FEA;  /*!< \brief Iterative scheme for nonlinear structural analysis. */
@@ -616,6 +626,13 @@ private:
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
+  bool Linear_Solver_ILU_Level_Scheduling;       /*!< \brief Use level scheduling instead of thread partitions in ILU. */
+  unsigned short Linear_Solver_AMG_Levels;       /*!< \brief Max. number of levels of the AMG preconditioner. */
+  unsigned long Linear_Solver_AMG_Coarse_Size;   /*!< \brief Number of rows below which AMG stops coarsening. */
+  su2double Linear_Solver_AMG_Strength;          /*!< \brief Strength of connection threshold for AMG aggregation. */
+  unsigned short Linear_Solver_AMG_Sweeps;       /*!< \brief Pre and post smoothing sweeps of the AMG cycle. */
+  MIXED_PRECISION_SOLVER* Linear_Solver_Mixed_Precision; /*!< \brief Solvers using single precision matrices in the linear solver. */
+  unsigned short nLinear_Solver_Mixed_Precision;          /*!< \brief Number of solvers using mixed precision. */
   su2double SemiSpan;                   /*!< \brief Wing Semi span. */
   su2double Roe_Kappa;                  /*!< \brief Relaxation of the Roe scheme. */
   su2double Relaxation_Factor_Adjoint;  /*!< \brief Relaxation coefficient for variable updates of adjoint solvers. */
@@ -691,6 +708,8 @@ private:
   Wrt_Restart_Overwrite,              /*!< \brief Overwrite restart files or append iteration number.*/
   Wrt_Surface_Overwrite,              /*!< \brief Overwrite surface output files or append iteration number.*/
   Wrt_Volume_Overwrite,               /*!< \brief Overwrite volume output files or append iteration number.*/
+  Async_Output,                       /*!< \brief Write output files in a background thread.*/
+  Wall_Distance_Distributed,          /*!< \brief Compute the wall distance without gathering the walls on all ranks.*/
   Restart_Flow;                       /*!< \brief Restart flow solution for adjoint and linearized problems. */
   unsigned short nMarker_Monitoring,  /*!< \brief Number of markers to monitor. */
   nMarker_Designing,                  /*!< \brief Number of markers for the objective function. */
@@ -765,6 +784,7 @@ private:
   su2double *nBlades;                 /*!< \brief number of blades for turbomachinery computation. */
   unsigned short Geo_Description;     /*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;     /*!< \brief Mesh input format. */
+  unsigned short Mesh_Out_FileFormat; /*!< \brief Mesh output format (SU2 or SU2_BINARY). */
   TAB_OUTPUT Tab_FileFormat;          /*!< \brief Format of the output files. */
   unsigned short output_precision;    /*!< \brief <ofstream>.precision(value) for SU2_DOT and HISTORY output */
   unsigned short ActDisk_Jump;        /*!< \brief Format of the output files. */
@@ -789,6 +809,9 @@ private:
   nRefOriginMoment_Z;      /*!< \brief Number of Z-coordinate moment computation origins. */
   unsigned short nMesh_Box_Size;
   short *Mesh_Box_Size;          /*!< \brief Array containing the number of grid points in the x-, y-, and z-directions for the analytic RECTANGLE and BOX grid formats. */
+  MESH_BOX_ELEMENTS Kind_MeshBoxElements; /*!< \brief Type of elements of the analytic RECTANGLE and BOX grids. */
+  su2double MeshBox_Perturbation;         /*!< \brief Random perturbation of the interior points of the analytic grids. */
+  unsigned long Benchmark_Iter;           /*!< \brief Number of iterations of the benchmark mode (0 to disable it). */
   string Mesh_FileName,          /*!< \brief Mesh input file. */
   Mesh_Out_FileName,             /*!< \brief Mesh output file. */
   Solution_FileName,             /*!< \brief Flow solution input file. */
@@ -810,6 +833,7 @@ private:
 
   bool
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
+  Wrt_Profiling,             /*!< \brief Profile the main phases of the iterations and write a report at the end. */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_MultiGrid,             /*!< \brief Write the coarse grids to the visualization files.  */
@@ -1036,6 +1060,12 @@ private:
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
+  bool Partition_Cache;             /*!< \brief Reuse the partitioned grid of a previous run with the same mesh and ranks. */
+  string Partition_Cache_FileName;  /*!< \brief Prefix of the per-rank partition cache files. */
+  unsigned long Rebalance_Iter;     /*!< \brief Iterations over which the cost of the points is measured before repartitioning. */
+  su2double Rebalance_Tolerance;    /*!< \brief Measured load imbalance (above 1) that triggers the repartitioning. */
+  POINT_ORDERING Kind_PointOrdering; /*!< \brief Renumbering of the points of each rank. */
+  EDGE_ORDERING Kind_EdgeOrdering;   /*!< \brief Order of the edges. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint;                /*!< \brief AD-based discrete adjoint mode. */
   su2double Const_DES;                 /*!< \brief Detached Eddy Simulation Constant. */
@@ -1107,6 +1137,7 @@ private:
   jst_adj_coeff[2],      /*!< \brief artificial dissipation (adjoint) array for the COption class. */
   mesh_box_length[3],    /*!< \brief mesh box length for the COption class. */
   mesh_box_offset[3],    /*!< \brief mesh box offset for the COption class. */
+  mesh_box_stretching[3], /*!< \brief mesh box wall clustering for the COption class. */
   geo_loc[2],            /*!< \brief SU2_GEO section locations array for the COption class. */
   distortion[2],         /*!< \brief SU2_GEO section locations array for the COption class. */
   ea_lim[3],             /*!< \brief equivalent area limit array for the COption class. */
@@ -1148,6 +1179,8 @@ private:
                 ScreenWrtFreq[3];     /*!< \brief Array containing screen writing frequencies for timer iter, outer iter, inner iter */
   OUTPUT_TYPE* VolumeOutputFiles;     /*!< \brief File formats to output */
   unsigned short nVolumeOutputFiles=0;/*!< \brief Number of File formats to output */
+  VTU_COMPRESSION VolumeCompression;  /*!< \brief Compression of volume Paraview XML files */
+  VTU_COMPRESSION SurfaceCompression; /*!< \brief Compression of surface Paraview XML files */
   unsigned short nVolumeOutputFrequencies; /*!< \brief Number of frequencies for the volume outputs */
   unsigned long *VolumeOutputFrequencies; /*!< \brief list containing the writing frequencies */
 
@@ -1176,6 +1209,8 @@ private:
   string caseName;                 /*!< \brief Name of the current case */
 
   unsigned long edgeColorGroupSize; /*!< \brief Size of the edge groups colored for OpenMP parallelization of edge loops. */
+  bool haloCommOverlap;             /*!< \brief Overlap halo exchanges with the computation of interior edge fluxes. */
+  bool haloCommPersistent;          /*!< \brief Use persistent MPI requests for the halo exchanges. */
 
   INLET_SPANWISE_INTERP Kind_InletInterpolationFunction; /*!brief type of spanwise interpolation function to use for the inlet face. */
   INLET_INTERP_TYPE Kind_Inlet_InterpolationType;    /*!brief type of spanwise interpolation data to use for the inlet face. */
@@ -1201,6 +1236,7 @@ private:
   bool frozen,                              /*!< \brief Flag for determining if mixture is frozen. */
   ionization,                               /*!< \brief Flag for determining if free electron gas is in the mixture. */
   vt_transfer_res_limit,                    /*!< \brief Flag for determining if residual limiting for source term VT-transfer is used. */
+  point_implicit_chemistry,                 /*!< \brief Flag for the operator-split, point-implicit chemistry integration. */
   monoatomic,                               /*!< \brief Flag for monoatomic mixture. */
   Supercatalytic_Wall;                      /*!< \brief Flag for supercatalytic wall. */
   string GasModel,                          /*!< \brief Gas Model. */
@@ -1209,6 +1245,7 @@ private:
   su2double CatalyticEfficiency;            /*!< \brief Wall catalytic efficiency. */
   su2double *Inlet_MassFrac;                /*!< \brief Specified Mass fraction vectors for NEMO inlet boundaries. */
   su2double Inlet_Temperature_ve;           /*!< \brief Specified Tve for supersonic inlet boundaries (NEMO solver). */
+  unsigned short nPointImplicit_Substeps;   /*!< \brief Number of sub-steps of the point-implicit chemistry integration. */
 
   /*--- Additional species solver options ---*/
   bool Species_Clipping;           /*!< \brief Boolean that activates solution clipping for scalar transport. */
@@ -3126,6 +3163,12 @@ public:
    */
   unsigned short GetnRoughWall(void) const { return nRough_Wall; }
 
+  /*!
+   * \brief Get whether the wall distance is computed with distributed wall ADTs.
+   * \return <code>TRUE</code> if each rank only stores its own viscous wall elements.
+   */
+  bool GetWall_Distance_Distributed(void) const { return Wall_Distance_Distributed; }
+
   /*!
    * \brief Get the total number of objectives in kind_objective list
    * \return Total number of objectives in kind_objective list
@@ -3228,6 +3271,12 @@ public:
    */
   bool GetWrt_Performance(void) const { return Wrt_Performance; }
 
+  /*!
+   * \brief Get information about profiling the phases of the iterations (see CProfiler).
+   * \return <code>TRUE</code> means that the timings per region will be written to "profiling.csv" at the end.
+   */
+  bool GetWrt_Profiling(void) const { return Wrt_Profiling; }
+
   /*!
    * \brief Get information about the computational graph (e.g. memory usage) when using AD in reverse mode.
    * \return <code>TRUE</code> means that the tape statistics will be written after each recording.
@@ -3882,6 +3931,38 @@ public:
    */
   su2double GetRelaxation_DataDriven(void) const { return DataDriven_Relaxation_Factor; }
 
+  /*!
+   * \brief Check if binary versions of the look-up tables are used (and created).
+   * \return <code>TRUE</code> if look-up tables are memory-mapped from binary files.
+   */
+  bool GetLUT_BinaryCache(void) const { return LUT_Binary_Cache; }
+
+  /*!
+   * \brief Check if CoolProp is evaluated through a table built at startup.
+   * \return <code>TRUE</code> if the CoolProp fluid model is tabulated.
+   */
+  bool GetCoolProp_Tabulation(void) const { return CoolProp_Tabulation; }
+
+  /*!
+   * \brief Get the density range (min, max) of the CoolProp table.
+   */
+  const su2double* GetCoolProp_Table_Density(void) const { return CoolProp_Table_Density; }
+
+  /*!
+   * \brief Get the static energy range (min, max) of the CoolProp table.
+   */
+  const su2double* GetCoolProp_Table_Energy(void) const { return CoolProp_Table_Energy; }
+
+  /*!
+   * \brief Get the number of density and energy nodes of the CoolProp table.
+   */
+  const unsigned short* GetCoolProp_Table_Size(void) const { return CoolProp_Table_Size; }
+
+  /*!
+   * \brief Get the name of the file where the CoolProp table is cached.
+   */
+  const string& GetCoolProp_Table_FileName(void) const { return CoolProp_Table_FileName; }
+
   /*!
    * \brief Returns the name of the fluid we are using in CoolProp.
    */
@@ -4219,6 +4300,42 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void) const { return Linear_Solver_ILU_n; }
 
+  /*!
+   * \brief Get whether the ILU preconditioner is thread-parallelized by level scheduling (instead of partitioning).
+   */
+  bool GetLinear_Solver_ILU_Level_Scheduling(void) const { return Linear_Solver_ILU_Level_Scheduling; }
+
+  /*!
+   * \brief Get the maximum number of levels (including the finest) of the AMG preconditioner.
+   */
+  unsigned short GetLinear_Solver_AMG_Levels(void) const { return Linear_Solver_AMG_Levels; }
+
+  /*!
+   * \brief Get the number of (block) rows below which the AMG preconditioner stops coarsening.
+   */
+  unsigned long GetLinear_Solver_AMG_Coarse_Size(void) const { return Linear_Solver_AMG_Coarse_Size; }
+
+  /*!
+   * \brief Get the strength of connection threshold used to form the AMG aggregates.
+   */
+  su2double GetLinear_Solver_AMG_Strength(void) const { return Linear_Solver_AMG_Strength; }
+
+  /*!
+   * \brief Get the number of pre and post smoothing sweeps of the AMG cycle.
+   */
+  unsigned short GetLinear_Solver_AMG_Sweeps(void) const { return Linear_Solver_AMG_Sweeps; }
+
+  /*!
+   * \brief Check if a solver uses single precision matrices (and double precision refinement) in its linear solver.
+   * \param[in] solver - Kind of solver.
+   * \return True if the solver was listed in LINEAR_SOLVER_MIXED_PRECISION.
+   */
+  bool GetLinear_Solver_Mixed_Precision(MIXED_PRECISION_SOLVER solver) const {
+    for (unsigned short i = 0; i < nLinear_Solver_Mixed_Precision; ++i)
+      if (Linear_Solver_Mixed_Precision[i] == solver) return true;
+    return false;
+  }
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
@@ -4267,6 +4384,21 @@ public:
    */
   array<su2double,4> GetNewtonKrylovDblParam(void) const { return NK_DblParam; }
 
+  /*!
+   * \brief Get the maximum number of Newton-Krylov iterations that reuse the preconditioner (0 rebuilds it every iteration).
+   */
+  unsigned short GetNewtonKrylovPrecondLag(void) const { return NK_PrecondLag; }
+
+  /*!
+   * \brief Get the criteria {linear iterations growth factor, residual change} for an early preconditioner refresh.
+   */
+  array<su2double,2> GetNewtonKrylovPrecondRefresh(void) const { return NK_PrecondRefresh; }
+
+  /*!
+   * \brief Get whether the Newton-Krylov preconditioner is built from a first-order Jacobian.
+   */
+  bool GetNewtonKrylovPrecondFirstOrder(void) const { return NK_PrecondFirstOrder; }
+
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
    * \return relaxation coefficient of the linear solver for the implicit formulation.
@@ -4517,6 +4649,11 @@ public:
    */
   bool GetMUSCL_Flow(void) const { return MUSCL_Flow; }
 
+  /*!
+   * \brief Set the MUSCL reconstruction of the flow equations (used to evaluate first-order Jacobians).
+   */
+  void SetMUSCL_Flow(bool val_muscl) { MUSCL_Flow = val_muscl; }
+
   /*!
    * \brief Get if the upwind scheme used MUSCL or not.
    * \note This is the information that the code will use, the method will
@@ -5436,6 +5573,12 @@ public:
    */
   bool GetWrt_Volume_Overwrite(void) const { return Wrt_Volume_Overwrite; }
 
+  /*!
+   * \brief Flag for whether output files are written asynchronously.
+   * \return <code>TRUE</code> if the files are written by a background thread from a snapshot of the sorted data.
+   */
+  bool GetAsync_Output(void) const { return Async_Output; }
+
   /*!
    * \brief Provides the number of varaibles.
    * \return Number of variables.
@@ -5477,6 +5620,16 @@ public:
    */
   bool GetVTTransferResidualLimiting(void) const { return vt_transfer_res_limit; }
 
+  /*!
+   * \brief Indicates whether the chemistry and VT relaxation sources are integrated point-implicitly after the flow update.
+   */
+  bool GetPointImplicitChemistry(void) const { return point_implicit_chemistry; }
+
+  /*!
+   * \brief Number of implicit sub-steps per time step of the point-implicit chemistry integration.
+   */
+  unsigned short GetnPointImplicit_Substeps(void) const { return nPointImplicit_Substeps; }
+
   /*!
    * \brief Indicates if mixture is monoatomic.
    */
@@ -5538,6 +5691,12 @@ public:
    */
   unsigned short GetMesh_FileFormat(void) const { return Mesh_FileFormat; }
 
+  /*!
+   * \brief Get the format of the output grid (SU2 or SU2_BINARY).
+   * \return Format of the output grid.
+   */
+  unsigned short GetMesh_Out_FileFormat(void) const { return Mesh_Out_FileFormat; }
+
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -8720,25 +8879,6 @@ public:
    */
   unsigned long GetNonphysical_Reconstr(void) const { return Nonphys_Reconstr; }
 
-  /*!
-   * \brief Start the timer for profiling subroutines.
-   * \param[in] val_start_time - the value of the start time.
-   */
-  void Tick(double *val_start_time);
-
-  /*!
-   * \brief Stop the timer for profiling subroutines and store results.
-   * \param[in] val_start_time - the value of the start time.
-   * \param[in] val_function_name - string for the name of the profiled subroutine.
-   * \param[in] val_group_id - string for the name of the profiled subroutine.
-   */
-  void Tock(double val_start_time, const string& val_function_name, int val_group_id);
-
-  /*!
-   * \brief Write a CSV file containing the results of the profiling.
-   */
-  void SetProfilingCSV(void);
-
   /*!
    * \brief Start the timer for profiling subroutines.
    * \param[in] val_start_time - the value of the start time.
@@ -9364,6 +9504,12 @@ public:
    */
   unsigned long GetRestart_Iter(void) const { return Restart_Iter; }
 
+  /*!
+   * \brief Set whether the solution is restarted, the solvers read the restart files when they are created.
+   * \param[in] val_restart - Whether to restart.
+   */
+  void SetRestart(bool val_restart) { Restart = val_restart; }
+
   /*!
    * \brief Get the time step for multizone problems
    * \return Time step for multizone problems, it is set on all the zones
@@ -9486,6 +9632,29 @@ public:
    */
   su2double GetMeshBoxOffset(unsigned short val_iDim) const { return mesh_box_offset[val_iDim]; }
 
+  /*!
+   * \brief Get the wall clustering factor of the analytic RECTANGLE or BOX grid in the specified coordinate direction.
+   * \return Factor of the tanh distribution of the points (0 for uniform spacing).
+   */
+  passivedouble GetMeshBoxStretching(unsigned short val_iDim) const { return SU2_TYPE::GetValue(mesh_box_stretching[val_iDim]); }
+
+  /*!
+   * \brief Get the amplitude of the random perturbation of the interior points of the analytic RECTANGLE or BOX grid.
+   * \return Maximum displacement as a fraction of the local spacing.
+   */
+  passivedouble GetMeshBoxPerturbation() const { return SU2_TYPE::GetValue(MeshBox_Perturbation); }
+
+  /*!
+   * \brief Get the type of elements of the analytic RECTANGLE or BOX grid.
+   */
+  MESH_BOX_ELEMENTS GetKind_MeshBoxElements() const { return Kind_MeshBoxElements; }
+
+  /*!
+   * \brief Get the number of iterations of the benchmark mode.
+   * \return Number of iterations, 0 if the benchmark mode is disabled.
+   */
+  unsigned long GetBenchmark_Iter() const { return Benchmark_Iter; }
+
   /*!
    * \brief Get the number of screen output variables requested (maximum 6)
    */
@@ -9617,6 +9786,12 @@ public:
    */
   unsigned short GetnVolumeOutputFiles() const { return nVolumeOutputFiles; }
 
+  /*!
+   * \brief Get the compression of the appended data of Paraview XML files.
+   * \param[in] surface - Whether the file is a surface or a volume file.
+   */
+  VTU_COMPRESSION GetOutput_Compression(bool surface) const { return surface ? SurfaceCompression : VolumeCompression; }
+
   /*!
    * \brief GetVolumeOutputFrequency
    * \param[in] iFile: index of file number for which the writing frequency needs to be returned.
@@ -9665,6 +9840,16 @@ public:
    */
   unsigned long GetEdgeColoringGroupSize(void) const { return edgeColorGroupSize; }
 
+  /*!
+   * \brief Check if halo exchanges are overlapped with the computation of interior edge fluxes.
+   */
+  bool GetHaloCommOverlap(void) const { return haloCommOverlap; }
+
+  /*!
+   * \brief Check if the halo (point-to-point) exchanges use persistent MPI requests.
+   */
+  bool GetHaloCommPersistent(void) const { return haloCommPersistent; }
+
   /*!
    * \brief Get the ParMETIS load balancing tolerance.
    */
@@ -9680,6 +9865,37 @@ public:
    */
   long GetParMETIS_EdgeWeight() const { return ParMETIS_edgeWgt; }
 
+  /*!
+   * \brief Check if the partitioned grid is stored in, and reloaded from, per-rank cache files.
+   */
+  bool GetPartition_Cache() const { return Partition_Cache; }
+
+  /*!
+   * \brief Get the prefix of the per-rank partition cache files.
+   */
+  const string& GetPartition_Cache_FileName() const { return Partition_Cache_FileName; }
+
+  /*!
+   * \brief Get the number of iterations (time iterations if unsteady) over which the cost of the points is measured
+   *        before the grid is repartitioned with the measured costs, 0 if dynamic load balancing is disabled.
+   */
+  unsigned long GetRebalance_Iter() const { return Rebalance_Iter; }
+
+  /*!
+   * \brief Get the measured load imbalance (max/avg - 1) above which the grid is repartitioned.
+   */
+  passivedouble GetRebalance_Tolerance() const { return SU2_TYPE::GetValue(Rebalance_Tolerance); }
+
+  /*!
+   * \brief Get the renumbering of the points of each rank.
+   */
+  POINT_ORDERING GetKind_PointOrdering() const { return Kind_PointOrdering; }
+
+  /*!
+   * \brief Get the order of the edges.
+   */
+  EDGE_ORDERING GetKind_EdgeOrdering() const { return Kind_EdgeOrdering; }
+
   /*!
    * \brief Find the marker index (if any) that is part of a given interface pair.
    * \param[in] iInterface - Number of the interface pair being tested, starting at 0.
@@ -122,6 +122,14 @@ class CADTElemClass : public CADTBaseClass {
                                  markerID, elemID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the bounding box of all elements in the ADT.
+   * \note For an empty ADT the minimum coordinates are larger than the maximum coordinates.
+   * \param[out] coorMin  Minimum coordinates of the bounding box.
+   * \param[out] coorMax  Maximum coordinates of the bounding box.
+   */
+  void GetBoundingBox(su2double* coorMin, su2double* coorMax) const;
+
  private:
   /*!
    * \brief Implementation of DetermineContainingElement.
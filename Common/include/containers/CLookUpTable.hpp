@@ -29,6 +29,7 @@
 
 #include <array>
 #include <iomanip>
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -56,14 +57,17 @@ class CLookUpTable {
 
   unsigned long n_variables, n_table_levels = 1;
 
+  unsigned long idx_CV1, /*!< \brief Column index of controlling variable 1 in the table data.*/
+      idx_CV2;           /*!< \brief Column index of controlling variable 2 in the table data.*/
+
   su2vector<su2double> z_values_levels; /*!< \brief Constant z-values of each table level.*/
 
   unsigned short table_dim = 2; /*!< \brief Table dimension.*/
   /*!
    * \brief The lower and upper limits of the z, y and x variable for each table level.
    */
-  std::pair<su2double*, su2double*> limits_table_z;
-  su2vector<std::pair<su2double*, su2double*>> limits_table_y, limits_table_x;
+  std::pair<const su2double*, const su2double*> limits_table_z;
+  su2vector<std::pair<const su2double*, const su2double*>> limits_table_y, limits_table_x;
 
   /*! \brief Holds the variable names stored in the table file.
    * Order is in sync with data.
@@ -103,7 +107,24 @@ class CLookUpTable {
   /*! \brief
    * Vector of all the weight factors for the interpolation.
    */
-  su2vector<su2vector<su2activematrix>> interp_mat_inv_x_y;
+  su2vector<su2activematrix> interp_mat_inv_x_y;
+
+  /*! \brief
+   * Number of edges per table level.
+   */
+  su2vector<unsigned long> n_edges;
+
+  /*! \brief
+   * Per-level pointers to the table data (n_variables x n_points), triangles (n_triangles x 3), hull points,
+   * and inverse interpolation matrices (n_triangles x 3 x 3), all row-major. They point either to the
+   * containers above or into the memory-mapped binary table, which is then shared by all processes of a node.
+   */
+  su2vector<const su2double*> table_data_p, interp_mat_inv_p;
+  su2vector<const unsigned long*> triangles_p, hull_p;
+
+  const char* mapped_data = nullptr; /*!< \brief Start of the memory-mapped binary table. */
+  size_t mapped_size = 0;            /*!< \brief Size of the memory-mapped binary table. */
+  std::vector<char> mapped_buffer;   /*!< \brief Binary table contents where memory mapping is not available. */
 
   /*! \brief
    * Returns the index to the variable in the lookup table.
@@ -137,9 +158,61 @@ class CLookUpTable {
    * \returns Pointer to the column data.
    */
   inline const su2double* GetDataP(const std::string& name_var, unsigned long i_level = 0) const {
-    return table_data[i_level][GetIndexOfVar(name_var)];
+    return GetDataP(GetIndexOfVar(name_var), i_level);
+  }
+
+  /*!
+   * \brief Get the pointer to the column data of the variable with index idx_var.
+   * \returns Pointer to the column data.
+   */
+  inline const su2double* GetDataP(unsigned long idx_var, unsigned long i_level) const {
+    return table_data_p[i_level] + idx_var * n_points[i_level];
   }
 
+  /*!
+   * \brief Point the per-level data pointers to the table containers.
+   */
+  void SetDataPointers();
+
+  /*!
+   * \brief Build the trapezoidal maps of all table levels.
+   */
+  void BuildTrapezoidalMaps();
+
+  /*!
+   * \brief Check if a file is a binary look-up table.
+   * \param[in] file_name - Name of the file.
+   * \returns True if the file starts with the binary table identifier.
+   */
+  static bool IsBinaryTable(const std::string& file_name);
+
+  /*!
+   * \brief Memory-map a binary look-up table file (read-only and shared between processes).
+   * \param[in] file_name - Name of the file.
+   * \returns True if the file could be mapped.
+   */
+  bool MapFile(const std::string& file_name);
+
+  /*!
+   * \brief Release the memory-mapped binary look-up table.
+   */
+  void UnmapFile();
+
+  /*!
+   * \brief Load the table data, connectivity, trapezoidal maps and interpolation coefficients from a binary table.
+   * \param[in] file_name - Name of the binary table.
+   * \param[in] file_name_source - Name of the ASCII table it was generated from, empty to skip the up-to-date check.
+   * \returns True if the table was loaded, false if the file is missing or outdated.
+   */
+  bool LoadTableBinary(const std::string& file_name, const std::string& file_name_source);
+
+  /*!
+   * \brief Write the table data, connectivity, trapezoidal maps and interpolation coefficients to a binary table.
+   * \param[in] file_name - Name of the binary table.
+   * \param[in] file_name_source - Name of the ASCII table, its size and modification time are stored.
+   */
+  void WriteTableBinary(const std::string& file_name, const std::string& file_name_source) const;
+
   /*!
    * \brief Find the table limits, i.e. the minimum and maximum values of the 2 independent
    * controlling variables. We put the values in the variables.
@@ -170,19 +243,19 @@ class CLookUpTable {
    * \param[in] vec_CV1 - Pointer to first coordinate (progress variable).
    * \param[in] vec_CV2 - Pointer to second coordinate (enthalpy).
    * \param[in] point_ids - Single triangle data.
-   * \param[out] interp_mat_inv - Inverse matrix for interpolation.
+   * \param[out] interp_mat_inv - Inverse matrix for interpolation (3x3, row-major).
    */
   void GetInterpMatInv(const su2double* vec_CV1, const su2double* vec_CV2, std::array<unsigned long, 3>& point_ids,
-                       su2activematrix& interp_mat_inv);
+                       su2double* interp_mat_inv);
 
   /*!
    * \brief Compute the interpolation coefficients for the triangular interpolation.
    * \param[in] val_CV1 - Value of first coordinate (progress variable).
    * \param[in] val_CV2 - Value of second coordinate (enthalpy).
-   * \param[in] interp_mat_inv - Inverse matrix for interpolation.
+   * \param[in] interp_mat_inv - Inverse matrix for interpolation (3x3, row-major).
    * \param[out] interp_coeffs - Interpolation coefficients.
    */
-  void GetInterpCoeffs(su2double val_CV1, su2double val_CV2, su2activematrix& interp_mat_inv,
+  void GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2double* interp_mat_inv,
                        std::array<su2double, 3>& interp_coeffs);
 
   /*!
@@ -196,29 +269,31 @@ class CLookUpTable {
                         std::array<su2double, 3>& val_interp_coeffs);
 
   /*!
-   * \brief Perform linear interpolation between two table levels for a single variable.
-   * \param[in] val_CV3 - Value of the third controlling variable at the query point.
-   * \param[in] lower_level - Table level index of the table level directly below the query point.
-   * \param[in] upper_level - Table level index of the table level directly above the query point.
-   * \param[in] lower_value - Result from x-y interpolation on the lower table level.
-   * \param[in] upper_value - Result from x-y interpolation on the upper table level.
-   * \param[in] val_vars - Pointer to interpolation result.
-   */
-  void Linear_Interpolation(const su2double val_CV3, const unsigned long lower_level, const unsigned long upper_level,
-                            su2double& lower_value, su2double& upper_value, su2double*& var_vals) const;
-
-  /*!
-   * \brief Perform linear interpolation between two table levels for a vector of variables.
+   * \brief Perform linear interpolation between two table levels for a set of variables.
    * \param[in] val_CV3 - Value of the third controlling variable at the query point.
    * \param[in] lower_level - Table level index of the table level directly below the query point.
    * \param[in] upper_level - Table level index of the table level directly above the query point.
    * \param[in] lower_values - Results from x-y interpolation on the lower table level.
    * \param[in] upper_values - Results from x-y interpolation on the upper table level.
-   * \param[in] val_vars - Pointer to interpolation results for all interpolation variables.
+   * \param[in] n_vars - Number of interpolated variables.
+   * \param[out] var_vals - Interpolation results for all interpolation variables.
    */
   void Linear_Interpolation(const su2double val_CV3, const unsigned long lower_level, const unsigned long upper_level,
-                            std::vector<su2double>& lower_values, std::vector<su2double>& upper_values,
-                            std::vector<su2double>& var_vals) const;
+                            const su2double* lower_values, const su2double* upper_values, unsigned long n_vars,
+                            su2double* var_vals) const;
+
+  /*!
+   * \brief Find the triangle that contains the point P(val_CV1,val_CV2) and its interpolation coefficients.
+   * \note The hint triangle is tested first, the trapezoidal map is only searched if P lies outside of it.
+   * \param[in] val_CV1 - First coordinate of point P(val_CV1,val_CV2).
+   * \param[in] val_CV2 - Second coordinate of point P(val_CV1,val_CV2).
+   * \param[in] i_level - Table level index.
+   * \param[in,out] id_triangle - Hint on input (ignored if out of range), containing triangle on output.
+   * \param[out] interp_coeffs - Interpolation coefficients of P in the triangle.
+   * \returns True if P lies inside the table, false otherwise.
+   */
+  bool FindTriangle(su2double val_CV1, su2double val_CV2, unsigned long i_level, unsigned long& id_triangle,
+                    std::array<su2double, 3>& interp_coeffs);
 
   /*!
    * \brief Find the point on the hull (boundary of the table) that is closest to the point P(val_CV1,val_CV2).
@@ -232,23 +307,13 @@ class CLookUpTable {
    * \brief Interpolate data based on distance-weighted averaging on the nearest two table nodes.
    * \param[in] val_CV1 - First coordinate of point P(val_CV1,val_CV2) to check.
    * \param[in] val_CV2 - Second coordinate of point P(val_CV1,val_CV2) to check.
-   * \param[in] val_names_var - Vector of string names of the variables to look up.
-   * \param[out] val_vars - Pointer to the vector of stored values of the variables to look up.
+   * \param[in] idx_vars - Column indices of the variables to look up (from GetVarIndices).
+   * \param[out] var_vals - Interpolated values of the variables to look up.
    */
   void InterpolateToNearestNeighbors(const su2double val_CV1, const su2double val_CV2,
-                                     const std::vector<std::string>& names_var, std::vector<su2double*>& var_vals,
+                                     const std::vector<unsigned long>& idx_vars, su2double* var_vals,
                                      const unsigned long i_level = 0);
 
-  /*!
-   * \brief Interpolate data based on distance-weighted averaging on the nearest two table nodes for a single variable.
-   * \param[in] val_CV1 - First coordinate of point P(val_CV1,val_CV2) to check.
-   * \param[in] val_CV2 - Second coordinate of point P(val_CV1,val_CV2) to check.
-   * \param[in] name_var - Variable name to look up.
-   * \param[out] var_val - Pointer to the to be interpolated variable.
-   */
-  void InterpolateToNearestNeighbors(const su2double val_CV1, const su2double val_CV2, const std::string& name_var,
-                                     su2double* var_val, const unsigned long i_level = 0);
-
   /*!
    * \brief Determine if a point P(val_CV1,val_CV2) is inside the triangle val_id_triangle.
    * \param[in] val_CV1 - First coordinate of point P(val_CV1,val_CV2) to check.
@@ -285,13 +350,86 @@ class CLookUpTable {
                                                               const su2double val_CV3);
 
  public:
-  CLookUpTable(const std::string& file_name_lut, std::string name_CV1_in, std::string name_CV2_in);
+  /*!
+   * \brief Load a look-up table.
+   * \note Binary tables (written with binary_cache) are memory-mapped, ASCII tables are parsed and, if
+   * binary_cache is set, stored as "<file_name_lut>.bin" to be mapped by subsequent runs.
+   * \param[in] file_name_lut - Name of the ASCII or binary table.
+   * \param[in] name_CV1_in - Name of controlling variable 1.
+   * \param[in] name_CV2_in - Name of controlling variable 2.
+   * \param[in] binary_cache - Use (and create) the binary version of an ASCII table.
+   */
+  CLookUpTable(const std::string& file_name_lut, std::string name_CV1_in, std::string name_CV2_in,
+               bool binary_cache = false);
+
+  ~CLookUpTable();
+
+  CLookUpTable(const CLookUpTable&) = delete;
+  CLookUpTable& operator=(const CLookUpTable&) = delete;
 
   /*!
    * \brief Print information to screen.
    */
   void PrintTableInfo();
 
+  /*!
+   * \brief Index returned by GetVarIndices for variables without data (NULL/ZERO), their lookups yield 0.
+   */
+  static constexpr unsigned long NO_VARIABLE = std::numeric_limits<unsigned long>::max();
+
+  /*!
+   * \brief Translate variable names into column indices of the table data, to be used with the
+   * index-based lookup functions. Resolve the names once, and reuse the indices for every lookup.
+   * \param[in] val_names_var - Vector of string names of variables.
+   * \returns Column index for each variable, NO_VARIABLE for NULL/ZERO names.
+   */
+  std::vector<unsigned long> GetVarIndices(const std::vector<std::string>& val_names_var) const;
+
+  /*!
+   * \brief Lookup the variables with column indices "idx_vars" using controlling variable values(val_CV1,val_CV2).
+   * \param[in] idx_vars - Column indices of the variables to look up (from GetVarIndices).
+   * \param[out] val_vars - Values of the variables to look up, size of idx_vars.
+   * \param[in] val_CV1 - Value of controlling variable 1.
+   * \param[in] val_CV2 - Value of controlling variable 2.
+   * \param[in] i_level - Table level index.
+   * \param[in,out] hint - Optional triangle search hint, e.g. the triangle found for the previous point.
+   * \returns 1 if the point lies outside the table and was extrapolated, 0 if not.
+   */
+  unsigned long LookUp_XY(const std::vector<unsigned long>& idx_vars, su2double* val_vars, su2double val_CV1,
+                          su2double val_CV2, unsigned long i_level = 0, unsigned long* hint = nullptr);
+
+  /*!
+   * \brief Lookup the variables with column indices "idx_vars" using controlling variable
+   * values(val_CV1,val_CV2,val_CV3).
+   * \param[in] idx_vars - Column indices of the variables to look up (from GetVarIndices).
+   * \param[out] val_vars - Values of the variables to look up, size of idx_vars.
+   * \param[in] val_CV1 - Value of controlling variable 1.
+   * \param[in] val_CV2 - Value of controlling variable 2.
+   * \param[in] val_CV3 - Value of controlling variable 3.
+   * \param[in,out] hint - Optional triangle search hints for the lower and upper table levels (size 2).
+   * \returns 1 if the point lies outside the table and was extrapolated, 0 if not.
+   */
+  unsigned long LookUp_XYZ(const std::vector<unsigned long>& idx_vars, su2double* val_vars, su2double val_CV1,
+                           su2double val_CV2, su2double val_CV3, unsigned long* hint = nullptr);
+
+  /*!
+   * \brief Lookup the variables with column indices "idx_vars" for a batch of query points.
+   * \note Consecutive points reuse the previously found triangle as search hint, hence batches should consist
+   * of points that are close in space (e.g. contiguous ranges of mesh points). The function does not modify
+   * the table and can be called concurrently by multiple threads on different batches.
+   * \param[in] idx_vars - Column indices of the variables to look up (from GetVarIndices).
+   * \param[in] n_queries - Number of query points.
+   * \param[in] val_CV1 - Values of controlling variable 1.
+   * \param[in] val_CV2 - Values of controlling variable 2.
+   * \param[in] val_CV3 - Values of controlling variable 3, nullptr for 2D lookups.
+   * \param[out] val_vars - Point-major results, n_queries x size of idx_vars.
+   * \param[out] exit_codes - Optional per-point exit codes (1 if extrapolated, 0 if not).
+   * \returns Number of points that lie outside the table.
+   */
+  unsigned long LookUp_Batch(const std::vector<unsigned long>& idx_vars, unsigned long n_queries,
+                             const su2double* val_CV1, const su2double* val_CV2, const su2double* val_CV3,
+                             su2double* val_vars, unsigned long* exit_codes = nullptr);
+
   /*!
    * \brief Lookup 1 value of the single variable "val_name_var" using controlling variable values(val_CV1,val_CV2).
    * \param[in] val_name_var - String name of the variable to look up.
@@ -362,7 +500,7 @@ class CLookUpTable {
    * \brief Determine the minimum and maximum value of the second controlling variable.
    * \returns Pair of minimum and maximum value of controlling variable 2.
    */
-  inline std::pair<su2double*, su2double*> GetTableLimitsY(unsigned long i_level = 0) const {
+  inline std::pair<const su2double*, const su2double*> GetTableLimitsY(unsigned long i_level = 0) const {
     return limits_table_y[i_level];
   }
 
@@ -370,7 +508,7 @@ class CLookUpTable {
    * \brief Determine the minimum and maximum value of the first controlling variable.
    * \returns Pair of minimum and maximum value of controlling variable 1.
    */
-  inline std::pair<su2double*, su2double*> GetTableLimitsX(unsigned long i_level = 0) const {
+  inline std::pair<const su2double*, const su2double*> GetTableLimitsX(unsigned long i_level = 0) const {
     return limits_table_x[i_level];
   }
 };
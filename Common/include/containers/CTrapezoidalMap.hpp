@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <cstdio>
 #include <string>
 #include <vector>
 
@@ -105,4 +106,19 @@ class CTrapezoidalMap {
    * \return - memory footprint in mega bytes.
    */
   double GetMemoryFootprint() const { return memory_footprint; }
+
+  /*!
+   * \brief Write the trapezoidal map to a binary file (see CLookUpTable::WriteTableBinary).
+   * \param[in] file - File opened for binary writing.
+   * \returns True if all data was written.
+   */
+  bool WriteBinary(FILE* file) const;
+
+  /*!
+   * \brief Read a trapezoidal map written by WriteBinary from a memory buffer.
+   * \param[in,out] buffer - Start of the trapezoidal map data, advanced past it on return.
+   * \param[in] buffer_end - End of the buffer.
+   * \returns True if the buffer contained a complete trapezoidal map.
+   */
+  bool ReadBinary(const char*& buffer, const char* buffer_end);
 };
@@ -880,6 +880,17 @@ class CMeshFEM_DG : public CMeshFEM {
     return -1;
   }
 
+  /*!
+   * \brief Get the global indices of the DOFs owned by this rank.
+   * \return Global indices in ascending order.
+   */
+  inline vector<unsigned long> GetGlobal_Domain_Points() const override {
+    vector<unsigned long> globalPoints;
+    globalPoints.reserve(Global_to_Local_Point.size());
+    for (const auto& pair : Global_to_Local_Point) globalPoints.push_back(pair.first);
+    return globalPoints;
+  }
+
   /*!
    * \brief Function, which carries out the preprocessing tasks when wall functions are used.
    * \param[in] config - Definition of the particular problem.
@@ -1164,9 +1175,10 @@ class CMeshFEM_DG : public CMeshFEM {
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] globalTree - Gather the viscous markers of all ranks, otherwise only the local ones are included.
    * \return pointer to the ADT
    */
-  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config) const override;
+  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config, bool globalTree = true) const override;
 
   /*!
    * \brief Set wall distances a specific value
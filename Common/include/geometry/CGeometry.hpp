@@ -203,6 +203,12 @@ class CGeometry {
 
   ColMajorMatrix<uint8_t> CoarseGridColor_; /*!< \brief Coarse grid levels, colorized. */
 
+  /*--- Measured cost of the points, for dynamic load balancing. ---*/
+
+  vector<passivedouble> pointCost;        /*!< \brief Time spent in the point-specific work of each point. */
+  bool measuringPointCost{false};         /*!< \brief Whether the point-specific work is being timed. */
+  vector<passivedouble> partitionWeights; /*!< \brief Measured cost of each point, used by SetColorGrid_Parallel. */
+
  public:
   /*!< \brief Linelets (mesh lines perpendicular to stretching direction). */
   struct CLineletInfo {
@@ -285,6 +291,18 @@ class CGeometry {
   SU2_MPI::Request* req_P2PSend{nullptr}; /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request* req_P2PRecv{nullptr}; /*!< \brief Data structure for point-to-point recv requests. */
 
+  /*!
+   * \brief Persistent requests for one kind of point-to-point exchange, the buffers, counts, and neighbors of an
+   * exchange only depend on the data type, the count per point, and the direction of the communication.
+   */
+  struct PersistentP2PRequests {
+    unsigned short commType = 0;
+    unsigned short countPerPoint = 0;
+    bool reverse = false;
+    vector<SU2_MPI::Request> send, recv;
+  };
+  mutable vector<PersistentP2PRequests> persistentP2P; /*!< \brief Persistent requests, created on first use. */
+
   /*--- Data structures for periodic communications. ---*/
 
   int maxCountPerPeriodicPoint{0}; /*!< \brief Maximum number of pieces of data sent per vertex in periodic comms. */
@@ -357,6 +375,22 @@ class CGeometry {
    */
   void AllocateP2PComms(unsigned short val_countPerPoint);
 
+  /*!
+   * \brief Get the persistent requests for a kind of point-to-point exchange, creating them on first use.
+   * \note Persistent requests are not used in AD builds, where every message needs to be recorded.
+   * \param[in] commType - Data type of the exchange.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \return Pointer to the requests, nullptr if persistent requests cannot be used.
+   */
+  const PersistentP2PRequests* GetPersistentP2PRequests(unsigned short commType, unsigned short countPerPoint,
+                                                        bool reverse) const;
+
+  /*!
+   * \brief Free the persistent point-to-point requests, e.g. because the buffers they refer to are reallocated.
+   */
+  void FreePersistentP2PRequests();
+
   /*!
    * \brief Routine to launch non-blocking recvs only for all point-to-point communication with neighboring partitions.
    * \note This routine is called by any class that has loaded data into the generic communication buffers.
@@ -701,6 +735,12 @@ class CGeometry {
    */
   inline virtual void SetRCM_Ordering(CConfig* config) {}
 
+  /*!
+   * \brief Renumber the points with the method selected in the config.
+   * \param[in] config - Definition of the particular problem.
+   */
+  inline virtual void SetPoint_Ordering(CConfig* config) {}
+
   /*!
    * \brief Connects elements  .
    */
@@ -711,6 +751,19 @@ class CGeometry {
    */
   void SetEdges();
 
+  /*!
+   * \brief Reorder the edges, must be called before the control volume is computed.
+   * \param[in] kind - Order of the edges.
+   */
+  void SetEdge_Ordering(EDGE_ORDERING kind);
+
+  /*!
+   * \brief Locality metrics of the point and edge ordering, reduced over ranks.
+   * \param[out] bandwidth - Max over the edges between domain points of the difference of their indices.
+   * \param[out] edgeGap - Average over consecutive edges of the change of the index of their points.
+   */
+  void GetOrdering_Metrics(unsigned long& bandwidth, passivedouble& edgeGap) const;
+
   /*!
    * \brief Sets the faces of an element..
    */
@@ -854,6 +907,44 @@ class CGeometry {
    */
   inline virtual void SetColorFEMGrid_Parallel(CConfig* config) {}
 
+  /*!
+   * \brief Set the measured cost of each (local) point, SetColorGrid_Parallel then balances these weights instead of
+   *        the static estimate based on the number of neighbors.
+   * \param[in] weights - Cost of each point of the linear partition of this rank (any positive scale).
+   */
+  void SetPartitionWeights(vector<passivedouble> weights) { partitionWeights = std::move(weights); }
+
+  /*!
+   * \brief Start timing the point-specific work (chemistry, wall functions, etc.) of each point, the previous
+   *        measurements are discarded. Must be called outside parallel regions.
+   */
+  void StartPointCostMeasurement() {
+    pointCost.assign(nPoint, 0.0);
+    measuringPointCost = true;
+  }
+
+  /*!
+   * \brief Stop timing the point-specific work, the measurements are kept.
+   */
+  void StopPointCostMeasurement() { measuringPointCost = false; }
+
+  /*!
+   * \brief Whether the point-specific work is being timed.
+   */
+  inline bool IsMeasuringPointCost() const { return measuringPointCost; }
+
+  /*!
+   * \brief Add time spent in the point-specific work of a point (thread-safe).
+   * \param[in] iPoint - Index of the point.
+   * \param[in] cost - Time in seconds.
+   */
+  inline void AddPointCost(unsigned long iPoint, passivedouble cost) { atomicAdd(cost, pointCost[iPoint]); }
+
+  /*!
+   * \brief Get the time spent in the point-specific work of each point, summed over threads.
+   */
+  inline const vector<passivedouble>& GetPointCost() const { return pointCost; }
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -1182,6 +1273,12 @@ class CGeometry {
    */
   inline virtual long GetGlobal_to_Local_Point(unsigned long val_ipoint) const { return 0; }
 
+  /*!
+   * \brief A virtual member.
+   * \return Global indices of the points owned by this rank, in ascending order.
+   */
+  inline virtual vector<unsigned long> GetGlobal_Domain_Points() const { return {}; }
+
   /*!
    * \brief Retrieve total number of elements in a simulation across all processors.
    * \return Total number of elements in a simulation across all processors.
@@ -1763,9 +1860,12 @@ class CGeometry {
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] globalTree - Gather the viscous markers of all ranks, otherwise only the local ones are included.
    * \return pointer to the ADT
    */
-  virtual std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config) const { return nullptr; }
+  virtual std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config, bool globalTree = true) const {
+    return nullptr;
+  }
 
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
@@ -1778,6 +1878,15 @@ class CGeometry {
   virtual void SetWallDistance(CADTElemClass* WallADT, const CConfig* config,
                                unsigned short iZone = numeric_limits<unsigned short>::max()) {}
 
+  /*!
+   * \brief Reduce the wall distance based on the local ADTs of all ranks (WALL_DISTANCE_DISTRIBUTED= YES).
+   * \note This is a collective call, the points are sent to the ranks whose walls may contain their nearest element.
+   * \param[in] WallADT - The ADT of the local viscous walls of this rank
+   * \param[in] config - Config of this geometry (not the ADT zone's geometry)
+   * \param[in] iZone - Zone whose markers made the ADT
+   */
+  virtual void SetWallDistanceDistributed(CADTElemClass* WallADT, const CConfig* config, unsigned short iZone) {}
+
   /*!
    * \brief Set wall distances a specific value
    *  \param[in] val - new value for the wall distance at all points.
@@ -1815,3 +1924,29 @@ class CGeometry {
    */
   inline virtual const su2double* GetStreamwise_Periodic_RefNode() const { return nullptr; }
 };
+
+/*!
+ * \class CPointCostTimer
+ * \brief Scoped timing of the point-specific work of a range of points, the time is divided equally among them.
+ * \details Used to measure the cost of work that is not proportional to the number of edges (e.g. finite rate
+ * chemistry or table lookups) for dynamic load balancing, it costs one branch when the geometry is not measuring.
+ */
+class CPointCostTimer {
+ private:
+  CGeometry* const geometry;
+  const unsigned long iPoint, nPoints;
+  passivedouble start = 0.0;
+
+ public:
+  CPointCostTimer(CGeometry* geo, unsigned long iPoint_, unsigned long nPoints_ = 1)
+      : geometry(geo->IsMeasuringPointCost() ? geo : nullptr), iPoint(iPoint_), nPoints(nPoints_) {
+    if (geometry) start = SU2_MPI::Wtime();
+  }
+  ~CPointCostTimer() {
+    if (!geometry) return;
+    const passivedouble cost = (SU2_MPI::Wtime() - start) / nPoints;
+    for (auto i = 0ul; i < nPoints; ++i) geometry->AddPointCost(iPoint + i, cost);
+  }
+  CPointCostTimer(const CPointCostTimer&) = delete;
+  CPointCostTimer& operator=(const CPointCostTimer&) = delete;
+};
@@ -86,6 +86,8 @@ class CPhysicalGeometry final : public CGeometry {
   unsigned long* Elem_ID_BoundTria_Linear{nullptr};
   unsigned long* Elem_ID_BoundQuad_Linear{nullptr};
 
+  static constexpr unsigned short PartitionCacheHeaderSize = 20; /*!< \brief Number of values in the cache header. */
+
   su2double Streamwise_Periodic_RefNode[MAXNDIM] = {
       0}; /*!< \brief Coordinates of the reference node [m] on the receiving periodic marker, for recovered
              pressure/temperature computation only.*/
@@ -134,6 +136,30 @@ class CPhysicalGeometry final : public CGeometry {
    */
   CPhysicalGeometry(CGeometry* geometry, CConfig* config, bool val_flag);
 
+  /*!
+   * \overload
+   * \brief Loads the partitioned grid of this rank from a cache file written by a previous run, which skips
+   *        reading the mesh, ParMETIS, and the redistribution of points and elements.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] cacheFileName - Name of the cache file of this rank, see GetPartitionCacheFileName.
+   */
+  CPhysicalGeometry(CConfig* config, const string& cacheFileName);
+
+  /*!
+   * \brief Get the name of the partition cache file of this rank, it contains a hash of the mesh file (size, time,
+   *        and header) and of the options that change the partitions, and the number of ranks. Must be called by all ranks.
+   * \param[in] config - Definition of the particular problem.
+   * \return Name of the file, empty if the mesh is not read from a file.
+   */
+  static string GetPartitionCacheFileName(const CConfig* config);
+
+  /*!
+   * \brief Check if all ranks can read their partition cache file. Must be called by all ranks.
+   * \param[in] fileName - Name of the cache file of this rank.
+   * \return True if the partitioned grid can be loaded from the cache.
+   */
+  static bool CheckPartitionCache(const string& fileName);
+
   /*!
    * \brief Destructor of the class.
    */
@@ -204,6 +230,26 @@ class CPhysicalGeometry final : public CGeometry {
    */
   void LoadSurfaceElements(CConfig* config, CGeometry* geometry);
 
+  /*!
+   * \brief Free the buffers of the redistributed points and elements once they are loaded.
+   */
+  void DeletePartitionBuffers();
+
+  /*!
+   * \brief Write the redistributed points, elements, and markers of this rank (the input of the Load* methods) to
+   * its partition cache file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem (linear partitions before redistribution).
+   */
+  void WritePartitionCache(const CConfig* config, const CGeometry* geometry) const;
+
+  /*!
+   * \brief Read the data written by WritePartitionCache.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] fileName - Name of the cache file of this rank.
+   */
+  void ReadPartitionCache(CConfig* config, const string& fileName);
+
   /*!
    * \brief Routine to launch non-blocking sends and recvs amongst all processors.
    * \param[in] bufSend - Buffer of data to be sent.
@@ -273,6 +319,12 @@ class CPhysicalGeometry final : public CGeometry {
     return -1;
   }
 
+  /*!
+   * \brief Get the global indices of the points owned by this rank.
+   * \return Global indices in ascending order.
+   */
+  vector<unsigned long> GetGlobal_Domain_Points() const override;
+
   /*!
    * \brief Reads the geometry of the grid and adjust the boundary
    *        conditions with the configuration file in parallel (for parmetis).
@@ -362,6 +414,26 @@ class CPhysicalGeometry final : public CGeometry {
    */
   void SetRCM_Ordering(CConfig* config) override;
 
+  /*!
+   * \brief Set a renumbering that follows a space-filling curve (Hilbert or Morton) through the coordinates.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetSFC_Ordering(CConfig* config);
+
+  /*!
+   * \brief Renumber the points with the method selected in the config.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetPoint_Ordering(CConfig* config) override;
+
+  /*!
+   * \brief Renumber the points, and the nodes of the elements, and reset the boundary flags of the points.
+   * \note The point connectivity needs to be computed again.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Result - Old index of each new point, the MPI points must stay after the domain points.
+   */
+  void RenumberPoints(const CConfig* config, const vector<unsigned long>& Result);
+
   /*!
    * \brief Set elements which surround an element.
    */
@@ -730,9 +802,10 @@ class CPhysicalGeometry final : public CGeometry {
   /*!
    * \brief Compute an ADT including the coordinates of all viscous markers
    * \param[in] config - Definition of the particular problem.
+   * \param[in] globalTree - Gather the viscous markers of all ranks, otherwise only the local ones are included.
    * \return pointer to the ADT
    */
-  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config) const override;
+  std::unique_ptr<CADTElemClass> ComputeViscousWallADT(const CConfig* config, bool globalTree = true) const override;
 
   /*!
    * \brief Reduce the wall distance based on an previously constructed ADT.
@@ -744,6 +817,17 @@ class CPhysicalGeometry final : public CGeometry {
    */
   void SetWallDistance(CADTElemClass* WallADT, const CConfig* config, unsigned short iZone) override;
 
+  /*!
+   * \brief Reduce the wall distance based on the local ADTs of all ranks.
+   * \details The bounding boxes of the local walls of all ranks are exchanged. Each point is first sent
+   * to the rank with the nearest bounding box, and then to the other ranks in order of increasing distance
+   * to their bounding box, until that distance exceeds the wall distance found so far.
+   * \param[in] WallADT - The ADT of the local viscous walls of this rank
+   * \param[in] config - Config of this geometry (not the ADT zone's geometry)
+   * \param[in] iZone - Zone whose markers made the ADT
+   */
+  void SetWallDistanceDistributed(CADTElemClass* WallADT, const CConfig* config, unsigned short iZone) override;
+
   /*!
    * \brief Set wall distances a specific value
    */
@@ -28,34 +28,22 @@
 
 #pragma once
 
-#include "CMeshReaderFVM.hpp"
+#include "CStructuredMeshReaderFVM.hpp"
 
 /*!
  * \class CBoxMeshReaderFVM
  * \brief Reads a 3D box grid into linear partitions for the finite volume solver (FVM).
+ * \details The cells are hexahedra, or they are split into 2 prisms or 6 tetrahedra (Kuhn triangulation). The splits
+ * are conforming because the diagonals of all faces connect the lowest and highest node indices. MIXED grids use prisms
+ * in the layers near the z walls and tetrahedra elsewhere.
  * \author: T. Economon
  */
-class CBoxMeshReaderFVM : public CMeshReaderFVM {
+class CBoxMeshReaderFVM : public CStructuredMeshReaderFVM {
  private:
-  unsigned long nNode; /*!< \brief Number of grid nodes in the x-direction. */
-  unsigned long mNode; /*!< \brief Number of grid nodes in the y-direction. */
-  unsigned long pNode; /*!< \brief Number of grid nodes in the z-direction. */
-
-  su2double Lx; /*!< \brief Length of the domain in the x-direction. */
-  su2double Ly; /*!< \brief Length of the domain in the y-direction. */
-  su2double Lz; /*!< \brief Length of the domain in the z-direction. */
-
-  su2double Ox; /*!< \brief Offset of the domain from 0.0 in the x-direction. */
-  su2double Oy; /*!< \brief Offset of the domain from 0.0 in the y-direction. */
-  su2double Oz; /*!< \brief Offset of the domain from 0.0 in the z-direction. */
-
-  unsigned short KindElem;  /*!< \brief VTK identifier of the interior elements. */
-  unsigned short KindBound; /*!< \brief VTK identifier of the surface elements. */
-
   /*!
-   * \brief Computes and stores the grid points based on an analytic definition of a box grid.
+   * \brief Number of elements in each cell of a layer (index in the z-direction).
    */
-  void ComputeBoxPointCoordinates();
+  unsigned short GetElementsPerCell(unsigned long kCell) const;
 
   /*!
    * \brief Computes and stores the volume element connectivity based on an analytic definition of a box grid.
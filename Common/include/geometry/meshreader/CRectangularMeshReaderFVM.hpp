@@ -28,31 +28,21 @@
 
 #pragma once
 
-#include "CMeshReaderFVM.hpp"
+#include "CStructuredMeshReaderFVM.hpp"
 
 /*!
  * \class CRectangularMeshReaderFVM
  * \brief Reads a 2D rectangular grid into linear partitions for the finite volume solver (FVM).
+ * \details The cells are quadrilaterals, or they are split into 2 triangles. MIXED grids use quadrilaterals in the
+ * layers near the y walls and triangles elsewhere.
  * \author: T. Economon
  */
-class CRectangularMeshReaderFVM : public CMeshReaderFVM {
+class CRectangularMeshReaderFVM : public CStructuredMeshReaderFVM {
  private:
-  unsigned long nNode; /*!< \brief Number of grid nodes in the x-direction. */
-  unsigned long mNode; /*!< \brief Number of grid nodes in the y-direction. */
-
-  su2double Lx; /*!< \brief Length of the domain in the x-direction. */
-  su2double Ly; /*!< \brief Length of the domain in the y-direction. */
-
-  su2double Ox; /*!< \brief Offset of the domain from 0.0 in the x-direction. */
-  su2double Oy; /*!< \brief Offset of the domain from 0.0 in the y-direction. */
-
-  unsigned short KindElem;  /*!< \brief VTK identifier of the interior elements. */
-  unsigned short KindBound; /*!< \brief VTK identifier of the surface elements. */
-
   /*!
-   * \brief Computes and stores the grid points based on an analytic definition of a rectangular grid.
+   * \brief Number of elements in each cell of a layer (index in the y-direction).
    */
-  void ComputeRectangularPointCoordinates();
+  unsigned short GetElementsPerCell(unsigned long jCell) const;
 
   /*!
    * \brief Computes and stores the volume element connectivity based on an analytic definition of a rectangular grid.
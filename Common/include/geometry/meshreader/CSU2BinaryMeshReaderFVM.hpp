@@ -0,0 +1,96 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.hpp
+ * \brief Header file for the class CSU2BinaryMeshReaderFVM.
+ *        The implementations are in the <i>CSU2BinaryMeshReaderFVM.cpp</i> file.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CSU2BinaryMeshReaderFVM
+ * \brief Reads a native SU2 binary grid into linear partitions for the finite volume solver (FVM).
+ * \note The file is written in native byte order by CSU2MeshFileWriter (MESH_BINARY output) and
+ * consists of fixed-width blocks, such that each rank can read its linear partition directly:
+ *  - Header: SU2_MESH_BINARY_MAGIC, nDim, nPoint, nElem, nMarker, nElemBound (unsigned long).
+ *  - Points: nPoint x nDim coordinates (double).
+ *  - Volume elements: nElem x [vtkType n0 ... n7] (unsigned long).
+ *  - Marker names: nMarker x CGNS_STRING_SIZE characters.
+ *  - Number of elements of each marker: nMarker (unsigned long).
+ *  - Surface elements: nElemBound x [vtkType n0 ... n3] (unsigned long).
+ */
+class CSU2BinaryMeshReaderFVM : public CMeshReaderFVM {
+ public:
+  static constexpr unsigned long HeaderSize = 6;                     /*!< \brief Number of values in the header. */
+  static constexpr unsigned long VolumeElemSize = SU2_CONN_SIZE - 1; /*!< \brief Values per volume element. */
+  static constexpr unsigned long SurfaceElemSize = N_POINTS_QUADRILATERAL + 1; /*!< \brief Values per surface elem. */
+
+ private:
+  const string meshFilename; /*!< \brief Name of the SU2 binary mesh file being read. */
+
+#ifdef HAVE_MPI
+  MPI_File fileHandle; /*!< \brief MPI file handle of the mesh file. */
+#else
+  FILE* fileHandle = nullptr; /*!< \brief File handle of the mesh file. */
+#endif
+
+  unsigned long numberOfSurfaceElements = 0; /*!< \brief Total number of surface elements (all markers). */
+
+  /*!
+   * \brief Read a range of bytes from the file.
+   * \param[in] offset - Position of the first byte in the file.
+   * \param[in] sizeInBytes - Number of bytes to read.
+   * \param[out] data - Destination of the data.
+   * \param[in] collective - Whether all ranks call this function (with their own ranges).
+   */
+  void ReadBytes(unsigned long offset, unsigned long sizeInBytes, void* data, bool collective) const;
+
+  /*!
+   * \brief Reads the header of the file on the master rank, checks it, and broadcasts it.
+   */
+  void ReadMetadata();
+
+  /*!
+   * \brief Reads the linear partition of grid points of this rank.
+   */
+  void ReadPointCoordinates();
+
+  /*!
+   * \brief Reads a linear partition of the volume elements and sends each one to the ranks
+   * that own its points (elements are repeated on the boundaries of the point partitions).
+   */
+  void ReadVolumeElementConnectivity();
+
+  /*!
+   * \brief Reads the markers, the names are known by all ranks, the connectivity only by the master.
+   */
+  void ReadSurfaceElementConnectivity();
+
+ public:
+  /*!
+   * \brief Constructor of the CSU2BinaryMeshReaderFVM class.
+   */
+  CSU2BinaryMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone);
+};
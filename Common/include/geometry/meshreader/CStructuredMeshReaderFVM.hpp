@@ -0,0 +1,127 @@
+/*!
+ * \file CStructuredMeshReaderFVM.hpp
+ * \brief Header file for the class CStructuredMeshReaderFVM.
+ *        The implementations are in the <i>CStructuredMeshReaderFVM.cpp</i> file.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CMeshReaderFVM.hpp"
+
+/*!
+ * \class CStructuredMeshReaderFVM
+ * \brief Base class of the analytic RECTANGLE and BOX grids, generated directly into linear partitions.
+ * \details Points are numbered lexicographically (i fastest), hence the points of each rank follow directly from
+ * the linear partitioning and each rank generates only its own points and the elements that touch them, i.e. the
+ * cost per rank is proportional to the size of its partition (plus one layer of cells) and not to the size of the
+ * grid. The points can be clustered towards the walls of each direction with a tanh distribution, and the interior
+ * points can be randomly perturbed, the perturbation depends only on the global index of the point, thus the grid
+ * does not depend on the number of ranks.
+ */
+class CStructuredMeshReaderFVM : public CMeshReaderFVM {
+ protected:
+  unsigned long nNode = 1; /*!< \brief Number of grid nodes in the x-direction. */
+  unsigned long mNode = 1; /*!< \brief Number of grid nodes in the y-direction. */
+  unsigned long pNode = 1; /*!< \brief Number of grid nodes in the z-direction (1 in 2D). */
+
+  passivedouble length[3] = {0.0};     /*!< \brief Length of the domain in each direction. */
+  passivedouble offset[3] = {0.0};     /*!< \brief Offset of the domain from 0.0 in each direction. */
+  passivedouble stretching[3] = {0.0}; /*!< \brief Wall clustering factor of each direction (0 for uniform). */
+  passivedouble perturbation = 0.0;    /*!< \brief Random perturbation of interior points, fraction of the spacing. */
+
+  MESH_BOX_ELEMENTS kindElements; /*!< \brief Type of elements used to fill the cells. */
+
+  unsigned long firstLocalPoint = 0; /*!< \brief Global index of the first point of this rank. */
+
+  /*!
+   * \brief Whether a global point index belongs to the linear partition of this rank.
+   */
+  inline bool IsLocalPoint(unsigned long globalIndex) const {
+    return globalIndex >= firstLocalPoint && globalIndex < firstLocalPoint + numberOfLocalPoints;
+  }
+
+  /*!
+   * \brief Whether the cells of a layer (in z for 3D, y for 2D) are near the walls, in MIXED grids the first and last
+   *        quarter of the layers use prisms (quadrilaterals in 2D) and the others tetrahedra (triangles).
+   * \param[in] iLayer - Index of the layer of cells.
+   * \param[in] nLayer - Number of layers of cells.
+   */
+  static inline bool IsWallLayer(unsigned long iLayer, unsigned long nLayer) {
+    const auto nWallLayer = nLayer / 4;
+    return iLayer < nWallLayer || iLayer >= nLayer - nWallLayer;
+  }
+
+  /*!
+   * \brief Unperturbed coordinate of a grid line.
+   * \param[in] iDim - Direction.
+   * \param[in] index - Index of the line in that direction.
+   * \param[in] nLine - Number of lines in that direction.
+   */
+  passivedouble GetLineCoordinate(unsigned short iDim, unsigned long index, unsigned long nLine) const;
+
+  /*!
+   * \brief Computes and stores the grid points of the linear partition of this rank.
+   */
+  void ComputePointCoordinates();
+
+  /*!
+   * \brief Store a volume element if any of its nodes belongs to this rank.
+   * \param[in] globalIndex - Global index of the element.
+   * \param[in] vtkType - VTK identifier of the element.
+   * \param[in] nNodes - Number of nodes.
+   * \param[in] nodes - Global indices of the nodes.
+   */
+  void AddVolumeElement(unsigned long globalIndex, unsigned short vtkType, unsigned short nNodes,
+                        const unsigned long* nodes);
+
+  /*!
+   * \brief Store a surface element of a marker.
+   * \param[in] iMarker - Index of the marker.
+   * \param[in] vtkType - VTK identifier of the element.
+   * \param[in] nNodes - Number of nodes.
+   * \param[in] nodes - Global indices of the nodes.
+   */
+  void AddSurfaceElement(unsigned short iMarker, unsigned short vtkType, unsigned short nNodes,
+                         const unsigned long* nodes);
+
+  /*!
+   * \brief Store a boundary quadrilateral, or the two triangles obtained by splitting it along the diagonal that
+   *        connects its lowest and highest node indices, which is how the cells of the triangulated grids are split.
+   * \param[in] iMarker - Index of the marker.
+   * \param[in] nodes - Global indices of the nodes of the quadrilateral (the orientation is preserved).
+   * \param[in] split - Whether to split the quadrilateral.
+   */
+  void AddSurfaceQuadrilateral(unsigned short iMarker, const unsigned long* nodes, bool split);
+
+ public:
+  /*!
+   * \brief Constructor of the CStructuredMeshReaderFVM class.
+   * \param[in] val_config - Definition of the grid.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Number of zones.
+   * \param[in] val_dimension - Dimension of the grid.
+   */
+  CStructuredMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone,
+                           unsigned short val_dimension);
+};
@@ -0,0 +1,185 @@
+/*!
+ * \file CAlgebraicMultigrid.hpp
+ * \brief Aggregation-based algebraic multigrid for block-sparse matrices.
+ *        The implementation is in <i>CAlgebraicMultigrid.cpp</i>.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../containers/C2DContainer.hpp"
+#include "../parallelization/omp_structure.hpp"
+
+#include <vector>
+
+class CConfig;
+
+/*!
+ * \class CAlgebraicMultigrid
+ * \ingroup SpLinSys
+ * \brief Aggregation-based AMG for the block-compressed-row-storage format of CSysMatrix.
+ * \note The hierarchy is built by greedy aggregation of strongly connected block rows (the strength
+ *       of a connection is measured with Frobenius norms of the blocks), the prolongation is piecewise
+ *       constant (identity blocks), and the coarse operators are Galerkin products, so the nVar x nVar
+ *       block structure is kept on all levels. Block Gauss-Seidel (forward before, backward after the
+ *       coarse grid correction) is the smoother. As for the other preconditioners of CSysMatrix, couplings
+ *       with halo points are ignored, i.e. across ranks (and across thread partitions in the smoother) the
+ *       method is additive. The aggregates are computed the first time the hierarchy is built, subsequent
+ *       builds only update the values of the coarse operators, the sparse pattern of the matrix is fixed.
+ */
+template <class ScalarType>
+class CAlgebraicMultigrid {
+ private:
+  /*!
+   * \brief Block-sparse operator and transfer information of one level of the hierarchy.
+   */
+  struct CLevel {
+    unsigned long nBlk = 0;              /*!< \brief Number of block rows (and columns) of the level. */
+    const unsigned long* rowPtr = nullptr; /*!< \brief Pointers to the first block of each row. */
+    const unsigned long* colIdx = nullptr; /*!< \brief Column index of each block. */
+    const unsigned long* diaPtr = nullptr; /*!< \brief Pointers to the diagonal block of each row. */
+    const ScalarType* values = nullptr;    /*!< \brief Block values. */
+
+    std::vector<unsigned long> rowPtrData, colIdxData, diaPtrData; /*!< \brief Pattern storage, coarse levels. */
+    std::vector<ScalarType> valuesData;                            /*!< \brief Value storage, coarse levels. */
+    std::vector<ScalarType> invDiag;                               /*!< \brief Inverse of the diagonal blocks. */
+    std::vector<unsigned long> partitions; /*!< \brief Row ranges smoothed independently by each thread. */
+
+    std::vector<unsigned long> aggregate;    /*!< \brief Coarse row (aggregate) of each row of this level. */
+    std::vector<unsigned long> aggPtr;       /*!< \brief Start of the rows of each aggregate in aggIdx. */
+    std::vector<unsigned long> aggIdx;       /*!< \brief Rows of this level that form each aggregate. */
+    std::vector<unsigned long> coarseBlkMap; /*!< \brief Coarse block to which each block of this level adds. */
+
+    mutable std::vector<ScalarType> rhs, sol, res; /*!< \brief Working vectors of the cycle. */
+  };
+
+  enum : unsigned long { NONE = ~0ul }; /*!< \brief Marker for unassigned rows and discarded blocks. */
+  enum { MIN_ROWS_PER_PART = 64 };      /*!< \brief Minimum size of the thread partitions of a level. */
+  enum { MAX_DIRECT_SIZE = 256 };       /*!< \brief Max. number of unknowns of a directly solved coarse level. */
+  enum { COARSE_SWEEPS = 2 };           /*!< \brief Symmetric smoothing sweeps when the coarsest level is not inverted. */
+  enum { OMP_MAX_SIZE = 512 };          /*!< \brief Max. chunk size used in parallel loops over rows. */
+
+  unsigned long nVar = 0;     /*!< \brief Size of the blocks. */
+  unsigned long nParts = 1;   /*!< \brief Number of thread partitions of the finest level. */
+  unsigned short nSweeps = 1; /*!< \brief Number of pre and post smoothing sweeps. */
+  bool isBuilt = false;       /*!< \brief Signals that the aggregates have been computed. */
+
+  std::vector<CLevel> levels;         /*!< \brief The hierarchy, 0 is the finest (input) level. */
+  su2matrix<ScalarType> coarseInverse; /*!< \brief Inverse of the coarsest operator (if solved directly). */
+  std::vector<std::vector<unsigned long> > marker; /*!< \brief Per-thread working memory for the setup. */
+  std::vector<unsigned long> numAggregates;         /*!< \brief Aggregates per thread partition (setup). */
+
+  /*!
+   * \brief Compute the row ranges that each thread smooths.
+   * \param[in,out] level - Level for which to set the partitions.
+   */
+  void SetPartitions(CLevel& level) const;
+
+  /*!
+   * \brief Greedy aggregation of strongly connected rows of a level.
+   * \param[in,out] level - Fine level, its aggregates are set.
+   * \param[in] threshold - Strength of connection threshold.
+   * \return Number of aggregates (i.e. rows of the coarse level).
+   */
+  unsigned long Aggregate(CLevel& level, passivedouble threshold);
+
+  /*!
+   * \brief Build the sparse pattern of the Galerkin coarse operator.
+   * \param[in,out] fine - Fine level, its map to coarse blocks is set.
+   * \param[in,out] coarse - Coarse level, its pattern is allocated and set.
+   */
+  void SetCoarsePattern(CLevel& fine, CLevel& coarse);
+
+  /*!
+   * \brief Compute the values of the Galerkin coarse operator.
+   * \param[in] fine - Fine level.
+   * \param[in,out] coarse - Coarse level, its values are set.
+   */
+  void SetCoarseValues(const CLevel& fine, CLevel& coarse) const;
+
+  /*!
+   * \brief Compute the inverse of the diagonal blocks of a level.
+   */
+  void SetInverseDiagonal(CLevel& level) const;
+
+  /*!
+   * \brief Compute the inverse of the coarsest operator, if it is small enough.
+   */
+  void SetCoarseInverse();
+
+  /*!
+   * \brief Block Gauss-Seidel sweep on a level.
+   * \param[in] level - The level.
+   * \param[in] forward - Direction of the sweep.
+   * \param[in] b - Right hand side.
+   * \param[in,out] x - Solution.
+   */
+  void Smooth(const CLevel& level, bool forward, const ScalarType* b, ScalarType* x) const;
+
+  /*!
+   * \brief One V-cycle starting at iLevel with zero initial guess.
+   * \param[in] iLevel - Level index.
+   * \param[in] b - Right hand side.
+   * \param[out] x - Solution.
+   */
+  void Cycle(unsigned long iLevel, const ScalarType* b, ScalarType* x) const;
+
+ public:
+  /*!
+   * \brief Build or update the hierarchy for a matrix. Must be called by all threads.
+   * \param[in] nvar - Size of the (square) blocks.
+   * \param[in] nPointDomain - Number of block rows, excluding halos.
+   * \param[in] rowPtr - Pointers to the first block of each row.
+   * \param[in] colIdx - Column index of each block.
+   * \param[in] diaPtr - Pointers to the diagonal block of each row.
+   * \param[in] values - Block values.
+   * \param[in] numParts - Number of thread partitions for the smoother.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Build(unsigned long nvar, unsigned long nPointDomain, const unsigned long* rowPtr, const unsigned long* colIdx,
+             const unsigned long* diaPtr, const ScalarType* values, unsigned long numParts, const CConfig* config);
+
+  /*!
+   * \brief Apply one V-cycle, x = M^{-1} b. Must be called by all threads.
+   * \param[in] b - Right hand side.
+   * \param[out] x - Approximate solution (only the domain points are set).
+   */
+  void Apply(const ScalarType* b, ScalarType* x) const;
+
+  /*!
+   * \brief Get the number of levels in the hierarchy (including the finest).
+   */
+  inline unsigned long GetNumLevels() const { return levels.size(); }
+
+  /*!
+   * \brief Get the number of block rows of a level.
+   */
+  inline unsigned long GetNumRows(unsigned long iLevel) const { return levels[iLevel].nBlk; }
+
+  /*!
+   * \brief Get the aggregate (row of the next level) of each row of a level (except the coarsest).
+   */
+  inline const std::vector<unsigned long>& GetAggregates(unsigned long iLevel) const {
+    return levels[iLevel].aggregate;
+  }
+};
@@ -30,7 +30,9 @@
 
 #include "../../include/CConfig.hpp"
 #include "CSysVector.hpp"
+#include "../toolboxes/graph_toolbox.hpp"
 #include "CPastixWrapper.hpp"
+#include "CAlgebraicMultigrid.hpp"
 
 #include <cstdlib>
 #include <vector>
@@ -116,6 +118,8 @@ template <class ScalarType>
 class CSysMatrix {
  private:
   friend struct CSysMatrixComms;
+  template <class T>
+  friend class CSysMatrix;
 
   const int rank; /*!< \brief MPI Rank. */
   const int size; /*!< \brief MPI Size. */
@@ -152,6 +156,9 @@ class CSysMatrix {
   const unsigned long* col_ind_ilu; /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;       /*!< \brief Fill in level for the ILU preconditioner. */
 
+  CCompressedSparsePatternUL ilu_lower_levels; /*!< \brief Level sets (rows) of the factorization and forward sweep. */
+  CCompressedSparsePatternUL ilu_upper_levels; /*!< \brief Level sets (rows) of the backward sweep. */
+
   ScalarType* invM; /*!< \brief Inverse of (Jacobi) preconditioner, or diagonal of ILU. */
 
   /*--- Temporary (hence mutable) working memory used in the Linelet preconditioner, outer vector is for threads ---*/
@@ -179,6 +186,8 @@ class CSysMatrix {
   mutable CPastixWrapper<ScalarType> pastix_wrapper;
 #endif
 
+  CAlgebraicMultigrid<ScalarType> amg; /*!< \brief Hierarchy of the AMG preconditioner. */
+
   /*!
    * \brief Auxilary object to wrap the edge map pointer used in fast block updates, i.e. without linear searches.
    */
@@ -319,6 +328,35 @@ class CSysMatrix {
    */
   inline void SetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j, ScalarType* val_block);
 
+  /*!
+   * \brief Incomplete factorization of a row of the ILU matrix, the rows it depends on must be factorized.
+   * \param[in] iPoint - Row to factorize.
+   * \param[in] begin - Inclusive lower bound for the rows (columns) considered in the factorization.
+   * \param[in] end - Exclusive upper bound for the rows (columns) considered in the factorization.
+   */
+  inline void FactorizeILURow(unsigned long iPoint, unsigned long begin, unsigned long end);
+
+  /*!
+   * \brief Forward substitution of a row with the lower part of the ILU factorization.
+   * \param[in] iPoint - Row to substitute.
+   * \param[in] begin - Inclusive lower bound for the columns considered.
+   * \param[in,out] prod - Vector (in-place substitution).
+   */
+  inline void ForwardSubstitutionILU(unsigned long iPoint, unsigned long begin, CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Backward substitution of a row with the upper part of the ILU factorization.
+   * \param[in] iPoint - Row to substitute.
+   * \param[in] end - Exclusive upper bound for the columns considered.
+   * \param[in,out] prod - Vector (in-place substitution).
+   */
+  inline void BackwardSubstitutionILU(unsigned long iPoint, unsigned long end, CSysVector<ScalarType>& prod) const;
+
+  /*!
+   * \brief Compute the level sets (rows that do not depend on each other) of the ILU factorization and sweeps.
+   */
+  void SetILULevelSchedule();
+
   /*!
    * \brief Performs the product of i-th row of the upper part of a sparse matrix by a vector.
    * \param[in] vec - Vector to be multiplied by the upper part of the sparse matrix A.
@@ -381,6 +419,32 @@ class CSysMatrix {
                   bool EdgeConnect, CGeometry* geometry, const CConfig* config, bool needTranspPtr = false,
                   bool grad_mode = false);
 
+  /*!
+   * \brief Initializes the matrix with the dimensions and sparse pattern of another, e.g. of different precision.
+   * \note The maps used for assembly (transpose and edge pointers) are not set, the matrix is only meant for solving.
+   * \param[in] other - Matrix from which the structure is taken.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template <class OtherType>
+  void Initialize(const CSysMatrix<OtherType>& other, CGeometry* geometry, const CConfig* config) {
+    Initialize(other.nPoint, other.nPointDomain, other.nVar, other.nEqn, other.edge_ptr.ptr != nullptr, geometry,
+               config);
+  }
+
+  /*!
+   * \brief Copies the values of another matrix with the same sparse pattern, e.g. of different precision.
+   * \param[in] other - Matrix from which the values are copied.
+   */
+  template <class OtherType>
+  void PassiveCopy(const CSysMatrix<OtherType>& other) {
+    assert(row_ptr == other.row_ptr && nnz * nVar * nEqn == other.nnz * other.nVar * other.nEqn);
+
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto i = 0ul; i < nnz * nVar * nEqn; ++i) matrix[i] = PassiveAssign(other.matrix[i]);
+    END_SU2_OMP_FOR
+  }
+
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
    */
@@ -917,4 +981,20 @@ class CSysMatrix {
    */
   void ComputePastixPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
                                    const CConfig* config) const;
+
+  /*!
+   * \brief Build (first call) or update the algebraic multigrid hierarchy.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildAMGPreconditioner(const CConfig* config);
+
+  /*!
+   * \brief Apply one AMG V-cycle to CSysVec.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                const CConfig* config) const;
 };
@@ -169,6 +169,85 @@ FORCEINLINE void CSysMatrix<ScalarType>::InverseDiagonalBlock_ILUMatrix(unsigned
   MatrixInverse(block, invBlock);
 }
 
+template <class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::FactorizeILURow(unsigned long iPoint, unsigned long begin,
+                                                         unsigned long end) {
+  ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
+
+  /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
+
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    /*--- jPoint is the column index (jPoint < iPoint). ---*/
+
+    auto jPoint = col_ind_ilu[index];
+
+    /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
+
+    if (jPoint < begin) continue;
+
+    /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
+
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
+
+    /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
+
+    for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
+      /*--- Get the column index (kPoint > jPoint). ---*/
+
+      auto kPoint = col_ind_ilu[index_];
+
+      if (kPoint >= end) break;
+
+      /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
+
+      auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
+
+      if (Block_ik != nullptr) {
+        auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
+        MatrixMatrixProduct(weight, Block_jk, aux_block);
+        MatrixSubtraction(Block_ik, aux_block, Block_ik);
+      }
+    }
+
+    /*--- Lastly, store "weight" in the lower triangular part, which
+     will be reused during the forward solve in the precon/smoother. ---*/
+
+    for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
+  }
+
+  /*--- The diagonal block is final, invert and store it for the rows that depend on this one. ---*/
+
+  InverseDiagonalBlock_ILUMatrix(iPoint, &invM[iPoint * nVar * nVar]);
+}
+
+template <class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::ForwardSubstitutionILU(unsigned long iPoint, unsigned long begin,
+                                                                CSysVector<ScalarType>& prod) const {
+  for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint < begin) continue;
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
+  }
+}
+
+template <class ScalarType>
+FORCEINLINE void CSysMatrix<ScalarType>::BackwardSubstitutionILU(unsigned long iPoint, unsigned long end,
+                                                                 CSysVector<ScalarType>& prod) const {
+  ScalarType aux_vec[MAXNVAR];
+  for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+
+  for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
+    auto jPoint = col_ind_ilu[index];
+    if (jPoint >= end) break;
+    auto Block_ij = &ILU_matrix[index * nVar * nVar];
+    MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
+  }
+
+  MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+}
+
 template <class ScalarType>
 FORCEINLINE void CSysMatrix<ScalarType>::RowProduct(const CSysVector<ScalarType>& vec, unsigned long row_i,
                                                     ScalarType* prod) const {
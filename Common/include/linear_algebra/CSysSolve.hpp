@@ -36,6 +36,7 @@
 #include <cstdlib>
 #include <iomanip>
 #include <string>
+#include <memory>
 
 #include "CSysVector.hpp"
 #include "../option_structure.hpp"
@@ -114,6 +115,10 @@ class CSysSolve {
   bool xIsZero = false;              /*!< \brief If true assume the initial solution is always 0. */
   bool recomputeRes = false;         /*!< \brief Recompute the residual after inner iterations, if monitoring. */
   unsigned long monitorFreq = 10;    /*!< \brief Monitoring frequency. */
+  bool mixedPrecision = false;       /*!< \brief Use a single precision copy of the matrix (see SetMixedPrecision). */
+
+  struct CLowPrecisionData;                       /*!< \brief Single precision matrix, vectors, and solver. */
+  std::unique_ptr<CLowPrecisionData> lowPrecData; /*!< \brief Allocated on the first mixed precision solve. */
 
   /*!
    * \brief sign transfer function
@@ -219,6 +224,28 @@ class CSysSolve {
    */
   void WriteWarning(ScalarType res_calc, ScalarType res_true, ScalarType tol) const;
 
+  /*!
+   * \brief Mixed precision solution of the linear system. The iterations of the chosen solver, and the preconditioner,
+   * use a single precision copy of the matrix, and this approximate solve preconditions a few outer (double precision)
+   * FGMRES iterations, which use the original matrix and converge the system to the requested tolerance.
+   * \param[in] Jacobian - Matrix of the linear system.
+   * \param[in] b - The right hand side vector.
+   * \param[in,out] x - On entry the initial guess, on exit the solution.
+   * \param[in] kindSolver - Solver used for the single precision iterations.
+   * \param[in] kindPrec - Preconditioner of the single precision iterations.
+   * \param[in] tol - Tolerance with which to solve the system.
+   * \param[in] m - Maximum number of iterations of each single precision solve.
+   * \param[out] residual - Final normalized residual.
+   * \param[in] monitoring - Turn on printing residuals of the outer iterations to screen.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Total number of single precision iterations.
+   */
+  unsigned long MixedPrecision_LinSolver(const MatrixType& Jacobian, const VectorType& b, VectorType& x,
+                                         unsigned short kindSolver, ENUM_LINEAR_SOLVER_PREC kindPrec, ScalarType tol,
+                                         unsigned long m, ScalarType& residual, bool monitoring, CGeometry* geometry,
+                                         const CConfig* config);
+
   /*!
    * \brief Used by Solve for compatibility between passive and active CSysVector.
    * \note Same type specialization, temporary variables are not required.
@@ -295,6 +322,12 @@ class CSysSolve {
    */
   CSysSolve(LINEAR_SOLVER_MODE linear_solver_mode = LINEAR_SOLVER_MODE::STANDARD);
 
+  /*!
+   * \brief Move constructor and destructor, defined where the single precision data is complete.
+   */
+  CSysSolve(CSysSolve&&);
+  ~CSysSolve();
+
   /*! \brief Conjugate Gradient method
    * \param[in] b - the right hand size vector
    * \param[in,out] x - on entry the intial guess, on exit the solution
@@ -419,4 +452,10 @@ class CSysSolve {
    * \brief Set the screen output frequency during monitoring.
    */
   inline void SetMonitoringFrequency(bool frequency) { monitorFreq = frequency; }
+
+  /*!
+   * \brief Solve with a single precision copy of the matrix and double precision refinement, or don't.
+   * \note Only has an effect in Solve, for iterative solvers, and when the matrix is of double precision.
+   */
+  inline void SetMixedPrecision(bool mixed) { mixedPrecision = mixed; }
 };
@@ -193,6 +193,9 @@ const int CGNS_STRING_SIZE = 33; /*!< \brief Length of strings used in the CGNS
 const int SU2_CONN_SIZE   = 10;  /*!< \brief Size of the connectivity array that is allocated for each element
                                              that we read from a mesh file in the format [[globalID vtkType n0 n1 n2 n3 n4 n5 n6 n7 n8]. */
 const int SU2_CONN_SKIP   = 2;   /*!< \brief Offset to skip the globalID and VTK type at the start of the element connectivity list for each CGNS element. */
+const int SU2_MESH_BINARY_MAGIC = 535533; /*!< \brief First value in native SU2 binary mesh files (restart files use 535532). */
+const int SU2_PARTITION_CACHE_MAGIC = 535534; /*!< \brief First value in partition cache files. */
+const int SU2_LUT_BINARY_MAGIC = 535535; /*!< \brief First value in binary look-up table files. */
 
 const su2double COLORING_EFF_THRESH = 0.875;  /*!< \brief Below this value fallback strategies are used instead. */
 
@@ -1976,13 +1979,60 @@ enum ENUM_INPUT {
   SU2       = 1,  /*!< \brief SU2 input format. */
   CGNS_GRID = 2,  /*!< \brief CGNS input format for the computational grid. */
   RECTANGLE = 3,  /*!< \brief 2D rectangular mesh with N x M points of size Lx x Ly. */
-  BOX       = 4   /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  BOX       = 4,  /*!< \brief 3D box mesh with N x M x L points of size Lx x Ly x Lz. */
+  SU2_BINARY = 5  /*!< \brief Native SU2 binary mesh format, read in parallel with MPI I/O. */
 };
 static const MapType<std::string, ENUM_INPUT> Input_Map = {
   MakePair("SU2", SU2)
   MakePair("CGNS", CGNS_GRID)
   MakePair("RECTANGLE", RECTANGLE)
   MakePair("BOX", BOX)
+  MakePair("SU2_BINARY", SU2_BINARY)
+};
+
+/*!
+ * \brief Types of elements of the analytic RECTANGLE and BOX grids (in 2D hexahedra are quadrilaterals, prisms and
+ *        tetrahedra are triangles).
+ */
+enum class MESH_BOX_ELEMENTS {
+  HEXAHEDRA,  /*!< \brief One hexahedron (quadrilateral) per cell. */
+  PRISMS,     /*!< \brief Two prisms (triangles) per cell. */
+  TETRAHEDRA, /*!< \brief Six tetrahedra (two triangles) per cell. */
+  MIXED,      /*!< \brief Prisms (quadrilaterals) near the walls, tetrahedra (triangles) elsewhere. */
+};
+static const MapType<std::string, MESH_BOX_ELEMENTS> MeshBoxElements_Map = {
+  MakePair("HEXAHEDRA", MESH_BOX_ELEMENTS::HEXAHEDRA)
+  MakePair("PRISMS", MESH_BOX_ELEMENTS::PRISMS)
+  MakePair("TETRAHEDRA", MESH_BOX_ELEMENTS::TETRAHEDRA)
+  MakePair("MIXED", MESH_BOX_ELEMENTS::MIXED)
+};
+
+/*!
+ * \brief Renumbering of the points of each rank to improve the locality of the memory accesses.
+ */
+enum class POINT_ORDERING {
+  NONE,    /*!< \brief Keep the order of the partitioning. */
+  RCM,     /*!< \brief Reverse Cuthill-McKee, minimizes the bandwidth of the sparse pattern. */
+  HILBERT, /*!< \brief Hilbert space-filling curve through the coordinates. */
+  MORTON,  /*!< \brief Morton (Z-order) space-filling curve through the coordinates. */
+};
+static const MapType<std::string, POINT_ORDERING> PointOrdering_Map = {
+  MakePair("NONE", POINT_ORDERING::NONE)
+  MakePair("RCM", POINT_ORDERING::RCM)
+  MakePair("HILBERT", POINT_ORDERING::HILBERT)
+  MakePair("MORTON", POINT_ORDERING::MORTON)
+};
+
+/*!
+ * \brief Order of the edges, which is the order in which the edge loops access the points.
+ */
+enum class EDGE_ORDERING {
+  NATURAL, /*!< \brief Sorted by first point, then by second point. */
+  BLOCKED, /*!< \brief Blocks of consecutive first points, sorted by second point within each block. */
+};
+static const MapType<std::string, EDGE_ORDERING> EdgeOrdering_Map = {
+  MakePair("NATURAL", EDGE_ORDERING::NATURAL)
+  MakePair("BLOCKED", EDGE_ORDERING::BLOCKED)
 };
 
 
@@ -2001,6 +2051,7 @@ enum class OUTPUT_TYPE {
   SURFACE_PARAVIEW_ASCII,  /*!< \brief Paraview ASCII format for the solution output. */
   SURFACE_PARAVIEW_LEGACY_BINARY, /*!< \brief Paraview binary format for the solution output. */
   MESH,                    /*!< \brief SU2 mesh format. */
+  MESH_BINARY,             /*!< \brief SU2 binary mesh format. */
   RESTART_BINARY,          /*!< \brief SU2 binary restart format. */
   RESTART_ASCII,           /*!< \brief SU2 ASCII restart format. */
   PARAVIEW_XML,            /*!< \brief Paraview XML with binary data format */
@@ -2026,6 +2077,7 @@ static const MapType<std::string, OUTPUT_TYPE> Output_Map = {
   MakePair("SURFACE_PARAVIEW", OUTPUT_TYPE::SURFACE_PARAVIEW_XML)
   MakePair("PARAVIEW_MULTIBLOCK", OUTPUT_TYPE::PARAVIEW_MULTIBLOCK)
   MakePair("MESH", OUTPUT_TYPE::MESH)
+  MakePair("MESH_BINARY", OUTPUT_TYPE::MESH_BINARY)
   MakePair("RESTART_ASCII", OUTPUT_TYPE::RESTART_ASCII)
   MakePair("RESTART", OUTPUT_TYPE::RESTART_BINARY)
   MakePair("CGNS", OUTPUT_TYPE::CGNS)
@@ -2067,6 +2119,20 @@ inline bool isTecplot(OUTPUT_TYPE format) {
   }
 }
 
+/*!
+ * \brief Compression of the appended data blocks of Paraview XML (.vtu) files.
+ */
+enum class VTU_COMPRESSION {
+  NONE,   /*!< \brief Raw appended data. */
+  ZLIB,   /*!< \brief Blocks compressed with zlib (vtkZLibDataCompressor). */
+  LZ4,    /*!< \brief Blocks compressed with LZ4 (vtkLZ4DataCompressor). */
+};
+static const MapType<std::string, VTU_COMPRESSION> VTU_Compression_Map = {
+  MakePair("NONE", VTU_COMPRESSION::NONE)
+  MakePair("ZLIB", VTU_COMPRESSION::ZLIB)
+  MakePair("LZ4", VTU_COMPRESSION::LZ4)
+};
+
 /*!
  * \brief Type of solution output file formats
  */
@@ -2279,6 +2345,7 @@ enum ENUM_LINEAR_SOLVER_PREC {
   LU_SGS,         /*!< \brief LU SGS preconditioner. */
   LINELET,        /*!< \brief Line implicit preconditioner. */
   ILU,            /*!< \brief ILU(k) preconditioner. */
+  AMG,            /*!< \brief Aggregation-based algebraic multigrid preconditioner. */
   PASTIX_ILU=10,  /*!< \brief PaStiX ILU(k) preconditioner. */
   PASTIX_LU_P,    /*!< \brief PaStiX LU as preconditioner. */
   PASTIX_LDLT_P,  /*!< \brief PaStiX LDLT as preconditioner. */
@@ -2288,6 +2355,7 @@ static const MapType<std::string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Ma
   MakePair("LU_SGS", LU_SGS)
   MakePair("LINELET", LINELET)
   MakePair("ILU", ILU)
+  MakePair("AMG", AMG)
   MakePair("PASTIX_ILU", PASTIX_ILU)
   MakePair("PASTIX_LU", PASTIX_LU_P)
   MakePair("PASTIX_LDLT", PASTIX_LDLT_P)
@@ -2610,6 +2678,22 @@ enum class LINEAR_SOLVER_MODE {
   GRADIENT_MODE,   /*!< \brief Operate in gradient smoothing mode. */
 };
 
+/*!
+ * \brief Solvers that may use single precision matrices in their linear systems (mixed precision mode).
+ */
+enum class MIXED_PRECISION_SOLVER {
+  FLOW,         /*!< \brief Flow solvers (compressible, incompressible, and NEMO). */
+  TURBULENCE,   /*!< \brief Turbulence model solvers (SA and SST). */
+  MESH_DEFORM,  /*!< \brief Mesh deformation (elasticity) solvers. */
+  FEA,          /*!< \brief Structural (FEA) solver. */
+};
+static const MapType<std::string, MIXED_PRECISION_SOLVER> Mixed_Precision_Solver_Map = {
+  MakePair("FLOW", MIXED_PRECISION_SOLVER::FLOW)
+  MakePair("TURBULENCE", MIXED_PRECISION_SOLVER::TURBULENCE)
+  MakePair("MESH_DEFORM", MIXED_PRECISION_SOLVER::MESH_DEFORM)
+  MakePair("FEA", MIXED_PRECISION_SOLVER::FEA)
+};
+
 /*!
  * \brief mode of operation for the sobolev smoothing solver.
  */
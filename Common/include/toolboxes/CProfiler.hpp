@@ -0,0 +1,182 @@
+/*!
+ * \file CProfiler.hpp
+ * \brief Low overhead, thread-safe, hierarchical profiler of code regions.
+ *        The implementation is in <i>CProfiler.cpp</i>.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../parallelization/mpi_structure.hpp"
+
+/*!
+ * \class CProfiler
+ * \brief Accumulates the wall time and number of calls of nested code regions.
+ * \details Regions form a tree, a region is identified by its name and by the regions that enclose it, i.e. the same
+ * name can appear under different parents. Each thread times the regions it executes into its own counters. Inside
+ * an OpenMP parallel region, the thread-parallel regions are nested in the innermost region that was open when the
+ * parallel region started. Timings are reduced over threads and ranks by GetSummary (used by WriteReport), which
+ * gives the min/max/avg over ranks and the load imbalance (max/avg) over ranks and threads.
+ * Regions are usually timed via the SU2_PROFILE_REGION macro, which costs one branch when profiling is disabled.
+ * \note Region names must be string literals (or otherwise outlive the profiler), they are stored by pointer.
+ * \ingroup Toolboxes
+ */
+class CProfiler {
+ public:
+  /*!
+   * \brief Timings of a region reduced over threads and ranks.
+   */
+  struct RegionSummary {
+    std::string path;              /*!< \brief Full name of the region. */
+    unsigned long calls;           /*!< \brief Number of calls (max over threads and ranks). */
+    passivedouble avgTime;         /*!< \brief Average over ranks of the time of the slowest thread. */
+    passivedouble minTime;         /*!< \brief Minimum over ranks. */
+    passivedouble maxTime;         /*!< \brief Maximum over ranks. */
+    passivedouble threadImbalance; /*!< \brief Max over ranks of the thread imbalance (max/avg over threads). */
+  };
+
+ private:
+  /*!
+   * \brief Region of the tree, only accessed inside critical sections or outside parallel regions.
+   */
+  struct Node {
+    const char* name; /*!< \brief Name of the region. */
+    int parent;       /*!< \brief Index of the enclosing region, -1 for top level regions. */
+  };
+
+  /*!
+   * \brief Entry of the stack of open regions.
+   */
+  struct OpenRegion {
+    int node;            /*!< \brief Region that is being timed. */
+    passivedouble start; /*!< \brief Time at which it started. */
+  };
+
+  /*!
+   * \brief Per-thread data, the thread that owns it is the only one that writes to it.
+   */
+  struct ThreadData {
+    std::vector<OpenRegion> stack;      /*!< \brief Regions opened by this thread inside a parallel region. */
+    std::vector<unsigned long> calls;   /*!< \brief Number of calls of each region (indexed by node). */
+    std::vector<passivedouble> time;    /*!< \brief Accumulated time in each region (indexed by node). */
+    std::vector<Node> cache;            /*!< \brief Regions already looked up by this thread (parent and name). */
+    std::vector<int> cacheNode;         /*!< \brief Index of the tree node for each entry of the cache. */
+    char padding[64];                   /*!< \brief Avoid false sharing between the data of different threads. */
+  };
+
+  static bool enabled;                   /*!< \brief Whether regions are being timed. */
+  static std::vector<Node> nodes;        /*!< \brief Tree of regions shared by all threads. */
+  static std::vector<OpenRegion> serialStack; /*!< \brief Regions opened outside parallel regions. */
+  static std::vector<ThreadData> threads;     /*!< \brief Data of each thread. */
+
+  /*!
+   * \brief Find or create the region with a given name and parent.
+   * \param[in] data - Data of the calling thread (its cache is updated).
+   * \param[in] parent - Index of the parent region.
+   * \param[in] name - Name of the region.
+   * \return Index of the region.
+   */
+  static int FindRegion(ThreadData& data, int parent, const char* name);
+
+  /*!
+   * \brief Full name of a region, i.e. the names of its ancestors and its own separated by "/".
+   */
+  static std::string GetPath(int node);
+
+ public:
+  /*!
+   * \brief Enable or disable the profiler, must be called outside parallel regions.
+   * \note Enabling the profiler discards previous timings.
+   */
+  static void Enable(bool enable);
+
+  /*!
+   * \brief Whether regions are being timed.
+   */
+  static inline bool IsEnabled() { return enabled; }
+
+  /*!
+   * \brief Start timing a region.
+   * \param[in] name - Name of the region.
+   */
+  static void Begin(const char* name);
+
+  /*!
+   * \brief Stop timing the innermost region opened by the calling thread.
+   */
+  static void End();
+
+  /*!
+   * \brief Total time and number of calls of a region on this rank (max over threads), by full name.
+   * \param[in] path - Full name of the region, e.g. "Iteration/Space_Integration".
+   * \return Pair of time and calls, zeros if the region was not executed.
+   */
+  static std::pair<passivedouble, unsigned long> GetLocalTiming(const std::string& path);
+
+  /*!
+   * \brief Reduce the timings over threads and ranks.
+   * \note Must be called by all ranks, outside parallel regions, and while no regions are open.
+   * \return Summary of each region executed by any rank, sorted by full name (sub-regions follow their parent).
+   */
+  static std::vector<RegionSummary> GetSummary();
+
+  /*!
+   * \brief Reduce the timings over threads and ranks and write them to a CSV file.
+   * \note Must be called by all ranks, outside parallel regions, and while no regions are open.
+   * \param[in] fileName - Name of the file (written by the master rank).
+   */
+  static void WriteReport(const std::string& fileName);
+};
+
+/*!
+ * \class CProfilerRegion
+ * \brief Scoped timing of a region with CProfiler (start on construction, stop on destruction).
+ * \ingroup Toolboxes
+ */
+class CProfilerRegion {
+ private:
+  const bool active;
+
+ public:
+  explicit CProfilerRegion(const char* name) : active(CProfiler::IsEnabled()) {
+    if (active) CProfiler::Begin(name);
+  }
+  ~CProfilerRegion() {
+    if (active) CProfiler::End();
+  }
+  CProfilerRegion(const CProfilerRegion&) = delete;
+  CProfilerRegion& operator=(const CProfilerRegion&) = delete;
+};
+
+#define SU2_PROFILE_CONCAT_(A, B) A##B
+#define SU2_PROFILE_CONCAT(A, B) SU2_PROFILE_CONCAT_(A, B)
+
+/*!
+ * \brief Time the enclosing scope as a region of the profiler, e.g. SU2_PROFILE_REGION("Linear_Solver").
+ */
+#define SU2_PROFILE_REGION(NAME) \
+  const CProfilerRegion SU2_PROFILE_CONCAT(su2ProfilerRegion_, __LINE__)(NAME)
@@ -27,6 +27,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 
 namespace GeometryToolbox {
 /// \addtogroup GeometryToolbox
@@ -216,5 +217,58 @@ inline void TangentProjection(Int nDim, const Mat& tensor, const Scalar* vector,
 
   for (Int iDim = 0; iDim < nDim; iDim++) proj[iDim] -= normalProj * vector[iDim];
 }
+
+/*!
+ * \brief Index of a point along the Morton (Z-order) curve, i.e. the interleaved bits of its integer coordinates.
+ * \param[in] nDim - Number of coordinates, nDim * nBits must not exceed 64.
+ * \param[in] nBits - Number of bits of each coordinate.
+ * \param[in] x - Integer coordinates.
+ */
+template <typename Int>
+inline uint64_t MortonIndex(Int nDim, int nBits, const uint32_t* x) {
+  uint64_t index = 0;
+  for (int iBit = nBits - 1; iBit >= 0; --iBit)
+    for (Int i = 0; i < nDim; ++i) index = (index << 1) | ((x[i] >> iBit) & 1u);
+  return index;
+}
+
+/*!
+ * \brief Index of a point along the Hilbert curve, consecutive indices are neighbors in the integer grid.
+ * \note Uses the transposition of J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004.
+ * \param[in] nDim - Number of coordinates (at most 3), nDim * nBits must not exceed 64.
+ * \param[in] nBits - Number of bits of each coordinate.
+ * \param[in] coord - Integer coordinates.
+ */
+template <typename Int>
+inline uint64_t HilbertIndex(Int nDim, int nBits, const uint32_t* coord) {
+  uint32_t x[3] = {0, 0, 0};
+  for (Int i = 0; i < nDim; ++i) x[i] = coord[i];
+
+  /*--- Inverse undo of the excess work. ---*/
+  const uint32_t M = 1u << (nBits - 1);
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    const uint32_t P = Q - 1;
+    for (Int i = 0; i < nDim; ++i) {
+      if (x[i] & Q) {
+        x[0] ^= P;
+      } else {
+        const uint32_t t = (x[0] ^ x[i]) & P;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  /*--- Gray encoding. ---*/
+  for (Int i = 1; i < nDim; ++i) x[i] ^= x[i - 1];
+  uint32_t t = 0;
+  for (uint32_t Q = M; Q > 1; Q >>= 1) {
+    if (x[nDim - 1] & Q) t ^= Q - 1;
+  }
+  for (Int i = 0; i < nDim; ++i) x[i] ^= t;
+
+  /*--- The transposed index is interleaved as a Morton index. ---*/
+  return MortonIndex(nDim, nBits, x);
+}
 /// @}
 }  // namespace GeometryToolbox
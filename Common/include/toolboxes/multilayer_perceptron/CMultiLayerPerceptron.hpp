@@ -0,0 +1,182 @@
+/*!
+ * \file CMultiLayerPerceptron.hpp
+ * \brief Batched evaluation of dense feed-forward neural networks stored in the MLPCpp ASCII format.
+ *        The implementation is in <i>CMultiLayerPerceptron.cpp</i>.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../parallelization/mpi_structure.hpp"
+#include "../../containers/C2DContainer.hpp"
+
+/*!
+ * \brief Multi-layer perceptron evaluated on batches of inputs.
+ * \details The network is read from the ASCII ".mlp" files written by MLPCpp. Instead of a matrix-vector product per
+ * query point, a block of points is propagated through each layer as one matrix-matrix product. The first and second
+ * derivatives of the outputs w.r.t. the inputs are propagated alongside the values (forward mode), as extra rows of
+ * the same product, such that they cost one wider GEMM per layer instead of finite differences.
+ * \note Evaluation uses internal work buffers, hence one object should not be used by multiple threads concurrently
+ * (fluid models are already allocated per thread).
+ * \ingroup LookUpInterp
+ */
+class CMultiLayerPerceptron {
+ public:
+  /*!
+   * \brief Supported activation functions.
+   */
+  enum class ACTIVATION : unsigned short {
+    LINEAR,      /*!< \brief f(x) = x. */
+    RELU,        /*!< \brief f(x) = max(0, x). */
+    ELU,         /*!< \brief f(x) = x for x > 0, exp(x) - 1 otherwise. */
+    SELU,        /*!< \brief Scaled ELU. */
+    GELU,        /*!< \brief Gaussian error linear unit, tanh approximation. */
+    SIGMOID,     /*!< \brief f(x) = 1 / (1 + exp(-x)). */
+    SWISH,       /*!< \brief f(x) = x * sigmoid(x). */
+    TANH,        /*!< \brief f(x) = tanh(x). */
+    EXPONENTIAL, /*!< \brief f(x) = exp(x). */
+  };
+
+ private:
+  /*!
+   * \brief Number of query points propagated together, chosen such that the work buffers of a block stay in cache.
+   */
+  static constexpr unsigned long BLOCK_SIZE = 32;
+
+  std::string filename; /*!< \brief Name of the network file. */
+
+  unsigned short n_inputs = 0,  /*!< \brief Number of network inputs. */
+                 n_outputs = 0; /*!< \brief Number of network outputs. */
+
+  std::vector<unsigned long> n_neurons; /*!< \brief Number of neurons per layer (input and output included). */
+  unsigned long max_neurons = 0;        /*!< \brief Width of the widest layer. */
+
+  std::vector<ACTIVATION> activation;       /*!< \brief Activation function per layer. */
+  std::vector<su2passivematrix> weights;    /*!< \brief Weights (n_neurons[i] x n_neurons[i+1]) between layers. */
+  std::vector<su2passivevector> biases;     /*!< \brief Biases of the neurons of each layer. */
+
+  std::vector<std::string> input_names,  /*!< \brief Names of the network inputs. */
+                           output_names; /*!< \brief Names of the network outputs. */
+
+  std::vector<std::pair<passivedouble, passivedouble>> input_norm, /*!< \brief Input normalization values. */
+                                                       output_norm; /*!< \brief Output normalization values. */
+
+  std::vector<passivedouble> input_offset, input_scale, /*!< \brief x_norm = (x - offset) / scale. */
+                             output_offset, output_scale; /*!< \brief y = offset + scale * y_norm. */
+
+  bool minmax_inputs = true; /*!< \brief Inputs are normalized with their range (and can be checked against it). */
+
+  std::vector<su2double> work_z,  /*!< \brief Pre-activation values and derivatives of the current layer. */
+                         work_y,  /*!< \brief Activated values and derivatives of the previous layer. */
+                         work_f1, /*!< \brief First derivative of the activation function. */
+                         work_f2; /*!< \brief Second derivative of the activation function. */
+
+  /*!
+   * \brief Read the network architecture, normalization and parameters from file.
+   */
+  void ReadFile();
+
+  /*!
+   * \brief Multiply a row-major (n_rows x n_in) block by the layer weights and add the bias to the value rows.
+   * \param[in] iLayer - Index of the layer that is computed (>0).
+   * \param[in] n_rows - Total number of rows (points times derivative channels).
+   * \param[in] n_value_rows - Number of leading rows that hold values (the bias is not added to derivatives).
+   * \param[in] y - Outputs of the previous layer.
+   * \param[out] z - Pre-activation values of the layer.
+   */
+  void LayerProduct(unsigned long iLayer, unsigned long n_rows, unsigned long n_value_rows, const su2double* y,
+                    su2double* z) const;
+
+  /*!
+   * \brief Evaluate the activation function and its first and second derivatives on a contiguous range.
+   * \param[in] function - Activation function.
+   * \param[in] n - Number of values.
+   * \param[in,out] z - Pre-activation values on input, activated values on output.
+   * \param[out] f1 - First derivatives, nullptr if not needed.
+   * \param[out] f2 - Second derivatives, nullptr if not needed.
+   */
+  static void Activate(ACTIVATION function, unsigned long n, su2double* z, su2double* f1, su2double* f2);
+
+  /*!
+   * \brief Propagate a block of at most BLOCK_SIZE points through the network.
+   */
+  unsigned long PredictBlock(unsigned long n_points, const su2double* inputs, unsigned short n_deriv,
+                             su2double* outputs, su2double* d_outputs, su2double* d2_outputs);
+
+ public:
+  /*!
+   * \brief Read the network from an MLPCpp ".mlp" file.
+   * \param[in] file_name - Name of the network file.
+   */
+  explicit CMultiLayerPerceptron(std::string file_name);
+
+  /*!
+   * \brief Number of second derivatives stored per output, i.e. the unique entries of the Hessian w.r.t. the inputs.
+   * \note Entries are packed by row of the upper triangle: (0,0), (0,1), ..., (0,n-1), (1,1), ..., (n-1,n-1).
+   */
+  inline unsigned short GetnHessianEntries() const { return n_inputs * (n_inputs + 1) / 2; }
+
+  /*!
+   * \brief Index of the Hessian entry (i,j) in the packed storage.
+   */
+  inline unsigned short GetHessianIndex(unsigned short i, unsigned short j) const {
+    if (i > j) std::swap(i, j);
+    return i * n_inputs - (i * (i - 1)) / 2 + (j - i);
+  }
+
+  inline unsigned short GetnInputs() const { return n_inputs; }
+  inline unsigned short GetnOutputs() const { return n_outputs; }
+  inline const std::string& GetInputName(unsigned short iInput) const { return input_names[iInput]; }
+  inline const std::string& GetOutputName(unsigned short iOutput) const { return output_names[iOutput]; }
+
+  /*!
+   * \brief Index of an input or output by name.
+   * \return Index of the variable, -1 if the network has no such variable.
+   */
+  int GetInputIndex(const std::string& name) const;
+  int GetOutputIndex(const std::string& name) const;
+
+  /*!
+   * \brief Normalization values of an input as read from file, (min, max) for min-max normalized networks.
+   */
+  inline const std::pair<passivedouble, passivedouble>& GetInputNorm(unsigned short iInput) const {
+    return input_norm[iInput];
+  }
+
+  /*!
+   * \brief Evaluate the network on a batch of points.
+   * \param[in] n_points - Number of query points.
+   * \param[in] inputs - Point-major inputs, n_points x n_inputs.
+   * \param[in] n_deriv - Derivative order to compute (0, 1 or 2).
+   * \param[out] outputs - Point-major outputs, n_points x n_outputs.
+   * \param[out] d_outputs - First derivatives, n_points x n_outputs x n_inputs (only used if n_deriv > 0).
+   * \param[out] d2_outputs - Packed second derivatives, n_points x n_outputs x GetnHessianEntries()
+   *             (only used if n_deriv > 1).
+   * \return Number of points outside the input range of the training data (min-max normalized networks only).
+   */
+  unsigned long Predict(unsigned long n_points, const su2double* inputs, unsigned short n_deriv, su2double* outputs,
+                        su2double* d_outputs = nullptr, su2double* d2_outputs = nullptr);
+};
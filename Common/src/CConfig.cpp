@@ -45,11 +45,6 @@ using namespace PrintingToolbox;
 #endif
 #endif
 
-vector<string> Profile_Function_tp;       /*!< \brief Vector of string names for profiled functions. */
-vector<double> Profile_Time_tp;           /*!< \brief Vector of elapsed time for profiled functions. */
-vector<double> Profile_ID_tp;             /*!< \brief Vector of group ID number for profiled functions. */
-map<string, vector<int> > Profile_Map_tp; /*!< \brief Map containing the final results for profiled functions. */
-
 map<CLong3T, int> GEMM_Profile_MNK;       /*!< \brief Map, which maps the GEMM size to the index where
                                                       the data for this GEMM is stored in several vectors. */
 vector<long>   GEMM_Profile_NCalls;       /*!< \brief Vector, which stores the number of calls to this
@@ -58,8 +53,6 @@ vector<double> GEMM_Profile_TotTime;      /*!< \brief Total time spent for this
 vector<double> GEMM_Profile_MinTime;      /*!< \brief Minimum time spent for this GEMM size. */
 vector<double> GEMM_Profile_MaxTime;      /*!< \brief Maximum time spent for this GEMM size. */
 
-//#pragma omp threadprivate(Profile_Function_tp, Profile_Time_tp, Profile_ID_tp, Profile_Map_tp)
-
 
 CConfig::CConfig(char case_filename[MAX_STRING_SIZE], SU2_COMPONENT val_software, bool verb_high) {
 
@@ -792,6 +785,23 @@ unsigned short CConfig::GetnDim(const string& val_mesh_filename, unsigned short
 
       break;
     }
+    case SU2_BINARY: {
+
+      /*--- The dimension is the second value of the header, after the magic number. ---*/
+      unsigned long header[2] = {0, 0};
+
+      ifstream mesh_file(val_mesh_filename, ios::in | ios::binary);
+      if (mesh_file.fail()) {
+        SU2_MPI::Error(string("The SU2 binary mesh file named ") + val_mesh_filename + string(" was not found."), CURRENT_FUNCTION);
+      }
+      mesh_file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+      if (!mesh_file || header[0] != static_cast<unsigned long>(SU2_MESH_BINARY_MAGIC)) {
+        SU2_MPI::Error(val_mesh_filename + string(" is not a native SU2 binary mesh file."), CURRENT_FUNCTION);
+      }
+      nDim = header[1];
+      break;
+    }
     case RECTANGLE: {
       nDim = 2;
       break;
@@ -1160,6 +1170,8 @@ void CConfig::SetConfig_Options() {
   addBoolOption("WRT_SURFACE_OVERWRITE", Wrt_Surface_Overwrite, true);
   /*!\brief WRT_VOLUME_OVERWRITE \n DESCRIPTION: overwrite visualisation files or append iteration number. \n Options: YES, NO \ingroup Config */
   addBoolOption("WRT_VOLUME_OVERWRITE", Wrt_Volume_Overwrite, true);
+  /*!\brief ASYNC_OUTPUT \n DESCRIPTION: Write volume and surface files in a background thread while the solver continues. \n Options: YES, NO \ingroup Config */
+  addBoolOption("ASYNC_OUTPUT", Async_Output, false);
   /*!\brief SYSTEM_MEASUREMENTS \n DESCRIPTION: System of measurements \n OPTIONS: see \link Measurements_Map \endlink \n DEFAULT: SI \ingroup Config*/
   addEnumOption("SYSTEM_MEASUREMENTS", SystemMeasurements, Measurements_Map, SI);
 
@@ -1176,6 +1188,22 @@ void CConfig::SetConfig_Options() {
   addStringListOption("FILENAMES_INTERPOLATOR", n_Datadriven_files, DataDriven_Method_FileNames);
   /*!\brief DATADRIVEN_NEWTON_RELAXATION \n DESCRIPTION: Relaxation factor for Newton solvers in data-driven fluid model. \n \ingroup Config*/
   addDoubleOption("DATADRIVEN_NEWTON_RELAXATION", DataDriven_Relaxation_Factor, 0.05);
+  /*!\brief LUT_BINARY_CACHE \n DESCRIPTION: Store look-up tables in binary form and memory-map them in subsequent runs. \n \ingroup Config*/
+  addBoolOption("LUT_BINARY_CACHE", LUT_Binary_Cache, false);
+
+  /*!\brief COOLPROP_TABULATION \n DESCRIPTION: Evaluate the CoolProp fluid model through a table in (density, static energy) built at startup. \n \ingroup Config*/
+  addBoolOption("COOLPROP_TABULATION", CoolProp_Tabulation, false);
+  CoolProp_Table_Density[0] = 0.0; CoolProp_Table_Density[1] = 0.0;
+  /*!\brief COOLPROP_TABLE_DENSITY \n DESCRIPTION: Density range (min, max) of the CoolProp table, kg/m^3. \n \ingroup Config*/
+  addDoubleArrayOption("COOLPROP_TABLE_DENSITY", 2, CoolProp_Table_Density);
+  CoolProp_Table_Energy[0] = 0.0; CoolProp_Table_Energy[1] = 0.0;
+  /*!\brief COOLPROP_TABLE_ENERGY \n DESCRIPTION: Static energy range (min, max) of the CoolProp table, J/kg. \n \ingroup Config*/
+  addDoubleArrayOption("COOLPROP_TABLE_ENERGY", 2, CoolProp_Table_Energy);
+  CoolProp_Table_Size[0] = 200; CoolProp_Table_Size[1] = 200;
+  /*!\brief COOLPROP_TABLE_SIZE \n DESCRIPTION: Number of density and energy nodes of the CoolProp table. \n \ingroup Config*/
+  addUShortArrayOption("COOLPROP_TABLE_SIZE", 2, CoolProp_Table_Size);
+  /*!\brief COOLPROP_TABLE_FILENAME \n DESCRIPTION: File where the CoolProp table is cached between runs. \n \ingroup Config*/
+  addStringOption("COOLPROP_TABLE_FILENAME", CoolProp_Table_FileName, string("coolprop_table.bin"));
 
   /*!\brief CONFINEMENT_PARAM \n DESCRIPTION: Input Confinement Parameter for Vorticity Confinement*/
   addDoubleOption("CONFINEMENT_PARAM", Confinement_Param, 0.0);
@@ -1214,6 +1242,10 @@ void CConfig::SetConfig_Options() {
   addBoolOption("IONIZATION", ionization, false);
   /* DESCRIPTION: Specify if there is VT transfer residual limiting */
   addBoolOption("VT_RESIDUAL_LIMITING", vt_transfer_res_limit, false);
+  /* DESCRIPTION: Integrate the chemistry and VT relaxation source terms point-implicitly, split from the flow update */
+  addBoolOption("POINT_IMPLICIT_CHEMISTRY", point_implicit_chemistry, false);
+  /* DESCRIPTION: Number of linearized implicit sub-steps per flow time step of the point-implicit chemistry */
+  addUnsignedShortOption("POINT_IMPLICIT_SUBSTEPS", nPointImplicit_Substeps, 1);
   /* DESCRIPTION: List of catalytic walls */
   addStringListOption("CATALYTIC_WALL", nWall_Catalytic, Wall_Catalytic);
   /* DESCRIPTION: Specfify super-catalytic wall */
@@ -1637,6 +1669,9 @@ void CConfig::SetConfig_Options() {
   /*!\brief WALL_ROUGHNESS  \n DESCRIPTION: Specified roughness heights at wall boundary marker(s)
    Format: ( Wall marker, roughness_height (static), ... ) \ingroup Config*/
   addStringDoubleListOption("WALL_ROUGHNESS", nRough_Wall, Marker_RoughWall, Roughness_Height);
+  /*!\brief WALL_DISTANCE_DISTRIBUTED \n DESCRIPTION: Compute the wall distance with the viscous wall elements of each rank
+   instead of gathering all of them on every rank, the memory then scales with the local work. \n Options: YES, NO \ingroup Config*/
+  addBoolOption("WALL_DISTANCE_DISTRIBUTED", Wall_Distance_Distributed, false);
   /*!\brief MARKER_ENGINE_INFLOW  \n DESCRIPTION: Engine inflow boundary marker(s)
    Format: ( nacelle inflow marker, fan face Mach, ... ) \ingroup Config*/
   addStringDoubleListOption("MARKER_ENGINE_INFLOW", nMarker_EngineInflow, Marker_EngineInflow, EngineInflow_Target);
@@ -1712,6 +1747,12 @@ void CConfig::SetConfig_Options() {
   addUShortArrayOption("NEWTON_KRYLOV_IPARAM", NK_IntParam.size(), NK_IntParam.data());
   /* DESCRIPTION: Double parameters {startup residual drop, precond tolerance, full tolerance residual drop, findiff step}. */
   addDoubleArrayOption("NEWTON_KRYLOV_DPARAM", NK_DblParam.size(), NK_DblParam.data());
+  /* DESCRIPTION: Maximum number of NK iterations that reuse (lag) the preconditioner, 0 rebuilds it every iteration. */
+  addUnsignedShortOption("NEWTON_KRYLOV_PRECOND_LAG", NK_PrecondLag, 0);
+  /* DESCRIPTION: Early refresh of a lagged preconditioner {growth factor of linear iterations, change of residual (orders of magnitude)}. */
+  addDoubleArrayOption("NEWTON_KRYLOV_PRECOND_REFRESH", NK_PrecondRefresh.size(), NK_PrecondRefresh.data());
+  /* DESCRIPTION: Build the NK preconditioner from a first-order (no MUSCL) Jacobian. */
+  addBoolOption("NEWTON_KRYLOV_PRECOND_FIRST_ORDER", NK_PrecondFirstOrder, false);
 
   /* DESCRIPTION: Number of samples for quasi-Newton methods. */
   addUnsignedShortOption("QUASI_NEWTON_NUM_SAMPLES", nQuasiNewtonSamples, 0);
@@ -1803,6 +1844,18 @@ void CConfig::SetConfig_Options() {
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Thread-parallel ILU by level scheduling, which keeps the factorization of the entire rank */
+  addBoolOption("LINEAR_SOLVER_ILU_LEVEL_SCHEDULING", Linear_Solver_ILU_Level_Scheduling, false);
+  /* DESCRIPTION: Maximum number of levels (including the finest) of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_LEVELS", Linear_Solver_AMG_Levels, 10);
+  /* DESCRIPTION: Number of (block) rows below which the AMG preconditioner stops coarsening */
+  addUnsignedLongOption("LINEAR_SOLVER_AMG_COARSE_SIZE", Linear_Solver_AMG_Coarse_Size, 64);
+  /* DESCRIPTION: Strength of connection threshold for the aggregation of the AMG preconditioner */
+  addDoubleOption("LINEAR_SOLVER_AMG_STRENGTH", Linear_Solver_AMG_Strength, 0.08);
+  /* DESCRIPTION: Number of pre and post smoothing (block Gauss-Seidel) sweeps of the AMG preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_AMG_SWEEPS", Linear_Solver_AMG_Sweeps, 1);
+  /* DESCRIPTION: Solvers whose linear systems are solved with single precision matrices and double precision refinement */
+  addEnumListOption("LINEAR_SOLVER_MIXED_PRECISION", nLinear_Solver_Mixed_Precision, Linear_Solver_Mixed_Precision, Mixed_Precision_Solver_Map);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
   /* DESCRIPTION: Relaxation factor for iterative linear smoothers (SMOOTHER_ILU/JACOBI/LU-SGS/LINELET) */
@@ -2084,6 +2137,8 @@ void CConfig::SetConfig_Options() {
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
   addStringOption("MESH_OUT_FILENAME", Mesh_Out_FileName, string("mesh_out.su2"));
+  /*!\brief MESH_OUT_FORMAT \n DESCRIPTION: Format of the output mesh, SU2 or SU2_BINARY \n OPTIONS: see \link Input_Map \endlink \n DEFAULT: SU2 \ingroup Config*/
+  addEnumOption("MESH_OUT_FORMAT", Mesh_Out_FileFormat, Input_Map, SU2);
 
   /* DESCRIPTION: List of the number of grid points in the RECTANGLE or BOX grid in the x,y,z directions. (default: (33,33,33) ). */
   addShortListOption("MESH_BOX_SIZE", nMesh_Box_Size, Mesh_Box_Size);
@@ -2096,6 +2151,16 @@ void CConfig::SetConfig_Options() {
   mesh_box_offset[0] = 0.0; mesh_box_offset[1] = 0.0; mesh_box_offset[2] = 0.0;
   addDoubleArrayOption("MESH_BOX_OFFSET", 3, mesh_box_offset);
 
+  /* DESCRIPTION: Wall clustering of the RECTANGLE or BOX grid in the x,y,z directions, factor of a tanh distribution (default: (0.0,0.0,0.0), i.e. uniform). */
+  mesh_box_stretching[0] = 0.0; mesh_box_stretching[1] = 0.0; mesh_box_stretching[2] = 0.0;
+  addDoubleArrayOption("MESH_BOX_STRETCHING", 3, mesh_box_stretching);
+
+  /* DESCRIPTION: Random perturbation of the interior points of the RECTANGLE or BOX grid, as a fraction of the local spacing (default: 0.0). */
+  addDoubleOption("MESH_BOX_PERTURBATION", MeshBox_Perturbation, 0.0);
+
+  /* DESCRIPTION: Type of elements of the RECTANGLE or BOX grid (default: HEXAHEDRA). */
+  addEnumOption("MESH_BOX_ELEMENTS", Kind_MeshBoxElements, MeshBoxElements_Map, MESH_BOX_ELEMENTS::HEXAHEDRA);
+
   /* DESCRIPTION: Determine if the mesh file supports multizone. \n DEFAULT: true (temporarily) */
   addBoolOption("MULTIZONE_MESH", Multizone_Mesh, true);
   /* DESCRIPTION: Determine if we need to allocate memory to store the multizone residual. \n DEFAULT: true (temporarily) */
@@ -2153,6 +2218,10 @@ void CConfig::SetConfig_Options() {
   addStringOption("VOLUME_SENS_FILENAME", VolSens_FileName, string("volume_sens"));
   /* DESCRIPTION: Output the performance summary to the console at the end of SU2_CFD  \ingroup Config*/
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
+  /* DESCRIPTION: Time the phases of the iterations and write the report to profiling.csv at the end of SU2_CFD  \ingroup Config*/
+  addBoolOption("WRT_PROFILING", Wrt_Profiling, false);
+  /* DESCRIPTION: Run the given number of iterations regardless of convergence, without output files, and report the time per iteration of each phase (0 disables the benchmark mode)  \ingroup Config*/
+  addUnsignedLongOption("BENCHMARK_ITER", Benchmark_Iter, 0);
   /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
   /*!\brief MARKER_ANALYZE_AVERAGE
@@ -2812,6 +2881,24 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: ParMETIS load balancing weight for edges (equiv. to neighbors) */
   addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_edgeWgt, 1);
 
+  /* DESCRIPTION: Store the partitioned grid of each rank and reuse it when the mesh and number of ranks are the same */
+  addBoolOption("PARTITION_CACHE", Partition_Cache, false);
+
+  /* DESCRIPTION: Prefix of the per-rank partition cache files */
+  addStringOption("PARTITION_CACHE_FILENAME", Partition_Cache_FileName, string("partition_cache"));
+
+  /* DESCRIPTION: Number of iterations over which the cost of the points is measured before repartitioning the grid (0 disables dynamic load balancing) */
+  addUnsignedLongOption("REBALANCE_ITER", Rebalance_Iter, 0);
+
+  /* DESCRIPTION: Measured load imbalance (max/avg - 1) above which the grid is repartitioned */
+  addDoubleOption("REBALANCE_TOLERANCE", Rebalance_Tolerance, 0.1);
+
+  /* DESCRIPTION: Renumbering of the points of each rank for memory locality */
+  addEnumOption("POINT_ORDERING", Kind_PointOrdering, PointOrdering_Map, POINT_ORDERING::RCM);
+
+  /* DESCRIPTION: Order of the edges of the finite volume grids */
+  addEnumOption("EDGE_ORDERING", Kind_EdgeOrdering, EdgeOrdering_Map, EDGE_ORDERING::NATURAL);
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -2892,6 +2979,11 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Volume solution files */
   addEnumListOption("OUTPUT_FILES", nVolumeOutputFiles, VolumeOutputFiles, Output_Map);
 
+  /* DESCRIPTION: Compression of the appended data of volume Paraview XML files (PARAVIEW, PARAVIEW_MULTIBLOCK) */
+  addEnumOption("VOLUME_OUTPUT_COMPRESSION", VolumeCompression, VTU_Compression_Map, VTU_COMPRESSION::NONE);
+  /* DESCRIPTION: Compression of the appended data of surface Paraview XML files (SURFACE_PARAVIEW) */
+  addEnumOption("SURFACE_OUTPUT_COMPRESSION", SurfaceCompression, VTU_Compression_Map, VTU_COMPRESSION::NONE);
+
   /* DESCRIPTION: Parameter to perturb eigenvalues */
   addDoubleOption("UQ_DELTA_B", uq_delta_b, 1.0);
 
@@ -2916,6 +3008,12 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Size of the edge groups colored for thread parallel edge loops (0 forces the reducer strategy). */
   addUnsignedLongOption("EDGE_COLORING_GROUP_SIZE", edgeColorGroupSize, 512);
 
+  /* DESCRIPTION: Overlap the last halo exchange before the upwind residual with the fluxes of interior edges. */
+  addBoolOption("HALO_COMM_OVERLAP", haloCommOverlap, false);
+
+  /* DESCRIPTION: Use persistent MPI requests (created once, then restarted) for the halo exchanges. */
+  addBoolOption("HALO_COMM_PERSISTENT", haloCommPersistent, false);
+
   /*--- options that are used for libROM ---*/
   /*!\par CONFIG_CATEGORY:libROM options \ingroup Config*/
 
@@ -3344,8 +3442,36 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     Multizone_Problem = YES;
   }
 
+  /*--- Benchmark mode, run a fixed number of iterations (time iterations if unsteady) while
+   timing the phases, and only write files if they were explicitly requested. ---*/
+  if (Benchmark_Iter > 0) {
+    if (Time_Domain) {
+      nTimeIter = Benchmark_Iter;
+    } else if (Multizone_Problem) {
+      nOuterIter = Benchmark_Iter;
+    } else {
+      nIter = Benchmark_Iter;
+      nInnerIter = Benchmark_Iter;
+    }
+    Wrt_Performance = true;
+    Wrt_Profiling = true;
+  }
+
+  /*--- Dynamic load balancing repartitions the grid of the zone and migrates the solution. ---*/
+  if (Rebalance_Iter > 0) {
+    if (Multizone_Problem || !GetFluidProblem() || DiscreteAdjoint || ContinuousAdjoint ||
+        GetDynamic_Grid() || Deform_Mesh || GetBoolTurbomachinery()) {
+      SU2_MPI::Error("REBALANCE_ITER is only available for single-zone, primal fluid simulations on static grids.",
+                     CURRENT_FUNCTION);
+    }
+#if !defined(HAVE_MPI) || !defined(HAVE_PARMETIS)
+    if (rank == MASTER_NODE) cout << "WARNING: REBALANCE_ITER requires ParMETIS, the grid will not be repartitioned.\n";
+    Rebalance_Iter = 0;
+#endif
+  }
+
   /*--- Set the default output files ---*/
-  if (!OptionIsSet("OUTPUT_FILES")){
+  if (!OptionIsSet("OUTPUT_FILES") && Benchmark_Iter == 0){
     nVolumeOutputFiles = 3;
     VolumeOutputFiles = new OUTPUT_TYPE[nVolumeOutputFiles];
     VolumeOutputFiles[0] = OUTPUT_TYPE::RESTART_BINARY;
@@ -3377,6 +3503,10 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     nVolumeOutputFrequencies = nVolumeOutputFiles;
   }
 
+  if (Mesh_Out_FileFormat != SU2 && Mesh_Out_FileFormat != SU2_BINARY) {
+    SU2_MPI::Error("MESH_OUT_FORMAT must be SU2 or SU2_BINARY.", CURRENT_FUNCTION);
+  }
+
   /*--- Check if SU2 was build with TecIO support, as that is required for Tecplot Binary output. ---*/
 #ifndef HAVE_TECIO
   for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++){
@@ -3397,11 +3527,34 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   }
 #endif
 
+  /*--- Check if SU2 was built with the libraries required for compressed Paraview XML output. ---*/
+#ifndef HAVE_ZLIB
+  if (VolumeCompression == VTU_COMPRESSION::ZLIB || SurfaceCompression == VTU_COMPRESSION::ZLIB) {
+    SU2_MPI::Error("ZLIB output compression requested but SU2 was built without zlib support (-Denable-zlib=true).", CURRENT_FUNCTION);
+  }
+#endif
+#ifndef HAVE_LZ4
+  if (VolumeCompression == VTU_COMPRESSION::LZ4 || SurfaceCompression == VTU_COMPRESSION::LZ4) {
+    SU2_MPI::Error("LZ4 output compression requested but SU2 was built without LZ4 support (-Denable-lz4=true).", CURRENT_FUNCTION);
+  }
+#endif
+
   /*--- Check if CoolProp is used with non-dimensionalization. ---*/
   if (Kind_FluidModel == COOLPROP && Ref_NonDim != DIMENSIONAL) {
     SU2_MPI::Error("CoolProp can not be used with non-dimensionalization.", CURRENT_FUNCTION);
   }
 
+  if (Kind_FluidModel == COOLPROP && CoolProp_Tabulation) {
+    if (CoolProp_Table_Density[0] <= 0.0 || CoolProp_Table_Density[1] <= CoolProp_Table_Density[0] ||
+        CoolProp_Table_Energy[1] <= CoolProp_Table_Energy[0]) {
+      SU2_MPI::Error("COOLPROP_TABLE_DENSITY and COOLPROP_TABLE_ENERGY must be given as (min, max), with min > 0 for the density.",
+                     CURRENT_FUNCTION);
+    }
+    if (CoolProp_Table_Size[0] < 2 || CoolProp_Table_Size[1] < 2) {
+      SU2_MPI::Error("COOLPROP_TABLE_SIZE requires at least 2 nodes in each direction.", CURRENT_FUNCTION);
+    }
+  }
+
   /*--- STL_BINARY output not implemented yet, but already a value in option_structure.hpp---*/
   for (unsigned short iVolumeFile = 0; iVolumeFile < nVolumeOutputFiles; iVolumeFile++) {
     if (VolumeOutputFiles[iVolumeFile] == OUTPUT_TYPE::STL_BINARY){
@@ -3988,6 +4141,14 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
                      CURRENT_FUNCTION);
     }
 
+    if (point_implicit_chemistry && Kind_FluidModel != SU2_NONEQ) {
+      SU2_MPI::Error("POINT_IMPLICIT_CHEMISTRY requires the source term Jacobians of SU2TCLIB (FLUID_MODEL= SU2_NONEQ).", CURRENT_FUNCTION);
+    }
+
+    if (point_implicit_chemistry && nPointImplicit_Substeps == 0) {
+      SU2_MPI::Error("POINT_IMPLICIT_SUBSTEPS must be at least 1.", CURRENT_FUNCTION);
+    }
+
     if (Kind_FluidModel == SU2_NONEQ && GasModel == "AIR-7" && nWall_Catalytic != 0) {
       SU2_MPI::Error("Catalytic wall recombination is not yet available for ionized flows in SU2_NEMO.", CURRENT_FUNCTION);
     }
@@ -5194,6 +5355,13 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
     SU2_MPI::Error("MESH_BOX_SIZE specified without 3 values.\n", CURRENT_FUNCTION);
   }
 
+  if (MeshBox_Perturbation < 0.0 || MeshBox_Perturbation > 0.2) {
+    SU2_MPI::Error("MESH_BOX_PERTURBATION must be between 0 and 0.2 for all elements to remain valid.", CURRENT_FUNCTION);
+  }
+  for (auto iDim = 0u; iDim < 3; iDim++) {
+    if (mesh_box_stretching[iDim] < 0.0) SU2_MPI::Error("MESH_BOX_STRETCHING must not be negative.", CURRENT_FUNCTION);
+  }
+
   /* Force the lowest memory preconditioner when direct solvers are used. */
 
   auto isPastix = [](unsigned short kindSolver) {
@@ -6934,6 +7102,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 cout << "FGMRES is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case AMG: cout << "Using an algebraic multigrid preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
@@ -6942,6 +7111,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
             case SMOOTHER:
               switch (Kind_Linear_Solver_Prec) {
                 case ILU:     cout << "A ILU(" << Linear_Solver_ILU_n << ")"; break;
+                case AMG:     cout << "An algebraic multigrid"; break;
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
@@ -9620,191 +9790,6 @@ short CConfig::FindInterfaceMarker(unsigned short iInterface) const {
   return -1;
 }
 
-void CConfig::Tick(double *val_start_time) {
-
-#ifdef PROFILE
-  *val_start_time = SU2_MPI::Wtime();
-#endif
-
-}
-
-void CConfig::Tock(double val_start_time, const string& val_function_name, int val_group_id) {
-
-#ifdef PROFILE
-
-  double val_stop_time = 0.0, val_elapsed_time = 0.0;
-
-  val_stop_time = SU2_MPI::Wtime();
-
-  /*--- Compute the elapsed time for this subroutine ---*/
-  val_elapsed_time = val_stop_time - val_start_time;
-
-  /*--- Store the subroutine name and the elapsed time ---*/
-  Profile_Function_tp.push_back(val_function_name);
-  Profile_Time_tp.push_back(val_elapsed_time);
-  Profile_ID_tp.push_back(val_group_id);
-
-#endif
-
-}
-
-void CConfig::SetProfilingCSV() {
-
-#ifdef PROFILE
-
-  int rank = MASTER_NODE;
-  int size = SINGLE_NODE;
-#ifdef HAVE_MPI
-  SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
-  SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
-#endif
-
-  /*--- Each rank has the same stack trace, so the they have the same
-   function calls and ordering in the vectors. We're going to reduce
-   the timings from each rank and extract the avg, min, and max timings. ---*/
-
-  /*--- First, create a local mapping, so that we can extract the
-   min and max values for each function. ---*/
-
-  for (unsigned int i = 0; i < Profile_Function_tp.size(); i++) {
-
-    /*--- Add the function and initialize if not already stored (the ID
-     only needs to be stored the first time).---*/
-    if (Profile_Map_tp.find(Profile_Function_tp[i]) == Profile_Map_tp.end()) {
-
-      vector<int> profile; profile.push_back(i);
-      Profile_Map_tp.insert(pair<string,vector<int> >(Profile_Function_tp[i],profile));
-
-    } else {
-
-      /*--- This function has already been added, so simply increment the
-       number of calls and total time for this function. ---*/
-
-      Profile_Map_tp[Profile_Function_tp[i]].push_back(i);
-
-    }
-  }
-
-  /*--- We now have everything gathered by function name, so we can loop over
-   each function and store the min/max times. ---*/
-
-  int map_size = 0;
-  for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-    map_size++;
-  }
-
-  /*--- Allocate and initialize memory ---*/
-
-  double *l_min_red = NULL, *l_max_red = NULL, *l_tot_red = NULL, *l_avg_red = NULL;
-  int *n_calls_red = NULL;
-  double* l_min = new double[map_size];
-  double* l_max = new double[map_size];
-  double* l_tot = new double[map_size];
-  double* l_avg = new double[map_size];
-  int* n_calls  = new int[map_size];
-  for (int i = 0; i < map_size; i++)
-  {
-    l_min[i]   = 1e10;
-    l_max[i]   = 0.0;
-    l_tot[i]   = 0.0;
-    l_avg[i]   = 0.0;
-    n_calls[i] = 0;
-  }
-
-  /*--- Collect the info for each function from the current rank ---*/
-
-  int func_counter = 0;
-  for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-
-    for (unsigned int i = 0; i < (it->second).size(); i++) {
-      n_calls[func_counter]++;
-      l_tot[func_counter] += Profile_Time_tp[(it->second)[i]];
-      if (Profile_Time_tp[(it->second)[i]] < l_min[func_counter])
-        l_min[func_counter] = Profile_Time_tp[(it->second)[i]];
-      if (Profile_Time_tp[(it->second)[i]] > l_max[func_counter])
-        l_max[func_counter] = Profile_Time_tp[(it->second)[i]];
-
-    }
-    l_avg[func_counter] = l_tot[func_counter]/((double)n_calls[func_counter]);
-    func_counter++;
-  }
-
-  /*--- Now reduce the data ---*/
-
-  if (rank == MASTER_NODE) {
-    l_min_red = new double[map_size];
-    l_max_red = new double[map_size];
-    l_tot_red = new double[map_size];
-    l_avg_red = new double[map_size];
-    n_calls_red  = new int[map_size];
-  }
-
-#ifdef HAVE_MPI
-  MPI_Reduce(n_calls, n_calls_red, map_size, MPI_INT, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_tot, l_tot_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_avg, l_avg_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_min, l_min_red, map_size, MPI_DOUBLE, MPI_MIN, MASTER_NODE, SU2_MPI::GetComm());
-  MPI_Reduce(l_max, l_max_red, map_size, MPI_DOUBLE, MPI_MAX, MASTER_NODE, SU2_MPI::GetComm());
-#else
-  memcpy(n_calls_red, n_calls, map_size*sizeof(int));
-  memcpy(l_tot_red,   l_tot,   map_size*sizeof(double));
-  memcpy(l_avg_red,   l_avg,   map_size*sizeof(double));
-  memcpy(l_min_red,   l_min,   map_size*sizeof(double));
-  memcpy(l_max_red,   l_max,   map_size*sizeof(double));
-#endif
-
-  /*--- The master rank will write the file ---*/
-
-  if (rank == MASTER_NODE) {
-
-    /*--- Take averages over all ranks on the master ---*/
-
-    for (int i = 0; i < map_size; i++) {
-      l_tot_red[i]   = l_tot_red[i]/(double)size;
-      l_avg_red[i]   = l_avg_red[i]/(double)size;
-      n_calls_red[i] = n_calls_red[i]/size;
-    }
-
-    /*--- Now write a CSV file with the processed results ---*/
-
-    ofstream Profile_File;
-    Profile_File.precision(15);
-    Profile_File.open("profiling.csv");
-
-    /*--- Create the CSV header ---*/
-
-    Profile_File << "\"Function_Name\", \"N_Calls\", \"Avg_Total_Time\", \"Avg_Time\", \"Min_Time\", \"Max_Time\", \"Function_ID\"" << endl;
-
-    /*--- Loop through the map and write the results to the file ---*/
-
-    func_counter = 0;
-    for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-
-      Profile_File << scientific << it->first << ", " << n_calls_red[func_counter] << ", " << l_tot_red[func_counter] << ", " << l_avg_red[func_counter] << ", " << l_min_red[func_counter] << ", " << l_max_red[func_counter] << ", " << (int)Profile_ID_tp[(it->second)[0]] << endl;
-      func_counter++;
-    }
-
-    Profile_File.close();
-
-  }
-
-  delete [] l_min;
-  delete [] l_max;
-  delete [] l_avg;
-  delete [] l_tot;
-  delete [] n_calls;
-  if (rank == MASTER_NODE) {
-    delete [] l_min_red;
-    delete [] l_max_red;
-    delete [] l_avg_red;
-    delete [] l_tot_red;
-    delete [] n_calls_red;
-  }
-
-#endif
-
-}
-
 void CConfig::GEMM_Tick(double *val_start_time) const {
 
 #ifdef PROFILE
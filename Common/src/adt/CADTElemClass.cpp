@@ -28,6 +28,7 @@
 #include "../../include/adt/CADTElemClass.hpp"
 #include "../../include/parallelization/mpi_structure.hpp"
 #include "../../include/option_structure.hpp"
+#include <limits>
 
 /* Define the tolerance to decide whether or not a point is inside an element. */
 const su2double tolInsideElem = 1.e-10;
@@ -260,6 +261,23 @@ CADTElemClass::CADTElemClass(unsigned short val_nDim, vector<su2double>& val_coo
   for (auto& vec : FrontLeavesNew) vec.reserve(200);
 }
 
+void CADTElemClass::GetBoundingBox(su2double* coorMin, su2double* coorMax) const {
+  for (unsigned short k = 0; k < nDim; ++k) {
+    coorMin[k] = numeric_limits<passivedouble>::max();
+    coorMax[k] = numeric_limits<passivedouble>::lowest();
+  }
+
+  /* The bounding box of all elements follows from the points of the elements,
+     the tolerance added to the element bounding boxes is not needed here. */
+  for (const auto iPoint : elemConns) {
+    const su2double* xP = coorPoints.data() + nDim * iPoint;
+    for (unsigned short k = 0; k < nDim; ++k) {
+      coorMin[k] = min(coorMin[k], xP[k]);
+      coorMax[k] = max(coorMax[k], xP[k]);
+    }
+  }
+}
+
 bool CADTElemClass::DetermineContainingElement_impl(vector<unsigned long>& frontLeaves,
                                                     vector<unsigned long>& frontLeavesNew, const su2double* coor,
                                                     unsigned short& markerID, unsigned long& elemID, int& rankID,
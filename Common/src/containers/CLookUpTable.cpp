@@ -25,8 +25,20 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <utility>
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include "../../../Common/include/containers/CLookUpTable.hpp"
 
 #include "../../../Common/include/linear_algebra/blas_structure.hpp"
@@ -34,10 +46,38 @@
 
 using namespace std;
 
-CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in, string name_CV2_in)
+constexpr unsigned long CLookUpTable::NO_VARIABLE;
+
+CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in, string name_CV2_in,
+                           bool binary_cache)
     : file_name_lut{var_file_name_lut}, name_CV1{std::move(name_CV1_in)}, name_CV2{std::move(name_CV2_in)} {
   rank = SU2_MPI::GetRank();
 
+  /*--- Binary tables are mapped directly, ASCII tables may have an up-to-date binary version. ---*/
+  const bool binary_input = IsBinaryTable(var_file_name_lut);
+  const string file_name_binary = var_file_name_lut + ".bin";
+  bool loaded_binary = false;
+
+  if (binary_input) {
+    loaded_binary = LoadTableBinary(var_file_name_lut, "");
+    if (!loaded_binary) SU2_MPI::Error("Unable to load binary look-up table " + var_file_name_lut, CURRENT_FUNCTION);
+  } else if (binary_cache) {
+    loaded_binary = LoadTableBinary(file_name_binary, var_file_name_lut);
+  }
+
+  if (loaded_binary) {
+    FindTableLimits(name_CV1, name_CV2);
+
+    PrintTableInfo();
+
+    if (rank == MASTER_NODE) {
+      cout << "Table data, trapezoidal maps and interpolation coefficients memory-mapped from "
+           << (binary_input ? var_file_name_lut : file_name_binary) << "\n" << endl;
+      cout << "LUT fluid model ready for use" << endl;
+    }
+    return;
+  }
+
   LoadTableRaw(var_file_name_lut);
 
   FindTableLimits(name_CV1, name_CV2);
@@ -53,6 +93,19 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
 
   PrintTableInfo();
 
+  BuildTrapezoidalMaps();
+
+  ComputeInterpCoeffs();
+
+  /*--- Only one process writes the binary table, to a temporary file that is then renamed. ---*/
+  if (binary_cache && (rank == MASTER_NODE)) WriteTableBinary(file_name_binary, var_file_name_lut);
+
+  if (rank == MASTER_NODE) cout << "LUT fluid model ready for use" << endl;
+}
+
+CLookUpTable::~CLookUpTable() { UnmapFile(); }
+
+void CLookUpTable::BuildTrapezoidalMaps() {
   if (rank == MASTER_NODE) switch (table_dim) {
       case 2:
         cout << "Building a trapezoidal map for the (" + name_CV1 + ", " + name_CV2 +
@@ -77,7 +130,7 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
   double tmap_memory_footprint = 0;
   for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
     trap_map_x_y[i_level] =
-        CTrapezoidalMap(GetDataP(name_CV1, i_level), GetDataP(name_CV2, i_level), table_data[i_level].cols(),
+        CTrapezoidalMap(GetDataP(idx_CV1, i_level), GetDataP(idx_CV2, i_level), n_points[i_level],
                         edges[i_level], edge_to_triangle[i_level], display_map_info);
     tmap_memory_footprint += trap_map_x_y[i_level].GetMemoryFootprint();
     /* Display a progress bar to monitor table generation process */
@@ -107,10 +160,6 @@ CLookUpTable::CLookUpTable(const string& var_file_name_lut, string name_CV1_in,
     cout << "Trapezoidal map memory footprint: " << tmap_memory_footprint << " MB\n";
     cout << "Table data memory footprint: " << memory_footprint_data << " MB\n" << endl;
   }
-
-  ComputeInterpCoeffs();
-
-  if (rank == MASTER_NODE) cout << "LUT fluid model ready for use" << endl;
 }
 
 void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
@@ -154,21 +203,35 @@ void CLookUpTable::LoadTableRaw(const string& var_file_name_lut) {
       z_values_levels[i_level] = file_reader.GetTableLevel(i_level);
     }
   }
+  SetDataPointers();
+
   if (rank == MASTER_NODE) cout << " done." << endl;
 }
 
+void CLookUpTable::SetDataPointers() {
+  table_data_p.resize(n_table_levels);
+  triangles_p.resize(n_table_levels);
+  hull_p.resize(n_table_levels);
+  interp_mat_inv_p.resize(n_table_levels);
+
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    table_data_p[i_level] = table_data[i_level].data();
+    triangles_p[i_level] = triangles[i_level].data();
+    hull_p[i_level] = hull[i_level].data();
+    interp_mat_inv_p[i_level] = interp_mat_inv_x_y[i_level].data();
+  }
+}
+
 void CLookUpTable::FindTableLimits(const string& name_cv1, const string& name_cv2) {
-  int idx_CV1 = GetIndexOfVar(name_cv1);
-  int idx_CV2 = GetIndexOfVar(name_cv2);
+  idx_CV1 = GetIndexOfVar(name_cv1);
+  idx_CV2 = GetIndexOfVar(name_cv2);
   limits_table_x.resize(n_table_levels);
   limits_table_y.resize(n_table_levels);
 
   /* we find the lowest and highest value of y and x in the table */
   for (auto i_level = 0u; i_level < n_table_levels; i_level++) {
-    limits_table_y[i_level] =
-        minmax_element(table_data[i_level][idx_CV2], table_data[i_level][idx_CV2] + table_data[i_level].cols());
-    limits_table_x[i_level] =
-        minmax_element(table_data[i_level][idx_CV1], table_data[i_level][idx_CV1] + table_data[i_level].cols());
+    limits_table_y[i_level] = minmax_element(GetDataP(idx_CV2, i_level), GetDataP(idx_CV2, i_level) + n_points[i_level]);
+    limits_table_x[i_level] = minmax_element(GetDataP(idx_CV1, i_level), GetDataP(idx_CV1, i_level) + n_points[i_level]);
   }
 
   if (table_dim == 3) {
@@ -176,6 +239,245 @@ void CLookUpTable::FindTableLimits(const string& name_cv1, const string& name_cv
   }
 }
 
+bool CLookUpTable::IsBinaryTable(const string& file_name) {
+  unsigned long magic = 0;
+  FILE* file = fopen(file_name.c_str(), "rb");
+  if (file == nullptr) return false;
+  const bool read = (fread(&magic, sizeof(magic), 1, file) == 1);
+  fclose(file);
+  return read && (magic == SU2_LUT_BINARY_MAGIC);
+}
+
+bool CLookUpTable::MapFile(const string& file_name) {
+  UnmapFile();
+#if defined(_WIN32)
+  ifstream file(file_name, ios::binary | ios::ate);
+  if (!file.is_open()) return false;
+  mapped_buffer.resize(file.tellg());
+  file.seekg(0);
+  if (!file.read(mapped_buffer.data(), mapped_buffer.size())) return false;
+  mapped_data = mapped_buffer.data();
+  mapped_size = mapped_buffer.size();
+#else
+  /*--- A shared read-only mapping lives in the page cache, i.e. it exists once per node. ---*/
+  const int fd = open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat file_stat;
+  if ((fstat(fd, &file_stat) != 0) || (file_stat.st_size == 0)) {
+    close(fd);
+    return false;
+  }
+  void* map = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) return false;
+  mapped_data = static_cast<const char*>(map);
+  mapped_size = file_stat.st_size;
+#endif
+  return true;
+}
+
+void CLookUpTable::UnmapFile() {
+#if !defined(_WIN32)
+  if (mapped_data != nullptr) munmap(const_cast<char*>(mapped_data), mapped_size);
+#endif
+  vector<char>().swap(mapped_buffer);
+  mapped_data = nullptr;
+  mapped_size = 0;
+}
+
+bool CLookUpTable::LoadTableBinary(const string& file_name, const string& file_name_source) {
+  /*--- The binary table is outdated if the size or modification time of its source changed. ---*/
+  unsigned long source_size = 0, source_time = 0;
+  if (!file_name_source.empty()) {
+    struct stat source_stat;
+    if (stat(file_name_source.c_str(), &source_stat) != 0) return false;
+    source_size = source_stat.st_size;
+    source_time = source_stat.st_mtime;
+  }
+
+  if (!IsBinaryTable(file_name) || !MapFile(file_name)) return false;
+
+  /*--- All values are 8 byte words, the arrays are used in place unless they need conversion. ---*/
+  const char* buffer = mapped_data;
+  const char* buffer_end = mapped_data + mapped_size;
+  bool ok = true;
+
+  auto take = [&](size_t n_bytes) {
+    const char* begin = buffer;
+    n_bytes = nextMultiple(n_bytes, sizeof(unsigned long));
+    ok = ok && (n_bytes <= size_t(buffer_end - buffer));
+    if (ok) buffer += n_bytes;
+    return begin;
+  };
+  auto read_ulong = [&]() {
+    unsigned long value = 0;
+    const char* begin = take(sizeof(value));
+    if (ok) memcpy(&value, begin, sizeof(value));
+    return value;
+  };
+  auto read_string = [&]() {
+    const unsigned long length = read_ulong();
+    const char* begin = take(length);
+    return ok ? string(begin, length) : string();
+  };
+
+  const unsigned long magic = read_ulong();
+  const unsigned long size_ulong = read_ulong();
+  const unsigned long size_double = read_ulong();
+  const unsigned long stored_source_size = read_ulong();
+  const unsigned long stored_source_time = read_ulong();
+
+  if ((magic != SU2_LUT_BINARY_MAGIC) || (size_ulong != sizeof(unsigned long)) ||
+      (size_double != sizeof(passivedouble))) {
+    UnmapFile();
+    if (file_name_source.empty())
+      SU2_MPI::Error("Binary look-up table " + file_name + " was written on an incompatible system.",
+                     CURRENT_FUNCTION);
+    return false;
+  }
+  if (!file_name_source.empty() && ((stored_source_size != source_size) || (stored_source_time != source_time))) {
+    UnmapFile();
+    return false;
+  }
+
+  table_dim = read_ulong();
+  n_table_levels = read_ulong();
+  n_variables = read_ulong();
+  version_lut = read_string();
+  version_reader = read_string();
+  names_var.resize(n_variables);
+  for (auto i_var = 0ul; i_var < n_variables; i_var++) names_var[i_var] = read_string();
+
+  n_points.resize(n_table_levels);
+  n_triangles.resize(n_table_levels);
+  n_hull_points.resize(n_table_levels);
+  n_edges.resize(n_table_levels);
+  z_values_levels.resize(n_table_levels);
+  table_data_p.resize(n_table_levels);
+  triangles_p.resize(n_table_levels);
+  hull_p.resize(n_table_levels);
+  interp_mat_inv_p.resize(n_table_levels);
+  table_data.resize(n_table_levels);
+  interp_mat_inv_x_y.resize(n_table_levels);
+  trap_map_x_y.resize(n_table_levels);
+
+  /*--- Active types cannot alias the stored doubles, the data is then copied into the containers. ---*/
+  auto view_or_copy = [&](unsigned long n_rows, unsigned long n_cols, su2activematrix& storage) {
+    const char* begin = take(n_rows * n_cols * sizeof(passivedouble));
+    if (!ok) return static_cast<const su2double*>(nullptr);
+#if defined(CODI_FORWARD_TYPE) || defined(CODI_REVERSE_TYPE)
+    storage.resize(n_rows, n_cols);
+    for (auto i = 0ul; i < n_rows * n_cols; i++) {
+      passivedouble value;
+      memcpy(&value, begin + i * sizeof(value), sizeof(value));
+      storage.data()[i] = value;
+    }
+    return static_cast<const su2double*>(storage.data());
+#else
+    return reinterpret_cast<const su2double*>(begin);
+#endif
+  };
+
+  memory_footprint_data = 0;
+  for (auto i_level = 0ul; ok && i_level < n_table_levels; i_level++) {
+    n_points[i_level] = read_ulong();
+    n_triangles[i_level] = read_ulong();
+    n_hull_points[i_level] = read_ulong();
+    n_edges[i_level] = read_ulong();
+    passivedouble z_value = 0;
+    const char* z_begin = take(sizeof(z_value));
+    if (ok) memcpy(&z_value, z_begin, sizeof(z_value));
+    z_values_levels[i_level] = z_value;
+
+    table_data_p[i_level] = view_or_copy(n_variables, n_points[i_level], table_data[i_level]);
+    triangles_p[i_level] =
+        reinterpret_cast<const unsigned long*>(take(N_POINTS_TRIANGLE * n_triangles[i_level] * sizeof(unsigned long)));
+    hull_p[i_level] = reinterpret_cast<const unsigned long*>(take(n_hull_points[i_level] * sizeof(unsigned long)));
+    interp_mat_inv_p[i_level] = view_or_copy(n_triangles[i_level], 9, interp_mat_inv_x_y[i_level]);
+    ok = ok && trap_map_x_y[i_level].ReadBinary(buffer, buffer_end);
+
+    memory_footprint_data += n_variables * n_points[i_level] * sizeof(su2double);
+  }
+  memory_footprint_data /= 1e6;
+
+  if (!ok) {
+    UnmapFile();
+    SU2_MPI::Error("Binary look-up table " + file_name + " is incomplete.", CURRENT_FUNCTION);
+  }
+  if (table_dim != 3) z_values_levels.resize(0);
+
+  return true;
+}
+
+void CLookUpTable::WriteTableBinary(const string& file_name, const string& file_name_source) const {
+  struct stat source_stat;
+  if (stat(file_name_source.c_str(), &source_stat) != 0) return;
+
+  if (rank == MASTER_NODE) cout << "Writing binary look-up table " << file_name << " ..." << endl;
+
+  const string tmp_file_name = file_name + ".tmp";
+  FILE* file = fopen(tmp_file_name.c_str(), "wb");
+  if (file == nullptr) {
+    cout << "WARNING: Unable to write binary look-up table " << tmp_file_name << endl;
+    return;
+  }
+
+  bool ok = true;
+  auto write = [&](const void* data, size_t n_bytes) {
+    ok = ok && (n_bytes == 0 || fwrite(data, 1, n_bytes, file) == n_bytes);
+    /*--- Pad to 8 bytes, such that all arrays in the mapped file are aligned. ---*/
+    const char padding[sizeof(unsigned long)] = {0};
+    const size_t n_pad = nextMultiple(n_bytes, sizeof(unsigned long)) - n_bytes;
+    ok = ok && (n_pad == 0 || fwrite(padding, 1, n_pad, file) == n_pad);
+  };
+  auto write_ulong = [&](unsigned long value) { write(&value, sizeof(value)); };
+  auto write_string = [&](const string& value) {
+    write_ulong(value.size());
+    write(value.data(), value.size());
+  };
+  auto write_doubles = [&](const su2double* data, unsigned long n_values) {
+    vector<passivedouble> passive_data(n_values);
+    for (auto i = 0ul; i < n_values; i++) passive_data[i] = SU2_TYPE::GetValue(data[i]);
+    write(passive_data.data(), n_values * sizeof(passivedouble));
+  };
+
+  write_ulong(SU2_LUT_BINARY_MAGIC);
+  write_ulong(sizeof(unsigned long));
+  write_ulong(sizeof(passivedouble));
+  write_ulong(source_stat.st_size);
+  write_ulong(source_stat.st_mtime);
+
+  write_ulong(table_dim);
+  write_ulong(n_table_levels);
+  write_ulong(n_variables);
+  write_string(version_lut);
+  write_string(version_reader);
+  for (auto i_var = 0ul; i_var < n_variables; i_var++) write_string(names_var[i_var]);
+
+  for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
+    write_ulong(n_points[i_level]);
+    write_ulong(n_triangles[i_level]);
+    write_ulong(n_hull_points[i_level]);
+    write_ulong(n_edges[i_level]);
+    const su2double z_value = (table_dim == 3) ? z_values_levels[i_level] : su2double(0.0);
+    write_doubles(&z_value, 1);
+
+    write_doubles(table_data_p[i_level], n_variables * n_points[i_level]);
+    write(triangles_p[i_level], N_POINTS_TRIANGLE * n_triangles[i_level] * sizeof(unsigned long));
+    write(hull_p[i_level], n_hull_points[i_level] * sizeof(unsigned long));
+    write_doubles(interp_mat_inv_p[i_level], 9 * n_triangles[i_level]);
+    ok = ok && trap_map_x_y[i_level].WriteBinary(file);
+  }
+  fclose(file);
+
+  if (!ok || rename(tmp_file_name.c_str(), file_name.c_str()) != 0) {
+    remove(tmp_file_name.c_str());
+    cout << "WARNING: Unable to write binary look-up table " << file_name << endl;
+    return;
+  }
+  if (rank == MASTER_NODE) cout << " done." << endl;
+}
+
 void CLookUpTable::PrintTableInfo() {
   if (rank == MASTER_NODE) {
     cout << setfill(' ');
@@ -194,7 +496,7 @@ void CLookUpTable::PrintTableInfo() {
     for (auto i_level = 0ul; i_level < n_table_levels; i_level++) {
       n_points_av += n_points[i_level] / n_table_levels;
       n_tria_av += n_triangles[i_level] / n_table_levels;
-      n_edges_av += edges[i_level].size() / n_table_levels;
+      n_edges_av += n_edges[i_level] / n_table_levels;
       min_x = min(min_x, *limits_table_x[i_level].first);
       min_y = min(min_y, *limits_table_y[i_level].first);
       max_x = max(max_x, *limits_table_x[i_level].second);
@@ -250,6 +552,7 @@ void CLookUpTable::PrintTableInfo() {
 }
 
 void CLookUpTable::IdentifyUniqueEdges() {
+  n_edges.resize(n_table_levels);
   for (auto i_level = 0u; i_level < n_table_levels; i_level++) {
     /* loop through elements and store the vector of element IDs (neighbors)
        for each of the points in the table */
@@ -351,6 +654,7 @@ void CLookUpTable::IdentifyUniqueEdges() {
         }
       }
     }
+    n_edges[i_level] = edges[i_level].size();
   }
 }
 
@@ -360,26 +664,25 @@ void CLookUpTable::ComputeInterpCoeffs() {
 
     std::array<unsigned long, 3> next_triangle;
 
-    const su2double* val_CV1 = GetDataP(name_CV1, i_level);
-    const su2double* val_CV2 = GetDataP(name_CV2, i_level);
+    const su2double* val_CV1 = GetDataP(idx_CV1, i_level);
+    const su2double* val_CV2 = GetDataP(idx_CV2, i_level);
 
     /* calculate weights for each triangle (basically a distance function) and
      * build inverse interpolation matrices */
-    interp_mat_inv_x_y[i_level].resize(n_triangles[i_level]);
+    interp_mat_inv_x_y[i_level].resize(n_triangles[i_level], 9);
     for (unsigned long i_triangle = 0; i_triangle < n_triangles[i_level]; i_triangle++) {
       for (int p = 0; p < 3; p++) {
-        next_triangle[p] = triangles[i_level][i_triangle][p];
+        next_triangle[p] = triangles_p[i_level][3 * i_triangle + p];
       }
 
-      su2activematrix x_interp_mat_inv(3, 3);
-      GetInterpMatInv(val_CV1, val_CV2, next_triangle, x_interp_mat_inv);
-      interp_mat_inv_x_y[i_level][i_triangle] = x_interp_mat_inv;
+      GetInterpMatInv(val_CV1, val_CV2, next_triangle, interp_mat_inv_x_y[i_level][i_triangle]);
     }
+    interp_mat_inv_p[i_level] = interp_mat_inv_x_y[i_level].data();
   }
 }
 
 void CLookUpTable::GetInterpMatInv(const su2double* vec_x, const su2double* vec_y,
-                                   std::array<unsigned long, 3>& point_ids, su2activematrix& interp_mat_inv) {
+                                   std::array<unsigned long, 3>& point_ids, su2double* interp_mat_inv) {
   const unsigned int M = 3;
   CSquareMatrixCM global_M(3);
 
@@ -398,7 +701,7 @@ void CLookUpTable::GetInterpMatInv(const su2double* vec_x, const su2double* vec_
 
   for (unsigned int i = 0; i < M; i++) {
     for (unsigned int j = 0; j < M; j++) {
-      interp_mat_inv[i][j] = global_M(i, j);
+      interp_mat_inv[i * M + j] = global_M(i, j);
     }
   }
 }
@@ -425,43 +728,17 @@ std::pair<unsigned long, unsigned long> CLookUpTable::FindInclusionLevels(const
 
 unsigned long CLookUpTable::LookUp_XYZ(const std::string& val_name_var, su2double* val_var, su2double val_CV1,
                                        su2double val_CV2, su2double val_CV3) {
-  /*--- Perform quasi-3D interpolation for a single variable named val_name_var on a query point
-        with coordinates val_CV1, val_CV2, and val_CV3 ---*/
-
-  /* 1: Find table levels directly above and below the query point (the levels that sandwhich val_CV3) */
-  std::pair<unsigned long, unsigned long> inclusion_levels = FindInclusionLevels(val_CV3);
-  bool within_z_limits = (inclusion_levels.first != inclusion_levels.second);
-
-  if (within_z_limits) {
-    /* 2: Determine val_CV1 and val_CV2 for the inclusion table levels. */
-    std::array<std::array<su2double, 2>, 2> lower_upper_CV1_2 =
-        ComputeNormalizedXY(inclusion_levels, val_CV1, val_CV2, val_CV3);
-    su2double val_CV1_lower = lower_upper_CV1_2[0][0], val_CV2_lower = lower_upper_CV1_2[0][1],
-              val_CV1_upper = lower_upper_CV1_2[1][0], val_CV2_upper = lower_upper_CV1_2[1][1];
-
-    /* 3: Perform 2D interpolations on upper and lower inclusion levels */
-    unsigned long lower_level = inclusion_levels.first;
-    unsigned long upper_level = inclusion_levels.second;
-
-    su2double val_var_lower, val_var_upper;
-    unsigned long exit_code_lower = LookUp_XY(val_name_var, &val_var_lower, val_CV1_lower, val_CV2_lower, lower_level);
-    unsigned long exit_code_upper = LookUp_XY(val_name_var, &val_var_upper, val_CV1_upper, val_CV2_upper, upper_level);
-
-    /* 4: Perform linear interpolation along the z-direction using the x-y interpolation results
-             from upper and lower trapezoidal maps */
-    Linear_Interpolation(val_CV3, lower_level, upper_level, val_var_lower, val_var_upper, val_var);
-
-    return max(exit_code_lower, exit_code_upper);
-  } else {
-    /* Perform single, 2D interpolation when val_CV3 lies outside table bounds */
-    unsigned long bound_level = inclusion_levels.first;
-    LookUp_XY(val_name_var, val_var, val_CV1, val_CV2, bound_level);
-    return 1;
-  }
+  return LookUp_XYZ(GetVarIndices({val_name_var}), val_var, val_CV1, val_CV2, val_CV3);
 }
+
 unsigned long CLookUpTable::LookUp_XYZ(const std::vector<std::string>& val_names_var, std::vector<su2double>& val_vars,
                                        su2double val_CV1, su2double val_CV2, su2double val_CV3) {
-  /*--- Perform quasi-3D interpolation for a vector of variables with names val_names_var
+  return LookUp_XYZ(GetVarIndices(val_names_var), val_vars.data(), val_CV1, val_CV2, val_CV3);
+}
+
+unsigned long CLookUpTable::LookUp_XYZ(const std::vector<unsigned long>& idx_vars, su2double* val_vars,
+                                       su2double val_CV1, su2double val_CV2, su2double val_CV3, unsigned long* hint) {
+  /*--- Perform quasi-3D interpolation for the variables with indices idx_vars
         on a query point with coordinates val_CV1, val_CV2, and val_CV3 ---*/
 
   /* 1: Find table levels directly above and below the query point (the levels that sandwhich val_CV3) */
@@ -479,45 +756,32 @@ unsigned long CLookUpTable::LookUp_XYZ(const std::vector<std::string>& val_names
     unsigned long lower_level = inclusion_levels.first;
     unsigned long upper_level = inclusion_levels.second;
 
-    std::vector<su2double> val_vars_lower, val_vars_upper;
-    val_vars_lower.resize(val_vars.size());
-    val_vars_upper.resize(val_vars.size());
-    unsigned long exit_code_lower = LookUp_XY(val_names_var, val_vars_lower, val_CV1_lower, val_CV2_lower, lower_level);
-    unsigned long exit_code_upper = LookUp_XY(val_names_var, val_vars_upper, val_CV1_upper, val_CV2_upper, upper_level);
+    const auto n_vars = idx_vars.size();
+    std::vector<su2double> val_vars_lower(n_vars), val_vars_upper(n_vars);
+    unsigned long* hint_upper = hint ? hint + 1 : nullptr;
+    unsigned long exit_code_lower =
+        LookUp_XY(idx_vars, val_vars_lower.data(), val_CV1_lower, val_CV2_lower, lower_level, hint);
+    unsigned long exit_code_upper =
+        LookUp_XY(idx_vars, val_vars_upper.data(), val_CV1_upper, val_CV2_upper, upper_level, hint_upper);
 
     /* 4: Perform linear interpolation along the z-direction using the x-y interpolation results
              from upper and lower trapezoidal maps */
-    Linear_Interpolation(val_CV3, lower_level, upper_level, val_vars_lower, val_vars_upper, val_vars);
+    Linear_Interpolation(val_CV3, lower_level, upper_level, val_vars_lower.data(), val_vars_upper.data(), n_vars,
+                         val_vars);
 
     return max(exit_code_lower, exit_code_upper);
   } else {
     /* Perform single, 2D interpolation when val_CV3 lies outside table bounds */
     unsigned long bound_level = inclusion_levels.first;
-    LookUp_XY(val_names_var, val_vars, val_CV1, val_CV2, bound_level);
+    LookUp_XY(idx_vars, val_vars, val_CV1, val_CV2, bound_level, hint);
     return 1;
   }
 }
 
 void CLookUpTable::Linear_Interpolation(const su2double val_CV3, const unsigned long lower_level,
-                                        const unsigned long upper_level, su2double& lower_value, su2double& upper_value,
-                                        su2double*& var_val) const {
-  /* Perform linear interpolation along the z-direction of the table for a single variable */
-
-  /* Retrieve constant z-values of inclusion levels */
-  su2double val_z_lower = z_values_levels[lower_level];
-  su2double val_z_upper = z_values_levels[upper_level];
-
-  /* Compute linear interpolation coefficients */
-  su2double factor_upper = (val_CV3 - val_z_lower) / (val_z_upper - val_z_lower);
-  su2double factor_lower = (val_z_upper - val_CV3) / (val_z_upper - val_z_lower);
-
-  /* Perform linear interpolation */
-  *var_val = lower_value * factor_lower + upper_value * factor_upper;
-}
-
-void CLookUpTable::Linear_Interpolation(const su2double val_CV3, const unsigned long lower_level,
-                                        const unsigned long upper_level, std::vector<su2double>& lower_values,
-                                        std::vector<su2double>& upper_values, std::vector<su2double>& var_vals) const {
+                                        const unsigned long upper_level, const su2double* lower_values,
+                                        const su2double* upper_values, unsigned long n_vars,
+                                        su2double* var_vals) const {
   /* Perform linear interpolation along the z-direction of the table for multiple variables */
 
   /* Retrieve constant z-values of inclusion levels */
@@ -529,7 +793,7 @@ void CLookUpTable::Linear_Interpolation(const su2double val_CV3, const unsigned
   su2double factor_lower = (val_z_upper - val_CV3) / (val_z_upper - val_z_lower);
 
   /* Perform linear interpolation */
-  for (size_t iVar = 0; iVar < var_vals.size(); iVar++) {
+  for (auto iVar = 0ul; iVar < n_vars; iVar++) {
     var_vals[iVar] = lower_values[iVar] * factor_lower + upper_values[iVar] * factor_upper;
   }
 }
@@ -579,98 +843,114 @@ std::array<std::array<su2double, 2>, 2> CLookUpTable::ComputeNormalizedXY(
   return lower_upper_CVs;
 }
 
-unsigned long CLookUpTable::LookUp_XY(const string& val_name_var, su2double* val_var, su2double val_CV1,
-                                      su2double val_CV2, unsigned long i_level) {
-  unsigned long exit_code = 1;
-
-  if (noSource(val_name_var)) {
-    *val_var = 0.0;
-    exit_code = 0;
-    return exit_code;
-  }
-
-  /* check if x and y value is in table range */
-  if ((val_CV1 >= *limits_table_x[i_level].first && val_CV1 <= *limits_table_x[i_level].second) &&
-      (val_CV2 >= *limits_table_y[i_level].first && val_CV2 <= *limits_table_y[i_level].second)) {
-    /* find the triangle that holds the (x, y) point */
-    unsigned long id_triangle = trap_map_x_y[i_level].GetTriangle(val_CV1, val_CV2);
-
-    if (IsInTriangle(val_CV1, val_CV2, id_triangle, i_level)) {
-      /* get interpolation coefficients for point on triangle */
-      std::array<su2double, 3> interp_coeffs{0};
-      GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_x_y[i_level][id_triangle], interp_coeffs);
-
-      /* first, copy the single triangle from the large triangle list*/
-      std::array<unsigned long, 3> triangle{0};
-      for (int p = 0; p < 3; p++) triangle[p] = triangles[i_level][id_triangle][p];
-
-      *val_var = Interpolate(GetDataP(val_name_var, i_level), triangle, interp_coeffs);
-      exit_code = 0;
-    }
+vector<unsigned long> CLookUpTable::GetVarIndices(const vector<string>& val_names_var) const {
+  vector<unsigned long> idx_vars(val_names_var.size());
+  for (auto i_var = 0ul; i_var < val_names_var.size(); ++i_var) {
+    idx_vars[i_var] = noSource(val_names_var[i_var]) ? NO_VARIABLE : GetIndexOfVar(val_names_var[i_var]);
   }
-  if (exit_code == 1) InterpolateToNearestNeighbors(val_CV1, val_CV2, val_name_var, val_var, i_level);
+  return idx_vars;
+}
 
-  return exit_code;
+unsigned long CLookUpTable::LookUp_XY(const string& val_name_var, su2double* val_var, su2double val_CV1,
+                                      su2double val_CV2, unsigned long i_level) {
+  return LookUp_XY(GetVarIndices({val_name_var}), val_var, val_CV1, val_CV2, i_level);
 }
 
 unsigned long CLookUpTable::LookUp_XY(const vector<string>& val_names_var, vector<su2double>& val_vars,
                                       su2double val_CV1, su2double val_CV2, unsigned long i_level) {
-  vector<su2double*> look_up_data(val_names_var.size());
+  return LookUp_XY(GetVarIndices(val_names_var), val_vars.data(), val_CV1, val_CV2, i_level);
+}
+
+unsigned long CLookUpTable::LookUp_XY(const vector<string>& val_names_var, vector<su2double*>& val_vars,
+                                      su2double val_CV1, su2double val_CV2, unsigned long i_level) {
+  vector<su2double> look_up_data(val_names_var.size());
 
-  for (long unsigned int i_var = 0; i_var < val_vars.size(); ++i_var) {
-    look_up_data[i_var] = &val_vars[i_var];
-  }
+  unsigned long exit_code = LookUp_XY(GetVarIndices(val_names_var), look_up_data.data(), val_CV1, val_CV2, i_level);
 
-  unsigned long exit_code = LookUp_XY(val_names_var, look_up_data, val_CV1, val_CV2, i_level);
+  for (auto i_var = 0ul; i_var < val_names_var.size(); ++i_var) *val_vars[i_var] = look_up_data[i_var];
 
   return exit_code;
 }
 
-unsigned long CLookUpTable::LookUp_XY(const vector<string>& val_names_var, vector<su2double*>& val_vars,
-                                      su2double val_CV1, su2double val_CV2, unsigned long i_level) {
-  unsigned long exit_code = 1;
-  unsigned long id_triangle = 0;
-  std::array<su2double, 3> interp_coeffs{0};
-  std::array<unsigned long, 3> triangle{0};
+bool CLookUpTable::FindTriangle(su2double val_CV1, su2double val_CV2, unsigned long i_level,
+                                unsigned long& id_triangle, std::array<su2double, 3>& interp_coeffs) {
+  /* Neighboring query points usually fall in the same triangle, test the hint before searching the map. */
+  bool found = (id_triangle < n_triangles[i_level]) && IsInTriangle(val_CV1, val_CV2, id_triangle, i_level);
 
   /* check if x value is in table x-dimension range
    * and if y is in table y-dimension table range */
-  if ((val_CV1 >= *limits_table_x[i_level].first && val_CV1 <= *limits_table_x[i_level].second) &&
+  if (!found && (val_CV1 >= *limits_table_x[i_level].first && val_CV1 <= *limits_table_x[i_level].second) &&
       (val_CV2 >= *limits_table_y[i_level].first && val_CV2 <= *limits_table_y[i_level].second)) {
     /* if so, try to find the triangle that holds the (prog, enth) point */
     id_triangle = trap_map_x_y[i_level].GetTriangle(val_CV1, val_CV2);
 
     /* check if point is inside a triangle (if table domain is non-rectangular,
      * the previous range check might be true but the point could still be outside of the domain) */
-    if (IsInTriangle(val_CV1, val_CV2, id_triangle, i_level)) {
-      /* if so, get interpolation coefficients for point in  the triangle */
-      GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_x_y[i_level][id_triangle], interp_coeffs);
-
-      /* exit_code 0 means point was in triangle */
-      exit_code = 0;
-    }
+    found = IsInTriangle(val_CV1, val_CV2, id_triangle, i_level);
   }
 
-  /* loop over variable names and interpolate / get values */
-  for (long unsigned int i_var = 0; i_var < val_names_var.size(); ++i_var) {
-    if (noSource(val_names_var[i_var])) {
-      *val_vars[i_var] = 0.0;
-      exit_code = 0;
-    } else {
-      if (exit_code == 0) {
-        /* first, copy the single triangle from the large triangle list*/
-        for (int p = 0; p < 3; p++) triangle[p] = triangles[i_level][id_triangle][p];
-        *val_vars[i_var] = Interpolate(GetDataP(val_names_var[i_var], i_level), triangle, interp_coeffs);
+  /* if so, get interpolation coefficients for point in the triangle */
+  if (found) GetInterpCoeffs(val_CV1, val_CV2, interp_mat_inv_p[i_level] + 9 * id_triangle, interp_coeffs);
+
+  return found;
+}
+
+unsigned long CLookUpTable::LookUp_XY(const vector<unsigned long>& idx_vars, su2double* val_vars, su2double val_CV1,
+                                      su2double val_CV2, unsigned long i_level, unsigned long* hint) {
+  unsigned long id_triangle = NO_VARIABLE;
+  if (hint) id_triangle = *hint;
+  std::array<su2double, 3> interp_coeffs{0};
+
+  const bool in_table = FindTriangle(val_CV1, val_CV2, i_level, id_triangle, interp_coeffs);
+
+  if (in_table) {
+    if (hint) *hint = id_triangle;
+
+    /* first, copy the single triangle from the large triangle list*/
+    std::array<unsigned long, 3> triangle{0};
+    for (int p = 0; p < 3; p++) triangle[p] = triangles_p[i_level][3 * id_triangle + p];
+
+    for (auto i_var = 0ul; i_var < idx_vars.size(); ++i_var) {
+      if (idx_vars[i_var] == NO_VARIABLE) {
+        val_vars[i_var] = 0.0;
       } else {
-        InterpolateToNearestNeighbors(val_CV1, val_CV2, val_names_var[i_var], val_vars[i_var], i_level);
+        val_vars[i_var] = Interpolate(GetDataP(idx_vars[i_var], i_level), triangle, interp_coeffs);
       }
     }
+    return 0;
   }
 
-  return exit_code;
+  /* exit_code 1 means at least one variable had to be extrapolated */
+  const bool all_no_source =
+      all_of(idx_vars.begin(), idx_vars.end(), [](unsigned long idx) { return idx == NO_VARIABLE; });
+
+  InterpolateToNearestNeighbors(val_CV1, val_CV2, idx_vars, val_vars, i_level);
+
+  return all_no_source ? 0 : 1;
 }
 
-void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, su2activematrix& interp_mat_inv,
+unsigned long CLookUpTable::LookUp_Batch(const vector<unsigned long>& idx_vars, unsigned long n_queries,
+                                         const su2double* val_CV1, const su2double* val_CV2,
+                                         const su2double* val_CV3, su2double* val_vars, unsigned long* exit_codes) {
+  const auto n_vars = idx_vars.size();
+  const bool lookup_3d = (val_CV3 != nullptr) && (table_dim == 3);
+
+  /* Each batch keeps its own search hints, which makes concurrent batches independent. */
+  unsigned long hint[2] = {NO_VARIABLE, NO_VARIABLE};
+  unsigned long n_misses = 0;
+
+  for (auto i_query = 0ul; i_query < n_queries; ++i_query) {
+    su2double* vals = val_vars + i_query * n_vars;
+    const unsigned long exit_code =
+        lookup_3d ? LookUp_XYZ(idx_vars, vals, val_CV1[i_query], val_CV2[i_query], val_CV3[i_query], hint)
+                  : LookUp_XY(idx_vars, vals, val_CV1[i_query], val_CV2[i_query], 0, hint);
+    if (exit_codes) exit_codes[i_query] = exit_code;
+    n_misses += exit_code;
+  }
+  return n_misses;
+}
+
+void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, const su2double* interp_mat_inv,
                                    std::array<su2double, 3>& interp_coeffs) {
   std::array<su2double, 3> query_vector = {1, val_CV1, val_CV2};
 
@@ -678,7 +958,7 @@ void CLookUpTable::GetInterpCoeffs(su2double val_CV1, su2double val_CV2, su2acti
   for (int i = 0; i < 3; i++) {
     d = 0;
     for (int j = 0; j < 3; j++) {
-      d = d + interp_mat_inv[i][j] * query_vector[j];
+      d = d + interp_mat_inv[i * 3 + j] * query_vector[j];
     }
     interp_coeffs[i] = d;
   }
@@ -704,8 +984,8 @@ unsigned long CLookUpTable::FindNearestNeighborOnHull(su2double val_CV1, su2doub
   su2double next_y_norm;
   unsigned long neighbor_id = 0;
 
-  const su2double* x_table = GetDataP(name_CV1, i_level);
-  const su2double* y_table = GetDataP(name_CV2, i_level);
+  const su2double* x_table = GetDataP(idx_CV1, i_level);
+  const su2double* y_table = GetDataP(idx_CV2, i_level);
 
   su2double norm_coeff_x = 1. / (limits_table_x[i_level].second - limits_table_x[i_level].first);
   su2double norm_coeff_y = 1. / (limits_table_y[i_level].second - limits_table_y[i_level].first);
@@ -713,22 +993,22 @@ unsigned long CLookUpTable::FindNearestNeighborOnHull(su2double val_CV1, su2doub
   su2double val_CV2_norm = val_CV2 / (limits_table_y[i_level].second - limits_table_y[i_level].first);
 
   for (unsigned long i_point = 0; i_point < n_hull_points[i_level]; ++i_point) {
-    next_x_norm = x_table[hull[i_level][i_point]] * norm_coeff_x;
-    next_y_norm = y_table[hull[i_level][i_point]] * norm_coeff_y;
+    next_x_norm = x_table[hull_p[i_level][i_point]] * norm_coeff_x;
+    next_y_norm = y_table[hull_p[i_level][i_point]] * norm_coeff_y;
 
     next_distance = sqrt(pow(val_CV1_norm - next_x_norm, 2) + pow(val_CV2_norm - next_y_norm, 2));
 
     if (next_distance < min_distance) {
       min_distance = next_distance;
-      neighbor_id = hull[i_level][i_point];
+      neighbor_id = hull_p[i_level][i_point];
     }
   }
   return neighbor_id;
 }
 
 void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const su2double val_CV2,
-                                                 const std::vector<std::string>& names_var,
-                                                 std::vector<su2double*>& var_vals, const unsigned long i_level) {
+                                                 const std::vector<unsigned long>& idx_vars, su2double* var_vals,
+                                                 const unsigned long i_level) {
   /* Interpolate data using distance-weighted averaging on the two nearest table nodes. */
 
   su2double min_distance = 1e99, second_distance = 1e99;
@@ -737,13 +1017,13 @@ void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const
   su2double val_CV1_norm = val_CV1 / (*limits_table_x[i_level].second - *limits_table_x[i_level].first);
   su2double val_CV2_norm = val_CV2 / (*limits_table_y[i_level].second - *limits_table_y[i_level].first);
 
-  const su2double* x_table = GetDataP(name_CV1, i_level);
-  const su2double* y_table = GetDataP(name_CV2, i_level);
+  const su2double* x_table = GetDataP(idx_CV1, i_level);
+  const su2double* y_table = GetDataP(idx_CV2, i_level);
   unsigned long i_nearest = 0, i_second_nearest = 0;
 
   for (unsigned long i_point = 0; i_point < n_hull_points[i_level]; ++i_point) {
-    su2double next_x_norm = x_table[hull[i_level][i_point]] * norm_coeff_x;
-    su2double next_y_norm = y_table[hull[i_level][i_point]] * norm_coeff_y;
+    su2double next_x_norm = x_table[hull_p[i_level][i_point]] * norm_coeff_x;
+    su2double next_y_norm = y_table[hull_p[i_level][i_point]] * norm_coeff_y;
 
     su2double next_distance = pow(val_CV1_norm - next_x_norm, 2) + pow(val_CV2_norm - next_y_norm, 2);
 
@@ -753,9 +1033,9 @@ void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const
       min_distance = next_distance;
 
       i_second_nearest = i_nearest;
-      i_nearest = hull[i_level][i_point];
+      i_nearest = hull_p[i_level][i_point];
     } else if ((next_distance > min_distance) && (next_distance < second_distance)) {
-      i_second_nearest = hull[i_level][i_point];
+      i_second_nearest = hull_p[i_level][i_point];
 
       second_distance = next_distance;
     }
@@ -766,31 +1046,27 @@ void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const
 
   /* Interpolate data using distance-weighted averaging */
   su2double delimiter = (1.0 / min_distance) + (1.0 / second_distance);
-  for (auto iVar = 0u; iVar < var_vals.size(); iVar++) {
-    su2double data_nearest = GetDataP(names_var[iVar], i_level)[i_nearest],
-              data_second_nearest = GetDataP(names_var[iVar], i_level)[i_second_nearest];
-    *var_vals[iVar] = (data_nearest * (1.0 / min_distance) + data_second_nearest * (1.0 / second_distance)) / delimiter;
+  for (auto iVar = 0u; iVar < idx_vars.size(); iVar++) {
+    if (idx_vars[iVar] == NO_VARIABLE) {
+      var_vals[iVar] = 0.0;
+      continue;
+    }
+    su2double data_nearest = GetDataP(idx_vars[iVar], i_level)[i_nearest],
+              data_second_nearest = GetDataP(idx_vars[iVar], i_level)[i_second_nearest];
+    var_vals[iVar] = (data_nearest * (1.0 / min_distance) + data_second_nearest * (1.0 / second_distance)) / delimiter;
   }
 }
 
-void CLookUpTable::InterpolateToNearestNeighbors(const su2double val_CV1, const su2double val_CV2,
-                                                 const std::string& name_var, su2double* var_vals,
-                                                 const unsigned long i_level) {
-  std::vector<std::string> names_var = {name_var};
-  std::vector<su2double*> val_names_var = {var_vals};
-  InterpolateToNearestNeighbors(val_CV1, val_CV2, names_var, val_names_var, i_level);
-}
-
 bool CLookUpTable::IsInTriangle(su2double val_CV1, su2double val_CV2, unsigned long val_id_triangle,
                                 unsigned long i_level) {
-  su2double tri_x_0 = GetDataP(name_CV1, i_level)[triangles[i_level][val_id_triangle][0]];
-  su2double tri_y_0 = GetDataP(name_CV2, i_level)[triangles[i_level][val_id_triangle][0]];
+  su2double tri_x_0 = GetDataP(idx_CV1, i_level)[triangles_p[i_level][3 * val_id_triangle + 0]];
+  su2double tri_y_0 = GetDataP(idx_CV2, i_level)[triangles_p[i_level][3 * val_id_triangle + 0]];
 
-  su2double tri_x_1 = GetDataP(name_CV1, i_level)[triangles[i_level][val_id_triangle][1]];
-  su2double tri_y_1 = GetDataP(name_CV2, i_level)[triangles[i_level][val_id_triangle][1]];
+  su2double tri_x_1 = GetDataP(idx_CV1, i_level)[triangles_p[i_level][3 * val_id_triangle + 1]];
+  su2double tri_y_1 = GetDataP(idx_CV2, i_level)[triangles_p[i_level][3 * val_id_triangle + 1]];
 
-  su2double tri_x_2 = GetDataP(name_CV1, i_level)[triangles[i_level][val_id_triangle][2]];
-  su2double tri_y_2 = GetDataP(name_CV2, i_level)[triangles[i_level][val_id_triangle][2]];
+  su2double tri_x_2 = GetDataP(idx_CV1, i_level)[triangles_p[i_level][3 * val_id_triangle + 2]];
+  su2double tri_y_2 = GetDataP(idx_CV2, i_level)[triangles_p[i_level][3 * val_id_triangle + 2]];
 
   su2double area_tri = TriArea(tri_x_0, tri_y_0, tri_x_1, tri_y_1, tri_x_2, tri_y_2);
 
@@ -26,6 +26,7 @@
  */
 
 #include <array>
+#include <cstring>
 #include <iomanip>
 
 #include "../../Common/include/option_structure.hpp"
@@ -281,3 +282,93 @@ pair<unsigned long, unsigned long> CTrapezoidalMap::GetEdges(pair<unsigned long,
 
   return make_pair(edge_low, edge_up);
 }
+
+bool CTrapezoidalMap::WriteBinary(FILE* file) const {
+  /*--- All values are stored as 8 byte words, ragged arrays as offsets followed by the values. ---*/
+  bool ok = true;
+  auto write_ulong = [&](unsigned long value) { ok = ok && (fwrite(&value, sizeof(value), 1, file) == 1); };
+  auto write_double = [&](su2double value) {
+    const passivedouble passive_value = SU2_TYPE::GetValue(value);
+    ok = ok && (fwrite(&passive_value, sizeof(passive_value), 1, file) == 1);
+  };
+
+  write_ulong(unique_bands_x.size());
+  for (const auto& band : unique_bands_x) write_double(band);
+
+  write_ulong(edge_limits_x.rows());
+  for (auto i_edge = 0ul; i_edge < edge_limits_x.rows(); i_edge++) {
+    for (auto i = 0u; i < 2; i++) write_double(edge_limits_x[i_edge][i]);
+    for (auto i = 0u; i < 2; i++) write_double(edge_limits_y[i_edge][i]);
+  }
+
+  write_ulong(edge_to_triangle.size());
+  for (auto i_edge = 0ul; i_edge < edge_to_triangle.size(); i_edge++) {
+    write_ulong(edge_to_triangle[i_edge].size());
+    for (const auto i_triangle : edge_to_triangle[i_edge]) write_ulong(i_triangle);
+  }
+
+  write_ulong(y_edge_at_band_mid.size());
+  for (auto i_band = 0ul; i_band < y_edge_at_band_mid.size(); i_band++) {
+    write_ulong(y_edge_at_band_mid[i_band].size());
+    for (const auto& y_edge : y_edge_at_band_mid[i_band]) {
+      write_double(y_edge.first);
+      write_ulong(y_edge.second);
+    }
+  }
+  return ok;
+}
+
+bool CTrapezoidalMap::ReadBinary(const char*& buffer, const char* buffer_end) {
+  bool ok = true;
+  auto read_ulong = [&]() {
+    unsigned long value = 0;
+    ok = ok && (buffer + sizeof(value) <= buffer_end);
+    if (ok) {
+      memcpy(&value, buffer, sizeof(value));
+      buffer += sizeof(value);
+    }
+    return value;
+  };
+  auto read_double = [&]() {
+    passivedouble value = 0;
+    ok = ok && (buffer + sizeof(value) <= buffer_end);
+    if (ok) {
+      memcpy(&value, buffer, sizeof(value));
+      buffer += sizeof(value);
+    }
+    return su2double(value);
+  };
+
+  unique_bands_x.resize(read_ulong());
+  for (auto& band : unique_bands_x) band = read_double();
+
+  const unsigned long n_edges = read_ulong();
+  if (!ok) return false;
+  edge_limits_x.resize(n_edges, 2);
+  edge_limits_y.resize(n_edges, 2);
+  for (auto i_edge = 0ul; i_edge < n_edges; i_edge++) {
+    for (auto i = 0u; i < 2; i++) edge_limits_x[i_edge][i] = read_double();
+    for (auto i = 0u; i < 2; i++) edge_limits_y[i_edge][i] = read_double();
+  }
+
+  edge_to_triangle.resize(read_ulong());
+  for (auto i_edge = 0ul; ok && i_edge < edge_to_triangle.size(); i_edge++) {
+    edge_to_triangle[i_edge].resize(read_ulong());
+    for (auto& i_triangle : edge_to_triangle[i_edge]) i_triangle = read_ulong();
+  }
+
+  y_edge_at_band_mid.resize(read_ulong());
+  double size_y_edge_at_band_mid = 0;
+  for (auto i_band = 0ul; ok && i_band < y_edge_at_band_mid.size(); i_band++) {
+    y_edge_at_band_mid[i_band].resize(read_ulong());
+    for (auto& y_edge : y_edge_at_band_mid[i_band]) {
+      y_edge.first = read_double();
+      y_edge.second = read_ulong();
+    }
+    size_y_edge_at_band_mid += y_edge_at_band_mid[i_band].size() * (sizeof(su2double) + sizeof(unsigned long)) / 1e6;
+  }
+
+  memory_footprint = (sizeof(su2double) * (unique_bands_x.size() + 4 * n_edges) +
+                      sizeof(unsigned long) * 2 * edge_to_triangle.size()) / 1e6 + size_y_edge_at_band_mid;
+  return ok;
+}
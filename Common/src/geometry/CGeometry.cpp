@@ -33,6 +33,14 @@
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/toolboxes/ndflattener.hpp"
 
+/*--- Point-to-point exchanges may use persistent requests (HALO_COMM_PERSISTENT), except in AD
+ builds where the wrapper of the AD tool needs to record each message. ---*/
+#if defined(HAVE_MPI) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+constexpr bool PERSISTENT_P2P_COMMS = true;
+#else
+constexpr bool PERSISTENT_P2P_COMMS = false;
+#endif
+
 CGeometry::CGeometry() : size(SU2_MPI::GetSize()), rank(SU2_MPI::GetRank()) {}
 
 CGeometry::~CGeometry() {
@@ -94,6 +102,8 @@ CGeometry::~CGeometry() {
 
   /*--- Delete structures for MPI point-to-point communication. ---*/
 
+  FreePersistentP2PRequests();
+
   delete[] bufD_P2PRecv;
   delete[] bufD_P2PSend;
 
@@ -346,6 +356,10 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
     maxCountPerPoint = countPerPoint;
 
+    /*--- The persistent requests refer to the old buffers. ---*/
+
+    FreePersistentP2PRequests();
+
     /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
     delete[] bufD_P2PSend;
@@ -363,12 +377,99 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
+const CGeometry::PersistentP2PRequests* CGeometry::GetPersistentP2PRequests(unsigned short commType,
+                                                                           unsigned short countPerPoint,
+                                                                           bool reverse) const {
+#if defined(HAVE_MPI) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  for (const auto& requests : persistentP2P) {
+    if (requests.commType == commType && requests.countPerPoint == countPerPoint && requests.reverse == reverse)
+      return &requests;
+  }
+
+  if (commType != COMM_TYPE_DOUBLE && commType != COMM_TYPE_UNSIGNED_SHORT) {
+    SU2_MPI::Error("Unrecognized data type for point-to-point MPI comms.", CURRENT_FUNCTION);
+  }
+
+  /*--- First use of this kind of exchange, set up the requests with the same buffer
+   locations, counts, and tags as the non-persistent version in PostP2PRecvs/Sends.
+   In reverse comms the send and recv buffers and neighbors swap roles. ---*/
+
+  persistentP2P.emplace_back();
+  auto& requests = persistentP2P.back();
+  requests.commType = commType;
+  requests.countPerPoint = countPerPoint;
+  requests.reverse = reverse;
+  requests.send.resize(nP2PSend);
+  requests.recv.resize(nP2PRecv);
+
+  const auto nPointRecv = reverse ? nPoint_P2PSend : nPoint_P2PRecv;
+  const auto nPointSend = reverse ? nPoint_P2PRecv : nPoint_P2PSend;
+  const auto neighborsRecv = reverse ? Neighbors_P2PSend : Neighbors_P2PRecv;
+  const auto neighborsSend = reverse ? Neighbors_P2PRecv : Neighbors_P2PSend;
+
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    const auto offset = countPerPoint * nPointRecv[iRecv];
+    const auto count = countPerPoint * (nPointRecv[iRecv + 1] - nPointRecv[iRecv]);
+    const auto source = neighborsRecv[iRecv];
+
+    if (commType == COMM_TYPE_DOUBLE) {
+      auto buf = reverse ? bufD_P2PSend : bufD_P2PRecv;
+      SU2_MPI::Recv_init(&buf[offset], count, MPI_DOUBLE, source, source + 1, SU2_MPI::GetComm(),
+                         &requests.recv[iRecv]);
+    } else {
+      auto buf = reverse ? bufS_P2PSend : bufS_P2PRecv;
+      SU2_MPI::Recv_init(&buf[offset], count, MPI_UNSIGNED_SHORT, source, source + 1, SU2_MPI::GetComm(),
+                         &requests.recv[iRecv]);
+    }
+  }
+
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    const auto offset = countPerPoint * nPointSend[iSend];
+    const auto count = countPerPoint * (nPointSend[iSend + 1] - nPointSend[iSend]);
+    const auto dest = neighborsSend[iSend];
+
+    if (commType == COMM_TYPE_DOUBLE) {
+      const auto buf = reverse ? bufD_P2PRecv : bufD_P2PSend;
+      SU2_MPI::Send_init(&buf[offset], count, MPI_DOUBLE, dest, rank + 1, SU2_MPI::GetComm(), &requests.send[iSend]);
+    } else {
+      const auto buf = reverse ? bufS_P2PRecv : bufS_P2PSend;
+      SU2_MPI::Send_init(&buf[offset], count, MPI_UNSIGNED_SHORT, dest, rank + 1, SU2_MPI::GetComm(),
+                         &requests.send[iSend]);
+    }
+  }
+  return &requests;
+#else
+  return nullptr;
+#endif
+}
+
+void CGeometry::FreePersistentP2PRequests() {
+  for (auto& requests : persistentP2P) {
+    for (auto& request : requests.send) SU2_MPI::Request_free(&request);
+    for (auto& request : requests.recv) SU2_MPI::Request_free(&request);
+  }
+  persistentP2P.clear();
+}
+
 void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigned short commType,
                              unsigned short countPerPoint, bool val_reverse) const {
   /*--- Launch the non-blocking recv's first. Note that we have stored
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
 
+  /*--- Restart the persistent requests of this kind of exchange, the request
+   handles are copied to the regular array where the completion is checked. ---*/
+
+  if (PERSISTENT_P2P_COMMS && config->GetHaloCommPersistent()) {
+    SU2_OMP_MASTER {
+      const auto requests = GetPersistentP2PRequests(commType, countPerPoint, val_reverse);
+      copy(requests->recv.begin(), requests->recv.end(), req_P2PRecv);
+      SU2_MPI::Startall(nP2PRecv, req_P2PRecv);
+    }
+    END_SU2_OMP_MASTER
+    return;
+  }
+
   SU2_OMP_MASTER
   for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
     const auto iMessage = iRecv;
@@ -460,6 +561,16 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
                              unsigned short countPerPoint, int val_iSend, bool val_reverse) const {
   /*--- Post the non-blocking send as soon as the buffer is loaded. ---*/
 
+  if (PERSISTENT_P2P_COMMS && config->GetHaloCommPersistent()) {
+    SU2_OMP_MASTER {
+      const auto requests = GetPersistentP2PRequests(commType, countPerPoint, val_reverse);
+      req_P2PSend[val_iSend] = requests->send[val_iSend];
+      SU2_MPI::Start(&req_P2PSend[val_iSend]);
+    }
+    END_SU2_OMP_MASTER
+    return;
+  }
+
   /*--- In some instances related to the adjoint solver, we need
    to reverse the direction of communications such that the normal
    send nodes become the recv nodes and vice-versa. ---*/
@@ -1278,6 +1389,62 @@ void CGeometry::SetEdges() {
   edges->SetPaddingNodes();
 }
 
+void CGeometry::SetEdge_Ordering(EDGE_ORDERING kind) {
+  if (kind == EDGE_ORDERING::NATURAL || nEdge == 0) return;
+
+  /*--- The edges of a block of consecutive first points are sorted by second point, which then increases
+   * monotonically within the block instead of jumping back for each first point. The data of the first points
+   * of a block stays in cache, and consecutive edges (the lanes of a SIMD group, the edges of a color group)
+   * share more second points. The blocks are small to keep the first points close in the edge order. ---*/
+  constexpr unsigned long blockSize = 16;
+
+  vector<unsigned long> order(nEdge);
+  iota(order.begin(), order.end(), 0ul);
+  stable_sort(order.begin(), order.end(), [&](unsigned long iEdge, unsigned long jEdge) {
+    const auto iBlock = edges->GetNode(iEdge, 0) / blockSize;
+    const auto jBlock = edges->GetNode(jEdge, 0) / blockSize;
+    if (iBlock != jBlock) return iBlock < jBlock;
+    return edges->GetNode(iEdge, 1) < edges->GetNode(jEdge, 1);
+  });
+
+  /*--- Move the nodes of the edges (the normals are not computed yet) and renumber the edges of the points. ---*/
+
+  vector<unsigned long> newIndex(nEdge), oldNodes(2 * nEdge);
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    newIndex[order[iEdge]] = iEdge;
+    oldNodes[2 * iEdge] = edges->GetNode(iEdge, 0);
+    oldNodes[2 * iEdge + 1] = edges->GetNode(iEdge, 1);
+  }
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    edges->SetNodes(iEdge, oldNodes[2 * order[iEdge]], oldNodes[2 * order[iEdge] + 1]);
+  }
+  edges->SetPaddingNodes();
+
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    for (auto iNode = 0u; iNode < nodes->GetnPoint(iPoint); iNode++) {
+      nodes->SetEdge(iPoint, newIndex[nodes->GetEdge(iPoint, iNode)], iNode);
+    }
+  }
+}
+
+void CGeometry::GetOrdering_Metrics(unsigned long& bandwidth, passivedouble& edgeGap) const {
+  auto absDiff = [](unsigned long a, unsigned long b) { return (a > b) ? a - b : b - a; };
+
+  unsigned long localBandwidth = 0, localGap[2] = {0, 0}, globalGap[2] = {0, 0};
+  for (auto iEdge = 0ul; iEdge < nEdge; iEdge++) {
+    const auto iPoint = edges->GetNode(iEdge, 0);
+    const auto jPoint = edges->GetNode(iEdge, 1);
+    if (iPoint < nPointDomain && jPoint < nPointDomain) localBandwidth = max(localBandwidth, absDiff(iPoint, jPoint));
+    if (iEdge > 0) {
+      localGap[0] += absDiff(iPoint, edges->GetNode(iEdge - 1, 0)) + absDiff(jPoint, edges->GetNode(iEdge - 1, 1));
+      localGap[1] += 2;
+    }
+  }
+  SU2_MPI::Allreduce(&localBandwidth, &bandwidth, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(localGap, globalGap, 2, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  edgeGap = (globalGap[1] > 0) ? static_cast<passivedouble>(globalGap[0]) / globalGap[1] : 0.0;
+}
+
 void CGeometry::SetFaces() {
   //  unsigned long iPoint, jPoint, iFace;
   //  unsigned short jNode, iNode;
@@ -3910,6 +4077,10 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
   bool allEmpty = true;
   vector<bool> wallDistanceNeeded(nZone, false);
 
+  /*--- In distributed mode each rank only keeps its own wall elements in the ADT (FVM only). ---*/
+  const bool distributed =
+      config_container[ZONE_0]->GetWall_Distance_Distributed() && !config_container[ZONE_0]->GetFEMSolver();
+
   for (int iInst = 0; iInst < config_container[ZONE_0]->GetnTimeInstances(); iInst++) {
     for (int iZone = 0; iZone < nZone; iZone++) {
       /*--- Check if a zone needs the wall distance and store a boolean ---*/
@@ -3931,14 +4102,25 @@ void CGeometry::ComputeWallDistance(const CConfig* const* config_container, CGeo
     /*--- Loop over all zones and compute the ADT based on the viscous walls in that zone ---*/
     for (int iZone = 0; iZone < nZone; iZone++) {
       unique_ptr<CADTElemClass> WallADT =
-          geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(config_container[iZone]);
-      if (WallADT && !WallADT->IsEmpty()) {
+          geometry_container[iZone][iInst][MESH_0]->ComputeViscousWallADT(config_container[iZone], !distributed);
+      bool emptyADT = !WallADT || WallADT->IsEmpty();
+      if (distributed) {
+        /*--- The local ADTs are only empty if no rank has viscous walls in this zone. ---*/
+        int localWalls = !emptyADT, globalWalls = 0;
+        SU2_MPI::Allreduce(&localWalls, &globalWalls, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+        emptyADT = !globalWalls;
+      }
+      if (!emptyADT) {
         allEmpty = false;
         /*--- Inner loop over all zones to update the wall distances.
          * It might happen that there is a closer viscous wall in zone iZone for points in zone jZone. ---*/
         for (int jZone = 0; jZone < nZone; jZone++) {
-          if (wallDistanceNeeded[jZone])
-            geometry_container[jZone][iInst][MESH_0]->SetWallDistance(WallADT.get(), config_container[jZone], iZone);
+          if (!wallDistanceNeeded[jZone]) continue;
+          CGeometry* geometry = geometry_container[jZone][iInst][MESH_0];
+          if (distributed)
+            geometry->SetWallDistanceDistributed(WallADT.get(), config_container[jZone], iZone);
+          else
+            geometry->SetWallDistance(WallADT.get(), config_container[jZone], iZone);
         }
       }
     }
@@ -33,6 +33,7 @@
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/geometry/meshreader/CSU2ASCIIMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CCGNSMeshReaderFVM.hpp"
+#include "../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CRectangularMeshReaderFVM.hpp"
 #include "../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
 
@@ -95,6 +96,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig* config, unsigned short val_iZone,
   } else {
     switch (val_format) {
       case SU2:
+      case SU2_BINARY:
       case CGNS_GRID:
       case RECTANGLE:
       case BOX:
@@ -246,6 +248,11 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
   SU2_MPI::Allreduce(&nLocal_Elem, &nGlobal_Elem, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
   SU2_MPI::Allreduce(&nLocal_Bound_Elem, &nGlobal_Bound_Elem, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
 
+  /*--- Store the redistributed grid such that subsequent runs can skip the steps above. ---*/
+
+  if (config->GetPartition_Cache() && (config->GetKind_SU2() == SU2_COMPONENT::SU2_CFD))
+    WritePartitionCache(config, geometry);
+
   /*--- With the distribution of all points, elements, and markers based
    on the ParMETIS coloring complete, as a final step, load this data into
    our geometry class data structures. ---*/
@@ -261,6 +268,45 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
 
   /*--- Free memory associated with the partitioning of points and elems. ---*/
 
+  DeletePartitionBuffers();
+}
+
+constexpr unsigned short CPhysicalGeometry::PartitionCacheHeaderSize;
+
+CPhysicalGeometry::CPhysicalGeometry(CConfig* config, const string& cacheFileName) : CGeometry() {
+  edgeColorGroupSize = config->GetEdgeColoringGroupSize();
+  nZone = config->GetnZone();
+
+  if (rank == MASTER_NODE) cout << "Loading the partitioned grid from the partition cache." << endl;
+
+  /*--- Read the redistributed points, elements, and markers. The global sizes of the linearly
+   partitioned grid are stored in this object, as the Load* methods read them from their
+   "geometry" argument, and they are overwritten with the final values by those methods. ---*/
+
+  ReadPartitionCache(config, cacheFileName);
+
+  PrepareOffsets(Global_nPoint);
+
+  nLocal_Elem = (nLocal_Tria + nLocal_Quad + nLocal_Tetr + nLocal_Hexa + nLocal_Pris + nLocal_Pyra);
+  nLocal_Bound_Elem = nLocal_Line + nLocal_BoundTria + nLocal_BoundQuad;
+
+  SU2_MPI::Allreduce(&nLocal_Elem, &nGlobal_Elem, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+  SU2_MPI::Allreduce(&nLocal_Bound_Elem, &nGlobal_Bound_Elem, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+  /*--- From here on this is the same as distributing the grid. ---*/
+
+  LoadPoints(config, this);
+  LoadVolumeElements(config, this);
+  LoadSurfaceElements(config, this);
+
+  if (config->GetSmoothGradient()) {
+    Sensitivity.resize(nPoint, nDim) = su2double(0.0);
+  }
+
+  DeletePartitionBuffers();
+}
+
+void CPhysicalGeometry::DeletePartitionBuffers() {
   decltype(Neighbors)().swap(Neighbors);
   decltype(Color_List)().swap(Color_List);
 
@@ -304,6 +350,281 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry* geometry, CConfig* config) : CGe
   delete[] Elem_ID_BoundQuad_Linear;
 }
 
+string CPhysicalGeometry::GetPartitionCacheFileName(const CConfig* config) {
+  const auto format = config->GetMesh_FileFormat();
+  if ((format != SU2) && (format != SU2_BINARY) && (format != CGNS_GRID)) return "";
+
+  /*--- 64-bit FNV-1a hash of the mesh file and of the options that change the partitions. ---*/
+
+  unsigned long key = 14695981039346656037ul;
+  auto hashBytes = [&key](const void* data, size_t nBytes) {
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < nBytes; ++i) {
+      key ^= bytes[i];
+      key *= 1099511628211ul;
+    }
+  };
+  auto hashString = [&hashBytes](const string& str) { hashBytes(str.c_str(), str.size() + 1); };
+
+  int fileFound = 1;
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    /*--- Hashing the entire file would cost as much as reading it, the mesh is identified by its size,
+     modification time, and header (dimension, AoA/AoS offsets, and the first points or elements). ---*/
+
+    const string& meshFileName = config->GetMesh_FileName();
+    struct stat meshStat;
+    FILE* file = fopen(meshFileName.c_str(), "rb");
+    if ((file == nullptr) || (stat(meshFileName.c_str(), &meshStat) != 0)) {
+      fileFound = 0;
+    } else {
+      const unsigned long sizeAndTime[] = {(unsigned long)meshStat.st_size, (unsigned long)meshStat.st_mtime};
+      hashBytes(sizeAndTime, sizeof(sizeAndTime));
+      vector<unsigned char> buffer(1 << 16);
+      hashBytes(buffer.data(), fread(buffer.data(), 1, buffer.size(), file));
+    }
+    if (file != nullptr) fclose(file);
+
+    const passivedouble tolerance = config->GetParMETIS_Tolerance();
+    const long weights[] = {config->GetParMETIS_PointWeight(), config->GetParMETIS_EdgeWeight()};
+    const unsigned short zoneAndUnits[] = {config->GetiZone(), config->GetnZone(), config->GetSystemMeasurements()};
+    hashBytes(&tolerance, sizeof(tolerance));
+    hashBytes(weights, sizeof(weights));
+    hashBytes(zoneAndUnits, sizeof(zoneAndUnits));
+
+    /*--- The SU2 ASCII reader splits the actuator disk surfaces, which adds points to the grid. ---*/
+
+    const unsigned short actDisk[] = {config->GetnMarker_ActDiskInlet(), config->GetnMarker_ActDiskOutlet(),
+                                      config->GetActDisk_DoubleSurface(), config->GetActDisk_SU2_DEF()};
+    hashBytes(actDisk, sizeof(actDisk));
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_ActDiskInlet(); ++iMarker)
+      hashString(config->GetMarker_ActDiskInlet_TagBound(iMarker));
+    for (unsigned short iMarker = 0; iMarker < config->GetnMarker_ActDiskOutlet(); ++iMarker)
+      hashString(config->GetMarker_ActDiskOutlet_TagBound(iMarker));
+  }
+  SU2_MPI::Bcast(&fileFound, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Bcast(&key, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  if (!fileFound) return "";
+
+  stringstream name;
+  name << config->GetMultizone_FileName(config->GetPartition_Cache_FileName(), config->GetiZone(), "") << "_"
+       << hex << key << dec << "_" << SU2_MPI::GetSize() << "_" << SU2_MPI::GetRank() << ".dat";
+  return name.str();
+}
+
+bool CPhysicalGeometry::CheckPartitionCache(const string& fileName) {
+  int valid = 0;
+
+  if (!fileName.empty()) {
+    FILE* file = fopen(fileName.c_str(), "rb");
+    if (file != nullptr) {
+      unsigned long header[3] = {0};
+      if (fread(header, sizeof(unsigned long), 3, file) == 3) {
+        valid = (header[0] == SU2_PARTITION_CACHE_MAGIC) && (header[1] == (unsigned long)SU2_MPI::GetSize()) &&
+                (header[2] == (unsigned long)SU2_MPI::GetRank());
+      }
+      fclose(file);
+    }
+  }
+
+  /*--- The cache is only used if all ranks have a valid file. ---*/
+
+  int allValid = 0;
+  SU2_MPI::Allreduce(&valid, &allValid, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+  return allValid != 0;
+}
+
+void CPhysicalGeometry::WritePartitionCache(const CConfig* config, const CGeometry* geometry) const {
+  const string fileName = GetPartitionCacheFileName(config);
+  if (fileName.empty()) return;
+
+  if (rank == MASTER_NODE) cout << "Writing the partitioned grid to the partition cache." << endl;
+
+  /*--- Write to a temporary file first, such that an interrupted run does not leave an
+   incomplete cache behind. ---*/
+
+  const string tmpFileName = fileName + ".tmp";
+  FILE* file = fopen(tmpFileName.c_str(), "wb");
+  if (file == nullptr) SU2_MPI::Error("Unable to open partition cache file " + tmpFileName, CURRENT_FUNCTION);
+
+  auto write = [&](const void* data, size_t sizeOfValue, size_t nValues) {
+    if (nValues == 0) return;
+    if (fwrite(data, sizeOfValue, nValues, file) != nValues)
+      SU2_MPI::Error("Unable to write partition cache file " + tmpFileName, CURRENT_FUNCTION);
+  };
+
+  const unsigned long header[PartitionCacheHeaderSize] = {
+      SU2_PARTITION_CACHE_MAGIC,         (unsigned long)size, (unsigned long)rank, nDim,
+      geometry->GetGlobal_nPoint(),      geometry->GetGlobal_nPointDomain(),
+      geometry->GetGlobal_nElemDomain(), nMarker_Global,
+      nLocal_Point,                      nLocal_PointDomain,
+      nLocal_PointGhost,                 nLocal_Tria,
+      nLocal_Quad,                       nLocal_Tetr,
+      nLocal_Hexa,                       nLocal_Pris,
+      nLocal_Pyra,                       nLocal_Line,
+      nLocal_BoundTria,                  nLocal_BoundQuad};
+  write(header, sizeof(unsigned long), PartitionCacheHeaderSize);
+
+  /*--- The mesh reader adds the AoA and AoS offsets of the mesh file to the config, see ReadPartitionCache. ---*/
+
+  const passivedouble offsets[] = {SU2_TYPE::GetValue(config->GetAoA_Offset()),
+                                   SU2_TYPE::GetValue(config->GetAoS_Offset())};
+  write(offsets, sizeof(passivedouble), 2);
+
+  vector<char> tags(nMarker_Global * MAX_STRING_SIZE, '\0');
+  for (unsigned long iMarker = 0; iMarker < nMarker_Global; iMarker++)
+    Marker_Tags[iMarker].copy(&tags[iMarker * MAX_STRING_SIZE], MAX_STRING_SIZE - 1);
+  write(tags.data(), sizeof(char), tags.size());
+
+  vector<passivedouble> coords(nLocal_Point * nDim);
+  for (unsigned long i = 0; i < coords.size(); i++) coords[i] = SU2_TYPE::GetValue(Local_Coords[i]);
+
+  write(Local_Points, sizeof(unsigned long), nLocal_Point);
+  write(Local_Colors, sizeof(unsigned long), nLocal_Point);
+  write(coords.data(), sizeof(passivedouble), coords.size());
+
+  write(Conn_Tria, sizeof(unsigned long), nLocal_Tria * N_POINTS_TRIANGLE);
+  write(Conn_Quad, sizeof(unsigned long), nLocal_Quad * N_POINTS_QUADRILATERAL);
+  write(Conn_Tetr, sizeof(unsigned long), nLocal_Tetr * N_POINTS_TETRAHEDRON);
+  write(Conn_Hexa, sizeof(unsigned long), nLocal_Hexa * N_POINTS_HEXAHEDRON);
+  write(Conn_Pris, sizeof(unsigned long), nLocal_Pris * N_POINTS_PRISM);
+  write(Conn_Pyra, sizeof(unsigned long), nLocal_Pyra * N_POINTS_PYRAMID);
+
+  write(ID_Tria, sizeof(unsigned long), nLocal_Tria);
+  write(ID_Quad, sizeof(unsigned long), nLocal_Quad);
+  write(ID_Tetr, sizeof(unsigned long), nLocal_Tetr);
+  write(ID_Hexa, sizeof(unsigned long), nLocal_Hexa);
+  write(ID_Pris, sizeof(unsigned long), nLocal_Pris);
+  write(ID_Pyra, sizeof(unsigned long), nLocal_Pyra);
+
+  write(Conn_Line, sizeof(unsigned long), nLocal_Line * N_POINTS_LINE);
+  write(Conn_BoundTria, sizeof(unsigned long), nLocal_BoundTria * N_POINTS_TRIANGLE);
+  write(Conn_BoundQuad, sizeof(unsigned long), nLocal_BoundQuad * N_POINTS_QUADRILATERAL);
+
+  write(ID_Line, sizeof(unsigned long), nLocal_Line);
+  write(ID_BoundTria, sizeof(unsigned long), nLocal_BoundTria);
+  write(ID_BoundQuad, sizeof(unsigned long), nLocal_BoundQuad);
+
+  write(Elem_ID_Line, sizeof(unsigned long), nLocal_Line);
+  write(Elem_ID_BoundTria, sizeof(unsigned long), nLocal_BoundTria);
+  write(Elem_ID_BoundQuad, sizeof(unsigned long), nLocal_BoundQuad);
+
+  fclose(file);
+
+  if (rename(tmpFileName.c_str(), fileName.c_str()) != 0)
+    SU2_MPI::Error("Unable to rename partition cache file " + tmpFileName, CURRENT_FUNCTION);
+}
+
+void CPhysicalGeometry::ReadPartitionCache(CConfig* config, const string& fileName) {
+  FILE* file = fopen(fileName.c_str(), "rb");
+  if (file == nullptr) SU2_MPI::Error("Unable to open partition cache file " + fileName, CURRENT_FUNCTION);
+
+  auto read = [&](void* data, size_t sizeOfValue, size_t nValues) {
+    if (nValues == 0) return;
+    if (fread(data, sizeOfValue, nValues, file) != nValues)
+      SU2_MPI::Error("Partition cache file " + fileName + " is truncated.", CURRENT_FUNCTION);
+  };
+
+  /*--- Allocate (if not empty) and read an array of global indices. ---*/
+
+  auto readIndices = [&](unsigned long*& data, unsigned long nValues) {
+    if (nValues == 0) return;
+    data = new unsigned long[nValues];
+    read(data, sizeof(unsigned long), nValues);
+  };
+
+  unsigned long header[PartitionCacheHeaderSize] = {0};
+  read(header, sizeof(unsigned long), PartitionCacheHeaderSize);
+
+  if ((header[0] != SU2_PARTITION_CACHE_MAGIC) || (header[1] != (unsigned long)size) ||
+      (header[2] != (unsigned long)rank)) {
+    SU2_MPI::Error("Partition cache file " + fileName + " does not match this run.", CURRENT_FUNCTION);
+  }
+
+  nDim = header[3];
+  Global_nPoint = header[4];
+  Global_nPointDomain = header[5];
+  Global_nElemDomain = header[6];
+  nMarker_Global = header[7];
+  nLocal_Point = header[8];
+  nLocal_PointDomain = header[9];
+  nLocal_PointGhost = header[10];
+  nLocal_Tria = header[11];
+  nLocal_Quad = header[12];
+  nLocal_Tetr = header[13];
+  nLocal_Hexa = header[14];
+  nLocal_Pris = header[15];
+  nLocal_Pyra = header[16];
+  nLocal_Line = header[17];
+  nLocal_BoundTria = header[18];
+  nLocal_BoundQuad = header[19];
+
+  /*--- Apply the AoA and AoS offsets as done by CSU2ASCIIMeshReaderFVM, the mesh file is not read. ---*/
+
+  passivedouble offsets[2] = {0.0};
+  read(offsets, sizeof(passivedouble), 2);
+
+  config->SetAoA_Offset(offsets[0]);
+  config->SetAoA(config->GetAoA() + offsets[0]);
+  config->SetAoS_Offset(offsets[1]);
+  config->SetAoS(config->GetAoS() + offsets[1]);
+
+  if ((rank == MASTER_NODE) && ((offsets[0] != 0.0) || (offsets[1] != 0.0))) {
+    cout << "WARNING: AoA offset (" << offsets[0] << " deg.) and AoS offset (" << offsets[1]
+         << " deg.) of the mesh file, AoA = " << config->GetAoA() << " deg., AoS = " << config->GetAoS() << " deg."
+         << endl;
+  }
+
+  /*--- Set the marker tags as done by DistributeMarkerTags. ---*/
+
+  vector<char> tags(nMarker_Global * MAX_STRING_SIZE);
+  read(tags.data(), sizeof(char), tags.size());
+
+  for (unsigned long iMarker = 0; iMarker < nMarker_Global; iMarker++) {
+    tags[(iMarker + 1) * MAX_STRING_SIZE - 1] = '\0';
+    Marker_Tags.emplace_back(&tags[iMarker * MAX_STRING_SIZE]);
+    config->SetMarker_All_TagBound(iMarker, Marker_Tags.back());
+    config->SetMarker_All_SendRecv(iMarker, NO);
+  }
+
+  readIndices(Local_Points, nLocal_Point);
+  readIndices(Local_Colors, nLocal_Point);
+
+  vector<passivedouble> coords(nLocal_Point * nDim);
+  read(coords.data(), sizeof(passivedouble), coords.size());
+  Local_Coords = new su2double[coords.size()];
+  for (unsigned long i = 0; i < coords.size(); i++) Local_Coords[i] = coords[i];
+
+  readIndices(Conn_Tria, nLocal_Tria * N_POINTS_TRIANGLE);
+  readIndices(Conn_Quad, nLocal_Quad * N_POINTS_QUADRILATERAL);
+  readIndices(Conn_Tetr, nLocal_Tetr * N_POINTS_TETRAHEDRON);
+  readIndices(Conn_Hexa, nLocal_Hexa * N_POINTS_HEXAHEDRON);
+  readIndices(Conn_Pris, nLocal_Pris * N_POINTS_PRISM);
+  readIndices(Conn_Pyra, nLocal_Pyra * N_POINTS_PYRAMID);
+
+  readIndices(ID_Tria, nLocal_Tria);
+  readIndices(ID_Quad, nLocal_Quad);
+  readIndices(ID_Tetr, nLocal_Tetr);
+  readIndices(ID_Hexa, nLocal_Hexa);
+  readIndices(ID_Pris, nLocal_Pris);
+  readIndices(ID_Pyra, nLocal_Pyra);
+
+  readIndices(Conn_Line, nLocal_Line * N_POINTS_LINE);
+  readIndices(Conn_BoundTria, nLocal_BoundTria * N_POINTS_TRIANGLE);
+  readIndices(Conn_BoundQuad, nLocal_BoundQuad * N_POINTS_QUADRILATERAL);
+
+  readIndices(ID_Line, nLocal_Line);
+  readIndices(ID_BoundTria, nLocal_BoundTria);
+  readIndices(ID_BoundQuad, nLocal_BoundQuad);
+
+  readIndices(Elem_ID_Line, nLocal_Line);
+  readIndices(Elem_ID_BoundTria, nLocal_BoundTria);
+  readIndices(Elem_ID_BoundQuad, nLocal_BoundQuad);
+
+  fclose(file);
+}
+
 CPhysicalGeometry::~CPhysicalGeometry() {
   delete[] Local_to_Global_Point;
 
@@ -450,6 +771,14 @@ void CPhysicalGeometry::SetGlobal_to_Local_Point() {
   }
 }
 
+vector<unsigned long> CPhysicalGeometry::GetGlobal_Domain_Points() const {
+  vector<unsigned long> globalPoints;
+  globalPoints.reserve(Global_to_Local_Point.size());
+  for (const auto& pair : Global_to_Local_Point) globalPoints.push_back(pair.first);
+  sort(globalPoints.begin(), globalPoints.end());
+  return globalPoints;
+}
+
 void CPhysicalGeometry::DistributeColoring(const CConfig* config, CGeometry* geometry) {
   /*--- To start, each linear partition carries the color only for the
    owned nodes (nPoint), but we have repeated elems on each linear partition.
@@ -3467,6 +3796,9 @@ void CPhysicalGeometry::Read_Mesh_FVM(CConfig* config, const string& val_mesh_fi
     case SU2:
       MeshFVM = new CSU2ASCIIMeshReaderFVM(config, val_iZone, val_nZone);
       break;
+    case SU2_BINARY:
+      MeshFVM = new CSU2BinaryMeshReaderFVM(config, val_iZone, val_nZone);
+      break;
     case CGNS_GRID:
       MeshFVM = new CCGNSMeshReaderFVM(config, val_iZone, val_nZone);
       break;
@@ -4535,6 +4867,66 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig* config) {
     Result.push_back(iPoint);
   }
 
+  RenumberPoints(config, Result);
+}
+
+void CPhysicalGeometry::SetSFC_Ordering(CConfig* config) {
+  /*--- The coordinates of the domain points are quantized on a uniform grid over their bounding box, with as many
+   * bits per direction as fit in the 64-bit index of the curve, and the points are sorted by that index. ---*/
+  const int nBits = 64 / nDim;
+  const passivedouble maxInt = std::ldexp(1.0, nBits) - 1;
+
+  passivedouble minCoord[MAXNDIM] = {0.0}, scale[MAXNDIM] = {0.0};
+  for (auto iDim = 0u; iDim < nDim; iDim++) {
+    passivedouble minX = std::numeric_limits<passivedouble>::max();
+    passivedouble maxX = std::numeric_limits<passivedouble>::lowest();
+    for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+      const passivedouble x = SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim));
+      minX = min(minX, x);
+      maxX = max(maxX, x);
+    }
+    minCoord[iDim] = minX;
+    scale[iDim] = (maxX > minX) ? maxInt / (maxX - minX) : 0.0;
+  }
+
+  const bool hilbert = config->GetKind_PointOrdering() == POINT_ORDERING::HILBERT;
+
+  vector<uint64_t> Index(nPointDomain);
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    uint32_t IntCoord[MAXNDIM] = {0};
+    for (auto iDim = 0u; iDim < nDim; iDim++) {
+      const passivedouble x = (SU2_TYPE::GetValue(nodes->GetCoord(iPoint, iDim)) - minCoord[iDim]) * scale[iDim];
+      IntCoord[iDim] = static_cast<uint32_t>(min(max(x, 0.0), maxInt));
+    }
+    Index[iPoint] = hilbert ? GeometryToolbox::HilbertIndex(nDim, nBits, IntCoord)
+                            : GeometryToolbox::MortonIndex(nDim, nBits, IntCoord);
+  }
+
+  /*--- Points with the same index (closer than the quantization) keep their relative order, the MPI points
+   * are kept at the end. ---*/
+  vector<unsigned long> Result(nPoint);
+  iota(Result.begin(), Result.end(), 0ul);
+  stable_sort(Result.begin(), Result.begin() + nPointDomain,
+              [&](unsigned long iPoint, unsigned long jPoint) { return Index[iPoint] < Index[jPoint]; });
+
+  RenumberPoints(config, Result);
+}
+
+void CPhysicalGeometry::SetPoint_Ordering(CConfig* config) {
+  switch (config->GetKind_PointOrdering()) {
+    case POINT_ORDERING::NONE:
+      break;
+    case POINT_ORDERING::RCM:
+      SetRCM_Ordering(config);
+      break;
+    case POINT_ORDERING::HILBERT:
+    case POINT_ORDERING::MORTON:
+      SetSFC_Ordering(config);
+      break;
+  }
+}
+
+void CPhysicalGeometry::RenumberPoints(const CConfig* config, const vector<unsigned long>& Result) {
   /*--- Reset old data structures ---*/
 
   nodes->ResetElems();
@@ -7759,6 +8151,24 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
     vwgt[iPoint] = wp + we * (xadj[iPoint + 1] - xadj[iPoint]);
   }
 
+  /*--- When rebalancing, the measured cost of each point replaces the static estimate. The weights are
+   * scaled to integers with an average of 1000 (less for very large grids so that their sum fits in idx_t). ---*/
+
+  if (partitionWeights.size() == nPoint) {
+    passivedouble localSum = 0.0, globalSum = 0.0;
+    for (const auto w : partitionWeights) localSum += w;
+    MPI_Allreduce(&localSum, &globalSum, 1, MPI_DOUBLE, MPI_SUM, comm);
+
+    const passivedouble average =
+        min(1000.0, 0.5 * passivedouble(numeric_limits<idx_t>::max()) / max<unsigned long>(Global_nPointDomain, 1));
+    const passivedouble scale = (globalSum > 0.0) ? average * Global_nPointDomain / globalSum : 0.0;
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      vwgt[iPoint] = max<idx_t>(1, static_cast<idx_t>(round(partitionWeights[iPoint] * scale)));
+    }
+    decltype(partitionWeights)().swap(partitionWeights);
+  }
+
   /*--- Create some structures that ParMETIS needs to output the partitioning. ---*/
 
   idx_t edgecut;
@@ -10485,7 +10895,7 @@ void CPhysicalGeometry::Compute_Nacelle(CConfig* config, bool original_surface,
   delete[] Twist;
 }
 
-std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CConfig* config) const {
+std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CConfig* config, bool globalTree) const {
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
   /*---         subelements of the local boundaries that must be taken     ---*/
@@ -10560,7 +10970,7 @@ std::unique_ptr<CADTElemClass> CPhysicalGeometry::ComputeViscousWallADT(const CC
   /*--------------------------------------------------------------------------*/
 
   std::unique_ptr<CADTElemClass> WallADT(
-      new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs, elemIDs, true));
+      new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem, markerIDs, elemIDs, globalTree));
 
   return WallADT;
 }
@@ -10604,5 +11014,221 @@ void CPhysicalGeometry::SetWallDistance(CADTElemClass* WallADT, const CConfig* c
   }
 }
 
+void CPhysicalGeometry::SetWallDistanceDistributed(CADTElemClass* WallADT, const CConfig* config, unsigned short iZone) {
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 1: Make the bounding boxes of the local viscous walls of all  ---*/
+  /*---         ranks available on all ranks. These are used to select the ---*/
+  /*---         ranks that may contain the nearest wall element of a point.---*/
+  /*--------------------------------------------------------------------------*/
+
+  const int nBoxCoor = 2 * nDim;
+  vector<su2double> localBox(nBoxCoor), allBoxes(size * nBoxCoor);
+  WallADT->GetBoundingBox(localBox.data(), localBox.data() + nDim);
+
+  SU2_MPI::Allgather(localBox.data(), nBoxCoor, MPI_DOUBLE, allBoxes.data(), nBoxCoor, MPI_DOUBLE,
+                     SU2_MPI::GetComm());
+
+  vector<int> wallRanks;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    if (allBoxes[iRank * nBoxCoor] <= allBoxes[iRank * nBoxCoor + nDim]) wallRanks.push_back(iRank);
+  }
+  if (wallRanks.empty()) return;
+
+  /*--- Squared distance from a point to the nearest (lower bound of the distance to the walls
+   of a rank) or to the farthest (upper bound) corner of the bounding box of a rank. ---*/
+
+  auto boxDist2 = [&](const su2double* coor, int iRank, bool farthest) {
+    const su2double* bbMin = allBoxes.data() + iRank * nBoxCoor;
+    const su2double* bbMax = bbMin + nDim;
+    su2double dist2 = 0.0;
+    for (unsigned short iDim = 0; iDim < nDim; ++iDim) {
+      su2double d = 0.0;
+      if (farthest)
+        d = max(fabs(coor[iDim] - bbMin[iDim]), fabs(coor[iDim] - bbMax[iDim]));
+      else
+        d = max(su2double(0.0), max(bbMin[iDim] - coor[iDim], coor[iDim] - bbMax[iDim]));
+      dist2 += d * d;
+    }
+    return dist2;
+  };
+
+  /*--- Send the coordinates of the points to the ranks they are assigned to, search the local ADT
+   of those ranks, and keep the results that are closer than the current wall distance. ---*/
+
+  vector<su2double> nearestDist(nPoint);
+  vector<int> nearestRank(nPoint, -1);
+  vector<unsigned short> nearestMarker(nPoint, 0);
+  vector<unsigned long> nearestElem(nPoint, 0);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) nearestDist[iPoint] = nodes->GetWall_Distance(iPoint);
+
+  auto searchRanks = [&](const vector<vector<unsigned long> >& pointsToRank) {
+    vector<int> sendCounts(size), recvCounts(size), sendDispl(size + 1, 0), recvDispl(size + 1, 0);
+    for (int iRank = 0; iRank < size; ++iRank) sendCounts[iRank] = pointsToRank[iRank].size();
+
+    SU2_MPI::Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      sendDispl[iRank + 1] = sendDispl[iRank] + sendCounts[iRank];
+      recvDispl[iRank + 1] = recvDispl[iRank] + recvCounts[iRank];
+    }
+    const unsigned long nSend = sendDispl[size], nRecv = recvDispl[size];
+
+    /*--- Counts and displacements for a number of entries per point. ---*/
+    auto scaled = [&](const vector<int>& vec, int factor) {
+      vector<int> res(vec.size());
+      for (size_t i = 0; i < vec.size(); ++i) res[i] = factor * vec[i];
+      return res;
+    };
+
+    vector<su2double> sendCoor(nSend * nDim), recvCoor(nRecv * nDim);
+    for (int iRank = 0; iRank < size; ++iRank) {
+      auto* coor = sendCoor.data() + sendDispl[iRank] * nDim;
+      for (const auto iPoint : pointsToRank[iRank]) {
+        for (unsigned short iDim = 0; iDim < nDim; ++iDim) *(coor++) = nodes->GetCoord(iPoint, iDim);
+      }
+    }
+
+    SU2_MPI::Alltoallv(sendCoor.data(), scaled(sendCounts, nDim).data(), scaled(sendDispl, nDim).data(), MPI_DOUBLE,
+                       recvCoor.data(), scaled(recvCounts, nDim).data(), scaled(recvDispl, nDim).data(), MPI_DOUBLE,
+                       SU2_MPI::GetComm());
+
+    /*--- Search the local ADT for the received points, the marker and element ID are returned together. ---*/
+
+    vector<su2double> recvDist(nRecv, numeric_limits<passivedouble>::max());
+    vector<unsigned long> recvIDs(2 * nRecv, 0);
+
+    if (!WallADT->IsEmpty()) {
+      SU2_OMP_PARALLEL {
+        SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+        for (unsigned long i = 0; i < nRecv; ++i) {
+          unsigned short markerID;
+          unsigned long elemID;
+          int rankID;
+          WallADT->DetermineNearestElement(recvCoor.data() + i * nDim, recvDist[i], markerID, elemID, rankID);
+          recvIDs[2 * i] = markerID;
+          recvIDs[2 * i + 1] = elemID;
+        }
+        END_SU2_OMP_FOR
+      }
+      END_SU2_OMP_PARALLEL
+    }
+
+    vector<su2double> sendDist(nSend);
+    vector<unsigned long> sendIDs(2 * nSend);
+
+    SU2_MPI::Alltoallv(recvDist.data(), recvCounts.data(), recvDispl.data(), MPI_DOUBLE, sendDist.data(),
+                       sendCounts.data(), sendDispl.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+
+    SU2_MPI::Alltoallv(recvIDs.data(), scaled(recvCounts, 2).data(), scaled(recvDispl, 2).data(), MPI_UNSIGNED_LONG,
+                       sendIDs.data(), scaled(sendCounts, 2).data(), scaled(sendDispl, 2).data(), MPI_UNSIGNED_LONG,
+                       SU2_MPI::GetComm());
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      for (unsigned long i = sendDispl[iRank]; i < static_cast<unsigned long>(sendDispl[iRank + 1]); ++i) {
+        const auto iPoint = pointsToRank[iRank][i - sendDispl[iRank]];
+        if (sendDist[i] < nearestDist[iPoint]) {
+          nearestDist[iPoint] = sendDist[i];
+          nearestRank[iPoint] = iRank;
+          nearestMarker[iPoint] = sendIDs[2 * i];
+          nearestElem[iPoint] = sendIDs[2 * i + 1];
+        }
+      }
+    }
+  };
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 2: Obtain an upper bound of the wall distance of each point   ---*/
+  /*---         from the rank with the nearest wall bounding box, ties     ---*/
+  /*---         (e.g. points inside several boxes) are broken by the       ---*/
+  /*---         farthest corner of the boxes.                              ---*/
+  /*--------------------------------------------------------------------------*/
+
+  vector<int> firstRank(nPoint);
+  vector<vector<unsigned long> > pointsToRank(size);
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    const su2double* coor = nodes->GetCoord(iPoint);
+    int bestRank = wallRanks[0];
+    su2double bestLower = numeric_limits<passivedouble>::max();
+    su2double bestUpper = bestLower;
+    for (const auto iRank : wallRanks) {
+      const su2double lower = boxDist2(coor, iRank, false);
+      if (lower > bestLower) continue;
+      const su2double upper = boxDist2(coor, iRank, true);
+      if (lower < bestLower || upper < bestUpper) {
+        bestLower = lower;
+        bestUpper = upper;
+        bestRank = iRank;
+      }
+    }
+    firstRank[iPoint] = bestRank;
+    pointsToRank[bestRank].push_back(iPoint);
+  }
+  searchRanks(pointsToRank);
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 3: Search the other ranks whose walls may be closer than the  ---*/
+  /*---         distance found so far, in order of increasing lower bound. ---*/
+  /*--------------------------------------------------------------------------*/
+
+  /*--- Candidate ranks of each point (CSR format) sorted by the lower bound of their distance. ---*/
+
+  vector<unsigned long> candidateStart(nPoint + 1, 0);
+  vector<pair<su2double, int> > candidates;
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    const su2double* coor = nodes->GetCoord(iPoint);
+    const su2double dist2 = pow(nearestDist[iPoint], 2);
+    const auto begin = candidates.size();
+    for (const auto iRank : wallRanks) {
+      if (iRank == firstRank[iPoint]) continue;
+      const su2double lower = boxDist2(coor, iRank, false);
+      if (lower < dist2) candidates.emplace_back(lower, iRank);
+    }
+    sort(candidates.begin() + begin, candidates.end());
+    candidateStart[iPoint + 1] = candidates.size();
+  }
+
+  /*--- Each round sends the points to their next candidates, the ones whose lower bound exceeds the
+   distance found in the previous rounds are pruned. The number of candidates per round doubles to
+   bound the number of rounds (each is a set of collective communications). ---*/
+
+  vector<unsigned long> nextCandidate(candidateStart.begin(), candidateStart.end() - 1);
+
+  for (unsigned long candidatesPerRound = 1;; candidatesPerRound *= 2) {
+    for (auto& points : pointsToRank) points.clear();
+    unsigned long nQuery = 0;
+
+    for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+      const su2double dist2 = pow(nearestDist[iPoint], 2);
+      auto& k = nextCandidate[iPoint];
+      for (unsigned long n = 0; n < candidatesPerRound && k < candidateStart[iPoint + 1]; ++n, ++k) {
+        if (candidates[k].first >= dist2) {
+          k = candidateStart[iPoint + 1];
+          break;
+        }
+        pointsToRank[candidates[k].second].push_back(iPoint);
+        ++nQuery;
+      }
+    }
+
+    unsigned long nQueryGlobal = 0;
+    SU2_MPI::Allreduce(&nQuery, &nQueryGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    if (nQueryGlobal == 0) break;
+
+    searchRanks(pointsToRank);
+  }
+
+  /*--- Store the wall distance of the points for which a closer wall element was found. ---*/
+
+  for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
+    if (nearestRank[iPoint] >= 0) {
+      nodes->SetWall_Distance(iPoint, nearestDist[iPoint], nearestRank[iPoint], iZone, nearestMarker[iPoint],
+                              nearestElem[iPoint]);
+    }
+  }
+}
+
 #undef CPHYSGEO_PARFOR
 #undef END_CPHYSGEO_PARFOR
@@ -26,242 +26,171 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "../../../include/toolboxes/CLinearPartitioner.hpp"
 #include "../../../include/geometry/meshreader/CBoxMeshReaderFVM.hpp"
 
 CBoxMeshReaderFVM::CBoxMeshReaderFVM(CConfig* val_config, unsigned short val_iZone, unsigned short val_nZone)
-    : CMeshReaderFVM(val_config, val_iZone, val_nZone) {
-  /* The box mesh is always 3D. */
-  dimension = 3;
-
-  /* Set the VTK type for the interior elements and the boundary elements. */
-  KindElem = HEXAHEDRON;
-  KindBound = QUADRILATERAL;
-
-  /* The number of nodes in the i and j directions. */
-  nNode = config->GetMeshBoxSize(0);
-  mNode = config->GetMeshBoxSize(1);
-  pNode = config->GetMeshBoxSize(2);
-
-  /* Lengths for non-square domains. */
-  Lx = config->GetMeshBoxLength(0);
-  Ly = config->GetMeshBoxLength(1);
-  Lz = config->GetMeshBoxLength(2);
-
-  /* Offsets in x and y directions from 0.0. */
-  Ox = config->GetMeshBoxOffset(0);
-  Oy = config->GetMeshBoxOffset(1);
-  Oz = config->GetMeshBoxOffset(2);
-
+    : CStructuredMeshReaderFVM(val_config, val_iZone, val_nZone, 3) {
   /* Compute and store the points, interior elements, and surface elements.
    In these routines, we use a simple analytic formula to compute the
    coordinates and the node numbering. We store only the points and interior
    elements on our rank's linear partition, but the master stores the entire
    set of surface connectivity. */
-  ComputeBoxPointCoordinates();
+  ComputePointCoordinates();
   ComputeBoxVolumeConnectivity();
   ComputeBoxSurfaceConnectivity();
 }
 
 CBoxMeshReaderFVM::~CBoxMeshReaderFVM() = default;
 
-void CBoxMeshReaderFVM::ComputeBoxPointCoordinates() {
-  /* Set the global count of points based on the grid dimensions. */
-  numberOfGlobalPoints = (nNode) * (mNode) * (pNode);
-
-  /* Get a partitioner to help with linear partitioning. */
-  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
-
-  /* Determine number of local points */
-  for (unsigned long globalIndex = 0; globalIndex < numberOfGlobalPoints; globalIndex++) {
-    if ((int)pointPartitioner.GetRankContainingIndex(globalIndex) == rank) {
-      numberOfLocalPoints++;
-    }
-  }
-
-  /* Loop over our analytically defined of coordinates and store only
-   those that contain a node within our linear partition of points. */
-  localPointCoordinates.resize(dimension);
-  for (int k = 0; k < dimension; k++) localPointCoordinates[k].reserve(numberOfLocalPoints);
-
-  unsigned long globalIndex = 0;
-  for (unsigned long kNode = 0; kNode < pNode; kNode++) {
-    for (unsigned long jNode = 0; jNode < mNode; jNode++) {
-      for (unsigned long iNode = 0; iNode < nNode; iNode++) {
-        if ((int)pointPartitioner.GetRankContainingIndex(globalIndex) == rank) {
-          /* Store the coordinates more clearly. */
-          const passivedouble x = SU2_TYPE::GetValue(Lx * ((su2double)iNode) / ((su2double)(nNode - 1)) + Ox);
-          const passivedouble y = SU2_TYPE::GetValue(Ly * ((su2double)jNode) / ((su2double)(mNode - 1)) + Oy);
-          const passivedouble z = SU2_TYPE::GetValue(Lz * ((su2double)kNode) / ((su2double)(pNode - 1)) + Oz);
-
-          /* Load into the coordinate class data structure. */
-          localPointCoordinates[0].push_back(x);
-          localPointCoordinates[1].push_back(y);
-          localPointCoordinates[2].push_back(z);
-        }
-        globalIndex++;
-      }
-    }
+unsigned short CBoxMeshReaderFVM::GetElementsPerCell(unsigned long kCell) const {
+  switch (kindElements) {
+    case MESH_BOX_ELEMENTS::HEXAHEDRA:
+      return 1;
+    case MESH_BOX_ELEMENTS::PRISMS:
+      return 2;
+    case MESH_BOX_ELEMENTS::TETRAHEDRA:
+      return 6;
+    case MESH_BOX_ELEMENTS::MIXED:
+      return IsWallLayer(kCell, pNode - 1) ? 2 : 6;
   }
+  return 1;
 }
 
 void CBoxMeshReaderFVM::ComputeBoxVolumeConnectivity() {
-  /* Set the global count of elements based on the grid dimensions. */
-  numberOfGlobalElements = (nNode - 1) * (mNode - 1) * (pNode - 1);
+  /* Local nodes of the hexahedron of each element obtained by splitting it. Prisms share the
+   diagonal 0-2 (4-6), tetrahedra are the 6 paths from node 0 to node 6 along the edges. */
+  const unsigned short prisms[2][N_POINTS_PRISM] = {{0, 2, 1, 4, 6, 5}, {0, 3, 2, 4, 7, 6}};
+  const unsigned short tetras[6][N_POINTS_TETRAHEDRON] = {{0, 1, 2, 6}, {0, 3, 7, 6}, {0, 4, 5, 6},
+                                                          {0, 5, 1, 6}, {0, 2, 3, 6}, {0, 7, 4, 6}};
+
+  /* Set the global count of elements based on the grid dimensions, the
+   elements are numbered by layers of cells in the z-direction. */
+  const unsigned long nCellsPerLayer = (nNode - 1) * (mNode - 1);
+  vector<unsigned long> layerOffset(pNode, 0);
+  for (unsigned long kNode = 0; kNode < pNode - 1; kNode++)
+    layerOffset[kNode + 1] = layerOffset[kNode] + nCellsPerLayer * GetElementsPerCell(kNode);
+  numberOfGlobalElements = layerOffset[pNode - 1];
+
+  /* A cell is identified by its lowest node, whose index is at most nNode*mNode + nNode + 1 lower
+   than that of the other nodes. Therefore only the cells in that range below our linear partition
+   of points can contain a local node, and we do not need to visit the entire grid. */
+  const unsigned long nPlane = nNode * mNode;
+  const unsigned long reach = nPlane + nNode + 1;
+  const auto firstCell = firstLocalPoint > reach ? firstLocalPoint - reach : 0ul;
+  const auto lastCell = firstLocalPoint + numberOfLocalPoints;
 
-  /* Get a partitioner to help with linear partitioning. */
-  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
-
-  /* Loop over our analytically defined of elements and store only those
-   that contain a node within our linear partition of points. */
   numberOfLocalElements = 0;
-  vector<unsigned long> connectivity(N_POINTS_HEXAHEDRON, 0);
-  unsigned long globalIndex = 0;
-  for (unsigned long kNode = 0; kNode < pNode - 1; kNode++) {
-    for (unsigned long jNode = 0; jNode < mNode - 1; jNode++) {
-      for (unsigned long iNode = 0; iNode < nNode - 1; iNode++) {
-        /* Compute connectivity based on the i,j,k index. */
-        connectivity[0] = kNode * mNode * nNode + jNode * nNode + iNode;
-        connectivity[1] = kNode * mNode * nNode + jNode * nNode + iNode + 1;
-        connectivity[2] = kNode * mNode * nNode + (jNode + 1) * nNode + (iNode + 1);
-        connectivity[3] = kNode * mNode * nNode + (jNode + 1) * nNode + iNode;
-        connectivity[4] = (kNode + 1) * mNode * nNode + jNode * nNode + iNode;
-        connectivity[5] = (kNode + 1) * mNode * nNode + jNode * nNode + iNode + 1;
-        connectivity[6] = (kNode + 1) * mNode * nNode + (jNode + 1) * nNode + (iNode + 1);
-        connectivity[7] = (kNode + 1) * mNode * nNode + (jNode + 1) * nNode + iNode;
-
-        /* Check whether any of the points is in our linear partition. */
-        bool isOwned = false;
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-          if ((int)pointPartitioner.GetRankContainingIndex(connectivity[i]) == rank) {
-            isOwned = true;
-          }
-        }
-
-        /* If so, we need to store the element locally. */
-        if (isOwned) {
-          localVolumeElementConnectivity.push_back(globalIndex);
-          localVolumeElementConnectivity.push_back(KindElem);
-          for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++) {
-            localVolumeElementConnectivity.push_back(connectivity[i]);
-          }
-          numberOfLocalElements++;
-        }
-        globalIndex++;
+  unsigned long hexa[N_POINTS_HEXAHEDRON], connectivity[N_POINTS_HEXAHEDRON];
+
+  for (auto base = firstCell; base < lastCell; base++) {
+    const auto iNode = base % nNode;
+    const auto jNode = (base / nNode) % mNode;
+    const auto kNode = base / nPlane;
+    if (iNode == nNode - 1 || jNode == mNode - 1 || kNode == pNode - 1) continue;
+
+    /* Compute connectivity based on the i,j,k index. */
+    hexa[0] = base;
+    hexa[1] = base + 1;
+    hexa[2] = base + nNode + 1;
+    hexa[3] = base + nNode;
+    for (unsigned short i = 0; i < 4; i++) hexa[i + 4] = hexa[i] + nPlane;
+
+    /* The elements of a cell check individually whether they contain a local node. */
+    const auto nElem = GetElementsPerCell(kNode);
+    const auto globalIndex = layerOffset[kNode] + (jNode * (nNode - 1) + iNode) * nElem;
+
+    for (unsigned short iElem = 0; iElem < nElem; iElem++) {
+      switch (nElem) {
+        case 1:
+          AddVolumeElement(globalIndex, HEXAHEDRON, N_POINTS_HEXAHEDRON, hexa);
+          break;
+        case 2:
+          for (unsigned short i = 0; i < N_POINTS_PRISM; i++) connectivity[i] = hexa[prisms[iElem][i]];
+          AddVolumeElement(globalIndex + iElem, PRISM, N_POINTS_PRISM, connectivity);
+          break;
+        default:
+          for (unsigned short i = 0; i < N_POINTS_TETRAHEDRON; i++) connectivity[i] = hexa[tetras[iElem][i]];
+          AddVolumeElement(globalIndex + iElem, TETRAHEDRON, N_POINTS_TETRAHEDRON, connectivity);
+          break;
       }
     }
   }
 }
 
 void CBoxMeshReaderFVM::ComputeBoxSurfaceConnectivity() {
-  /* The rectangle alays has 4 markers. */
+  /* The box always has 6 markers. */
   numberOfMarkers = 6;
   surfaceElementConnectivity.resize(numberOfMarkers);
-  markerNames.resize(numberOfMarkers);
+  markerNames = {"x_minus", "x_plus", "y_minus", "y_plus", "z_minus", "z_plus"};
 
-  vector<unsigned long> connectivity(N_POINTS_HEXAHEDRON, 0);
+  if (rank != MASTER_NODE) return;
 
-  /* Compute and store the 6 sets of connectivity. */
+  /* Faces normal to x and y are split when the cells of the layer are tetrahedra,
+   faces normal to z when they are not hexahedra. */
+  auto isTetraLayer = [&](unsigned long kNode) { return GetElementsPerCell(kNode) == 6; };
 
-  markerNames[0] = "x_minus";
-  if (rank == MASTER_NODE) {
-    for (unsigned long kNode = 0; kNode < pNode - 1; kNode++) {
-      for (unsigned long jNode = 0; jNode < mNode - 1; jNode++) {
-        connectivity[0] = kNode * mNode * nNode + jNode * nNode;
-        connectivity[1] = (kNode + 1) * mNode * nNode + jNode * nNode;
-        connectivity[2] = (kNode + 1) * mNode * nNode + (jNode + 1) * nNode;
-        connectivity[3] = kNode * mNode * nNode + (jNode + 1) * nNode;
+  unsigned long connectivity[N_POINTS_QUADRILATERAL];
+  const unsigned long nPlane = nNode * mNode;
 
-        surfaceElementConnectivity[0].push_back(0);
-        surfaceElementConnectivity[0].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-          surfaceElementConnectivity[0].push_back(connectivity[i]);
-      }
+  /* Compute and store the 6 sets of connectivity. */
+
+  for (unsigned long kNode = 0; kNode < pNode - 1; kNode++) {
+    for (unsigned long jNode = 0; jNode < mNode - 1; jNode++) {
+      connectivity[0] = kNode * nPlane + jNode * nNode;
+      connectivity[1] = (kNode + 1) * nPlane + jNode * nNode;
+      connectivity[2] = (kNode + 1) * nPlane + (jNode + 1) * nNode;
+      connectivity[3] = kNode * nPlane + (jNode + 1) * nNode;
+      AddSurfaceQuadrilateral(0, connectivity, isTetraLayer(kNode));
     }
   }
 
-  markerNames[1] = "x_plus";
-  if (rank == MASTER_NODE) {
-    for (unsigned long kNode = 0; kNode < pNode - 1; kNode++) {
-      for (unsigned long jNode = 0; jNode < mNode - 1; jNode++) {
-        connectivity[0] = kNode * mNode * nNode + jNode * nNode + (nNode - 1);
-        connectivity[1] = kNode * mNode * nNode + (jNode + 1) * nNode + (nNode - 1);
-        connectivity[2] = (kNode + 1) * mNode * nNode + (jNode + 1) * nNode + (nNode - 1);
-        connectivity[3] = (kNode + 1) * mNode * nNode + jNode * nNode + (nNode - 1);
-
-        surfaceElementConnectivity[1].push_back(0);
-        surfaceElementConnectivity[1].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-          surfaceElementConnectivity[1].push_back(connectivity[i]);
-      }
+  for (unsigned long kNode = 0; kNode < pNode - 1; kNode++) {
+    for (unsigned long jNode = 0; jNode < mNode - 1; jNode++) {
+      connectivity[0] = kNode * nPlane + jNode * nNode + (nNode - 1);
+      connectivity[1] = kNode * nPlane + (jNode + 1) * nNode + (nNode - 1);
+      connectivity[2] = (kNode + 1) * nPlane + (jNode + 1) * nNode + (nNode - 1);
+      connectivity[3] = (kNode + 1) * nPlane + jNode * nNode + (nNode - 1);
+      AddSurfaceQuadrilateral(1, connectivity, isTetraLayer(kNode));
     }
   }
 
-  markerNames[2] = "y_minus";
-  if (rank == MASTER_NODE) {
-    for (unsigned long kNode = 0; kNode < pNode - 1; kNode++) {
-      for (unsigned long iNode = 0; iNode < nNode - 1; iNode++) {
-        connectivity[0] = kNode * mNode * nNode + iNode;
-        connectivity[1] = kNode * mNode * nNode + iNode + 1;
-        connectivity[2] = (kNode + 1) * mNode * nNode + iNode + 1;
-        connectivity[3] = (kNode + 1) * mNode * nNode + iNode;
-
-        surfaceElementConnectivity[2].push_back(0);
-        surfaceElementConnectivity[2].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-          surfaceElementConnectivity[2].push_back(connectivity[i]);
-      }
+  for (unsigned long kNode = 0; kNode < pNode - 1; kNode++) {
+    for (unsigned long iNode = 0; iNode < nNode - 1; iNode++) {
+      connectivity[0] = kNode * nPlane + iNode;
+      connectivity[1] = kNode * nPlane + iNode + 1;
+      connectivity[2] = (kNode + 1) * nPlane + iNode + 1;
+      connectivity[3] = (kNode + 1) * nPlane + iNode;
+      AddSurfaceQuadrilateral(2, connectivity, isTetraLayer(kNode));
     }
   }
 
-  markerNames[3] = "y_plus";
-  if (rank == MASTER_NODE) {
-    for (unsigned long kNode = 0; kNode < pNode - 1; kNode++) {
-      for (unsigned long iNode = 0; iNode < nNode - 1; iNode++) {
-        connectivity[0] = kNode * mNode * nNode + (mNode - 1) * nNode + iNode;
-        connectivity[1] = kNode * mNode * nNode + (mNode - 1) * nNode + iNode + 1;
-        connectivity[2] = (kNode + 1) * mNode * nNode + (mNode - 1) * nNode + iNode + 1;
-        connectivity[3] = (kNode + 1) * mNode * nNode + (mNode - 1) * nNode + iNode;
-
-        surfaceElementConnectivity[3].push_back(0);
-        surfaceElementConnectivity[3].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-          surfaceElementConnectivity[3].push_back(connectivity[i]);
-      }
+  for (unsigned long kNode = 0; kNode < pNode - 1; kNode++) {
+    for (unsigned long iNode = 0; iNode < nNode - 1; iNode++) {
+      connectivity[0] = kNode * nPlane + (mNode - 1) * nNode + iNode;
+      connectivity[1] = kNode * nPlane + (mNode - 1) * nNode + iNode + 1;
+      connectivity[2] = (kNode + 1) * nPlane + (mNode - 1) * nNode + iNode + 1;
+      connectivity[3] = (kNode + 1) * nPlane + (mNode - 1) * nNode + iNode;
+      AddSurfaceQuadrilateral(3, connectivity, isTetraLayer(kNode));
     }
   }
 
-  markerNames[4] = "z_minus";
-  if (rank == MASTER_NODE) {
-    for (unsigned long jNode = 0; jNode < mNode - 1; jNode++) {
-      for (unsigned long iNode = 0; iNode < nNode - 1; iNode++) {
-        connectivity[0] = jNode * nNode + iNode;
-        connectivity[1] = jNode * nNode + iNode + 1;
-        connectivity[2] = (jNode + 1) * nNode + (iNode + 1);
-        connectivity[3] = (jNode + 1) * nNode + iNode;
-
-        surfaceElementConnectivity[4].push_back(0);
-        surfaceElementConnectivity[4].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-          surfaceElementConnectivity[4].push_back(connectivity[i]);
-      }
+  for (unsigned long jNode = 0; jNode < mNode - 1; jNode++) {
+    for (unsigned long iNode = 0; iNode < nNode - 1; iNode++) {
+      connectivity[0] = jNode * nNode + iNode;
+      connectivity[1] = jNode * nNode + iNode + 1;
+      connectivity[2] = (jNode + 1) * nNode + (iNode + 1);
+      connectivity[3] = (jNode + 1) * nNode + iNode;
+      AddSurfaceQuadrilateral(4, connectivity, GetElementsPerCell(0) != 1);
     }
   }
 
-  markerNames[5] = "z_plus";
-  if (rank == MASTER_NODE) {
-    for (unsigned long jNode = 0; jNode < mNode - 1; jNode++) {
-      for (unsigned long iNode = 0; iNode < nNode - 1; iNode++) {
-        connectivity[0] = (pNode - 1) * mNode * nNode + jNode * nNode + iNode;
-        connectivity[1] = (pNode - 1) * mNode * nNode + jNode * nNode + iNode + 1;
-        connectivity[2] = (pNode - 1) * mNode * nNode + (jNode + 1) * nNode + (iNode + 1);
-        connectivity[3] = (pNode - 1) * mNode * nNode + (jNode + 1) * nNode + iNode;
-
-        surfaceElementConnectivity[5].push_back(0);
-        surfaceElementConnectivity[5].push_back(KindBound);
-        for (unsigned short i = 0; i < N_POINTS_HEXAHEDRON; i++)
-          surfaceElementConnectivity[5].push_back(connectivity[i]);
-      }
+  for (unsigned long jNode = 0; jNode < mNode - 1; jNode++) {
+    for (unsigned long iNode = 0; iNode < nNode - 1; iNode++) {
+      connectivity[0] = (pNode - 1) * nPlane + jNode * nNode + iNode;
+      connectivity[1] = (pNode - 1) * nPlane + jNode * nNode + iNode + 1;
+      connectivity[2] = (pNode - 1) * nPlane + (jNode + 1) * nNode + (iNode + 1);
+      connectivity[3] = (pNode - 1) * nPlane + (jNode + 1) * nNode + iNode;
+      AddSurfaceQuadrilateral(5, connectivity, GetElementsPerCell(pNode - 2) != 1);
     }
   }
 }
@@ -0,0 +1,342 @@
+/*!
+ * \file CSU2BinaryMeshReaderFVM.cpp
+ * \brief Reads a native SU2 binary grid into linear partitions for the
+ *        finite volume solver (FVM).
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
+
+constexpr unsigned long CSU2BinaryMeshReaderFVM::HeaderSize;
+constexpr unsigned long CSU2BinaryMeshReaderFVM::VolumeElemSize;
+constexpr unsigned long CSU2BinaryMeshReaderFVM::SurfaceElemSize;
+
+CSU2BinaryMeshReaderFVM::CSU2BinaryMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone,
+                                                 unsigned short val_nZone)
+    : CMeshReaderFVM(val_config, val_iZone, val_nZone), meshFilename(config->GetMesh_FileName()) {
+  if (val_nZone > 1 && config->GetMultizone_Mesh()) {
+    SU2_MPI::Error(
+        "SU2 binary mesh files contain a single zone.\n"
+        "Use MULTIZONE_MESH= NO and one mesh file per zone.",
+        CURRENT_FUNCTION);
+  }
+
+  /*--- All ranks open the file, the header and markers are read by the master,
+   and each rank reads its own linear partition of the points and elements. ---*/
+
+#ifdef HAVE_MPI
+  const int ierr =
+      MPI_File_open(SU2_MPI::GetComm(), meshFilename.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL, &fileHandle);
+  const bool fail = (ierr != MPI_SUCCESS);
+#else
+  fileHandle = fopen(meshFilename.c_str(), "rb");
+  const bool fail = (fileHandle == nullptr);
+#endif
+  if (fail) {
+    SU2_MPI::Error("Error opening SU2 binary grid " + meshFilename + ".\nCheck that the file exists.",
+                   CURRENT_FUNCTION);
+  }
+
+  ReadMetadata();
+
+  ReadPointCoordinates();
+
+  ReadVolumeElementConnectivity();
+
+  ReadSurfaceElementConnectivity();
+
+#ifdef HAVE_MPI
+  MPI_File_close(&fileHandle);
+#else
+  fclose(fileHandle);
+#endif
+}
+
+void CSU2BinaryMeshReaderFVM::ReadBytes(unsigned long offset, unsigned long sizeInBytes, void* data,
+                                        bool collective) const {
+  auto buffer = static_cast<char*>(data);
+
+#ifdef HAVE_MPI
+  /*--- MPI counts are int, therefore large ranges are read in chunks. The
+   collective version needs all ranks to make the same number of calls. ---*/
+
+  constexpr unsigned long maxChunk = 1ul << 30;
+  unsigned long nChunks = (sizeInBytes + maxChunk - 1) / maxChunk;
+  if (collective) {
+    const auto myChunks = nChunks;
+    SU2_MPI::Allreduce(&myChunks, &nChunks, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+  }
+
+  int ierr = MPI_SUCCESS;
+  for (unsigned long iChunk = 0; iChunk < nChunks; ++iChunk) {
+    const auto begin = min(iChunk * maxChunk, sizeInBytes);
+    const auto count = static_cast<int>(min(sizeInBytes - begin, maxChunk));
+    const auto position = static_cast<MPI_Offset>(offset + begin);
+    if (collective) {
+      ierr |= MPI_File_read_at_all(fileHandle, position, buffer + begin, count, MPI_BYTE, MPI_STATUS_IGNORE);
+    } else {
+      ierr |= MPI_File_read_at(fileHandle, position, buffer + begin, count, MPI_BYTE, MPI_STATUS_IGNORE);
+    }
+  }
+  const bool fail = (ierr != MPI_SUCCESS);
+#else
+  const bool fail = (fseek(fileHandle, offset, SEEK_SET) != 0) ||
+                    (fread(buffer, sizeof(char), sizeInBytes, fileHandle) != sizeInBytes);
+#endif
+  if (fail) {
+    SU2_MPI::Error("Error reading SU2 binary grid " + meshFilename + ".", CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadMetadata() {
+  /*--- The master reads the header and the size of the file. ---*/
+
+  unsigned long header[HeaderSize] = {0};
+  unsigned long fileSize = 0;
+
+  if (rank == MASTER_NODE) {
+#ifdef HAVE_MPI
+    MPI_Offset sizeInBytes = 0;
+    MPI_File_get_size(fileHandle, &sizeInBytes);
+    fileSize = sizeInBytes;
+#else
+    fseek(fileHandle, 0, SEEK_END);
+    fileSize = ftell(fileHandle);
+#endif
+    if (fileSize >= sizeof(header)) ReadBytes(0, sizeof(header), header, false);
+  }
+  SU2_MPI::Bcast(header, HeaderSize, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+  SU2_MPI::Bcast(&fileSize, 1, MPI_UNSIGNED_LONG, MASTER_NODE, SU2_MPI::GetComm());
+
+  /*--- Check that this is an SU2 binary mesh file written with the same byte order. ---*/
+
+  if (header[0] != static_cast<unsigned long>(SU2_MESH_BINARY_MAGIC)) {
+    SU2_MPI::Error("File " + meshFilename +
+                       " is not a native SU2 binary mesh file.\n"
+                       "Note that the binary format uses the byte order of the machine where it was written.",
+                   CURRENT_FUNCTION);
+  }
+
+  dimension = header[1];
+  numberOfGlobalPoints = header[2];
+  numberOfGlobalElements = header[3];
+  numberOfMarkers = header[4];
+  numberOfSurfaceElements = header[5];
+
+  if (dimension != 2 && dimension != 3) {
+    SU2_MPI::Error("Invalid dimension in SU2 binary grid " + meshFilename + ".", CURRENT_FUNCTION);
+  }
+
+  /*--- Catch truncated files before any rank attempts to read its partition. ---*/
+
+  const unsigned long expectedSize =
+      HeaderSize * sizeof(unsigned long) + numberOfGlobalPoints * dimension * sizeof(passivedouble) +
+      numberOfGlobalElements * VolumeElemSize * sizeof(unsigned long) + numberOfMarkers * CGNS_STRING_SIZE +
+      numberOfMarkers * sizeof(unsigned long) + numberOfSurfaceElements * SurfaceElemSize * sizeof(unsigned long);
+
+  if (fileSize != expectedSize) {
+    SU2_MPI::Error("The size of SU2 binary grid " + meshFilename + " does not match its header.", CURRENT_FUNCTION);
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadPointCoordinates() {
+  /* Get a partitioner to help with linear partitioning. */
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+
+  /* Determine number of local points */
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+
+  /*--- The coordinates are stored point by point, read our range in one go. ---*/
+
+  vector<passivedouble> coords(numberOfLocalPoints * dimension);
+
+  const unsigned long bytesPerPoint = dimension * sizeof(passivedouble);
+  const unsigned long offset =
+      HeaderSize * sizeof(unsigned long) + pointPartitioner.GetCumulativeSizeBeforeRank(rank) * bytesPerPoint;
+
+  ReadBytes(offset, numberOfLocalPoints * bytesPerPoint, coords.data(), true);
+
+  /*--- Load into the data structure, which is stored by dimension. ---*/
+
+  localPointCoordinates.resize(dimension);
+  for (unsigned short iDim = 0; iDim < dimension; iDim++) {
+    localPointCoordinates[iDim].resize(numberOfLocalPoints);
+    for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++) {
+      localPointCoordinates[iDim][iPoint] = coords[iPoint * dimension + iDim];
+    }
+  }
+}
+
+void CSU2BinaryMeshReaderFVM::ReadVolumeElementConnectivity() {
+  /*--- Each rank reads a linear partition of the elements. ---*/
+
+  CLinearPartitioner elemPartitioner(numberOfGlobalElements, 0);
+  const auto firstElem = elemPartitioner.GetCumulativeSizeBeforeRank(rank);
+  const auto nElemRead = elemPartitioner.GetSizeOnRank(rank);
+
+  vector<unsigned long> connFile(nElemRead * VolumeElemSize);
+
+  const unsigned long offset = HeaderSize * sizeof(unsigned long) +
+                               numberOfGlobalPoints * dimension * sizeof(passivedouble) +
+                               firstElem * VolumeElemSize * sizeof(unsigned long);
+
+  ReadBytes(offset, connFile.size() * sizeof(unsigned long), connFile.data(), true);
+
+  /*--- The elements need to be stored on all ranks that own at least one of their
+   points (as for the other readers). Determine the destinations of each element. ---*/
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+
+  vector<int> nElemSend(size, 0);
+  vector<vector<int> > destinations(nElemRead);
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    const auto* conn = &connFile[iElem * VolumeElemSize];
+
+    unsigned short nPointsElem = 0;
+    switch (conn[0]) {
+      case TRIANGLE:
+      case QUADRILATERAL:
+      case TETRAHEDRON:
+      case HEXAHEDRON:
+      case PRISM:
+      case PYRAMID:
+        nPointsElem = nPointsOfElementType(conn[0]);
+        break;
+      default:
+        SU2_MPI::Error("Invalid volume element type in SU2 binary grid " + meshFilename + ".", CURRENT_FUNCTION);
+        break;
+    }
+
+    auto& dest = destinations[iElem];
+    for (unsigned short iNode = 0; iNode < nPointsElem; iNode++) {
+      const int iRank = pointPartitioner.GetRankContainingIndex(conn[1 + iNode]);
+      if (find(dest.begin(), dest.end(), iRank) == dest.end()) {
+        dest.push_back(iRank);
+        nElemSend[iRank]++;
+      }
+    }
+  }
+
+  /*--- Put the elements in the standard format [globalID vtkType n0 ... n7] and
+   load the send buffer, which is ordered by destination rank. ---*/
+
+  vector<int> sendCounts(size), sendDispls(size + 1, 0);
+  for (int iRank = 0; iRank < size; iRank++) {
+    sendCounts[iRank] = nElemSend[iRank] * SU2_CONN_SIZE;
+    sendDispls[iRank + 1] = sendDispls[iRank] + sendCounts[iRank];
+  }
+
+  vector<unsigned long> connSend(sendDispls[size]);
+  vector<int> position(sendDispls.begin(), sendDispls.end() - 1);
+
+  for (unsigned long iElem = 0; iElem < nElemRead; iElem++) {
+    for (const auto iRank : destinations[iElem]) {
+      auto* conn = &connSend[position[iRank]];
+      conn[0] = firstElem + iElem;
+      for (unsigned long i = 0; i < VolumeElemSize; i++) conn[1 + i] = connFile[iElem * VolumeElemSize + i];
+      position[iRank] += SU2_CONN_SIZE;
+    }
+  }
+
+  vector<unsigned long>().swap(connFile);
+  vector<vector<int> >().swap(destinations);
+
+  /*--- Exchange the elements. ---*/
+
+  vector<int> recvCounts(size), recvDispls(size + 1, 0);
+  SU2_MPI::Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  for (int iRank = 0; iRank < size; iRank++) recvDispls[iRank + 1] = recvDispls[iRank] + recvCounts[iRank];
+
+  localVolumeElementConnectivity.resize(recvDispls[size]);
+
+  SU2_MPI::Alltoallv(connSend.data(), sendCounts.data(), sendDispls.data(), MPI_UNSIGNED_LONG,
+                     localVolumeElementConnectivity.data(), recvCounts.data(), recvDispls.data(), MPI_UNSIGNED_LONG,
+                     SU2_MPI::GetComm());
+
+  numberOfLocalElements = localVolumeElementConnectivity.size() / SU2_CONN_SIZE;
+}
+
+void CSU2BinaryMeshReaderFVM::ReadSurfaceElementConnectivity() {
+  /*--- The master reads the names and sizes of the markers, and shares the names. ---*/
+
+  vector<char> names(numberOfMarkers * CGNS_STRING_SIZE, '\0');
+  vector<unsigned long> nElemMarker(numberOfMarkers, 0);
+
+  const unsigned long offset = HeaderSize * sizeof(unsigned long) +
+                               numberOfGlobalPoints * dimension * sizeof(passivedouble) +
+                               numberOfGlobalElements * VolumeElemSize * sizeof(unsigned long);
+
+  if (rank == MASTER_NODE) {
+    ReadBytes(offset, names.size(), names.data(), false);
+    ReadBytes(offset + names.size(), numberOfMarkers * sizeof(unsigned long), nElemMarker.data(), false);
+  }
+  SU2_MPI::Bcast(names.data(), names.size(), MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+
+  markerNames.resize(numberOfMarkers);
+  surfaceElementConnectivity.resize(numberOfMarkers);
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+    names[(iMarker + 1) * CGNS_STRING_SIZE - 1] = '\0';
+    markerNames[iMarker] = string(&names[iMarker * CGNS_STRING_SIZE]);
+  }
+
+  /*--- Only the master stores the surface connectivity. ---*/
+
+  if (rank != MASTER_NODE) return;
+
+  unsigned long nElemTotal = 0;
+  for (auto nElem : nElemMarker) nElemTotal += nElem;
+
+  if (nElemTotal != numberOfSurfaceElements) {
+    SU2_MPI::Error("The markers of SU2 binary grid " + meshFilename + " do not match its header.", CURRENT_FUNCTION);
+  }
+
+  vector<unsigned long> connFile(numberOfSurfaceElements * SurfaceElemSize);
+  ReadBytes(offset + names.size() + numberOfMarkers * sizeof(unsigned long), connFile.size() * sizeof(unsigned long),
+            connFile.data(), false);
+
+  const auto* conn = connFile.data();
+
+  for (unsigned long iMarker = 0; iMarker < numberOfMarkers; iMarker++) {
+    auto& connMarker = surfaceElementConnectivity[iMarker];
+    connMarker.resize(nElemMarker[iMarker] * SU2_CONN_SIZE, 0);
+
+    for (unsigned long iElem = 0; iElem < nElemMarker[iMarker]; iElem++, conn += SurfaceElemSize) {
+      const auto VTK_Type = conn[0];
+
+      if ((VTK_Type != LINE && VTK_Type != TRIANGLE && VTK_Type != QUADRILATERAL) ||
+          (dimension == 3 && VTK_Type == LINE)) {
+        SU2_MPI::Error("Invalid surface element type in marker " + markerNames[iMarker] + " of SU2 binary grid.",
+                       CURRENT_FUNCTION);
+      }
+
+      connMarker[iElem * SU2_CONN_SIZE + 1] = VTK_Type;
+      for (unsigned short i = 0; i < N_POINTS_QUADRILATERAL; i++) {
+        connMarker[iElem * SU2_CONN_SIZE + SU2_CONN_SKIP + i] = conn[1 + i];
+      }
+    }
+  }
+}
@@ -0,0 +1,144 @@
+/*!
+ * \file CStructuredMeshReaderFVM.cpp
+ * \brief Common functionality of the analytic RECTANGLE and BOX grids.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../include/geometry/meshreader/CStructuredMeshReaderFVM.hpp"
+
+#include <cmath>
+#include <cstdint>
+
+namespace {
+/*--- Uniform number in [0,1) from an integer key (splitmix64), used for reproducible perturbations. ---*/
+passivedouble HashToUnit(uint64_t key) {
+  uint64_t z = key + 0x9E3779B97F4A7C15ull;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  z = z ^ (z >> 31);
+  return (z >> 11) * (1.0 / 9007199254740992.0);
+}
+}  // namespace
+
+CStructuredMeshReaderFVM::CStructuredMeshReaderFVM(const CConfig* val_config, unsigned short val_iZone,
+                                                   unsigned short val_nZone, unsigned short val_dimension)
+    : CMeshReaderFVM(val_config, val_iZone, val_nZone) {
+  dimension = val_dimension;
+
+  nNode = config->GetMeshBoxSize(0);
+  mNode = config->GetMeshBoxSize(1);
+  if (dimension == 3) pNode = config->GetMeshBoxSize(2);
+
+  for (unsigned short iDim = 0; iDim < dimension; iDim++) {
+    length[iDim] = SU2_TYPE::GetValue(config->GetMeshBoxLength(iDim));
+    offset[iDim] = SU2_TYPE::GetValue(config->GetMeshBoxOffset(iDim));
+    stretching[iDim] = config->GetMeshBoxStretching(iDim);
+  }
+  perturbation = config->GetMeshBoxPerturbation();
+  kindElements = config->GetKind_MeshBoxElements();
+
+  /* With lexicographic numbering, the points of our linear partition are a contiguous range of global indices. */
+  numberOfGlobalPoints = nNode * mNode * pNode;
+
+  CLinearPartitioner pointPartitioner(numberOfGlobalPoints, 0);
+  firstLocalPoint = pointPartitioner.GetFirstIndexOnRank(rank);
+  numberOfLocalPoints = pointPartitioner.GetSizeOnRank(rank);
+}
+
+passivedouble CStructuredMeshReaderFVM::GetLineCoordinate(unsigned short iDim, unsigned long index,
+                                                         unsigned long nLine) const {
+  passivedouble s = passivedouble(index) / passivedouble(nLine - 1);
+
+  /* Two-sided tanh clustering towards both walls. */
+  const auto beta = stretching[iDim];
+  if (beta > 0.0) s = 0.5 * (1.0 + tanh(beta * (2.0 * s - 1.0)) / tanh(beta));
+
+  return offset[iDim] + length[iDim] * s;
+}
+
+void CStructuredMeshReaderFVM::ComputePointCoordinates() {
+  const unsigned long nLine[] = {nNode, mNode, pNode};
+
+  localPointCoordinates.resize(dimension);
+  for (int k = 0; k < dimension; k++) localPointCoordinates[k].resize(numberOfLocalPoints);
+
+  for (unsigned long iPoint = 0; iPoint < numberOfLocalPoints; iPoint++) {
+    const auto globalIndex = firstLocalPoint + iPoint;
+    const unsigned long index[] = {globalIndex % nNode, (globalIndex / nNode) % mNode, globalIndex / (nNode * mNode)};
+
+    for (unsigned short iDim = 0; iDim < dimension; iDim++) {
+      auto coord = GetLineCoordinate(iDim, index[iDim], nLine[iDim]);
+
+      /* Only move points in the directions in which they are interior, this keeps the boundaries flat. */
+      if (perturbation > 0.0 && index[iDim] > 0 && index[iDim] < nLine[iDim] - 1) {
+        const auto hMinus = coord - GetLineCoordinate(iDim, index[iDim] - 1, nLine[iDim]);
+        const auto hPlus = GetLineCoordinate(iDim, index[iDim] + 1, nLine[iDim]) - coord;
+        const auto random = 2.0 * HashToUnit(globalIndex * 3 + iDim) - 1.0;
+        coord += perturbation * std::min(hMinus, hPlus) * random;
+      }
+      localPointCoordinates[iDim][iPoint] = coord;
+    }
+  }
+}
+
+void CStructuredMeshReaderFVM::AddVolumeElement(unsigned long globalIndex, unsigned short vtkType,
+                                                unsigned short nNodes, const unsigned long* nodes) {
+  bool isOwned = false;
+  for (unsigned short iNode = 0; iNode < nNodes; iNode++) isOwned |= IsLocalPoint(nodes[iNode]);
+  if (!isOwned) return;
+
+  localVolumeElementConnectivity.push_back(globalIndex);
+  localVolumeElementConnectivity.push_back(vtkType);
+  for (unsigned short iNode = 0; iNode < SU2_CONN_SIZE - SU2_CONN_SKIP; iNode++)
+    localVolumeElementConnectivity.push_back(iNode < nNodes ? nodes[iNode] : 0);
+  numberOfLocalElements++;
+}
+
+void CStructuredMeshReaderFVM::AddSurfaceElement(unsigned short iMarker, unsigned short vtkType,
+                                                 unsigned short nNodes, const unsigned long* nodes) {
+  auto& connectivity = surfaceElementConnectivity[iMarker];
+  connectivity.push_back(0);
+  connectivity.push_back(vtkType);
+  for (unsigned short iNode = 0; iNode < SU2_CONN_SIZE - SU2_CONN_SKIP; iNode++)
+    connectivity.push_back(iNode < nNodes ? nodes[iNode] : 0);
+}
+
+void CStructuredMeshReaderFVM::AddSurfaceQuadrilateral(unsigned short iMarker, const unsigned long* nodes,
+                                                       bool split) {
+  if (!split) {
+    AddSurfaceElement(iMarker, QUADRILATERAL, N_POINTS_QUADRILATERAL, nodes);
+    return;
+  }
+
+  /* The lowest and highest indices of a structured face are always at opposite corners. */
+  unsigned short iMin = 0;
+  for (unsigned short iNode = 1; iNode < N_POINTS_QUADRILATERAL; iNode++)
+    if (nodes[iNode] < nodes[iMin]) iMin = iNode;
+
+  const auto a = iMin % 2;
+  const unsigned long tri0[] = {nodes[a], nodes[a + 1], nodes[a + 2]};
+  const unsigned long tri1[] = {nodes[a], nodes[a + 2], nodes[(a + 3) % 4]};
+  AddSurfaceElement(iMarker, TRIANGLE, N_POINTS_TRIANGLE, tri0);
+  AddSurfaceElement(iMarker, TRIANGLE, N_POINTS_TRIANGLE, tri1);
+}
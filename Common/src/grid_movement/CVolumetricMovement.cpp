@@ -51,6 +51,7 @@ CVolumetricMovement::CVolumetricMovement(CGeometry* geometry, CConfig* config)
     LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
     LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
     StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+    System.SetMixedPrecision(config->GetLinear_Solver_Mixed_Precision(MIXED_PRECISION_SOLVER::MESH_DEFORM));
   }
 }
 
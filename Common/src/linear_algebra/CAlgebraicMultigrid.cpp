@@ -0,0 +1,581 @@
+/*!
+ * \file CAlgebraicMultigrid.cpp
+ * \brief Implementation of the aggregation-based algebraic multigrid.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/linear_algebra/CAlgebraicMultigrid.hpp"
+#include "../../include/linear_algebra/blas_structure.hpp"
+#include "../../include/CConfig.hpp"
+
+#include <algorithm>
+
+namespace {
+/*!
+ * \brief Squared Frobenius norm of a (passive copy of a) block.
+ */
+template <class T>
+passivedouble SquaredBlockNorm(unsigned long blkSz, const T* block) {
+  passivedouble norm = 0;
+  for (auto i = 0ul; i < blkSz; ++i) norm += pow(SU2_TYPE::GetValue(block[i]), 2);
+  return norm;
+}
+
+/*!
+ * \brief Invert a small dense block (Gauss-Jordan with partial pivoting).
+ * \param[in] n - Size of the block.
+ * \param[in,out] a - On entry the block, destroyed on exit.
+ * \param[out] inv - The inverse.
+ */
+template <class T>
+void InvertBlock(unsigned long n, T* a, T* inv) {
+  for (auto i = 0ul; i < n; ++i)
+    for (auto j = 0ul; j < n; ++j) inv[i * n + j] = T(i == j);
+
+  for (auto j = 0ul; j < n; ++j) {
+    auto piv = j;
+    for (auto i = j + 1; i < n; ++i)
+      if (fabs(a[i * n + j]) > fabs(a[piv * n + j])) piv = i;
+
+    if (piv != j) {
+      for (auto k = 0ul; k < n; ++k) {
+        std::swap(a[j * n + k], a[piv * n + k]);
+        std::swap(inv[j * n + k], inv[piv * n + k]);
+      }
+    }
+    const T scale = 1 / a[j * n + j];
+    for (auto k = 0ul; k < n; ++k) {
+      a[j * n + k] *= scale;
+      inv[j * n + k] *= scale;
+    }
+    for (auto i = 0ul; i < n; ++i) {
+      if (i == j) continue;
+      const T w = a[i * n + j];
+      for (auto k = 0ul; k < n; ++k) {
+        a[i * n + k] -= w * a[j * n + k];
+        inv[i * n + k] -= w * inv[j * n + k];
+      }
+    }
+  }
+}
+}  // namespace
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetPartitions(CLevel& level) const {
+  const auto numParts = std::max(1ul, std::min(nParts, level.nBlk / MIN_ROWS_PER_PART));
+  const auto rowsPerPart = roundUpDiv(level.nBlk, numParts);
+
+  level.partitions.resize(numParts + 1);
+  for (auto iPart = 0ul; iPart <= numParts; ++iPart)
+    level.partitions[iPart] = std::min(iPart * rowsPerPart, level.nBlk);
+}
+
+template <class ScalarType>
+unsigned long CAlgebraicMultigrid<ScalarType>::Aggregate(CLevel& level, passivedouble threshold) {
+  const auto blkSz = nVar * nVar;
+  const auto nPart = level.partitions.size() - 1;
+  const auto theta2 = threshold * threshold;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    level.aggregate.assign(level.nBlk, NONE);
+    numAggregates.assign(nPart + 1, 0);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  auto& agg = level.aggregate;
+
+  /*--- Each thread aggregates the rows of its partition, aggregates do not cross partitions. ---*/
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto iPart = 0ul; iPart < nPart; ++iPart) {
+    const auto begin = level.partitions[iPart];
+    const auto end = level.partitions[iPart + 1];
+
+    /*--- Norm of the diagonal blocks, relative to which connections are measured. ---*/
+    std::vector<passivedouble> diagNorm(end - begin);
+    for (auto i = begin; i < end; ++i)
+      diagNorm[i - begin] = sqrt(SquaredBlockNorm(blkSz, &level.values[level.diaPtr[i] * blkSz]));
+
+    /*--- Relative strength of connection ij, or 0 if j is not a strong neighbor of i. ---*/
+    auto strength = [&](unsigned long i, unsigned long k) {
+      const auto j = level.colIdx[k];
+      if (j == i || j < begin || j >= end) return 0.0;
+      const auto sij = SquaredBlockNorm(blkSz, &level.values[k * blkSz]);
+      const auto dij = diagNorm[i - begin] * diagNorm[j - begin];
+      return (sij >= theta2 * dij && sij > 0) ? sij / std::max(dij, 1e-300) : 0.0;
+    };
+
+    unsigned long nAgg = 0;
+
+    /*--- Pass 1, rows whose strong neighbors are all free form new aggregates with them. ---*/
+
+    for (auto i = begin; i < end; ++i) {
+      if (agg[i] != NONE) continue;
+      bool free = true, connected = false;
+      for (auto k = level.rowPtr[i]; k < level.rowPtr[i + 1] && free; ++k) {
+        if (strength(i, k) == 0) continue;
+        connected = true;
+        free = (agg[level.colIdx[k]] == NONE);
+      }
+      if (!free || !connected) continue;
+
+      agg[i] = nAgg;
+      for (auto k = level.rowPtr[i]; k < level.rowPtr[i + 1]; ++k)
+        if (strength(i, k) > 0) agg[level.colIdx[k]] = nAgg;
+      ++nAgg;
+    }
+
+    /*--- Pass 2, remaining rows join the aggregate of their strongest aggregated neighbor,
+     *    the assignments are deferred to avoid chains of rows joining through this pass. ---*/
+
+    std::vector<std::pair<unsigned long, unsigned long> > joins;
+
+    for (auto i = begin; i < end; ++i) {
+      if (agg[i] != NONE) continue;
+      passivedouble maxStrength = 0;
+      unsigned long target = NONE;
+      for (auto k = level.rowPtr[i]; k < level.rowPtr[i + 1]; ++k) {
+        /*--- Strength is 0 for columns outside the partition of this thread. ---*/
+        const auto s = strength(i, k);
+        if (s <= maxStrength) continue;
+        const auto a = agg[level.colIdx[k]];
+        if (a != NONE) {
+          maxStrength = s;
+          target = a;
+        }
+      }
+      if (target != NONE) joins.emplace_back(i, target);
+    }
+    for (const auto& join : joins) agg[join.first] = join.second;
+
+    /*--- Pass 3, leftover rows form aggregates with their free strong neighbors (or alone). ---*/
+
+    for (auto i = begin; i < end; ++i) {
+      if (agg[i] != NONE) continue;
+      agg[i] = nAgg;
+      for (auto k = level.rowPtr[i]; k < level.rowPtr[i + 1]; ++k) {
+        const auto j = level.colIdx[k];
+        if (strength(i, k) > 0 && agg[j] == NONE) agg[j] = nAgg;
+      }
+      ++nAgg;
+    }
+    numAggregates[iPart + 1] = nAgg;
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Global numbering of the aggregates. ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    for (auto iPart = 0ul; iPart < nPart; ++iPart) numAggregates[iPart + 1] += numAggregates[iPart];
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto iPart = 0ul; iPart < nPart; ++iPart) {
+    for (auto i = level.partitions[iPart]; i < level.partitions[iPart + 1]; ++i) agg[i] += numAggregates[iPart];
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Rows of each aggregate (transpose of the map). ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    const auto nCoarse = numAggregates[nPart];
+    level.aggPtr.assign(nCoarse + 1, 0);
+    for (auto i = 0ul; i < level.nBlk; ++i) ++level.aggPtr[agg[i] + 1];
+    for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) level.aggPtr[iAgg + 1] += level.aggPtr[iAgg];
+
+    level.aggIdx.resize(level.nBlk);
+    auto pos = level.aggPtr;
+    for (auto i = 0ul; i < level.nBlk; ++i) level.aggIdx[pos[agg[i]]++] = i;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  return level.aggPtr.size() - 1;
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetCoarsePattern(CLevel& fine, CLevel& coarse) {
+  const auto nCoarse = coarse.nBlk;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    coarse.rowPtrData.assign(nCoarse + 1, 0);
+    fine.coarseBlkMap.assign(fine.rowPtr[fine.nBlk], NONE);
+    /*--- The first half tags visited columns, the second stores their position. ---*/
+    for (auto& m : marker) m.assign(2 * nCoarse, NONE);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Count the distinct coarse columns of each coarse row. ---*/
+
+  SU2_OMP_FOR_DYN(computeStaticChunkSize(nCoarse, omp_get_num_threads(), OMP_MAX_SIZE))
+  for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) {
+    auto* tag = marker[omp_get_thread_num()].data();
+    unsigned long count = 0;
+    for (auto p = fine.aggPtr[iAgg]; p < fine.aggPtr[iAgg + 1]; ++p) {
+      const auto i = fine.aggIdx[p];
+      for (auto k = fine.rowPtr[i]; k < fine.rowPtr[i + 1]; ++k) {
+        const auto j = fine.colIdx[k];
+        if (j >= fine.nBlk) continue;
+        const auto jAgg = fine.aggregate[j];
+        if (tag[jAgg] != iAgg) {
+          tag[jAgg] = iAgg;
+          ++count;
+        }
+      }
+    }
+    coarse.rowPtrData[iAgg + 1] = count;
+  }
+  END_SU2_OMP_FOR
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) coarse.rowPtrData[iAgg + 1] += coarse.rowPtrData[iAgg];
+    const auto nnz = coarse.rowPtrData[nCoarse];
+
+    coarse.colIdxData.resize(nnz);
+    coarse.diaPtrData.resize(nCoarse);
+    coarse.valuesData.resize(nnz * nVar * nVar);
+    coarse.rowPtr = coarse.rowPtrData.data();
+    coarse.colIdx = coarse.colIdxData.data();
+    coarse.diaPtr = coarse.diaPtrData.data();
+    coarse.values = coarse.valuesData.data();
+
+    coarse.res.resize(nCoarse * nVar);
+    coarse.rhs.resize(nCoarse * nVar);
+    coarse.sol.resize(nCoarse * nVar);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  /*--- Fill the (sorted) columns and map the fine blocks to the coarse ones. The tags of
+   *    the previous loop are smaller than nCoarse, so they do not need to be reset. ---*/
+
+  SU2_OMP_FOR_DYN(computeStaticChunkSize(nCoarse, omp_get_num_threads(), OMP_MAX_SIZE))
+  for (auto iAgg = 0ul; iAgg < nCoarse; ++iAgg) {
+    auto* tag = marker[omp_get_thread_num()].data();
+    auto* position = tag + nCoarse;
+    auto* cols = &coarse.colIdxData[coarse.rowPtrData[iAgg]];
+    unsigned long count = 0;
+
+    for (auto p = fine.aggPtr[iAgg]; p < fine.aggPtr[iAgg + 1]; ++p) {
+      const auto i = fine.aggIdx[p];
+      for (auto k = fine.rowPtr[i]; k < fine.rowPtr[i + 1]; ++k) {
+        const auto j = fine.colIdx[k];
+        if (j >= fine.nBlk) continue;
+        const auto jAgg = fine.aggregate[j];
+        if (tag[jAgg] != iAgg + nCoarse) {
+          tag[jAgg] = iAgg + nCoarse;
+          cols[count++] = jAgg;
+        }
+      }
+    }
+    std::sort(cols, cols + count);
+
+    for (auto q = coarse.rowPtrData[iAgg]; q < coarse.rowPtrData[iAgg + 1]; ++q) {
+      position[coarse.colIdxData[q]] = q;
+      if (coarse.colIdxData[q] == iAgg) coarse.diaPtrData[iAgg] = q;
+    }
+
+    for (auto p = fine.aggPtr[iAgg]; p < fine.aggPtr[iAgg + 1]; ++p) {
+      const auto i = fine.aggIdx[p];
+      for (auto k = fine.rowPtr[i]; k < fine.rowPtr[i + 1]; ++k) {
+        const auto j = fine.colIdx[k];
+        if (j < fine.nBlk) fine.coarseBlkMap[k] = position[fine.aggregate[j]];
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetCoarseValues(const CLevel& fine, CLevel& coarse) const {
+  const auto blkSz = nVar * nVar;
+
+  /*--- A_IJ = sum_{i in I, j in J} A_ij, since the prolongation blocks are identities. ---*/
+
+  SU2_OMP_FOR_DYN(computeStaticChunkSize(coarse.nBlk, omp_get_num_threads(), OMP_MAX_SIZE))
+  for (auto iAgg = 0ul; iAgg < coarse.nBlk; ++iAgg) {
+    const auto begin = coarse.rowPtr[iAgg] * blkSz;
+    const auto end = coarse.rowPtr[iAgg + 1] * blkSz;
+    for (auto q = begin; q < end; ++q) coarse.valuesData[q] = 0.0;
+
+    for (auto p = fine.aggPtr[iAgg]; p < fine.aggPtr[iAgg + 1]; ++p) {
+      const auto i = fine.aggIdx[p];
+      for (auto k = fine.rowPtr[i]; k < fine.rowPtr[i + 1]; ++k) {
+        const auto q = fine.coarseBlkMap[k];
+        if (q == NONE) continue;
+        auto* dst = &coarse.valuesData[q * blkSz];
+        const auto* src = &fine.values[k * blkSz];
+        SU2_OMP_SIMD
+        for (auto iVar = 0ul; iVar < blkSz; ++iVar) dst[iVar] += src[iVar];
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetInverseDiagonal(CLevel& level) const {
+  const auto blkSz = nVar * nVar;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { level.invDiag.resize(level.nBlk * blkSz); }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  std::vector<ScalarType> block(blkSz);
+
+  SU2_OMP_FOR_DYN(computeStaticChunkSize(level.nBlk, omp_get_num_threads(), OMP_MAX_SIZE))
+  for (auto i = 0ul; i < level.nBlk; ++i) {
+    const auto* diag = &level.values[level.diaPtr[i] * blkSz];
+    for (auto iVar = 0ul; iVar < blkSz; ++iVar) block[iVar] = diag[iVar];
+    InvertBlock(nVar, block.data(), &level.invDiag[i * blkSz]);
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::SetCoarseInverse() {
+  const auto& level = levels.back();
+  const auto n = level.nBlk * nVar;
+
+  /*--- Larger coarse levels are smoothed instead. ---*/
+  if (n > MAX_DIRECT_SIZE) return;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    coarseInverse.resize(n, n) = ScalarType(0);
+
+    for (auto i = 0ul; i < level.nBlk; ++i) {
+      for (auto k = level.rowPtr[i]; k < level.rowPtr[i + 1]; ++k) {
+        const auto j = level.colIdx[k];
+        if (j >= level.nBlk) continue;
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar)
+            coarseInverse(i * nVar + iVar, j * nVar + jVar) = level.values[(k * nVar + iVar) * nVar + jVar];
+      }
+    }
+    CBlasStructure::inverse(n, coarseInverse);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Build(unsigned long nvar, unsigned long nPointDomain,
+                                            const unsigned long* rowPtr, const unsigned long* colIdx,
+                                            const unsigned long* diaPtr, const ScalarType* values,
+                                            unsigned long numParts, const CConfig* config) {
+  if (!isBuilt) {
+    const auto maxLevels = std::max<unsigned long>(1, config->GetLinear_Solver_AMG_Levels());
+    const auto coarseSize = config->GetLinear_Solver_AMG_Coarse_Size();
+    auto threshold = SU2_TYPE::GetValue(config->GetLinear_Solver_AMG_Strength());
+
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      nVar = nvar;
+      nParts = std::max(1ul, numParts);
+      nSweeps = std::max<unsigned short>(1, config->GetLinear_Solver_AMG_Sweeps());
+      marker.resize(omp_get_max_threads());
+
+      /*--- References to levels are kept while adding new ones. ---*/
+      levels.clear();
+      levels.reserve(maxLevels);
+      levels.emplace_back();
+
+      auto& finest = levels[0];
+      finest.nBlk = nPointDomain;
+      finest.rowPtr = rowPtr;
+      finest.colIdx = colIdx;
+      finest.diaPtr = diaPtr;
+      finest.res.resize(nPointDomain * nVar);
+      SetPartitions(finest);
+
+      /*--- Values are needed to measure the strength of connections. ---*/
+      finest.values = values;
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+    while (levels.size() < maxLevels && levels.back().nBlk > coarseSize) {
+      auto& fine = levels.back();
+      const auto nCoarse = Aggregate(fine, threshold);
+
+      /*--- Stop if the coarsening stagnates (e.g. very weakly connected rows). ---*/
+      if (nCoarse * 10 > fine.nBlk * 9) break;
+
+      BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+        levels.emplace_back();
+        levels.back().nBlk = nCoarse;
+        SetPartitions(levels.back());
+      }
+      END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+      /*--- The coarse values are needed to aggregate the next level. ---*/
+      SetCoarsePattern(levels[levels.size() - 2], levels.back());
+      SetCoarseValues(levels[levels.size() - 2], levels.back());
+
+      /*--- Coarse operators are denser, relax the criterion. ---*/
+      threshold *= 0.5;
+    }
+
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { isBuilt = true; }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+
+  /*--- Numerical phase. ---*/
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS { levels[0].values = values; }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  SetInverseDiagonal(levels[0]);
+
+  for (auto iLevel = 1ul; iLevel < levels.size(); ++iLevel) {
+    SetCoarseValues(levels[iLevel - 1], levels[iLevel]);
+    SetInverseDiagonal(levels[iLevel]);
+  }
+  SetCoarseInverse();
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Smooth(const CLevel& level, bool forward, const ScalarType* b,
+                                             ScalarType* x) const {
+  const auto blkSz = nVar * nVar;
+  const auto nPart = level.partitions.size() - 1;
+
+  SU2_OMP_FOR_STAT(1)
+  for (auto iPart = 0ul; iPart < nPart; ++iPart) {
+    const auto begin = level.partitions[iPart];
+    const auto end = level.partitions[iPart + 1];
+
+    std::vector<ScalarType> tmp(nVar);
+
+    for (auto n = begin; n < end; ++n) {
+      const auto i = forward ? n : end - 1 - (n - begin);
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) tmp[iVar] = b[i * nVar + iVar];
+
+      /*--- Only the couplings within the partition are considered. ---*/
+      for (auto k = level.rowPtr[i]; k < level.rowPtr[i + 1]; ++k) {
+        const auto j = level.colIdx[k];
+        if (j == i || j < begin || j >= end) continue;
+        const auto* blk = &level.values[k * blkSz];
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          for (auto jVar = 0ul; jVar < nVar; ++jVar) tmp[iVar] -= blk[iVar * nVar + jVar] * x[j * nVar + jVar];
+      }
+
+      const auto* inv = &level.invDiag[i * blkSz];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        ScalarType sum = 0.0;
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) sum += inv[iVar * nVar + jVar] * tmp[jVar];
+        x[i * nVar + iVar] = sum;
+      }
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Cycle(unsigned long iLevel, const ScalarType* b, ScalarType* x) const {
+  const auto& level = levels[iLevel];
+  const auto n = level.nBlk * nVar;
+  const auto blkSz = nVar * nVar;
+
+  /*--- Coarsest level, direct solve if possible, otherwise smooth. ---*/
+
+  if (iLevel + 1 == levels.size()) {
+    if (coarseInverse.size() != 0) {
+      SU2_OMP_FOR_STAT(roundUpDiv(n, omp_get_num_threads()))
+      for (auto i = 0ul; i < n; ++i) {
+        ScalarType sum = 0.0;
+        for (auto j = 0ul; j < n; ++j) sum += coarseInverse(i, j) * b[j];
+        x[i] = sum;
+      }
+      END_SU2_OMP_FOR
+    } else {
+      parallelSet(n, ScalarType(0), x);
+      for (auto iSweep = 0ul; iSweep < 2ul * COARSE_SWEEPS; ++iSweep) Smooth(level, iSweep % 2 == 0, b, x);
+    }
+    return;
+  }
+
+  /*--- Pre-smoothing. ---*/
+
+  parallelSet(n, ScalarType(0), x);
+  for (auto iSweep = 0u; iSweep < nSweeps; ++iSweep) Smooth(level, true, b, x);
+
+  /*--- Residual. ---*/
+
+  SU2_OMP_FOR_DYN(computeStaticChunkSize(level.nBlk, omp_get_num_threads(), OMP_MAX_SIZE))
+  for (auto i = 0ul; i < level.nBlk; ++i) {
+    auto* r = &level.res[i * nVar];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) r[iVar] = b[i * nVar + iVar];
+
+    for (auto k = level.rowPtr[i]; k < level.rowPtr[i + 1]; ++k) {
+      const auto j = level.colIdx[k];
+      if (j >= level.nBlk) continue;
+      const auto* blk = &level.values[k * blkSz];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) r[iVar] -= blk[iVar * nVar + jVar] * x[j * nVar + jVar];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Restriction (sum over the aggregates), coarse correction, and prolongation. ---*/
+
+  const auto& coarse = levels[iLevel + 1];
+
+  SU2_OMP_FOR_STAT(computeStaticChunkSize(coarse.nBlk, omp_get_num_threads(), OMP_MAX_SIZE))
+  for (auto iAgg = 0ul; iAgg < coarse.nBlk; ++iAgg) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) coarse.rhs[iAgg * nVar + iVar] = 0.0;
+    for (auto p = level.aggPtr[iAgg]; p < level.aggPtr[iAgg + 1]; ++p) {
+      const auto i = level.aggIdx[p];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) coarse.rhs[iAgg * nVar + iVar] += level.res[i * nVar + iVar];
+    }
+  }
+  END_SU2_OMP_FOR
+
+  Cycle(iLevel + 1, coarse.rhs.data(), coarse.sol.data());
+
+  SU2_OMP_FOR_STAT(computeStaticChunkSize(level.nBlk, omp_get_num_threads(), OMP_MAX_SIZE))
+  for (auto i = 0ul; i < level.nBlk; ++i) {
+    const auto iAgg = level.aggregate[i];
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) x[i * nVar + iVar] += coarse.sol[iAgg * nVar + iVar];
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Post-smoothing. ---*/
+
+  for (auto iSweep = 0u; iSweep < nSweeps; ++iSweep) Smooth(level, false, b, x);
+}
+
+template <class ScalarType>
+void CAlgebraicMultigrid<ScalarType>::Apply(const ScalarType* b, ScalarType* x) const {
+  if (!isBuilt) SU2_MPI::Error("The AMG hierarchy has not been built yet.", CURRENT_FUNCTION);
+  Cycle(0, b, x);
+}
+
+/*--- Explicit instantiations ---*/
+
+#ifdef CODI_FORWARD_TYPE
+template class CAlgebraicMultigrid<su2double>;
+#else
+template class CAlgebraicMultigrid<su2mixedfloat>;
+#ifdef USE_MIXED_PRECISION
+template class CAlgebraicMultigrid<passivedouble>;
+#else
+template class CAlgebraicMultigrid<float>;
+#endif
+#endif
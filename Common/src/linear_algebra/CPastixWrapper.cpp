@@ -315,6 +315,8 @@ template class CPastixWrapper<su2double>;
 template class CPastixWrapper<su2mixedfloat>;
 #ifdef USE_MIXED_PRECISION
 template class CPastixWrapper<passivedouble>;
+#else
+template class CPastixWrapper<float>;
 #endif
 #endif
 #endif
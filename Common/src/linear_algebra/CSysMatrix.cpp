@@ -149,6 +149,8 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
     col_ind_ilu = csr_ilu.innerIdx();
     dia_ptr_ilu = csr_ilu.diagPtr();
     nnz_ilu = csr_ilu.getNumNonZeros();
+
+    if (config->GetLinear_Solver_ILU_Level_Scheduling() && nPointDomain > 0) SetILULevelSchedule();
   }
 
   /*--- Allocate data. ---*/
@@ -647,6 +649,21 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 
   /*--- Transform system in Upper Matrix ---*/
 
+  if (!ilu_lower_levels.empty()) {
+    /*--- Level-scheduled factorization of the entire domain, the rows of each level only depend
+     *    on rows of previous levels, thus the result is the same as the serial factorization. ---*/
+
+    for (auto iLevel = 0ul; iLevel < ilu_lower_levels.getOuterSize(); ++iLevel) {
+      const auto rows = ilu_lower_levels.innerIdx() + ilu_lower_levels.outerPtr()[iLevel];
+      const auto size = ilu_lower_levels.getNumNonZeros(iLevel);
+
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto k = 0ul; k < size; ++k) FactorizeILURow(rows[k], 0, nPointDomain);
+      END_SU2_OMP_FOR
+    }
+    return;
+  }
+
   /*--- OpenMP Parallelization, a loop construct is used to ensure
    *    the preconditioner is computed correctly even if called
    *    outside of a parallel section. ---*/
@@ -655,62 +672,12 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
   for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
     const auto begin = omp_partitions[thread];
     const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
 
     /*--- Each thread will work on the submatrix defined from row/col "begin"
      *    to row/col "end-1" (i.e. the range [begin,end[). Which is exactly
      *    what the MPI-only implementation does. ---*/
 
-    ScalarType weight[MAXNVAR * MAXNVAR], aux_block[MAXNVAR * MAXNVAR];
-
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      /*--- Invert and store the previous diagonal block to later compute the weight. ---*/
-
-      InverseDiagonalBlock_ILUMatrix(iPoint - 1, &invM[(iPoint - 1) * nVar * nVar]);
-
-      /*--- For this row (unknown), loop over its lower diagonal entries. ---*/
-
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        /*--- jPoint is the column index (jPoint < iPoint). ---*/
-
-        auto jPoint = col_ind_ilu[index];
-
-        /*--- We only care about the sub matrix within "begin" and "end-1". ---*/
-
-        if (jPoint < begin) continue;
-
-        /*--- Multiply the block by the inverse of the corresponding diagonal block. ---*/
-
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixMatrixProduct(Block_ij, &invM[jPoint * nVar * nVar], weight);
-
-        /*--- "weight" holds Aij*inv(Ajj). Jump to the upper part of the jPoint row. ---*/
-
-        for (auto index_ = dia_ptr_ilu[jPoint] + 1; index_ < row_ptr_ilu[jPoint + 1]; index_++) {
-          /*--- Get the column index (kPoint > jPoint). ---*/
-
-          auto kPoint = col_ind_ilu[index_];
-
-          if (kPoint >= end) break;
-
-          /*--- If Aik exists, update it: Aik -= Aij*inv(Ajj)*Ajk ---*/
-
-          auto Block_ik = GetBlock_ILUMatrix(iPoint, kPoint);
-
-          if (Block_ik != nullptr) {
-            auto Block_jk = &ILU_matrix[index_ * nVar * nVar];
-            MatrixMatrixProduct(weight, Block_jk, aux_block);
-            MatrixSubtraction(Block_ik, aux_block, Block_ik);
-          }
-        }
-
-        /*--- Lastly, store "weight" in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
-
-        for (auto iVar = 0ul; iVar < nVar * nVar; ++iVar) Block_ij[iVar] = weight[iVar];
-      }
-    }
-    InverseDiagonalBlock_ILUMatrix(end - 1, &invM[(end - 1) * nVar * nVar]);
+    for (auto iPoint = begin; iPoint < end; iPoint++) FactorizeILURow(iPoint, begin, end);
   }
   END_SU2_OMP_FOR
 }
@@ -721,49 +688,57 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
-  /*--- OpenMP Parallelization ---*/
-  SU2_OMP_FOR_STAT(1)
-  for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
-    const auto begin = omp_partitions[thread];
-    const auto end = omp_partitions[thread + 1];
-    if (begin == end) continue;
+  if (!ilu_lower_levels.empty()) {
+    /*--- Level-scheduled sweeps, the implicit barriers separate the levels. ---*/
 
-    ScalarType aux_vec[MAXNVAR];
+    SU2_OMP_FOR_STAT(omp_light_size)
+    for (auto iVar = 0ul; iVar < nPointDomain * nVar; iVar++) prod[iVar] = vec[iVar];
+    END_SU2_OMP_FOR
 
-    /*--- Copy vector to then work on prod in place ---*/
+    for (auto iLevel = 0ul; iLevel < ilu_lower_levels.getOuterSize(); ++iLevel) {
+      const auto rows = ilu_lower_levels.innerIdx() + ilu_lower_levels.outerPtr()[iLevel];
+      const auto size = ilu_lower_levels.getNumNonZeros(iLevel);
 
-    for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto k = 0ul; k < size; ++k) ForwardSubstitutionILU(rows[k], 0, prod);
+      END_SU2_OMP_FOR
+    }
 
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+    for (auto iLevel = 0ul; iLevel < ilu_upper_levels.getOuterSize(); ++iLevel) {
+      const auto rows = ilu_upper_levels.innerIdx() + ilu_upper_levels.outerPtr()[iLevel];
+      const auto size = ilu_upper_levels.getNumNonZeros(iLevel);
 
-    for (auto iPoint = begin + 1; iPoint < end; iPoint++) {
-      for (auto index = row_ptr_ilu[iPoint]; index < dia_ptr_ilu[iPoint]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint < begin) continue;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], &prod[iPoint * nVar]);
-      }
+      SU2_OMP_FOR_DYN(OMP_MIN_SIZE)
+      for (auto k = 0ul; k < size; ++k) BackwardSubstitutionILU(rows[k], nPointDomain, prod);
+      END_SU2_OMP_FOR
     }
+  } else {
+    /*--- OpenMP Parallelization ---*/
+    SU2_OMP_FOR_STAT(1)
+    for (unsigned long thread = 0; thread < omp_num_parts; ++thread) {
+      const auto begin = omp_partitions[thread];
+      const auto end = omp_partitions[thread + 1];
+      if (begin == end) continue;
 
-    /*--- Backwards substitution (starts at the last row) ---*/
+      /*--- Copy vector to then work on prod in place ---*/
 
-    for (auto iPoint = end; iPoint > begin;) {
-      iPoint--;  // unsigned type
-      for (auto iVar = 0ul; iVar < nVar; iVar++) aux_vec[iVar] = prod[iPoint * nVar + iVar];
+      for (auto iVar = begin * nVar; iVar < end * nVar; iVar++) prod[iVar] = vec[iVar];
 
-      for (auto index = dia_ptr_ilu[iPoint] + 1; index < row_ptr_ilu[iPoint + 1]; index++) {
-        auto jPoint = col_ind_ilu[index];
-        if (jPoint >= end) break;
-        auto Block_ij = &ILU_matrix[index * nVar * nVar];
-        MatrixVectorProductSub(Block_ij, &prod[jPoint * nVar], aux_vec);
-      }
+      /*--- Forward solve the system using the lower matrix entries that
+       were computed and stored during the ILU preprocessing. Note
+       that we are overwriting the residual vector as we go. ---*/
+
+      for (auto iPoint = begin + 1; iPoint < end; iPoint++) ForwardSubstitutionILU(iPoint, begin, prod);
 
-      MatrixVectorProduct(&invM[iPoint * nVar * nVar], aux_vec, &prod[iPoint * nVar]);
+      /*--- Backwards substitution (starts at the last row) ---*/
+
+      for (auto iPoint = end; iPoint > begin;) {
+        iPoint--;  // unsigned type
+        BackwardSubstitutionILU(iPoint, end, prod);
+      }
     }
+    END_SU2_OMP_FOR
   }
-  END_SU2_OMP_FOR
 
   /*--- MPI Parallelization ---*/
 
@@ -771,6 +746,39 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::SetILULevelSchedule() {
+  /*--- The level of a row is one more than the highest level of the rows it depends on. The forward
+   *    sweep and the factorization depend on the lower part of the ILU pattern, the backward sweep
+   *    on the upper part. As in the partitioned approach, coupling with halo points is ignored. ---*/
+
+  auto buildLevels = [&](bool lower) {
+    vector<unsigned long> level(nPointDomain, 0);
+    unsigned long nLevel = 0;
+
+    for (auto n = 0ul; n < nPointDomain; ++n) {
+      const auto iPoint = lower ? n : nPointDomain - 1 - n;
+      const auto first = lower ? row_ptr_ilu[iPoint] : dia_ptr_ilu[iPoint] + 1;
+      const auto last = lower ? dia_ptr_ilu[iPoint] : row_ptr_ilu[iPoint + 1];
+
+      for (auto index = first; index < last; ++index) {
+        const auto jPoint = col_ind_ilu[index];
+        if (jPoint < nPointDomain) level[iPoint] = max(level[iPoint], level[jPoint] + 1);
+      }
+      nLevel = max(nLevel, level[iPoint] + 1);
+    }
+
+    /*--- Rows are kept in ascending order within each level for locality. ---*/
+    vector<vector<unsigned long> > rows(nLevel);
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) rows[level[iPoint]].push_back(iPoint);
+
+    return CCompressedSparsePatternUL(rows);
+  };
+
+  ilu_lower_levels = buildLevels(true);
+  ilu_upper_levels = buildLevels(false);
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType>& vec,
                                                          CSysVector<ScalarType>& prod, CGeometry* geometry,
@@ -1194,6 +1202,26 @@ void CSysMatrix<ScalarType>::ComputePastixPreconditioner(const CSysVector<Scalar
 #endif
 }
 
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner(const CConfig* config) {
+  /*--- The hierarchy only uses the domain rows, coupling with halos is ignored (as in ILU). ---*/
+  amg.Build(nVar, nPointDomain, row_ptr, col_ind, dia_ptr, matrix, omp_num_parts, config);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  /*--- Coalesced vector access by all threads is done by the multigrid, ensure vec is up to date. ---*/
+  SU2_OMP_BARRIER
+
+  amg.Apply(&vec[0], &prod[0]);
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
 /*--- Explicit instantiations ---*/
 
 #define INSTANTIATE_COMMS(TYPE)                                                                                       \
@@ -1213,9 +1241,12 @@ INSTANTIATE_MATRIX(su2double)
 #else
 /*--- Base and reverse AD, matrix is passive. ---*/
 INSTANTIATE_MATRIX(su2mixedfloat)
-/*--- If using mixed precision (float) instantiate also a version for doubles, and allow cross communications. ---*/
+/*--- If using mixed precision (float) instantiate also a version for doubles, and allow cross communications.
+ *    Otherwise instantiate a float version for the runtime mixed precision mode of CSysSolve. ---*/
 #ifdef USE_MIXED_PRECISION
 INSTANTIATE_MATRIX(passivedouble)
+#else
+INSTANTIATE_MATRIX(float)
 #endif
 #ifdef CODI_REVERSE_TYPE
 INSTANTIATE_COMMS(su2double)
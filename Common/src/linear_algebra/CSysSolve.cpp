@@ -28,6 +28,7 @@
 #include "../../include/linear_algebra/CSysSolve.hpp"
 #include "../../include/linear_algebra/CSysSolve_b.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
+#include "../../include/toolboxes/CProfiler.hpp"
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/linear_algebra/CSysMatrix.hpp"
@@ -49,6 +50,22 @@ template <>
 constexpr float linSolEpsilon<float>() {
   return 1e-12;
 }
+
+/*!
+ * \brief Preconditioner defined by a function object, used to nest solvers.
+ */
+template <class ScalarType, class Function>
+class CPreconditionerFunction final : public CPreconditioner<ScalarType> {
+ private:
+  const Function& function;
+
+ public:
+  CPreconditionerFunction(const Function& f) : function(f) {}
+
+  inline void operator()(const CSysVector<ScalarType>& u, CSysVector<ScalarType>& v) const override {
+    function(u, v);
+  }
+};
 }  // namespace
 
 template <class ScalarType>
@@ -61,6 +78,25 @@ CSysSolve<ScalarType>::CSysSolve(LINEAR_SOLVER_MODE linear_solver_mode)
       LinSysSol_ptr(nullptr),
       LinSysRes_ptr(nullptr) {}
 
+#ifndef CODI_FORWARD_TYPE
+template <class ScalarType>
+struct CSysSolve<ScalarType>::CLowPrecisionData {
+  CSysMatrix<float> matrix;
+  CSysVector<float> rhs, sol;
+  CSysSolve<float> solver;
+};
+#else
+/*--- The matrix is active in forward AD, mixed precision is not used. ---*/
+template <class ScalarType>
+struct CSysSolve<ScalarType>::CLowPrecisionData {};
+#endif
+
+template <class ScalarType>
+CSysSolve<ScalarType>::CSysSolve(CSysSolve&&) = default;
+
+template <class ScalarType>
+CSysSolve<ScalarType>::~CSysSolve() = default;
+
 template <class ScalarType>
 void CSysSolve<ScalarType>::ApplyGivens(ScalarType s, ScalarType c, ScalarType& h1, ScalarType& h2) const {
   ScalarType temp = c * h1 + s * h2;
@@ -862,10 +898,92 @@ unsigned long CSysSolve<ScalarType>::Smoother_LinSolver(const CSysVector<ScalarT
   return i;
 }
 
+template <class ScalarType>
+unsigned long CSysSolve<ScalarType>::MixedPrecision_LinSolver(const MatrixType& Jacobian, const VectorType& b,
+                                                              VectorType& x, unsigned short kindSolver,
+                                                              ENUM_LINEAR_SOLVER_PREC kindPrec, ScalarType tol,
+                                                              unsigned long m, ScalarType& residual, bool monitoring,
+                                                              CGeometry* geometry, const CConfig* config) {
+#ifdef CODI_FORWARD_TYPE
+  SU2_MPI::Error("Mixed precision linear solvers are not available in forward AD.", CURRENT_FUNCTION);
+  return 0;
+#else
+  /*--- Each outer iteration reduces the residual by (approximately) the tolerance of the single precision
+   * solves, the latter cannot be too small due to round-off, hence a few outer iterations may be needed. ---*/
+  const unsigned long maxOuterIter = 5;
+  const float minInnerTol = 1e-4;
+
+  if (!lowPrecData) {
+    BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+      lowPrecData.reset(new CLowPrecisionData);
+      lowPrecData->matrix.Initialize(Jacobian, geometry, config);
+      lowPrecData->rhs.Initialize(b.GetNBlk(), b.GetNBlkDomain(), b.GetNVar(), nullptr);
+      lowPrecData->sol.Initialize(b.GetNBlk(), b.GetNBlkDomain(), b.GetNVar(), nullptr);
+      lowPrecData->solver.SetxIsZero(true);
+    }
+    END_SU2_OMP_SAFE_GLOBAL_ACCESS
+  }
+  auto& data = *lowPrecData;
+
+  /*--- Refresh the single precision matrix and build its preconditioner. ---*/
+
+  data.matrix.PassiveCopy(Jacobian);
+
+  auto precond = CPreconditioner<float>::Create(kindPrec, data.matrix, geometry, config);
+  precond->Build();
+
+  const auto mat_vec = CSysMatrixVectorProduct<float>(data.matrix, geometry, config);
+  const float innerTol = max<float>(tol, minInnerTol);
+  unsigned long innerIter = 0;
+
+  /*--- The single precision solve acts as the preconditioner of the outer iterations. ---*/
+
+  auto innerSolve = [&](const VectorType& u, VectorType& v) {
+    data.rhs.PassiveCopy(u);
+    data.sol = 0.0f;
+    float res = 0.0f;
+
+    switch (kindSolver) {
+      case BCGSTAB:
+        innerIter += data.solver.BCGSTAB_LinSolver(data.rhs, data.sol, mat_vec, *precond, innerTol, m, res, false,
+                                                   config);
+        break;
+      case RESTARTED_FGMRES:
+        innerIter += data.solver.RFGMRES_LinSolver(data.rhs, data.sol, mat_vec, *precond, innerTol, m, res, false,
+                                                   config);
+        break;
+      case CONJUGATE_GRADIENT:
+        innerIter += data.solver.CG_LinSolver(data.rhs, data.sol, mat_vec, *precond, innerTol, m, res, false, config);
+        break;
+      case SMOOTHER:
+        innerIter += data.solver.Smoother_LinSolver(data.rhs, data.sol, mat_vec, *precond, innerTol, m, res, false,
+                                                    config);
+        break;
+      default:
+        innerIter += data.solver.FGMRES_LinSolver(data.rhs, data.sol, mat_vec, *precond, innerTol, m, res, false,
+                                                  config);
+        break;
+    }
+    v.PassiveCopy(data.sol);
+  };
+
+  const CPreconditionerFunction<ScalarType, decltype(innerSolve)> outerPrecond(innerSolve);
+
+  FGMRES_LinSolver(b, x, CSysMatrixVectorProduct<ScalarType>(Jacobian, geometry, config), outerPrecond, tol,
+                   maxOuterIter, residual, monitoring, config);
+
+  delete precond;
+
+  return innerIter;
+#endif
+}
+
 template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
                                            CSysVector<su2double>& LinSysSol, CGeometry* geometry,
                                            const CConfig* config) {
+  SU2_PROFILE_REGION("Linear_Solver");
+
   /*---
    A word about the templated types. It is assumed that the residual and solution vectors are always of su2doubles,
    meaning that they are active in the discrete adjoint. The same assumption is made in SetExternalSolve.
@@ -950,46 +1068,57 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
 
     const auto kindPrec = static_cast<ENUM_LINEAR_SOLVER_PREC>(KindPrecond);
 
-    auto precond = CPreconditioner<ScalarType>::Create(kindPrec, Jacobian, geometry, config);
+    /*--- Mixed precision is only possible with iterative solvers, and only useful if the matrix is of
+     * double precision. In that case the preconditioner is built for the single precision matrix. ---*/
+
+    const bool mixedSolve = mixedPrecision && std::is_same<ScalarType, passivedouble>::value &&
+                            (KindSolver != PASTIX_LDLT) && (KindSolver != PASTIX_LU);
+
+    auto precond = mixedSolve ? nullptr : CPreconditioner<ScalarType>::Create(kindPrec, Jacobian, geometry, config);
 
     /*--- Build preconditioner. ---*/
 
-    precond->Build();
+    if (precond) precond->Build();
 
     /*--- Solve system. ---*/
 
     ScalarType residual = 0.0;
 
-    switch (KindSolver) {
-      case BCGSTAB:
-        IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
-                                       ScreenOutput, config);
-        break;
-      case FGMRES:
-        IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
-                                      ScreenOutput, config);
-        break;
-      case RESTARTED_FGMRES:
-        IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
-                                       ScreenOutput, config);
-        break;
-      case CONJUGATE_GRADIENT:
-        IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
-                                  ScreenOutput, config);
-        break;
-      case SMOOTHER:
-        IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+    if (mixedSolve) {
+      IterLinSol = MixedPrecision_LinSolver(Jacobian, *LinSysRes_ptr, *LinSysSol_ptr, KindSolver, kindPrec, SolverTol,
+                                            MaxIter, residual, ScreenOutput, geometry, config);
+    } else {
+      switch (KindSolver) {
+        case BCGSTAB:
+          IterLinSol = BCGSTAB_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                         residual, ScreenOutput, config);
+          break;
+        case FGMRES:
+          IterLinSol = FGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
                                         ScreenOutput, config);
-        break;
-      case PASTIX_LDLT:
-      case PASTIX_LU:
-        Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
-        Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
-        IterLinSol = 1;
-        residual = 1e-20;
-        break;
-      default:
-        SU2_MPI::Error("Unknown type of linear solver.", CURRENT_FUNCTION);
+          break;
+        case RESTARTED_FGMRES:
+          IterLinSol = RFGMRES_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                         residual, ScreenOutput, config);
+          break;
+        case CONJUGATE_GRADIENT:
+          IterLinSol = CG_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter, residual,
+                                    ScreenOutput, config);
+          break;
+        case SMOOTHER:
+          IterLinSol = Smoother_LinSolver(*LinSysRes_ptr, *LinSysSol_ptr, mat_vec, *precond, SolverTol, MaxIter,
+                                          residual, ScreenOutput, config);
+          break;
+        case PASTIX_LDLT:
+        case PASTIX_LU:
+          Jacobian.BuildPastixPreconditioner(geometry, config, KindSolver);
+          Jacobian.ComputePastixPreconditioner(*LinSysRes_ptr, *LinSysSol_ptr, geometry, config);
+          IterLinSol = 1;
+          residual = 1e-20;
+          break;
+        default:
+          SU2_MPI::Error("Unknown type of linear solver.", CURRENT_FUNCTION);
+      }
     }
 
     SU2_OMP_MASTER {
@@ -1022,6 +1151,9 @@ unsigned long CSysSolve<ScalarType>::Solve(CSysMatrix<ScalarType>& Jacobian, con
         case ILU:
           if (RequiresTranspose) Jacobian.BuildILUPreconditioner();
           break;
+        case AMG:
+          if (RequiresTranspose) Jacobian.BuildAMGPreconditioner(config);
+          break;
         case JACOBI:
         case LINELET:
           if (RequiresTranspose) Jacobian.BuildJacobiPreconditioner();
@@ -1059,6 +1191,8 @@ template <class ScalarType>
 unsigned long CSysSolve<ScalarType>::Solve_b(CSysMatrix<ScalarType>& Jacobian, const CSysVector<su2double>& LinSysRes,
                                              CSysVector<su2double>& LinSysSol, CGeometry* geometry,
                                              const CConfig* config, const bool directCall) {
+  SU2_PROFILE_REGION("Linear_Solver");
+
   unsigned short KindSolver, KindPrecond;
   unsigned long MaxIter, IterLinSol = 0;
   ScalarType SolverTol;
@@ -1173,5 +1307,7 @@ template class CSysSolve<su2double>;
 template class CSysSolve<su2mixedfloat>;
 #ifdef USE_MIXED_PRECISION
 template class CSysSolve<passivedouble>;
+#else
+template class CSysSolve<float>;
 #endif
 #endif
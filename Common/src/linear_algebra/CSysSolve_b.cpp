@@ -75,5 +75,7 @@ void CSysSolve_b<ScalarType>::Solve_b(const su2double::Real* x, su2double::Real*
 template class CSysSolve_b<su2mixedfloat>;
 #ifdef USE_MIXED_PRECISION
 template class CSysSolve_b<passivedouble>;
+#else
+template class CSysSolve_b<float>;
 #endif
 #endif
@@ -74,6 +74,9 @@ template class CSysVector<su2double>;
 #ifdef USE_MIXED_PRECISION
 /*--- In reverse AD (or with mixed precision) we will also have passive (or float) vectors. ---*/
 template class CSysVector<su2mixedfloat>;
+#elif !defined(CODI_FORWARD_TYPE)
+/*--- Float vectors are also used in the runtime mixed precision mode of CSysSolve. ---*/
+template class CSysVector<float>;
 #endif
 #ifdef CODI_REVERSE_TYPE
 template class CSysVector<passivedouble>;
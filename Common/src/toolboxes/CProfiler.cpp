@@ -0,0 +1,258 @@
+/*!
+ * \file CProfiler.cpp
+ * \brief Implementation of the hierarchical profiler of code regions.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CProfiler.hpp"
+#include "../../include/parallelization/omp_structure.hpp"
+#include "../../include/option_structure.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+
+bool CProfiler::enabled = false;
+std::vector<CProfiler::Node> CProfiler::nodes;
+std::vector<CProfiler::OpenRegion> CProfiler::serialStack;
+std::vector<CProfiler::ThreadData> CProfiler::threads;
+
+void CProfiler::Enable(bool enable) {
+  enabled = enable;
+  nodes.clear();
+  serialStack.clear();
+  threads.clear();
+  if (enable) threads.resize(omp_get_max_threads());
+}
+
+int CProfiler::FindRegion(ThreadData& data, int parent, const char* name) {
+  /*--- Fast path, this thread already found this region. ---*/
+  for (size_t i = 0; i < data.cache.size(); ++i) {
+    if (data.cache[i].name == name && data.cache[i].parent == parent) return data.cacheNode[i];
+  }
+
+  /*--- Otherwise search the shared tree by name (the same name may be used from different
+   * translation units, i.e. with different pointers) and add the region if it is new. ---*/
+  int node = -1;
+  SU2_OMP_CRITICAL
+  {
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      if (nodes[i].parent == parent && strcmp(nodes[i].name, name) == 0) {
+        node = i;
+        break;
+      }
+    }
+    if (node < 0) {
+      node = nodes.size();
+      nodes.push_back({name, parent});
+    }
+  }
+  END_SU2_OMP_CRITICAL
+
+  data.cache.push_back({name, parent});
+  data.cacheNode.push_back(node);
+  if (data.calls.size() <= static_cast<size_t>(node)) {
+    data.calls.resize(node + 1, 0);
+    data.time.resize(node + 1, 0.0);
+  }
+  return node;
+}
+
+void CProfiler::Begin(const char* name) {
+  const int thread = omp_get_thread_num();
+  if (thread >= static_cast<int>(threads.size())) return;
+  auto& data = threads[thread];
+
+  /*--- Outside parallel regions the (master) thread uses the serial stack, whose innermost
+   * region is then the parent of the first regions opened by each thread in a parallel region.
+   * The serial stack is only modified outside parallel regions, reading it here is safe. ---*/
+  const bool parallel = omp_in_parallel();
+  auto& stack = parallel ? data.stack : serialStack;
+
+  int parent = -1;
+  if (!stack.empty()) {
+    parent = stack.back().node;
+  } else if (parallel && !serialStack.empty()) {
+    parent = serialStack.back().node;
+  }
+  const int node = FindRegion(data, parent, name);
+
+  stack.push_back({node, SU2_MPI::Wtime()});
+}
+
+void CProfiler::End() {
+  const passivedouble stop = SU2_MPI::Wtime();
+
+  const int thread = omp_get_thread_num();
+  if (thread >= static_cast<int>(threads.size())) return;
+  auto& data = threads[thread];
+  auto& stack = omp_in_parallel() ? data.stack : serialStack;
+  if (stack.empty()) return;
+
+  const auto region = stack.back();
+  stack.pop_back();
+  data.time[region.node] += stop - region.start;
+  data.calls[region.node] += 1;
+}
+
+std::string CProfiler::GetPath(int node) {
+  std::string path = nodes[node].name;
+  for (int parent = nodes[node].parent; parent >= 0; parent = nodes[parent].parent) {
+    path = std::string(nodes[parent].name) + "/" + path;
+  }
+  return path;
+}
+
+std::pair<passivedouble, unsigned long> CProfiler::GetLocalTiming(const std::string& path) {
+  std::pair<passivedouble, unsigned long> timing(0.0, 0);
+  for (size_t node = 0; node < nodes.size(); ++node) {
+    if (GetPath(node) != path) continue;
+    for (const auto& data : threads) {
+      if (data.calls.size() <= node) continue;
+      timing.first = std::max(timing.first, data.time[node]);
+      timing.second = std::max(timing.second, data.calls[node]);
+    }
+  }
+  return timing;
+}
+
+std::vector<CProfiler::RegionSummary> CProfiler::GetSummary() {
+  std::vector<RegionSummary> summary;
+  if (!enabled) return summary;
+
+  /*--- Reduce over the threads of this rank. The time of the rank is that of the slowest thread,
+   * the thread imbalance is max/avg over the threads that executed the region. ---*/
+
+  std::map<std::string, std::array<passivedouble, 3> > local;
+
+  for (size_t node = 0; node < nodes.size(); ++node) {
+    passivedouble maxTime = 0.0, sumTime = 0.0, calls = 0.0;
+    int nThreads = 0;
+    for (const auto& data : threads) {
+      if (data.calls.size() <= node || data.calls[node] == 0) continue;
+      maxTime = std::max(maxTime, data.time[node]);
+      sumTime += data.time[node];
+      calls = std::max(calls, passivedouble(data.calls[node]));
+      ++nThreads;
+    }
+    if (nThreads == 0) continue;
+    const passivedouble imbalance = (sumTime > 0.0) ? maxTime * nThreads / sumTime : 1.0;
+    local[GetPath(node)] = {{maxTime, calls, imbalance}};
+  }
+
+  /*--- Ranks may have executed different regions, the report covers the union of all regions. ---*/
+
+  std::string buffer;
+  for (const auto& region : local) buffer += region.first + '\n';
+
+  std::set<std::string> paths;
+  const int size = SU2_MPI::GetSize();
+  std::vector<char> allBuffers(buffer.begin(), buffer.end());
+
+#ifdef HAVE_MPI
+  if (size > 1) {
+    int length = buffer.size();
+    std::vector<int> lengths(size), displs(size, 0);
+    MPI_Allgather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, SU2_MPI::GetComm());
+    for (int i = 1; i < size; ++i) displs[i] = displs[i - 1] + lengths[i - 1];
+    allBuffers.resize(displs[size - 1] + lengths[size - 1]);
+    MPI_Allgatherv(buffer.data(), length, MPI_CHAR, allBuffers.data(), lengths.data(), displs.data(), MPI_CHAR,
+                   SU2_MPI::GetComm());
+  }
+#endif
+
+  std::string path;
+  for (const char c : allBuffers) {
+    if (c == '\n') {
+      paths.insert(path);
+      path.clear();
+    } else {
+      path += c;
+    }
+  }
+  const auto nRegions = paths.size();
+
+  /*--- Rank values of each region (zero if not executed), reduced with min, max, and sum. ---*/
+
+  std::vector<passivedouble> time(nRegions, 0.0), calls(nRegions, 0.0), threadImbalance(nRegions, 0.0);
+  size_t iRegion = 0;
+  for (const auto& region : paths) {
+    const auto it = local.find(region);
+    if (it != local.end()) {
+      time[iRegion] = it->second[0];
+      calls[iRegion] = it->second[1];
+      threadImbalance[iRegion] = it->second[2];
+    }
+    ++iRegion;
+  }
+
+  std::vector<passivedouble> minTime(time), maxTime(time), sumTime(time), maxCalls(calls),
+      maxThreadImbalance(threadImbalance);
+
+#ifdef HAVE_MPI
+  if (size > 1) {
+    const auto comm = SU2_MPI::GetComm();
+    MPI_Allreduce(time.data(), minTime.data(), nRegions, MPI_DOUBLE, MPI_MIN, comm);
+    MPI_Allreduce(time.data(), maxTime.data(), nRegions, MPI_DOUBLE, MPI_MAX, comm);
+    MPI_Allreduce(time.data(), sumTime.data(), nRegions, MPI_DOUBLE, MPI_SUM, comm);
+    MPI_Allreduce(calls.data(), maxCalls.data(), nRegions, MPI_DOUBLE, MPI_MAX, comm);
+    MPI_Allreduce(threadImbalance.data(), maxThreadImbalance.data(), nRegions, MPI_DOUBLE, MPI_MAX, comm);
+  }
+#endif
+
+  /*--- Regions are sorted by full name, hence sub-regions follow their parent. ---*/
+
+  iRegion = 0;
+  for (const auto& region : paths) {
+    summary.push_back({region, static_cast<unsigned long>(maxCalls[iRegion]), sumTime[iRegion] / size,
+                       minTime[iRegion], maxTime[iRegion], maxThreadImbalance[iRegion]});
+    ++iRegion;
+  }
+  return summary;
+}
+
+void CProfiler::WriteReport(const std::string& fileName) {
+  if (!enabled) return;
+
+  const auto summary = GetSummary();
+
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  std::ofstream file(fileName);
+  file.precision(6);
+  file << "\"Region\",\"Depth\",\"Calls\",\"Avg_Time\",\"Min_Time\",\"Max_Time\",\"Time_Per_Call\","
+          "\"Rank_Imbalance\",\"Thread_Imbalance\"\n";
+
+  for (const auto& region : summary) {
+    const passivedouble perCall = (region.calls > 0) ? region.avgTime / region.calls : 0.0;
+    const passivedouble imbalance = (region.avgTime > 0.0) ? region.maxTime / region.avgTime : 1.0;
+
+    file << '"' << region.path << "\"," << std::count(region.path.begin(), region.path.end(), '/') << ','
+         << region.calls << ',' << std::scientific << region.avgTime << ',' << region.minTime << ','
+         << region.maxTime << ',' << perCall << ',' << std::fixed << imbalance << ',' << region.threadImbalance
+         << '\n';
+  }
+}
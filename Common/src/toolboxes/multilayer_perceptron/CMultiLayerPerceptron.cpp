@@ -0,0 +1,443 @@
+/*!
+ * \file CMultiLayerPerceptron.cpp
+ * \brief Batched evaluation of dense feed-forward neural networks stored in the MLPCpp ASCII format.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/toolboxes/multilayer_perceptron/CMultiLayerPerceptron.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+#include "../../../include/parallelization/omp_structure.hpp"
+
+constexpr unsigned long CMultiLayerPerceptron::BLOCK_SIZE;
+
+CMultiLayerPerceptron::CMultiLayerPerceptron(std::string file_name) : filename(std::move(file_name)) {
+  ReadFile();
+
+  /*--- Work buffers for one block with values, first, and second derivatives. ---*/
+  const unsigned long n_channels = 1 + n_inputs + GetnHessianEntries();
+  work_z.resize(n_channels * BLOCK_SIZE * max_neurons);
+  work_y.resize(n_channels * BLOCK_SIZE * max_neurons);
+  work_f1.resize(BLOCK_SIZE * max_neurons);
+  work_f2.resize(BLOCK_SIZE * max_neurons);
+}
+
+void CMultiLayerPerceptron::ReadFile() {
+  std::ifstream file(filename);
+  if (!file.is_open()) SU2_MPI::Error("There is no MLP file called " + filename, CURRENT_FUNCTION);
+
+  std::string line;
+
+  /*--- Read the next non-empty line, stripped of surrounding white space. ---*/
+  auto next_line = [&]() {
+    while (std::getline(file, line)) {
+      const auto begin = line.find_first_not_of(" \t\r\n");
+      if (begin == std::string::npos) continue;
+      line = line.substr(begin, line.find_last_not_of(" \t\r\n") - begin + 1);
+      return true;
+    }
+    SU2_MPI::Error("Unexpected end of MLP file " + filename, CURRENT_FUNCTION);
+    return false;
+  };
+
+  auto skip_to = [&](const std::string& flag) {
+    do {
+      next_line();
+    } while (line != flag);
+  };
+
+  auto read_pair = [&]() {
+    next_line();
+    std::istringstream stream(line);
+    std::pair<passivedouble, passivedouble> values;
+    stream >> values.first >> values.second;
+    return values;
+  };
+
+  /*--- Header with the architecture and the normalization of the inputs and outputs. ---*/
+  skip_to("<header>");
+  unsigned long n_layers = 0;
+  std::string input_method = "minmax", output_method = "minmax";
+
+  while (next_line() && line != "</header>") {
+    if (line == "[number of layers]") {
+      next_line();
+      n_layers = std::stoul(line);
+      if (n_layers < 2) SU2_MPI::Error("MLP " + filename + " needs at least an input and output layer.", CURRENT_FUNCTION);
+    } else if (n_layers == 0) {
+      SU2_MPI::Error("The number of layers must be the first entry of the header of " + filename, CURRENT_FUNCTION);
+    } else if (line == "[neurons per layer]") {
+      n_neurons.resize(n_layers);
+      for (auto& n : n_neurons) {
+        next_line();
+        n = std::stoul(line);
+      }
+      n_inputs = n_neurons.front();
+      n_outputs = n_neurons.back();
+    } else if (line == "[activation function]") {
+      activation.resize(n_layers);
+      for (auto& function : activation) {
+        next_line();
+        if (line == "linear" || line == "none") function = ACTIVATION::LINEAR;
+        else if (line == "relu") function = ACTIVATION::RELU;
+        else if (line == "elu") function = ACTIVATION::ELU;
+        else if (line == "selu") function = ACTIVATION::SELU;
+        else if (line == "gelu") function = ACTIVATION::GELU;
+        else if (line == "sigmoid") function = ACTIVATION::SIGMOID;
+        else if (line == "swish") function = ACTIVATION::SWISH;
+        else if (line == "tanh") function = ACTIVATION::TANH;
+        else if (line == "exponential") function = ACTIVATION::EXPONENTIAL;
+        else SU2_MPI::Error("Unknown activation function \"" + line + "\" in " + filename, CURRENT_FUNCTION);
+      }
+    } else if (line == "[input names]") {
+      input_names.resize(n_inputs);
+      for (auto& name : input_names) {
+        next_line();
+        name = line;
+      }
+    } else if (line == "[input regularization method]") {
+      next_line();
+      input_method = line;
+    } else if (line == "[input normalization]") {
+      input_norm.resize(n_inputs);
+      for (auto& norm : input_norm) norm = read_pair();
+    } else if (line == "[output names]") {
+      output_names.resize(n_outputs);
+      for (auto& name : output_names) {
+        next_line();
+        name = line;
+      }
+    } else if (line == "[output regularization method]") {
+      next_line();
+      output_method = line;
+    } else if (line == "[output normalization]") {
+      output_norm.resize(n_outputs);
+      for (auto& norm : output_norm) norm = read_pair();
+    }
+  }
+
+  if (n_neurons.empty() || activation.size() != n_layers || input_names.size() != n_inputs ||
+      output_names.size() != n_outputs) {
+    SU2_MPI::Error("Incomplete header in MLP file " + filename, CURRENT_FUNCTION);
+  }
+  max_neurons = *std::max_element(n_neurons.begin(), n_neurons.end());
+
+  /*--- Missing normalization means the network works on dimensional values. ---*/
+  if (input_norm.empty()) input_norm.assign(n_inputs, {0.0, 1.0});
+  if (output_norm.empty()) output_norm.assign(n_outputs, {0.0, 1.0});
+
+  /*--- Min-max values are stored as (min, max), standard scaling as (mean, standard deviation). ---*/
+  auto set_scaling = [&](const std::string& method, const std::vector<std::pair<passivedouble, passivedouble>>& norm,
+                         std::vector<passivedouble>& offset, std::vector<passivedouble>& scale) {
+    const bool minmax = (method == "minmax");
+    if (!minmax && method != "standard")
+      SU2_MPI::Error("Unknown regularization method \"" + method + "\" in " + filename, CURRENT_FUNCTION);
+    for (const auto& values : norm) {
+      const passivedouble range = minmax ? values.second - values.first : values.second;
+      offset.push_back(values.first);
+      scale.push_back(range != 0.0 ? range : 1.0);
+    }
+    return minmax;
+  };
+  minmax_inputs = set_scaling(input_method, input_norm, input_offset, input_scale);
+  set_scaling(output_method, output_norm, output_offset, output_scale);
+
+  /*--- Weights, one block per pair of consecutive layers, one row per neuron of the first layer. ---*/
+  skip_to("[weights per layer]");
+  weights.resize(n_layers - 1);
+  for (auto iLayer = 0ul; iLayer < n_layers - 1; iLayer++) {
+    skip_to("<layer>");
+    weights[iLayer].resize(n_neurons[iLayer], n_neurons[iLayer + 1]);
+    for (auto iNeuron = 0ul; iNeuron < n_neurons[iLayer]; iNeuron++) {
+      next_line();
+      std::istringstream stream(line);
+      for (auto jNeuron = 0ul; jNeuron < n_neurons[iLayer + 1]; jNeuron++) {
+        if (!(stream >> weights[iLayer](iNeuron, jNeuron)))
+          SU2_MPI::Error("Missing weights in layer " + std::to_string(iLayer) + " of " + filename, CURRENT_FUNCTION);
+      }
+    }
+  }
+
+  /*--- Biases, one line per layer (the input layer line is not used). ---*/
+  skip_to("[biases per layer]");
+  biases.resize(n_layers);
+  for (auto iLayer = 0ul; iLayer < n_layers; iLayer++) {
+    next_line();
+    std::istringstream stream(line);
+    biases[iLayer].resize(n_neurons[iLayer]) = 0.0;
+    for (auto iNeuron = 0ul; iNeuron < n_neurons[iLayer]; iNeuron++) {
+      if (!(stream >> biases[iLayer][iNeuron]) && iLayer > 0)
+        SU2_MPI::Error("Missing biases in layer " + std::to_string(iLayer) + " of " + filename, CURRENT_FUNCTION);
+    }
+  }
+}
+
+int CMultiLayerPerceptron::GetInputIndex(const std::string& name) const {
+  const auto it = std::find(input_names.begin(), input_names.end(), name);
+  return it == input_names.end() ? -1 : static_cast<int>(it - input_names.begin());
+}
+
+int CMultiLayerPerceptron::GetOutputIndex(const std::string& name) const {
+  const auto it = std::find(output_names.begin(), output_names.end(), name);
+  return it == output_names.end() ? -1 : static_cast<int>(it - output_names.begin());
+}
+
+void CMultiLayerPerceptron::LayerProduct(unsigned long iLayer, unsigned long n_rows, unsigned long n_value_rows,
+                                         const su2double* y, su2double* z) const {
+  const auto& W = weights[iLayer - 1];
+  const auto& b = biases[iLayer];
+  const auto n_in = W.rows();
+  const auto n_out = W.cols();
+
+  /*--- Four rows are updated per pass over the weights, each weight row is loaded once for the four. ---*/
+  constexpr unsigned long ROWS = 4;
+
+  for (auto iRow = 0ul; iRow < n_rows; iRow += ROWS) {
+    const auto n_block = std::min(ROWS, n_rows - iRow);
+    su2double* z_row[ROWS];
+
+    for (auto k = 0ul; k < n_block; k++) {
+      z_row[k] = z + (iRow + k) * n_out;
+      const bool value_row = (iRow + k) < n_value_rows;
+      for (auto j = 0ul; j < n_out; j++) z_row[k][j] = value_row ? su2double(b[j]) : su2double(0.0);
+    }
+
+    if (n_block == ROWS) {
+      for (auto i = 0ul; i < n_in; i++) {
+        const passivedouble* w = W[i];
+        const su2double y0 = y[iRow * n_in + i], y1 = y[(iRow + 1) * n_in + i];
+        const su2double y2 = y[(iRow + 2) * n_in + i], y3 = y[(iRow + 3) * n_in + i];
+        su2double *z0 = z_row[0], *z1 = z_row[1], *z2 = z_row[2], *z3 = z_row[3];
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (auto j = 0ul; j < n_out; j++) {
+          z0[j] += y0 * w[j];
+          z1[j] += y1 * w[j];
+          z2[j] += y2 * w[j];
+          z3[j] += y3 * w[j];
+        }
+      }
+    } else {
+      for (auto k = 0ul; k < n_block; k++) {
+        for (auto i = 0ul; i < n_in; i++) {
+          const passivedouble* w = W[i];
+          const su2double yk = y[(iRow + k) * n_in + i];
+          su2double* zk = z_row[k];
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (auto j = 0ul; j < n_out; j++) zk[j] += yk * w[j];
+        }
+      }
+    }
+  }
+}
+
+void CMultiLayerPerceptron::Activate(ACTIVATION function, unsigned long n, su2double* z, su2double* f1,
+                                     su2double* f2) {
+  /*--- Each case is a branch-free loop over the block such that the compiler can vectorize it. ---*/
+  switch (function) {
+    case ACTIVATION::LINEAR:
+      if (f1) std::fill(f1, f1 + n, 1.0);
+      if (f2) std::fill(f2, f2 + n, 0.0);
+      break;
+
+    case ACTIVATION::RELU:
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto i = 0ul; i < n; i++) {
+        const su2double x = z[i];
+        if (f1) f1[i] = x > 0 ? 1.0 : 0.0;
+        if (f2) f2[i] = 0.0;
+        z[i] = x > 0 ? x : su2double(0.0);
+      }
+      break;
+
+    case ACTIVATION::ELU:
+    case ACTIVATION::SELU: {
+      const passivedouble scale = (function == ACTIVATION::SELU) ? 1.05070098735548 : 1.0;
+      const passivedouble alpha = (function == ACTIVATION::SELU) ? 1.67326324235437 : 1.0;
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto i = 0ul; i < n; i++) {
+        const su2double x = z[i];
+        const su2double ex = scale * alpha * exp(x > 0 ? su2double(0.0) : x);
+        if (f1) f1[i] = x > 0 ? su2double(scale) : ex;
+        if (f2) f2[i] = x > 0 ? su2double(0.0) : ex;
+        z[i] = x > 0 ? scale * x : ex - scale * alpha;
+      }
+      break;
+    }
+
+    case ACTIVATION::GELU: {
+      /*--- c = sqrt(2 / pi) ---*/
+      const passivedouble c = 0.7978845608028654, a = 0.044715;
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto i = 0ul; i < n; i++) {
+        const su2double x = z[i];
+        const su2double t = tanh(c * (x + a * x * x * x));
+        const su2double dt = 1 - t * t;
+        const su2double du = c * (1 + 3 * a * x * x);
+        if (f1) f1[i] = 0.5 * (1 + t) + 0.5 * x * dt * du;
+        if (f2) f2[i] = dt * du + 0.5 * x * dt * (6 * a * c * x - 2 * t * du * du);
+        z[i] = 0.5 * x * (1 + t);
+      }
+      break;
+    }
+
+    case ACTIVATION::SIGMOID:
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto i = 0ul; i < n; i++) {
+        const su2double s = 1 / (1 + exp(-z[i]));
+        if (f1) f1[i] = s * (1 - s);
+        if (f2) f2[i] = s * (1 - s) * (1 - 2 * s);
+        z[i] = s;
+      }
+      break;
+
+    case ACTIVATION::SWISH:
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto i = 0ul; i < n; i++) {
+        const su2double x = z[i];
+        const su2double s = 1 / (1 + exp(-x));
+        const su2double ds = s * (1 - s);
+        if (f1) f1[i] = s + x * ds;
+        if (f2) f2[i] = ds * (2 + x * (1 - 2 * s));
+        z[i] = x * s;
+      }
+      break;
+
+    case ACTIVATION::TANH:
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto i = 0ul; i < n; i++) {
+        const su2double t = tanh(z[i]);
+        if (f1) f1[i] = 1 - t * t;
+        if (f2) f2[i] = -2 * t * (1 - t * t);
+        z[i] = t;
+      }
+      break;
+
+    case ACTIVATION::EXPONENTIAL:
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto i = 0ul; i < n; i++) {
+        const su2double ex = exp(z[i]);
+        if (f1) f1[i] = ex;
+        if (f2) f2[i] = ex;
+        z[i] = ex;
+      }
+      break;
+  }
+}
+
+unsigned long CMultiLayerPerceptron::PredictBlock(unsigned long n_points, const su2double* inputs,
+                                                  unsigned short n_deriv, su2double* outputs, su2double* d_outputs,
+                                                  su2double* d2_outputs) {
+  /*--- Rows of the work matrices are grouped by channel: values, first derivatives w.r.t. each input, and the
+   * packed second derivatives. Each channel holds n_points consecutive rows. ---*/
+  const unsigned long n_hessian = GetnHessianEntries();
+  const unsigned long n_first = (n_deriv > 0) ? n_inputs : 0;
+  const unsigned long n_second = (n_deriv > 1) ? n_hessian : 0;
+  const unsigned long n_rows = (1 + n_first + n_second) * n_points;
+
+  su2double* y = work_y.data();
+  su2double* z = work_z.data();
+  unsigned long n_outside = 0;
+
+  /*--- Input layer, normalized inputs and their derivatives w.r.t. the dimensional inputs. ---*/
+  std::fill(y, y + n_rows * n_inputs, 0.0);
+  for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+    bool outside = false;
+    for (auto iInput = 0u; iInput < n_inputs; iInput++) {
+      const su2double x = (inputs[iPoint * n_inputs + iInput] - input_offset[iInput]) / input_scale[iInput];
+      outside |= minmax_inputs && (x < 0 || x > 1);
+      y[iPoint * n_inputs + iInput] = x;
+    }
+    n_outside += outside;
+  }
+  for (auto iInput = 0ul; iInput < n_first; iInput++) {
+    for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+      y[((1 + iInput) * n_points + iPoint) * n_inputs + iInput] = 1.0 / input_scale[iInput];
+    }
+  }
+
+  /*--- Hidden and output layers. ---*/
+  for (auto iLayer = 1ul; iLayer < n_neurons.size(); iLayer++) {
+    const auto width = n_neurons[iLayer];
+    const auto n_values = n_points * width;
+
+    LayerProduct(iLayer, n_rows, n_points, y, z);
+
+    if (activation[iLayer] != ACTIVATION::LINEAR) {
+      su2double* f1 = work_f1.data();
+      su2double* f2 = work_f2.data();
+      Activate(activation[iLayer], n_values, z, n_deriv > 0 ? f1 : nullptr, n_deriv > 1 ? f2 : nullptr);
+
+      /*--- Chain rule, d2y/dxidxj = f'' dz/dxi dz/dxj + f' d2z/dxidxj, before the first derivatives are updated. ---*/
+      for (auto i = 0ul, iHessian = 0ul; i < n_inputs && n_second > 0; i++) {
+        for (auto j = i; j < n_inputs; j++, iHessian++) {
+          const su2double* zi = z + (1 + i) * n_values;
+          const su2double* zj = z + (1 + j) * n_values;
+          su2double* zij = z + (1 + n_first + iHessian) * n_values;
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (auto k = 0ul; k < n_values; k++) zij[k] = f2[k] * zi[k] * zj[k] + f1[k] * zij[k];
+        }
+      }
+      for (auto i = 0ul; i < n_first; i++) {
+        su2double* zi = z + (1 + i) * n_values;
+        SU2_OMP_SIMD_IF_NOT_AD
+        for (auto k = 0ul; k < n_values; k++) zi[k] *= f1[k];
+      }
+    }
+    std::swap(y, z);
+  }
+
+  /*--- Scale the outputs back to dimensional values. ---*/
+  const unsigned long n_values = n_points * n_outputs;
+  for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+    for (auto iOutput = 0ul; iOutput < n_outputs; iOutput++) {
+      const auto iValue = iPoint * n_outputs + iOutput;
+      const auto scale = output_scale[iOutput];
+      outputs[iValue] = output_offset[iOutput] + scale * y[iValue];
+      for (auto i = 0ul; i < n_first; i++) d_outputs[iValue * n_inputs + i] = scale * y[(1 + i) * n_values + iValue];
+      for (auto i = 0ul; i < n_second; i++)
+        d2_outputs[iValue * n_hessian + i] = scale * y[(1 + n_first + i) * n_values + iValue];
+    }
+  }
+  return n_outside;
+}
+
+unsigned long CMultiLayerPerceptron::Predict(unsigned long n_points, const su2double* inputs, unsigned short n_deriv,
+                                             su2double* outputs, su2double* d_outputs, su2double* d2_outputs) {
+  if ((n_deriv > 0 && !d_outputs) || (n_deriv > 1 && !d2_outputs)) {
+    SU2_MPI::Error("Derivative outputs were requested without storage.", CURRENT_FUNCTION);
+  }
+  unsigned long n_outside = 0;
+
+  for (auto iPoint = 0ul; iPoint < n_points; iPoint += BLOCK_SIZE) {
+    const auto n_block = std::min(BLOCK_SIZE, n_points - iPoint);
+    const auto iValue = iPoint * n_outputs;
+    n_outside += PredictBlock(n_block, inputs + iPoint * n_inputs, n_deriv, outputs + iValue,
+                              n_deriv > 0 ? d_outputs + iValue * n_inputs : nullptr,
+                              n_deriv > 1 ? d2_outputs + iValue * GetnHessianEntries() : nullptr);
+  }
+  return n_outside;
+}
@@ -79,6 +79,10 @@ class CDriver : public CDriverBase {
   CInterface*** interface_container; /*!< \brief Definition of the interface of information and physics. */
   bool dry_run;                      /*!< \brief Flag if SU2_CFD was started as dry-run via "SU2_CFD -d <config>.cfg" */
 
+  passivedouble costMeasurementStart = 0.0; /*!< \brief Wall time at which the cost of the points started being measured. */
+  vector<passivedouble> rebalanceWeights;   /*!< \brief Measured cost of the points of the linear partition, used to
+                                                 partition the grid when it is rebuilt by Rebalance. */
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -105,6 +109,24 @@ class CDriver : public CDriverBase {
    */
   void InitializeContainers();
 
+  /*!
+   * \brief Print the time per iteration of each profiled phase and append it to scaling_benchmark.csv (benchmark mode).
+   * \note Must be called by all ranks.
+   */
+  void PrintBenchmarkSummary() const;
+
+  /*!
+   * \brief Start measuring the cost of the point-specific work of ZONE_0, for dynamic load balancing.
+   */
+  void StartCostMeasurement();
+
+  /*!
+   * \brief Stop measuring the cost of the points and, if the measured load imbalance exceeds the tolerance,
+   *        repartition the grid of ZONE_0 with the measured costs, rebuild the solvers, and migrate the solution.
+   * \note Only for single-zone primal FVM problems on static grids, must be called by all ranks between iterations.
+   */
+  void Rebalance();
+
   /*!
    * \brief Read in the config and mesh files.
    * \param[in] config - Definition of the particular problem.
@@ -34,6 +34,41 @@ class AbstractState;
 }
 #endif
 #include <memory>
+#include <vector>
+
+/*!
+ * \brief Thermodynamic properties of a CoolProp fluid tabulated on a structured grid in (log(rho), e), with the
+ * nodal first derivatives and cross derivatives required for bicubic Hermite interpolation of pressure and
+ * temperature. The grid is log-spaced in density, whose range typically spans orders of magnitude.
+ * \note A table is built once and shared (read-only) by the fluid model objects of all threads.
+ */
+struct CCoolPropTable {
+  /*!
+   * \brief Data stored per node, x = log(rho). The value and derivatives of each interpolated variable must be
+   * consecutive (see CCoolProp::SetTDState_rhoe_Table).
+   */
+  enum : unsigned short { I_P, I_DPDX, I_DPDE, I_D2PDXDE, I_T, I_DTDX, I_DTDE, I_D2TDXDE, I_C2, I_S, I_CP, N_DATA };
+
+  string fluid;                  /*!< \brief Name of the fluid. */
+  unsigned long n_rho = 0,       /*!< \brief Number of density nodes. */
+                n_e = 0;         /*!< \brief Number of energy nodes. */
+  passivedouble rho_min = 0.0,   /*!< \brief Density range. */
+                rho_max = 0.0,
+                e_min = 0.0,     /*!< \brief Energy range. */
+                e_max = 0.0;
+  passivedouble log_rho_min = 0.0, /*!< \brief Logarithm of the minimum density. */
+                dx = 0.0,          /*!< \brief Spacing of the nodes in log(rho). */
+                de = 0.0;          /*!< \brief Spacing of the nodes in e. */
+  std::vector<passivedouble> data; /*!< \brief Node-major data, nodes without valid data have a NaN pressure. */
+
+  /*!
+   * \brief Data of node (iRho, iE).
+   */
+  inline passivedouble* Node(unsigned long iRho, unsigned long iE) { return &data[(iRho * n_e + iE) * N_DATA]; }
+  inline const passivedouble* Node(unsigned long iRho, unsigned long iE) const {
+    return &data[(iRho * n_e + iE) * N_DATA];
+  }
+};
 
 /*!
  * \class CCoolProp
@@ -51,6 +86,47 @@ class CCoolProp final : public CFluidModel {
   const su2double dt{0.01};            /*!< threshold for temperature */
 #ifdef USE_COOLPROP
   std::unique_ptr<CoolProp::AbstractState> fluid_entity; /*!< \brief fluid entity */
+  std::shared_ptr<const CCoolPropTable> table;            /*!< \brief Tabulated fluid, nullptr if not used. */
+
+  /*!
+   * \brief Read the table from its cache file, or build it with CoolProp and write the cache file.
+   * \param[in] layout - Fluid, ranges, and size of the table.
+   * \param[in] file_name - Cache file.
+   * \return The table.
+   */
+  std::shared_ptr<const CCoolPropTable> BuildTable(CCoolPropTable layout, const string& file_name);
+
+  /*!
+   * \brief Set the state using density and internal energy by calling CoolProp.
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   */
+  void SetTDState_rhoe_CoolProp(su2double rho, su2double e);
+
+  /*!
+   * \brief Set the state using density and internal energy by interpolation in the table.
+   * \param[in] rho - first thermodynamic variable.
+   * \param[in] e - second thermodynamic variable.
+   * \return False if the state is outside the table or in a cell where CoolProp failed.
+   */
+  bool SetTDState_rhoe_Table(su2double rho, su2double e);
+
+  /*!
+   * \brief Set the state using pressure and temperature, by Newton iterations on the table.
+   * \param[in] P - first thermodynamic variable.
+   * \param[in] T - second thermodynamic variable.
+   * \return False if the iterations leave the table or do not converge.
+   */
+  bool SetTDState_PT_Table(su2double P, su2double T);
+
+  /*!
+   * \brief Set the state using density and pressure or temperature, by Newton iterations on the table.
+   * \param[in] rho - Density.
+   * \param[in] target - Pressure or temperature.
+   * \param[in] temperature - The target is the temperature.
+   * \return False if the iterations leave the table or do not converge.
+   */
+  bool SetTDState_rhoX_Table(su2double rho, su2double target, bool temperature);
 #endif
   /*!
    * \brief Avoid critical pressure
@@ -78,8 +154,10 @@ class CCoolProp final : public CFluidModel {
  public:
   /*!
    * \brief Constructor of the class.
+   * \param[in] fluidname - Name of the CoolProp fluid.
+   * \param[in] config - Definition of the tabulation (COOLPROP_TABULATION), nullptr to always call CoolProp.
    */
-  CCoolProp(const string& fluidname);
+  CCoolProp(const string& fluidname, const CConfig* config = nullptr);
 
 #ifdef USE_COOLPROP
   /*!
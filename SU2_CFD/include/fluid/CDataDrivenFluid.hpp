@@ -30,11 +30,7 @@
 
 #include <vector>
 #include "../../../Common/include/containers/CLookUpTable.hpp"
-#if defined(HAVE_MLPCPP)
-#define MLP_CUSTOM_TYPE su2double
-#include "../../../subprojects/MLPCpp/include/CLookUp_ANN.hpp"
-#define USE_MLPCPP
-#endif
+#include "../../../Common/include/toolboxes/multilayer_perceptron/CMultiLayerPerceptron.hpp"
 #include "CFluidModel.hpp"
 
 /*!
@@ -55,6 +51,19 @@ class CDataDrivenFluid final : public CFluidModel {
   size_t idx_rho, /*!< \brief Interpolator index for density input. */
       idx_e;      /*!< \brief Interpolator index for energy input. */
 
+  /*!
+   * \brief Position of the entropy and its derivatives in the data set evaluations (point-major arrays).
+   */
+  enum ENTROPY_DATA : unsigned short {
+    I_S,         /*!< \brief Entropy. */
+    I_DSDE_RHO,  /*!< \brief Entropy derivative w.r.t. static energy. */
+    I_DSDRHO_E,  /*!< \brief Entropy derivative w.r.t. density. */
+    I_D2SDE2,    /*!< \brief Entropy second derivative w.r.t. static energy. */
+    I_D2SDEDRHO, /*!< \brief Entropy second derivative w.r.t. density and static energy. */
+    I_D2SDRHO2,  /*!< \brief Entropy second derivative w.r.t. density. */
+    N_ENTROPY_DATA
+  };
+
   su2double Newton_Relaxation, /*!< \brief Relaxation factor for Newton solvers. */
       rho_start,               /*!< \brief Starting value for the density in Newton solver processes. */
       e_start,                 /*!< \brief Starting value for the energy in Newton solver processes. */
@@ -88,13 +97,26 @@ class CDataDrivenFluid final : public CFluidModel {
   vector<su2double*> outputs_rhoe; /*!< \brief Pointers to output variables. */
 
   /*--- Class variables for the multi-layer perceptron method ---*/
-#ifdef USE_MLPCPP
-  MLPToolbox::CLookUp_ANN* lookup_mlp; /*!< \brief Multi-layer perceptron collection. */
-  MLPToolbox::CIOMap* iomap_rhoe;      /*!< \brief Input-output map. */
-#endif
-  vector<su2double> MLP_inputs; /*!< \brief Inputs for the multi-layer perceptron look-up operation. */
+  vector<CMultiLayerPerceptron> mlp_networks; /*!< \brief Networks listed in the data-driven input files. */
+  vector<unsigned short> mlp_idx_rho,         /*!< \brief Density input index of each network. */
+      mlp_idx_e;                              /*!< \brief Energy input index of each network. */
+  vector<pair<unsigned short, unsigned short>> mlp_output_map; /*!< \brief Network and output index of each entry of
+                                                                  the data set, when all are network outputs. */
+  int mlp_entropy_network = -1; /*!< \brief Network that provides the entropy, whose derivatives are computed
+                                   analytically, -1 if the derivatives are network outputs. */
+  unsigned short mlp_idx_s = 0; /*!< \brief Output index of the entropy in mlp_entropy_network. */
+  vector<su2double> mlp_inputs, /*!< \brief Inputs of the batched network evaluations. */
+      mlp_outputs,              /*!< \brief Outputs of the batched network evaluations. */
+      mlp_d_outputs,            /*!< \brief First derivatives of the network outputs. */
+      mlp_d2_outputs;           /*!< \brief Second derivatives of the network outputs. */
 
-  CLookUpTable* lookup_table; /*!< \brief Look-up table regression object. */
+  CLookUpTable* lookup_table = nullptr; /*!< \brief Look-up table regression object. */
+  vector<unsigned long> idx_vars_LUT;   /*!< \brief Table columns of the data set entries. */
+
+  su2double dataset[N_ENTROPY_DATA];   /*!< \brief Data set evaluation of the current state. */
+  vector<su2double> batch_rho, batch_e, /*!< \brief Compacted states of the batched Newton solvers. */
+      batch_dataset;                     /*!< \brief Data set evaluations of the batched Newton solvers. */
+  vector<unsigned long> batch_active;    /*!< \brief Points that are not converged in the batched Newton solvers. */
 
   unsigned long outside_dataset, /*!< \brief Density-energy combination lies outside data set. */
       nIter_Newton;              /*!< \brief Number of Newton solver iterations. */
@@ -105,28 +127,66 @@ class CDataDrivenFluid final : public CFluidModel {
   void MapInputs_to_Outputs();
 
   /*!
-   * \brief Evaluate dataset through multi-layer perceptron.
-   * \param[in] rho - Density value.
-   * \param[in] e - Static energy value.
-   * \return Query point lies outside MLP normalization range (0 is inside, 1 is outside).
+   * \brief Evaluate dataset through multi-layer perceptrons, for a batch of states at once.
+   * \param[in] n_points - Number of states.
+   * \param[in] rho - Density values.
+   * \param[in] e - Static energy values.
+   * \param[out] data - Point-major entropy data (n_points x N_ENTROPY_DATA).
+   * \return Number of query points outside the MLP normalization range.
    */
-  unsigned long Predict_MLP(su2double rho, su2double e);
+  unsigned long Predict_MLP(unsigned long n_points, const su2double* rho, const su2double* e, su2double* data);
 
   /*!
-   * \brief Evaluate dataset through look-up table.
-   * \param[in] rho - Density value.
-   * \param[in] e - Static energy value.
-   * \return Query point lies outside table data range (0 is inside, 1 is outside).
+   * \brief Evaluate dataset through look-up table, for a batch of states at once.
+   * \param[in] n_points - Number of states.
+   * \param[in] rho - Density values.
+   * \param[in] e - Static energy values.
+   * \param[out] data - Point-major entropy data (n_points x N_ENTROPY_DATA).
+   * \param[out] exit_codes - Optional per-point flags (1 if outside the table).
+   * \return Number of query points outside the table data range.
    */
-  unsigned long Predict_LUT(su2double rho, su2double e);
+  unsigned long Predict_LUT(unsigned long n_points, const su2double* rho, const su2double* e, su2double* data,
+                            unsigned long* exit_codes = nullptr);
 
   /*!
-   * \brief Evaluate the data set.
+   * \brief Evaluate the data set for a batch of states.
+   * \param[in] n_points - Number of states.
+   * \param[in] rho - Density values.
+   * \param[in] e - Static energy values.
+   * \param[out] data - Point-major entropy data (n_points x N_ENTROPY_DATA).
+   * \param[out] exit_codes - Optional per-point flags (1 if outside the data set).
+   * \return Number of query points outside the data set.
+   */
+  unsigned long Evaluate_Dataset(unsigned long n_points, const su2double* rho, const su2double* e, su2double* data,
+                                 unsigned long* exit_codes = nullptr);
+
+  /*!
+   * \brief Evaluate the data set for a single state and store the entropy derivatives in the class members.
    * \param[in] rho - Density value.
    * \param[in] e - Static energy value.
    */
   void Evaluate_Dataset(su2double rho, su2double e);
 
+  /*!
+   * \brief Compute pressure, temperature and their derivatives from the entropy data of a state.
+   * \param[in] rho - Density value.
+   * \param[in] data - Entropy data of the state.
+   * \param[out] PT - Pressure, temperature, dPdrho_e, dPde_rho, dTdrho_e, dTde_rho.
+   */
+  static void EntropyToPT(su2double rho, const su2double* data, su2double* PT);
+
+  /*!
+   * \brief Linearize the current thermodynamic state (the previous solution) to estimate the density and energy
+   * corresponding to a new pressure and temperature, or pressure and density, target.
+   * \param[in] P - Target pressure.
+   * \param[in] T - Target temperature (ignored if rho is fixed).
+   * \param[in,out] rho - Fixed density if fix_rho is true, density estimate otherwise.
+   * \param[out] e - Energy estimate.
+   * \param[in] fix_rho - Density is a target instead of an unknown.
+   * \return True if the estimate is usable, i.e. close to the current state and inside the data set.
+   */
+  bool WarmStart(su2double P, su2double T, su2double& rho, su2double& e, bool fix_rho) const;
+
   /*!
    * \brief 2D Newton solver for computing the density and energy corresponding to Y1_target and Y2_target.
    * \param[in] Y1_target - Target value for output quantity 1.
@@ -150,6 +210,20 @@ class CDataDrivenFluid final : public CFluidModel {
    */
   void Run_Newton_Solver(su2double Y_target, su2double* Y, su2double* X, su2double* dYdX);
 
+  /*!
+   * \brief Batched Newton solver for the density and energy corresponding to pressure and temperature targets, or
+   * for the energy corresponding to pressure targets at fixed density.
+   * \param[in] n_points - Number of states.
+   * \param[in] P - Target pressure values.
+   * \param[in] T - Target temperature values (not used for fixed density).
+   * \param[in] rho_fixed - Fixed density values, nullptr to solve for the density.
+   * \param[in,out] rho_var - Density values if the density is solved for.
+   * \param[in,out] e - Static energy values.
+   * \return Number of states for which the solver did not converge.
+   */
+  unsigned long Run_Newton_Solver_Batch(unsigned long n_points, const su2double* P, const su2double* T,
+                                        const su2double* rho_fixed, su2double* rho_var, su2double* e);
+
   void ComputeIdealGasQuantities();
  public:
   /*!
@@ -172,6 +246,19 @@ class CDataDrivenFluid final : public CFluidModel {
    */
   void SetTDState_PT(su2double P, su2double T) override;
 
+  /*!
+   * \brief Set the states of a batch of points using density and internal energy, with one evaluation of the
+   * data set for the whole batch.
+   * \param[in,out] states - Density and StaticEnergy on input, the other properties on output.
+   */
+  void SetTDState_rhoe_Batch(CFluidStateBatch& states) override;
+
+  /*!
+   * \brief Set the states of a batch of points using pressure and temperature, with the batched Newton solver.
+   * \param[in,out] states - Pressure and Temperature on input, the other properties on output.
+   */
+  void SetTDState_PT_Batch(CFluidStateBatch& states) override;
+
   /*!
    * \brief Set the Dimensionless State using Pressure and Density.
    * \param[in] P - first thermodynamic variable (pressure).
@@ -206,6 +293,29 @@ class CDataDrivenFluid final : public CFluidModel {
    */
   void SetTDState_Ps(su2double P, su2double s) override;
 
+  /*!
+   * \brief Invert pressure and temperature to density and energy for a batch of states. All states are iterated
+   * together, each iteration evaluates the data set for the unconverged states in one batch.
+   * \param[in] n_points - Number of states.
+   * \param[in] P - Pressure values.
+   * \param[in] T - Temperature values.
+   * \param[in,out] rho - Density values, used as initial guess if they lie inside the data set (warm start).
+   * \param[in,out] e - Static energy values, used as initial guess if they lie inside the data set (warm start).
+   * \return Number of states for which the Newton solver did not converge.
+   */
+  unsigned long ComputeDensityEnergy_PT(unsigned long n_points, const su2double* P, const su2double* T,
+                                        su2double* rho, su2double* e);
+
+  /*!
+   * \brief Invert pressure and density to energy for a batch of states, see ComputeDensityEnergy_PT.
+   * \param[in] n_points - Number of states.
+   * \param[in] P - Pressure values.
+   * \param[in] rho - Density values.
+   * \param[in,out] e - Static energy values, used as initial guess if they lie inside the data set (warm start).
+   * \return Number of states for which the Newton solver did not converge.
+   */
+  unsigned long ComputeEnergy_Prho(unsigned long n_points, const su2double* P, const su2double* rho, su2double* e);
+
   /*!
    * \brief Get fluid model extrapolation instance.
    * \return Query point lies outside fluid model data range.
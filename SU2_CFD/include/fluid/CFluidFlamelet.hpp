@@ -77,6 +77,18 @@ class CFluidFlamelet final : public CFluidModel {
   vector<su2double> val_vars_TD, /*!< \brief References to thermodynamic state variables. */
       val_vars_Sources, val_vars_LookUp;
 
+  vector<unsigned long> idx_vars_TD, /*!< \brief Lookup table column indices of the lookup variables. */
+      idx_vars_Sources, idx_vars_LookUp;
+
+  /*! \brief Triangle search hints of the lower and upper table levels from the last lookup. */
+  unsigned long triangle_hint[2] = {CLookUpTable::NO_VARIABLE, CLookUpTable::NO_VARIABLE};
+
+  /*!
+   * \brief Get the variable names and table column indices for a type of manifold lookup.
+   */
+  void GetLookUpVariables(unsigned short lookup_type, const vector<string>*& varnames,
+                          const vector<unsigned long>*& idx_vars);
+
   void PreprocessLookUp(CConfig* config);
 
  public:
@@ -101,6 +113,21 @@ class CFluidFlamelet final : public CFluidModel {
   inline unsigned long EvaluateDataSet(const vector<su2double>& input_scalar, unsigned short lookup_type,
                                        vector<su2double>& output_refs) override;
 
+  /*!
+   * \brief Evaluate the flamelet manifold for a batch of points, reusing table search hints between points.
+   * \param[in] n_points - number of points in the batch.
+   * \param[in] input_scalars - point-major scalar solution, n_points x n_inputs.
+   * \param[in] n_inputs - number of scalars per point.
+   * \param[in] lookup_type - type of manifold lookup.
+   * \param[out] output_refs - point-major output data, n_points x n_outputs.
+   * \param[in] n_outputs - number of outputs per point.
+   * \param[out] misses - per point, within manifold bounds (0) or out of bounds (1).
+   * \return Number of points outside the manifold bounds.
+   */
+  unsigned long EvaluateDataSetBatch(unsigned long n_points, const su2double* input_scalars, unsigned short n_inputs,
+                                     unsigned short lookup_type, su2double* output_refs, unsigned short n_outputs,
+                                     unsigned long* misses) override;
+
   /*!
    * \brief Check for out-of-bounds condition for data set interpolation.
    * \return - within bounds (0) or out of bounds (1).
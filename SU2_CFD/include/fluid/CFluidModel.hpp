@@ -39,6 +39,30 @@
 using namespace std;
 
 class CLookUpTable;
+
+/*!
+ * \brief Thermodynamic states of a block of points in struct-of-arrays layout, for the batched interface of the
+ * fluid models (e.g. CFluidModel::SetTDState_rhoe_Batch). The fixed capacity keeps the arrays on the stack and
+ * contiguous, such that the models can evaluate them in vectorized loops.
+ */
+struct CFluidStateBatch {
+  static constexpr unsigned long MAXSIZE = 64; /*!< \brief Maximum number of states in a batch. */
+
+  unsigned long size = 0; /*!< \brief Number of states in the batch. */
+
+  su2double Density[MAXSIZE];      /*!< \brief Density. */
+  su2double StaticEnergy[MAXSIZE]; /*!< \brief Internal Energy. */
+  su2double Pressure[MAXSIZE];     /*!< \brief Pressure. */
+  su2double Temperature[MAXSIZE];  /*!< \brief Temperature. */
+  su2double SoundSpeed2[MAXSIZE];  /*!< \brief Speed of sound squared. */
+  su2double Entropy[MAXSIZE];      /*!< \brief Entropy (only computed by models that compute it in the scalar case). */
+  su2double dPdrho_e[MAXSIZE];     /*!< \brief DpDd_e. */
+  su2double dPde_rho[MAXSIZE];     /*!< \brief DpDe_d. */
+  su2double dTdrho_e[MAXSIZE];     /*!< \brief DTDd_e. */
+  su2double dTde_rho[MAXSIZE];     /*!< \brief DTDe_d. */
+  unsigned long Extrapolation[MAXSIZE]; /*!< \brief State lies outside the data of tabulated models. */
+};
+
 /*!
  * \class CFluidModel
  * \brief Main class for defining the Thermo-Physical Model
@@ -149,6 +173,22 @@ class CFluidModel {
    */
   virtual unsigned long EvaluateDataSet(const vector<su2double> &input_scalar, unsigned short lookup_type, vector<su2double> &output_refs) { return 0; }
 
+  /*!
+   * \brief Evaluate data manifold for a batch of points, the default evaluates one point at a time.
+   * \param[in] n_points - number of points in the batch.
+   * \param[in] input_scalars - point-major input data, n_points x n_inputs.
+   * \param[in] n_inputs - number of inputs per point.
+   * \param[in] lookup_type - type of manifold lookup.
+   * \param[out] output_refs - point-major output data, n_points x n_outputs.
+   * \param[in] n_outputs - number of outputs per point.
+   * \param[out] misses - per point, within manifold bounds (0) or out of bounds (1).
+   * \return Number of points outside the manifold bounds.
+   */
+  virtual unsigned long EvaluateDataSetBatch(unsigned long n_points, const su2double* input_scalars,
+                                             unsigned short n_inputs, unsigned short lookup_type,
+                                             su2double* output_refs, unsigned short n_outputs,
+                                             unsigned long* misses);
+
   /*!
    * \brief Get fluid dynamic viscosity.
    */
@@ -260,6 +300,22 @@ class CFluidModel {
    */
   virtual void SetMassDiffusivityModel(const CConfig* config);
 
+  /*!
+   * \brief Set the thermodynamic states of a batch of points from density and static energy.
+   * \note The default evaluates one state at a time with SetTDState_rhoe. Afterwards, the scalar state of the model
+   * (GetPressure, etc.) is undefined.
+   * \param[in,out] states - Density and StaticEnergy on input, the other properties on output.
+   */
+  virtual void SetTDState_rhoe_Batch(CFluidStateBatch& states);
+
+  /*!
+   * \brief Set the thermodynamic states of a batch of points from pressure and temperature.
+   * \note The default evaluates one state at a time with SetTDState_PT. Afterwards, the scalar state of the model
+   * (GetPressure, etc.) is undefined.
+   * \param[in,out] states - Pressure and Temperature on input, the other properties on output.
+   */
+  virtual void SetTDState_PT_Batch(CFluidStateBatch& states);
+
   /*!
    * \brief virtual member that would be different for each gas model implemented
    * \param[in] InputSpec - Input pair for FLP calls ("e, rho").
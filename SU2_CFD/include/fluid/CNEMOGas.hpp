@@ -88,6 +88,20 @@ protected:
 
 public:
 
+  static constexpr unsigned long BATCH_SIZE = 16; /*!< \brief Points evaluated together by the batched source terms. */
+
+  /*!
+   * \brief Per point inputs and outputs of the Jacobians of the batched source terms (one pointer per point).
+   */
+  struct SourceJacobians {
+    const su2double* const* eve = nullptr;    /*!< \brief Species V-E energies. */
+    const su2double* const* cvve = nullptr;   /*!< \brief Species V-E specific heats. */
+    const su2double* const* dTdU = nullptr;   /*!< \brief Derivatives of T w.r.t. the conservative variables. */
+    const su2double* const* dTvedU = nullptr; /*!< \brief Derivatives of Tve w.r.t. the conservative variables. */
+    su2double** const* chemistry = nullptr;   /*!< \brief Jacobians of the net production rates (nVar x nVar). */
+    su2double** const* relaxation = nullptr;  /*!< \brief Jacobians of the VT energy exchange (nVar x nVar). */
+  };
+
   /*!
    * \brief Constructor of the class.
    */
@@ -144,6 +158,28 @@ public:
    */
   virtual su2double ComputeEveSourceTerm() { return 0; }
 
+  /*!
+   * \brief Check if the model implements ComputeSourceTerms_Batch.
+   */
+  virtual bool SupportsBatchSourceTerms() const { return false; }
+
+  /*!
+   * \brief Compute the net production rates and the vibrational energy source terms of a batch of points.
+   * \note The object is not modified, hence the function can be called concurrently by multiple threads.
+   * The Jacobians are assembled per point from the rates computed for the batch, they are overwritten and
+   * not multiplied by the volume (as in ComputeNetProductionRates and GetEveSourceTermJacobian).
+   * \param[in] nPoints - Number of points.
+   * \param[in] val_rhos - Species partial densities, point-major (nPoints x nSpecies).
+   * \param[in] val_T - Translational/Rotational temperatures.
+   * \param[in] val_Tve - Vibrational/Electronic temperatures.
+   * \param[out] val_ws - Species net production rates, point-major (zero for frozen mixtures).
+   * \param[out] val_omega - Vibrational energy source terms.
+   * \param[in,out] val_jacobians - Inputs and outputs of the Jacobians, nullptr to compute only the residuals.
+   */
+  virtual void ComputeSourceTerms_Batch(unsigned long nPoints, const su2double* val_rhos, const su2double* val_T,
+                                        const su2double* val_Tve, su2double* val_ws, su2double* val_omega,
+                                        const SourceJacobians* val_jacobians = nullptr) const {}
+
   /*!
    * \brief Compute vibration enery source term jacobian.
    */
@@ -62,6 +62,19 @@ class CPengRobinson final : public CIdealGas {
    */
   void SetTDState_PT(su2double P, su2double T) override;
 
+  /*!
+   * \brief Set the states of a batch of points using density and internal energy, in one vectorized loop.
+   * \note The scalar version is used in AD builds to keep its preaccumulation.
+   * \param[in,out] states - Density and StaticEnergy on input, the other properties on output.
+   */
+  void SetTDState_rhoe_Batch(CFluidStateBatch& states) override;
+
+  /*!
+   * \brief Set the states of a batch of points using pressure and temperature (one Newton solve per point).
+   * \param[in,out] states - Pressure and Temperature on input, the other properties on output.
+   */
+  void SetTDState_PT_Batch(CFluidStateBatch& states) override { CFluidModel::SetTDState_PT_Batch(states); }
+
   /*!
    * \brief Set the Dimensionless State using Pressure and Density
    * \param[in] P - first thermodynamic variable.
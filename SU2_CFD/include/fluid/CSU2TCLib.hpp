@@ -92,10 +92,13 @@ private:
   su2activematrix CharElTemp,    /*!< \brief Characteristic temperature of electron states. */
   ElDegeneracy,                  /*!< \brief Degeneracy of electron states. */
   RxnConstantTable,              /*!< \brief Table of chemical equiibrium reaction constants */
+  MillikanWhite_A,               /*!< \brief Millikan & White relaxation time coefficient A of each species pair. */
+  MillikanWhite_B,               /*!< \brief Millikan & White relaxation time coefficient B of each species pair. */
   Blottner,                      /*!< \brief Blottner viscosity coefficients */
   Dij;                           /*!< \brief Binary diffusion coefficients. */
 
-  C3DDoubleMatrix Omega11,       /*!< \brief Collision integrals (Omega^(1,1)) */
+  C3DDoubleMatrix RxnEquilConstants, /*!< \brief RxnConstantTable of each reaction, tabulated at construction. */
+  Omega11,                       /*!< \brief Collision integrals (Omega^(1,1)) */
   Omega22;                       /*!< \brief Collision integrals (Omega^(2,2)) */
 
   /*--- Implicit variables ---*/
@@ -181,6 +184,27 @@ public:
    */
   su2double ComputeEveSourceTerm() final;
 
+  /*!
+   * \brief The batched source terms are implemented for all the gas models of the library.
+   */
+  bool SupportsBatchSourceTerms() const final {
+    return nSpecies == 1 || nSpecies == 2 || nSpecies == 5 || nSpecies == 7;
+  }
+
+  /*!
+   * \brief Compute the net production rates and the vibrational energy source terms of a batch of points.
+   * \param[in] nPoints - Number of points.
+   * \param[in] val_rhos - Species partial densities, point-major (nPoints x nSpecies).
+   * \param[in] val_T - Translational/Rotational temperatures.
+   * \param[in] val_Tve - Vibrational/Electronic temperatures.
+   * \param[out] val_ws - Species net production rates, point-major (zero for frozen mixtures).
+   * \param[out] val_omega - Vibrational energy source terms.
+   * \param[in,out] val_jacobians - Inputs and outputs of the Jacobians, nullptr to compute only the residuals.
+   */
+  void ComputeSourceTerms_Batch(unsigned long nPoints, const su2double* val_rhos, const su2double* val_T,
+                                const su2double* val_Tve, su2double* val_ws, su2double* val_omega,
+                                const SourceJacobians* val_jacobians = nullptr) const final;
+
   /*!
    * \brief Compute relaxation source term jacobian.
    */
@@ -227,6 +251,30 @@ public:
    */
   void ComputeKeqConstants(unsigned short val_Reaction);
 
+  /*!
+   * \brief Interpolation of the equilibrium constant tables in the mixture number density.
+   * \param[in] N - Mixture number density [1/cm^3].
+   * \param[out] iRow - Lower table row.
+   * \param[out] weight - Weight of the upper row (0 if the density is outside the table).
+   */
+  static void KeqInterpolation(su2double N, unsigned short& iRow, su2double& weight);
+
+  /*!
+   * \brief Batched source terms for a compile-time number of species, with species-major work arrays of at most
+   * BATCH_SIZE points such that the loops over points vectorize.
+   */
+  template <unsigned short NSPECIES>
+  void ComputeSourceTerms_Chunk(unsigned long nPoints, const su2double* val_rhos, const su2double* val_T,
+                                const su2double* val_Tve, su2double* val_ws, su2double* val_omega,
+                                const SourceJacobians* val_jacobians) const;
+
+  /*!
+   * \brief Compute the V-E specific heat of one species (see ComputeSpeciesCvVibEle).
+   * \param[in] val_Species - Species index.
+   * \param[in] val_T - Temperature.
+   */
+  su2double SpeciesCvVibEle(unsigned short val_Species, su2double val_T) const;
+
   /*!
    * \brief Calculate species diffusion coefficients with Wilke/Blottner/Eucken transport model.
    */
@@ -60,6 +60,18 @@ class CVanDerWaalsGas final : public CIdealGas {
    */
   void SetTDState_PT(su2double P, su2double T) override;
 
+  /*!
+   * \brief Set the states of a batch of points one at a time, the ideal gas version does not apply.
+   * \param[in,out] states - Density and StaticEnergy on input, the other properties on output.
+   */
+  void SetTDState_rhoe_Batch(CFluidStateBatch& states) override { CFluidModel::SetTDState_rhoe_Batch(states); }
+
+  /*!
+   * \brief Set the states of a batch of points one at a time, the ideal gas version does not apply.
+   * \param[in,out] states - Pressure and Temperature on input, the other properties on output.
+   */
+  void SetTDState_PT_Batch(CFluidStateBatch& states) override { CFluidModel::SetTDState_PT_Batch(states); }
+
   /*!
    * \brief Set the Dimensionless State using Pressure and Density
    * \param[in] P - first thermodynamic variable.
@@ -60,11 +60,50 @@ public:
   using Scalar = passivedouble;
   /*--- The block preconditioners may still use single precision. ---*/
   using MixedScalar = su2mixedfloat;
+  /*--- Precision of the runtime mixed precision preconditioner (LINEAR_SOLVER_MIXED_PRECISION= FLOW). ---*/
+  using LowScalar = float;
 #endif
 
+  /*!
+   * \brief Decides when a lagged preconditioner (and the Jacobian) is refreshed. It is reused for up to "lag"
+   * iterations, and refreshed earlier if the linear iterations grow by "itersFactor" relative to the first solve
+   * after the last refresh, if the linear solver does not converge, or if the residual changes by "residualOrders".
+   */
+  struct PrecondRefreshPolicy {
+    unsigned short lag = 0;         /*!< \brief Maximum number of iterations that reuse the preconditioner. */
+    su2double itersFactor = 0.0;    /*!< \brief Relative growth of the linear iterations that triggers a refresh. */
+    su2double residualOrders = 0.0; /*!< \brief Change of the residual (orders of magnitude) that triggers a refresh. */
+
+    bool refresh = true;                   /*!< \brief The preconditioner is refreshed in the next iteration. */
+    unsigned short itersSinceRefresh = 0;  /*!< \brief Linear solves since the last refresh. */
+    unsigned long refreshLinIters = 0;     /*!< \brief Linear iterations of the first solve after the last refresh. */
+    su2double refreshResidual = 0.0;       /*!< \brief Residual at the first solve after the last refresh. */
+
+    /*!
+     * \brief Decide if the preconditioner is refreshed in the next iteration.
+     * \param[in] linIters - Iterations of the last linear solve.
+     * \param[in] maxLinIters - Iteration limit of the linear solver.
+     * \param[in] residual - Current residual (average log10 of the RMS).
+     */
+    void Update(unsigned long linIters, unsigned long maxLinIters, su2double residual) {
+      if (lag == 0) return;
+      if (refresh) {
+        /*--- First solve with a new preconditioner, reference values for the refresh criteria. ---*/
+        itersSinceRefresh = 0;
+        refreshLinIters = std::max(linIters, 1ul);
+        refreshResidual = residual;
+      }
+      itersSinceRefresh += 1;
+
+      refresh = (itersSinceRefresh > lag) || (linIters >= maxLinIters) ||
+                (linIters > itersFactor * refreshLinIters) || (fabs(residual - refreshResidual) > residualOrders);
+    }
+  };
+
 private:
-  /*--- Residual evaluation modes, explicit for products, default to allow preconditioners to be built. ---*/
-  enum class ResEvalType {EXPLICIT, DEFAULT};
+  /*--- Residual evaluation modes, explicit for products, default to allow preconditioners to be built,
+   * no Jacobian for iterations that reuse the preconditioner (explicit, but the time step is updated). ---*/
+  enum class ResEvalType {EXPLICIT, NO_JACOBIAN, DEFAULT};
 
   bool setup = false;
   Scalar finDiffStepND = 0.0;
@@ -90,6 +129,10 @@ private:
   unsigned short tolRelaxFactor = 0;
   su2double fullTolResidual = 0.0;
 
+  /*--- The preconditioner (and the Jacobian) can be reused for a number of iterations. ---*/
+  PrecondRefreshPolicy refreshPolicy;
+  bool firstOrderPrecond = false;
+
   CConfig* config = nullptr;
   CSolver** solvers = nullptr;
   CGeometry* geometry = nullptr;
@@ -127,17 +170,29 @@ private:
   /*--- If mixed precision is used, these temporaries are used to interface with the preconditioner. ---*/
   mutable CSysVector<MixedScalar> precondIn, precondOut;
 
-  template<class T, su2enable_if<!std::is_same<T,MixedScalar>::value> = 0>
-  inline unsigned long Preconditioner_impl(const CSysVector<T>& u, CSysVector<T>& v,
-                                           unsigned long iters, Scalar& eps) const {
+#ifndef CODI_FORWARD_TYPE
+  /*--- With LINEAR_SOLVER_MIXED_PRECISION= FLOW (and a double precision Jacobian) the preconditioner is built
+   * on a single precision copy of the Jacobian, refreshed with the preconditioner, as in CSysSolve. ---*/
+  bool lowPrecision = false;
+  CSysMatrix<LowScalar> lowPrecJacobian;
+  CPreconditioner<LowScalar>* lowPrecPreconditioner = nullptr;
+  CSysSolve<LowScalar> lowPrecSolver;
+  mutable CSysVector<LowScalar> lowPrecIn, lowPrecOut;
+#endif
+
+  /*--- Apply a preconditioner of precision T through temporaries of that precision. ---*/
+  template<class T, class U, su2enable_if<!std::is_same<T,U>::value> = 0>
+  inline unsigned long Preconditioner_impl(const CSysVector<U>& u, CSysVector<U>& v, unsigned long iters,
+                                           Scalar& eps, const CSysMatrix<T>& matrix, const CPreconditioner<T>& prec,
+                                           const CSysSolve<T>& solver, CSysVector<T>& in, CSysVector<T>& out) const {
     CNEWTON_PARFOR
-    for (auto i = 0ul; i < u.GetLocSize(); ++i) precondIn[i] = u[i];
+    for (auto i = 0ul; i < u.GetLocSize(); ++i) in[i] = u[i];
     END_CNEWTON_PARFOR
 
-    iters = Preconditioner_impl(precondIn, precondOut, iters, eps);
+    iters = Preconditioner_impl(in, out, iters, eps, matrix, prec, solver, in, out);
 
     CNEWTON_PARFOR
-    for (auto i = 0ul; i < u.GetLocSize(); ++i) v[i] = precondOut[i];
+    for (auto i = 0ul; i < u.GetLocSize(); ++i) v[i] = out[i];
     END_CNEWTON_PARFOR
     SU2_OMP_BARRIER
 
@@ -145,21 +200,38 @@ private:
   }
 
   /*--- Otherwise they are not needed. ---*/
-  template<class T, su2enable_if<std::is_same<T,MixedScalar>::value> = 0>
-  inline unsigned long Preconditioner_impl(const CSysVector<T>& u, CSysVector<T>& v,
-                                           unsigned long iters, Scalar& eps) const {
+  template<class T, class U, su2enable_if<std::is_same<T,U>::value> = 0>
+  inline unsigned long Preconditioner_impl(const CSysVector<U>& u, CSysVector<U>& v, unsigned long iters,
+                                           Scalar& eps, const CSysMatrix<T>& matrix, const CPreconditioner<T>& prec,
+                                           const CSysSolve<T>& solver, CSysVector<T>&, CSysVector<T>&) const {
     if (iters == 0) {
-      (*preconditioner)(u, v);
+      prec(u, v);
       return 0;
     }
-    auto product = CSysMatrixVectorProduct<MixedScalar>(solvers[FLOW_SOL]->Jacobian, geometry, config);
-    v = MixedScalar(0.0);
-    MixedScalar eps_t = eps;
-    iters = solvers[FLOW_SOL]->System.FGMRES_LinSolver(u, v, product, *preconditioner, eps, iters, eps_t, false, config);
+    auto product = CSysMatrixVectorProduct<T>(matrix, geometry, config);
+    v = T(0.0);
+    T eps_t = eps;
+    iters = solver.FGMRES_LinSolver(u, v, product, prec, eps, iters, eps_t, false, config);
     eps = eps_t;
     return iters;
   }
 
+  /*!
+   * \brief Apply the linear preconditioner, in single precision if the runtime mixed precision mode is on.
+   */
+  template<class U>
+  inline unsigned long ApplyPreconditioner(const CSysVector<U>& u, CSysVector<U>& v, unsigned long iters,
+                                           Scalar& eps) const {
+#ifndef CODI_FORWARD_TYPE
+    if (lowPrecision) {
+      return Preconditioner_impl(u, v, iters, eps, lowPrecJacobian, *lowPrecPreconditioner, lowPrecSolver,
+                                 lowPrecIn, lowPrecOut);
+    }
+#endif
+    return Preconditioner_impl(u, v, iters, eps, solvers[FLOW_SOL]->Jacobian, *preconditioner,
+                               solvers[FLOW_SOL]->System, precondIn, precondOut);
+  }
+
   /*!
    * \brief Gather solver info, etc..
    */
@@ -181,6 +253,18 @@ private:
    */
   void ComputeFinDiffStep();
 
+  /*!
+   * \brief Evaluate the residual and, if the preconditioner is refreshed, the Jacobian, then prepare the linear system.
+   */
+  void PrepareIteration();
+
+  /*!
+   * \brief Decide if the preconditioner should be refreshed in the next iteration (see PrecondRefreshPolicy).
+   * \param[in] linIters - Iterations of the last linear solve.
+   * \param[in] residual - Current residual (average log10 of the RMS).
+   */
+  void UpdateRefreshPolicy(unsigned long linIters, su2double residual);
+
 public:
   /*!
    * \brief Constructor.
@@ -59,6 +59,9 @@ class CIteration {
   su2double StartTime{0.0}, /*!< \brief Tracking wall time. */
       StopTime{0.0}, UsedTime{0.0};
 
+  unsigned long firstInnerIter{0}; /*!< \brief First inner iteration run by Solve. */
+  unsigned long endInnerIter{std::numeric_limits<unsigned long>::max()}; /*!< \brief Solve stops before this one. */
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -76,6 +79,17 @@ class CIteration {
    */
   virtual ~CIteration(void) = default;
 
+  /*!
+   * \brief Restrict the inner iterations run by Solve, e.g. to stop a steady simulation and resume it later with
+   *        the same iteration numbers (the number of inner iterations still determines the final iteration).
+   * \param[in] first - First inner iteration.
+   * \param[in] end - Solve returns before this inner iteration.
+   */
+  void SetInnerIterRange(unsigned long first, unsigned long end) {
+    firstInnerIter = first;
+    endInnerIter = end;
+  }
+
   /*!
    * \brief Updates the positions and grid velocities for dynamic meshes between physical time steps.
    * \author T. Economon
@@ -43,6 +43,7 @@ private:
 
   su2double*  residual = nullptr;        /*!< \brief The source residual. */
   su2double** jacobian = nullptr;
+  vector<su2double> rhos;                /*!< \brief Species densities passed to the fluid model. */
 public:
 
   /*!
@@ -29,8 +29,13 @@
 
 #include "CNumericsSIMD.hpp"
 #include "flow/convection/roe.hpp"
+#include "flow/convection/ausm_slau.hpp"
+#include "flow/convection/hllc.hpp"
 #include "flow/convection/centered.hpp"
 #include "flow/diffusion/viscous_fluxes.hpp"
+#include "scalar/convection/upwind.hpp"
+#include "scalar/diffusion/turb_diffusion.hpp"
+#include "scalar/diffusion/species_diffusion.hpp"
 
 namespace {
 
@@ -44,6 +49,21 @@ CNumericsSIMD* createUpwindIdealNumerics(const CConfig& config, int iMesh, const
     case UPWIND::ROE:
       obj = new CRoeScheme<ViscousDecorator>(config, iMesh, turbVars);
       break;
+    case UPWIND::AUSMPLUSUP:
+      obj = new CAUSMPLUSUPScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::AUSMPLUSUP2:
+      obj = new CAUSMPLUSUP2Scheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU:
+      obj = new CSLAUScheme<ViscousDecorator,false>(config, iMesh, turbVars);
+      break;
+    case UPWIND::SLAU2:
+      obj = new CSLAUScheme<ViscousDecorator,true>(config, iMesh, turbVars);
+      break;
+    case UPWIND::HLLC:
+      obj = new CHLLCScheme<ViscousDecorator>(config, iMesh, turbVars);
+      break;
     default:
       break;
   }
@@ -126,6 +146,62 @@ CNumericsSIMD* createNumerics(const CConfig& config, int iMesh, const CVariable*
   return obj;
 }
 
+/*!
+ * \brief Turbulence models factory implementation.
+ */
+template<int nDim>
+CNumericsSIMD* createTurbNumerics(const CConfig& config, int iMesh, const CVariable* flowVars,
+                                  const CPrimitiveIndices<unsigned short>& flowIdx, const su2double* constants) {
+  CNumericsSIMD* obj = nullptr;
+
+  /*--- The bounded scalar formulation is handled by the scalar solver. ---*/
+  if (config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND || config.GetBounded_Turb()) return obj;
+
+  switch (TurbModelFamily(config.GetKind_Turb_Model())) {
+    case TURB_FAMILY::SA:
+      if (config.GetSAParsedOptions().version == SA_OPTIONS::NEG)
+        obj = new CUpwScalarScheme<CSADiffusion<nDim,true>,false>(config, iMesh, flowVars, flowIdx);
+      else
+        obj = new CUpwScalarScheme<CSADiffusion<nDim,false>,false>(config, iMesh, flowVars, flowIdx);
+      break;
+    case TURB_FAMILY::KW:
+      obj = new CUpwScalarScheme<CSSTDiffusion<nDim>,true>(config, iMesh, flowVars, flowIdx, constants);
+      break;
+    default:
+      break;
+  }
+  return obj;
+}
+
+/*!
+ * \brief Transition model factory implementation.
+ */
+template<int nDim>
+CNumericsSIMD* createTransNumerics(const CConfig& config, int iMesh, const CVariable* flowVars,
+                                   const CPrimitiveIndices<unsigned short>& flowIdx) {
+  if (config.GetKind_ConvNumScheme_Turb() != SPACE_UPWIND || config.GetBounded_Turb() ||
+      config.GetKind_Trans_Model() != TURB_TRANS_MODEL::LM) return nullptr;
+
+  return new CUpwScalarScheme<CLMDiffusion<nDim>,true>(config, iMesh, flowVars, flowIdx);
+}
+
+/*!
+ * \brief Species transport factory implementation, the number of variables is a template parameter.
+ */
+template<int nDim>
+CNumericsSIMD* createSpeciesNumerics(const CConfig& config, int nVar, int iMesh, const CVariable* flowVars,
+                                     const CPrimitiveIndices<unsigned short>& flowIdx) {
+  if (config.GetKind_ConvNumScheme_Species() != SPACE_UPWIND || config.GetBounded_Species()) return nullptr;
+
+  switch (nVar) {
+    case 1: return new CUpwScalarScheme<CSpeciesDiffusion<nDim,1>,true>(config, iMesh, flowVars, flowIdx);
+    case 2: return new CUpwScalarScheme<CSpeciesDiffusion<nDim,2>,true>(config, iMesh, flowVars, flowIdx);
+    case 3: return new CUpwScalarScheme<CSpeciesDiffusion<nDim,3>,true>(config, iMesh, flowVars, flowIdx);
+    case 4: return new CUpwScalarScheme<CSpeciesDiffusion<nDim,4>,true>(config, iMesh, flowVars, flowIdx);
+    default: return nullptr;
+  }
+}
+
 } // namespace
 
 /*!
@@ -145,3 +221,38 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
 
   return nullptr;
 }
+
+/*!
+ * \brief Same as CreateNumerics, for the turbulence models.
+ */
+CNumericsSIMD* CNumericsSIMD::CreateTurbNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* flowVars,
+                                                 const CPrimitiveIndices<unsigned short>& flowIdx,
+                                                 const su2double* constants) {
+  if (nDim == 2) return createTurbNumerics<2>(config, iMesh, flowVars, flowIdx, constants);
+  if (nDim == 3) return createTurbNumerics<3>(config, iMesh, flowVars, flowIdx, constants);
+
+  return nullptr;
+}
+
+/*!
+ * \brief Same as CreateNumerics, for the transition models.
+ */
+CNumericsSIMD* CNumericsSIMD::CreateTransNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* flowVars,
+                                                  const CPrimitiveIndices<unsigned short>& flowIdx) {
+  if (nDim == 2) return createTransNumerics<2>(config, iMesh, flowVars, flowIdx);
+  if (nDim == 3) return createTransNumerics<3>(config, iMesh, flowVars, flowIdx);
+
+  return nullptr;
+}
+
+/*!
+ * \brief Same as CreateNumerics, for the species transport equations.
+ */
+CNumericsSIMD* CNumericsSIMD::CreateSpeciesNumerics(const CConfig& config, int nDim, int nVar, int iMesh,
+                                                    const CVariable* flowVars,
+                                                    const CPrimitiveIndices<unsigned short>& flowIdx) {
+  if (nDim == 2) return createSpeciesNumerics<2>(config, nVar, iMesh, flowVars, flowIdx);
+  if (nDim == 3) return createSpeciesNumerics<3>(config, nVar, iMesh, flowVars, flowIdx);
+
+  return nullptr;
+}
@@ -49,6 +49,7 @@ template<class T> class CSysMatrix;
 class CConfig;
 class CGeometry;
 class CVariable;
+template<class T> struct CPrimitiveIndices;
 
 #ifdef CODI_FORWARD_TYPE
 using SparseMatrixType = CSysMatrix<su2double>;
@@ -97,4 +98,44 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Factory method for the convective + diffusive fluxes of turbulence models.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iMesh - Grid index.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] flowIdx - Indices of the flow primitive variables.
+   * \param[in] constants - Model constants (used by SST).
+   * \return nullptr if the model and options in use are not supported.
+   */
+  static CNumericsSIMD* CreateTurbNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* flowVars,
+                                           const CPrimitiveIndices<unsigned short>& flowIdx,
+                                           const su2double* constants = nullptr);
+
+  /*!
+   * \brief Factory method for the convective + diffusive fluxes of transition models.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iMesh - Grid index.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] flowIdx - Indices of the flow primitive variables.
+   * \return nullptr if the model and options in use are not supported.
+   */
+  static CNumericsSIMD* CreateTransNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* flowVars,
+                                            const CPrimitiveIndices<unsigned short>& flowIdx);
+
+  /*!
+   * \brief Factory method for the convective + diffusive fluxes of the species transport equations.
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] nVar - Number of transported scalars (up to 4).
+   * \param[in] iMesh - Grid index.
+   * \param[in] flowVars - Flow variables.
+   * \param[in] flowIdx - Indices of the flow primitive variables.
+   * \return nullptr if the number of scalars or the options in use are not supported.
+   */
+  static CNumericsSIMD* CreateSpeciesNumerics(const CConfig& config, int nDim, int nVar, int iMesh,
+                                              const CVariable* flowVars,
+                                              const CPrimitiveIndices<unsigned short>& flowIdx);
+
 };
@@ -0,0 +1,605 @@
+/*!
+ * \file ausm_slau.hpp
+ * \brief AUSM+up and SLAU families of convective schemes.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CAUSMSLAUBase
+ * \ingroup ConvDiscr
+ * \brief Base class for schemes of the AUSM+up and SLAU families, these fit the general form
+ * F = area * (0.5*mdot*(psi_i+psi_j) + 0.5*|mdot|*(psi_i-psi_j) + N*p), with psi = (1, velocity, enthalpy).
+ * Derived classes implement the face mass flux (per unit area) and pressure in a const
+ * "massAndPressureFluxes" method, which can only depend on the velocities, pressures,
+ * densities, and enthalpies of the pair of reconstructed states.
+ * The Jacobians are either approximated by those of the Roe scheme, or computed by
+ * finite differences of "massAndPressureFluxes" (when accurate Jacobians are requested).
+ * \note As in the non-vectorized implementation, grid velocities are not considered.
+ */
+template<class Derived, class Base>
+class CAUSMSLAUBase : public Base {
+protected:
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  /*--- Number of primitives on which the mass flux and pressure depend (velocity, pressure, density, enthalpy). ---*/
+  static constexpr size_t nFluxVar = nDim+3;
+
+  const su2double gamma;
+  const bool finestGrid;
+  const bool useAccurateJacobian;
+  const bool muscl;
+  const LIMITER typeLimiter;
+  const ENUM_ROELOWDISS typeDissip;
+
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CAUSMSLAUBase(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    useAccurateJacobian(config.GetUse_Accurate_Jacobians()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()),
+    typeDissip(Derived::LowDissipation ? static_cast<ENUM_ROELOWDISS>(config.GetKind_RoeLowDiss()) : NO_ROELOWDISS) {
+  }
+
+  /*!
+   * \brief Roe-type approximation of the Jacobians.
+   */
+  template<class PrimVarType, class ConsVarType>
+  FORCEINLINE void approximateJacobian(const VectorDbl<nDim>& normal,
+                                       Double area,
+                                       const VectorDbl<nDim>& unitNormal,
+                                       const CPair<PrimVarType>& V,
+                                       const CPair<ConsVarType>& U,
+                                       MatrixDbl<nVar>& jac_i,
+                                       MatrixDbl<nVar>& jac_j) const {
+
+    auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+
+    auto pMat = pMatrix(gamma, roeAvg.density, roeAvg.velocity,
+                        roeAvg.projVel, roeAvg.speedSound, unitNormal);
+    auto pMatInv = pMatrixInv(gamma, roeAvg.density, roeAvg.velocity,
+                              roeAvg.projVel, roeAvg.speedSound, unitNormal);
+
+    VectorDbl<nVar> lambda;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      lambda(iDim) = abs(roeAvg.projVel);
+    }
+    lambda(nDim) = abs(roeAvg.projVel + roeAvg.speedSound);
+    lambda(nDim+1) = abs(roeAvg.projVel - roeAvg.speedSound);
+
+    /*--- Scale = 0.5 because the flux ~ 0.5*(fc_i+fc_j)*Normal. ---*/
+
+    jac_i = inviscidProjJac(gamma, V.i.velocity(), U.i.energy(), normal, 0.5);
+    jac_j = inviscidProjJac(gamma, V.j.velocity(), U.j.energy(), normal, 0.5);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        Double projModJacTensor = 0.0;
+        for (size_t kVar = 0; kVar < nVar; ++kVar) {
+          projModJacTensor += pMat(iVar,kVar) * lambda(kVar) * pMatInv(kVar,jVar);
+        }
+        const Double dDdU = 0.5 * projModJacTensor * area;
+        jac_i(iVar,jVar) += dDdU;
+        jac_j(iVar,jVar) -= dDdU;
+      }
+    }
+  }
+
+  /*!
+   * \brief Jacobians of the general form, the derivatives of the mass flux and pressure w.r.t.
+   * the primitives are computed with forward finite differences, then the chain rule is used
+   * to obtain the derivatives w.r.t. the conservatives (ideal gas).
+   */
+  template<class PrimVarType>
+  FORCEINLINE void accurateJacobian(const VectorDbl<nDim>& normal,
+                                    Double area,
+                                    const VectorDbl<nDim>& unitNormal,
+                                    const CPair<PrimVarType>& V,
+                                    Double dissipation,
+                                    Double mdot,
+                                    Double pressure,
+                                    MatrixDbl<nVar>& jac_i,
+                                    MatrixDbl<nVar>& jac_j) const {
+    const auto derived = static_cast<const Derived*>(this);
+    constexpr passivedouble finDiffStep = 1e-4;
+
+    /*--- Derivatives w.r.t. (velocity, pressure, density, enthalpy), which
+     *    are stored contiguously in the primitives, starting at index 1. ---*/
+
+    CPair<VectorDbl<nFluxVar> > dmdot_dV, dpres_dV;
+    auto Vp = V;
+
+    for (size_t iVar = 0; iVar < nFluxVar; ++iVar) {
+      Double mdot_p, pressure_p;
+
+      /*--- Perturb side i. ---*/
+      Double epsilon = finDiffStep * fmax(1.0, abs(V.i.all(iVar+1)));
+      Vp.i.all(iVar+1) += epsilon;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdot_p, pressure_p);
+      dmdot_dV.i(iVar) = (mdot_p - mdot) / epsilon;
+      dpres_dV.i(iVar) = (pressure_p - pressure) / epsilon;
+      Vp.i.all(iVar+1) = V.i.all(iVar+1);
+
+      /*--- Perturb side j. ---*/
+      epsilon = finDiffStep * fmax(1.0, abs(V.j.all(iVar+1)));
+      Vp.j.all(iVar+1) += epsilon;
+      derived->massAndPressureFluxes(Vp, unitNormal, dissipation, mdot_p, pressure_p);
+      dmdot_dV.j(iVar) = (mdot_p - mdot) / epsilon;
+      dpres_dV.j(iVar) = (pressure_p - pressure) / epsilon;
+      Vp.j.all(iVar+1) = V.j.all(iVar+1);
+    }
+
+    /*--- Chain rule, the derivatives of the primitives w.r.t. conservative "jVar"
+     *    are computed on the fly for one side at a time. ---*/
+
+    auto chainRule = [&](const PrimVarType& v, const VectorDbl<nFluxVar>& dmdot,
+                         const VectorDbl<nFluxVar>& dpres, Double& dH_drho,
+                         VectorDbl<nVar>& dmdot_dU, VectorDbl<nVar>& dpres_dU) {
+      const Double oneOnRho = 1 / v.density();
+      const Double sqVel = squaredNorm<nDim>(v.velocity());
+      dH_drho = 0.5*(gamma-2)*sqVel - gamma*v.pressure()/((gamma-1)*v.density());
+
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        VectorDbl<nFluxVar> dV_dU;
+        for (size_t iVar = 0; iVar < nFluxVar; ++iVar) dV_dU(iVar) = 0.0;
+
+        if (jVar == 0) {
+          for (size_t iDim = 0; iDim < nDim; ++iDim) dV_dU(iDim) = -v.velocity(iDim) * oneOnRho;
+          dV_dU(nDim) = 0.5*(gamma-1)*sqVel;
+          dV_dU(nDim+1) = 1.0;
+          dV_dU(nDim+2) = dH_drho * oneOnRho;
+        }
+        else if (jVar == nVar-1) {
+          dV_dU(nDim) = gamma-1;
+          dV_dU(nDim+2) = gamma * oneOnRho;
+        }
+        else {
+          dV_dU(jVar-1) = oneOnRho;
+          dV_dU(nDim) = -(gamma-1)*v.velocity(jVar-1);
+          dV_dU(nDim+2) = dV_dU(nDim) * oneOnRho;
+        }
+        dmdot_dU(jVar) = dot(dmdot, dV_dU);
+        dpres_dU(jVar) = dot(dpres, dV_dU);
+      }
+    };
+
+    CPair<VectorDbl<nVar> > dmdot_dU, dpres_dU;
+    Double dHi_drhoi, dHj_drhoj;
+    chainRule(V.i, dmdot_dV.i, dpres_dV.i, dHi_drhoi, dmdot_dU.i, dpres_dU.i);
+    chainRule(V.j, dmdot_dV.j, dpres_dV.j, dHj_drhoj, dmdot_dU.j, dpres_dU.j);
+
+    /*--- Assemble the Jacobians (assuming phi = |mdot|), the upwind side is
+     *    selected with a mask to treat all SIMD lanes uniformly. ---*/
+
+    const Double upwind_i = mdot > 0.0;
+    const Double mdot_hat_i = upwind_i * area * mdot / V.i.density();
+    const Double mdot_hat_j = (1-upwind_i) * area * mdot / V.j.density();
+
+    VectorDbl<nVar> psi_hat;
+    psi_hat(0) = area;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      psi_hat(iDim+1) = area * (upwind_i * V.i.velocity(iDim) + (1-upwind_i) * V.j.velocity(iDim));
+    }
+    psi_hat(nVar-1) = area * (upwind_i * V.i.enthalpy() + (1-upwind_i) * V.j.enthalpy());
+
+    /*--- Contribution from the mass flux derivatives. ---*/
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iVar,jVar) = psi_hat(iVar) * dmdot_dU.i(jVar);
+        jac_j(iVar,jVar) = psi_hat(iVar) * dmdot_dU.j(jVar);
+      }
+    }
+
+    /*--- Contribution from the pressure derivatives. ---*/
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i(iDim+1,jVar) += normal(iDim) * dpres_dU.i(jVar);
+        jac_j(iDim+1,jVar) += normal(iDim) * dpres_dU.j(jVar);
+      }
+    }
+
+    /*--- Contributions from the derivatives of psi w.r.t. the conservatives. ---*/
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      jac_i(iDim+1,0) -= mdot_hat_i * V.i.velocity(iDim);
+      jac_i(iDim+1,iDim+1) += mdot_hat_i;
+      jac_i(nVar-1,iDim+1) -= mdot_hat_i * (gamma-1) * V.i.velocity(iDim);
+
+      jac_j(iDim+1,0) -= mdot_hat_j * V.j.velocity(iDim);
+      jac_j(iDim+1,iDim+1) += mdot_hat_j;
+      jac_j(nVar-1,iDim+1) -= mdot_hat_j * (gamma-1) * V.j.velocity(iDim);
+    }
+    jac_i(nVar-1,0) += mdot_hat_i * dHi_drhoi;
+    jac_i(nVar-1,nVar-1) += mdot_hat_i * gamma;
+    jac_j(nVar-1,0) += mdot_hat_j * dHj_drhoj;
+    jac_j(nVar-1,nVar-1) += mdot_hat_j * gamma;
+  }
+
+public:
+  /*!
+   * \brief Implementation of the general form of the AUSM-type fluxes.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    /*--- Face mass flux and pressure from the derived class (static polymorphism). ---*/
+
+    const auto derived = static_cast<const Derived*>(this);
+
+    const Double dissipation = roeDissipation(iPoint, jPoint, typeDissip, solution);
+
+    Double mdot, pressure;
+    derived->massAndPressureFluxes(V, unitNormal, dissipation, mdot, pressure);
+
+    /*--- General form of the flux. ---*/
+
+    const Double absMdot = abs(mdot);
+
+    VectorDbl<nVar> flux;
+    flux(0) = area * mdot;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = area * (0.5*mdot*(V.i.velocity(iDim) + V.j.velocity(iDim)) +
+                             0.5*absMdot*(V.i.velocity(iDim) - V.j.velocity(iDim)) +
+                             unitNormal(iDim)*pressure);
+    }
+    flux(nVar-1) = area * (0.5*mdot*(V.i.enthalpy() + V.j.enthalpy()) +
+                           0.5*absMdot*(V.i.enthalpy() - V.j.enthalpy()));
+
+    /*--- Jacobians. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      if (useAccurateJacobian) {
+        accurateJacobian(normal, area, unitNormal, V, dissipation, mdot, pressure, jac_i, jac_j);
+      }
+      else {
+        CPair<CCompressibleConservatives<nDim> > U;
+        U.i = compressibleConservatives(V.i);
+        U.j = compressibleConservatives(V.j);
+        approximateJacobian(normal, area, unitNormal, V, U, jac_i, jac_j);
+      }
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
+
+/*!
+ * \brief Interface speed of sound and split Mach numbers and pressures common to AUSM+up and AUSM+up2.
+ */
+template<size_t nDim>
+struct CAUSMPlusUpSplitting {
+  Double projVel_i, projVel_j; /*!< \brief Projected velocities. */
+  Double aF;                   /*!< \brief Interface speed of sound. */
+  Double MFsq;                 /*!< \brief Squared mean Mach number. */
+  Double fa;                   /*!< \brief Scaling function of the reference Mach number. */
+  Double rhoF;                 /*!< \brief Interface density. */
+  Double mLP, mRM;             /*!< \brief Split Mach numbers. */
+  Double pLP, pRM;             /*!< \brief Split pressure functions. */
+  Double mF;                   /*!< \brief Interface Mach number, including the pressure diffusion term. */
+
+  /*!
+   * \brief Compute the splitting for a pair of primitive variables.
+   */
+  template<class PrimVarType>
+  FORCEINLINE CAUSMPlusUpSplitting(Double gamma, Double Minf, Double Kp, Double sigma,
+                                   const CPair<PrimVarType>& V, const VectorDbl<nDim>& unitNormal) {
+    projVel_i = dot(V.i.velocity(), unitNormal);
+    projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Interface speed of sound. ---*/
+
+    const Double astarL = sqrt(2*(gamma-1)/(gamma+1)*V.i.enthalpy());
+    const Double astarR = sqrt(2*(gamma-1)/(gamma+1)*V.j.enthalpy());
+
+    const Double ahatL = astarL*astarL / fmax(astarL, projVel_i);
+    const Double ahatR = astarR*astarR / fmax(astarR, -projVel_j);
+
+    aF = fmin(ahatL, ahatR);
+
+    /*--- Left and right pressures and Mach numbers. ---*/
+
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    MFsq = 0.5*(mL*mL + mR*mR);
+    const Double Mrefsq = fmin(1.0, fmax(MFsq, Minf*Minf));
+
+    fa = 2*sqrt(Mrefsq) - Mrefsq;
+
+    const Double alpha = 3.0/16.0*(-4+5*fa*fa);
+    constexpr passivedouble beta = 1.0/8.0;
+
+    /*--- Subsonic polynomials and supersonic values blended with masks,
+     *    note that "m/|m|" is replaced by the sign test for |m| > 1. ---*/
+
+    const Double subL = abs(mL) <= 1.0;
+    Double p1 = 0.25*pow(mL+1,2);
+    Double p2 = pow(mL*mL-1,2);
+    mLP = subL*(p1 + beta*p2) + (1-subL)*0.5*(mL+abs(mL));
+    pLP = subL*(p1*(2-mL) + alpha*mL*p2) + (1-subL)*(mL > 0.0);
+
+    const Double subR = abs(mR) <= 1.0;
+    p1 = 0.25*pow(mR-1,2);
+    p2 = pow(mR*mR-1,2);
+    mRM = subR*(-p1 - beta*p2) + (1-subR)*0.5*(mR-abs(mR));
+    pRM = subR*(p1*(2+mR) - alpha*mR*p2) + (1-subR)*(mR < 0.0);
+
+    /*--- Mass flux with pressure diffusion term. ---*/
+
+    rhoF = 0.5*(V.i.density() + V.j.density());
+    const Double Mp = -(Kp/fa)*fmax(1-sigma*MFsq, 0.0)*(V.j.pressure()-V.i.pressure())/(rhoF*aF*aF);
+
+    mF = mLP + mRM + Mp;
+  }
+
+  /*!
+   * \brief Upwinded mass flux per unit area.
+   */
+  template<class PrimVarType>
+  FORCEINLINE Double massFlux(const CPair<PrimVarType>& V) const {
+    return aF * (fmax(mF, 0.0)*V.i.density() + fmin(mF, 0.0)*V.j.density());
+  }
+};
+
+/*!
+ * \class CAUSMPLUSUPScheme
+ * \ingroup ConvDiscr
+ * \brief AUSM+up scheme (Liou 2006).
+ */
+template<class Decorator>
+class CAUSMPLUSUPScheme : public CAUSMSLAUBase<CAUSMPLUSUPScheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CAUSMPLUSUPScheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double Minf;
+
+public:
+  static constexpr bool LowDissipation = false;
+
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUPScheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    Minf(config.GetMach()) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Face mass flux and pressure of AUSM+up.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    constexpr passivedouble Kp = 0.25, Ku = 0.75, sigma = 1.0;
+    const CAUSMPlusUpSplitting<nDim> s(gamma, Minf, Kp, sigma, V, unitNormal);
+
+    mdot = s.massFlux(V);
+
+    const Double Pu = -Ku*s.fa*s.pLP*s.pRM*2*s.rhoF*s.aF*(s.projVel_j-s.projVel_i);
+
+    pressure = s.pLP*V.i.pressure() + s.pRM*V.j.pressure() + Pu;
+  }
+};
+
+/*!
+ * \class CAUSMPLUSUP2Scheme
+ * \ingroup ConvDiscr
+ * \brief AUSM+up2 scheme (Kitamura and Shima 2013).
+ */
+template<class Decorator>
+class CAUSMPLUSUP2Scheme : public CAUSMSLAUBase<CAUSMPLUSUP2Scheme<Decorator>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CAUSMPLUSUP2Scheme<Decorator>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+  const su2double Minf;
+
+public:
+  static constexpr bool LowDissipation = false;
+
+  /*!
+   * \brief Constructor, store some constants and forward to base.
+   */
+  template<class... Ts>
+  CAUSMPLUSUP2Scheme(const CConfig& config, Ts&... args) : Base(config, args...),
+    Minf(config.GetMach()) {
+    if (Minf < EPS)
+      SU2_MPI::Error("AUSM+Up2 requires a reference Mach number (\"MACH_NUMBER\") greater than 0.", CURRENT_FUNCTION);
+  }
+
+  /*!
+   * \brief Face mass flux and pressure of AUSM+up2.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double,
+                                         Double& mdot,
+                                         Double& pressure) const {
+    constexpr passivedouble Kp = 0.25, sigma = 1.0;
+    const CAUSMPlusUpSplitting<nDim> s(gamma, Minf, Kp, sigma, V, unitNormal);
+
+    mdot = s.massFlux(V);
+
+    /*--- Modified pressure flux. ---*/
+
+    const Double sqVel = 0.5*(squaredNorm<nDim>(V.i.velocity()) + squaredNorm<nDim>(V.j.velocity()));
+
+    pressure = 0.5*(V.j.pressure()+V.i.pressure()) + 0.5*(s.pLP-s.pRM)*(V.i.pressure()-V.j.pressure()) +
+               sqrt(sqVel)*(s.pLP+s.pRM-1)*s.rhoF*s.aF;
+  }
+};
+
+/*!
+ * \class CSLAUScheme
+ * \ingroup ConvDiscr
+ * \brief SLAU (Shima and Kitamura 2011) and SLAU2 (Kitamura and Shima 2013) schemes.
+ * \note The low dissipation option (ROE_LOW_DISSIPATION) scales the pressure diffusion term.
+ */
+template<class Decorator, bool SLAU2>
+class CSLAUScheme : public CAUSMSLAUBase<CSLAUScheme<Decorator,SLAU2>,Decorator> {
+private:
+  using Base = CAUSMSLAUBase<CSLAUScheme<Decorator,SLAU2>,Decorator>;
+  using Base::nDim;
+  using Base::gamma;
+
+public:
+  static constexpr bool LowDissipation = true;
+
+  /*!
+   * \brief Constructor, forward everything to base.
+   */
+  template<class... Ts>
+  CSLAUScheme(const CConfig& config, Ts&... args) : Base(config, args...) {}
+
+  /*!
+   * \brief Face mass flux and pressure of SLAU/SLAU2.
+   */
+  template<class PrimVarType>
+  FORCEINLINE void massAndPressureFluxes(const CPair<PrimVarType>& V,
+                                         const VectorDbl<nDim>& unitNormal,
+                                         Double dissipation,
+                                         Double& mdot,
+                                         Double& pressure) const {
+
+    const Double projVel_i = dot(V.i.velocity(), unitNormal);
+    const Double projVel_j = dot(V.j.velocity(), unitNormal);
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    /*--- Speed of sound from the primitives that may be perturbed for the Jacobians. ---*/
+
+    const Double energy_i = V.i.enthalpy() - V.i.pressure()/V.i.density();
+    const Double energy_j = V.j.enthalpy() - V.j.pressure()/V.j.density();
+    const Double soundSpeed_i = sqrt(abs(gamma*(gamma-1)*(energy_i-0.5*sqVel_i)));
+    const Double soundSpeed_j = sqrt(abs(gamma*(gamma-1)*(energy_j-0.5*sqVel_j)));
+
+    /*--- Interface speed of sound, and left/right Mach number. ---*/
+
+    const Double aF = 0.5*(soundSpeed_i + soundSpeed_j);
+    const Double mL = projVel_i / aF;
+    const Double mR = projVel_j / aF;
+
+    /*--- Smooth function of the local Mach number. ---*/
+
+    const Double meanVel = sqrt(0.5*(sqVel_i+sqVel_j));
+    const Double machTilde = fmin(1.0, meanVel/aF);
+    const Double chi = pow(1-machTilde, 2);
+    const Double f_rho = -fmax(fmin(mL, 0.0), -1.0) * fmin(fmax(mR, 0.0), 1.0);
+
+    /*--- Mean normal velocity with density weighting. ---*/
+
+    const Double rho_i = V.i.density(), rho_j = V.j.density();
+    const Double vnMag = (rho_i*abs(projVel_i) + rho_j*abs(projVel_j)) / (rho_i + rho_j);
+    const Double vnMagL = (1-f_rho)*vnMag + f_rho*abs(projVel_i);
+    const Double vnMagR = (1-f_rho)*vnMag + f_rho*abs(projVel_j);
+
+    /*--- Mass flux function. ---*/
+
+    mdot = 0.5*(rho_i*(projVel_i+vnMagL) + rho_j*(projVel_j-vnMagR) - (chi/aF)*(V.j.pressure()-V.i.pressure()));
+
+    /*--- Pressure function. ---*/
+
+    const Double subL = abs(mL) < 1.0;
+    const Double subR = abs(mR) < 1.0;
+    const Double betaL = subL*0.25*(2-mL)*pow(mL+1,2) + (1-subL)*(mL >= 0.0);
+    const Double betaR = subR*0.25*(2+mR)*pow(mR-1,2) + (1-subR)*(mR < 0.0);
+
+    pressure = 0.5*(V.i.pressure()+V.j.pressure()) + 0.5*(betaL-betaR)*(V.i.pressure()-V.j.pressure());
+
+    if (!SLAU2) {
+      pressure += dissipation*(1-chi)*(betaL+betaR-1)*0.5*(V.i.pressure()+V.j.pressure());
+    } else {
+      pressure += dissipation*meanVel*(betaL+betaR-1)*aF*0.5*(rho_i+rho_j);
+    }
+  }
+};
@@ -34,21 +34,25 @@
 
 /*!
  * \brief Unlimited reconstruction.
+ * \note "start" is the index of the first reconstructed variable in the gradient container.
+ * The gradient rows are accessed via pointers as single-row matrices are stored as vectors.
  */
 template<size_t nVar, size_t nDim, class Gradient_t>
 FORCEINLINE void musclUnlimited(Int iPoint,
                                 const VectorDbl<nDim>& vector_ij,
                                 Double scale,
                                 const Gradient_t& gradient,
-                                VectorDbl<nVar>& vars) {
-  auto grad = gatherVariables<nVar,nDim>(iPoint, gradient);
+                                VectorDbl<nVar>& vars,
+                                size_t start = 0) {
+  auto grad = gatherVariables<nVar,nDim>(iPoint, gradient, start);
   for (size_t iVar = 0; iVar < nVar; ++iVar) {
-    vars(iVar) += scale * dot(grad[iVar], vector_ij);
+    vars(iVar) += scale * dot(&grad.data()[iVar*nDim], vector_ij);
   }
 }
 
 /*!
  * \brief Limited reconstruction with point-based limiter.
+ * \note "start" is the index of the first reconstructed variable in the gradient and limiter containers.
  */
 template<size_t nVar, size_t nDim, class Limiter_t, class Gradient_t>
 FORCEINLINE void musclPointLimited(Int iPoint,
@@ -56,11 +60,12 @@ FORCEINLINE void musclPointLimited(Int iPoint,
                                    Double scale,
                                    const Limiter_t& limiter,
                                    const Gradient_t& gradient,
-                                   VectorDbl<nVar>& vars) {
-  auto lim = gatherVariables<nVar>(iPoint, limiter);
-  auto grad = gatherVariables<nVar,nDim>(iPoint, gradient);
+                                   VectorDbl<nVar>& vars,
+                                   size_t start = 0) {
+  auto lim = gatherVariables<nVar>(iPoint, limiter, start);
+  auto grad = gatherVariables<nVar,nDim>(iPoint, gradient, start);
   for (size_t iVar = 0; iVar < nVar; ++iVar) {
-    vars(iVar) += lim(iVar) * scale * dot(grad[iVar], vector_ij);
+    vars(iVar) += lim(iVar) * scale * dot(&grad.data()[iVar*nDim], vector_ij);
   }
 }
 
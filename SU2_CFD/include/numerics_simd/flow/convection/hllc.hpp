@@ -0,0 +1,363 @@
+/*!
+ * \file hllc.hpp
+ * \brief HLLC convective scheme.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../../CNumericsSIMD.hpp"
+#include "../../util.hpp"
+#include "../variables.hpp"
+#include "common.hpp"
+#include "../../../variables/CEulerVariable.hpp"
+#include "../../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CHLLCScheme
+ * \ingroup ConvDiscr
+ * \brief HLLC scheme (Toro 1994) for ideal gases.
+ * \note The scalar implementation branches on the signs of the wave speeds, here the state used
+ * to compute the flux (left or right, star or supersonic) is selected with masks, i.e. all states
+ * are evaluated for all SIMD lanes. The Jacobians are the same as in the non-vectorized version.
+ */
+template<class Decorator>
+class CHLLCScheme : public Decorator {
+private:
+  using Base = Decorator;
+  using Base::nDim;
+  static constexpr size_t nVar = CCompressibleConservatives<nDim>::nVar;
+  static constexpr size_t nPrimVarGrad = nDim+4;
+  static constexpr size_t nPrimVar = Max(Base::nPrimVar, nPrimVarGrad);
+
+  const su2double kappa;
+  const su2double gamma;
+  const bool finestGrid;
+  const bool dynamicGrid;
+  const bool muscl;
+  const LIMITER typeLimiter;
+
+  /*!
+   * \brief Blend two values with a mask, "mask ? a : b".
+   */
+  FORCEINLINE static Double select(Double mask, Double a, Double b) { return mask*a + (1-mask)*b; }
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CHLLCScheme(const CConfig& config, unsigned iMesh, Ts&... args) : Base(config, iMesh, args...),
+    kappa(config.GetRoe_Kappa()),
+    gamma(config.GetGamma()),
+    finestGrid(iMesh == MESH_0),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(finestGrid && config.GetMUSCL_Flow()),
+    typeLimiter(config.GetKind_SlopeLimit_Flow()) {
+  }
+
+  /*!
+   * \brief Implementation of the HLLC flux.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution_,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const auto& solution = static_cast<const CEulerVariable&>(solution_);
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+    const auto area = norm(normal);
+    VectorDbl<nDim> unitNormal;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      unitNormal(iDim) = normal(iDim) / area;
+    }
+
+    /*--- Reconstructed primitives. ---*/
+
+    CPair<CCompressiblePrimitives<nDim,nPrimVar> > V1st;
+    V1st.i.all = gatherVariables<nPrimVar>(iPoint, solution.GetPrimitive());
+    V1st.j.all = gatherVariables<nPrimVar>(jPoint, solution.GetPrimitive());
+
+    auto V = reconstructPrimitives<CCompressiblePrimitives<nDim,nPrimVarGrad> >(
+                 iEdge, iPoint, jPoint, muscl, typeLimiter, V1st, vector_ij, solution);
+
+    CPair<CCompressibleConservatives<nDim> > U;
+    U.i = compressibleConservatives(V.i);
+    U.j = compressibleConservatives(V.j);
+
+    const Double sqVel_i = squaredNorm<nDim>(V.i.velocity());
+    const Double sqVel_j = squaredNorm<nDim>(V.j.velocity());
+
+    Double soundSpeed_i = sqrt((V.i.enthalpy() - 0.5*sqVel_i) * (gamma-1));
+    Double soundSpeed_j = sqrt((V.j.enthalpy() - 0.5*sqVel_j) * (gamma-1));
+
+    Double projVel_i = dot(V.i.velocity(), unitNormal);
+    Double projVel_j = dot(V.j.velocity(), unitNormal);
+
+    /*--- Grid motion. ---*/
+
+    Double projGridVel = 0.0;
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      projGridVel = 0.5*(dot(gatherVariables<nDim>(iPoint,gridVel), unitNormal)+
+                         dot(gatherVariables<nDim>(jPoint,gridVel), unitNormal));
+      soundSpeed_i -= projGridVel;
+      soundSpeed_j += projGridVel;
+      projVel_i -= projGridVel;
+      projVel_j -= projGridVel;
+    }
+
+    /*--- Roe averaged variables and wave speeds. ---*/
+
+    const auto roeAvg = roeAveragedVariables(gamma, V, unitNormal);
+    const Double roeProjVel = roeAvg.projVel - projGridVel;
+    const Double roeSoundSpeed = roeAvg.speedSound - projGridVel;
+
+    const Double sL = fmin(roeProjVel - roeSoundSpeed, projVel_i - soundSpeed_i);
+    const Double sR = fmax(roeProjVel + roeSoundSpeed, projVel_j + soundSpeed_j);
+
+    /*--- Speed of the contact surface and pressure in the star region. ---*/
+
+    const Double RHO = V.j.density()*(sR-projVel_j) - V.i.density()*(sL-projVel_i);
+    const Double sM = (V.i.pressure() - V.j.pressure() - V.i.density()*projVel_i*(sL-projVel_i) +
+                       V.j.density()*projVel_j*(sR-projVel_j)) / RHO;
+
+    const Double pStar = V.j.density()*(projVel_j-sR)*(projVel_j-sM) + V.j.pressure();
+
+    /*--- The flux is computed from the left states if sM > 0, from the right states otherwise,
+     *    and from the star state unless the flow is supersonic on that side. ---*/
+
+    const Double useLeft = sM > 0.0;
+    const Double supersonic = useLeft*(sL > 0.0) + (1-useLeft)*(sR < 0.0);
+
+    const Double sK = select(useLeft, sL, sR);
+    const Double projVel_k = select(useLeft, projVel_i, projVel_j);
+    const Double rho_k = select(useLeft, V.i.density(), V.j.density());
+    const Double p_k = select(useLeft, V.i.pressure(), V.j.pressure());
+    const Double H_k = select(useLeft, V.i.enthalpy(), V.j.enthalpy());
+    const Double rhoE_k = select(useLeft, U.i.rhoEnergy(), U.j.rhoEnergy());
+    VectorDbl<nDim> vel_k;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      vel_k(iDim) = select(useLeft, V.i.velocity(iDim), V.j.velocity(iDim));
+    }
+
+    /*--- Intermediate (star) state. ---*/
+
+    const Double rhoSK = (sK-projVel_k) / (sK-sM);
+    VectorDbl<nVar> UStar;
+    UStar(0) = rhoSK * rho_k;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      UStar(iDim+1) = rhoSK * (rho_k*vel_k(iDim) + (pStar-p_k)/(sK-projVel_k)*unitNormal(iDim));
+    }
+    UStar(nVar-1) = rhoSK * (rhoE_k - (p_k*projVel_k - pStar*sM)/(sK-projVel_k));
+
+    VectorDbl<nVar> flux;
+    const Double mdot_k = rho_k * projVel_k;
+    flux(0) = select(supersonic, mdot_k, sM*UStar(0));
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      flux(iDim+1) = select(supersonic, mdot_k*vel_k(iDim) + p_k*unitNormal(iDim),
+                            sM*UStar(iDim+1) + pStar*unitNormal(iDim));
+    }
+    flux(nVar-1) = select(supersonic, mdot_k*H_k, sM*(UStar(nVar-1)+pStar) + pStar*projGridVel);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) flux(iVar) *= area;
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    if (implicit) {
+      computeJacobians(V, U, unitNormal, sqVel_i, sqVel_j, projVel_i, projVel_j, sL, sR, sM, RHO,
+                       pStar, useLeft, supersonic, UStar, area*kappa, jac_i, jac_j);
+    }
+
+    /*--- Add the contributions from the base class (static decorator). ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, V1st, solution_, vector_ij, geometry,
+                       config, area, unitNormal, implicit, flux, jac_i, jac_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+
+private:
+  /*!
+   * \brief Jacobians of the HLLC flux, the expressions for the derivatives w.r.t. the left and right
+   * states are symmetric, thus they are written for the "upwind" side (K, from which the star state is
+   * computed) and the "downwind" side (the other one), and then assigned to i/j according to the mask.
+   */
+  template<class PrimVarType, class ConsVarType>
+  FORCEINLINE void computeJacobians(const CPair<PrimVarType>& V,
+                                    const CPair<ConsVarType>& U,
+                                    const VectorDbl<nDim>& unitNormal,
+                                    Double sqVel_i, Double sqVel_j,
+                                    Double projVel_i, Double projVel_j,
+                                    Double sL, Double sR, Double sM, Double RHO,
+                                    Double pStar, Double useLeft, Double supersonic,
+                                    const VectorDbl<nVar>& UStar, Double scale,
+                                    MatrixDbl<nVar>& jac_i,
+                                    MatrixDbl<nVar>& jac_j) const {
+
+    /*--- Derivatives of the pressure w.r.t. the conservatives of a side. ---*/
+
+    auto pressureDerivatives = [&](const PrimVarType& v, Double sqVel) {
+      VectorDbl<nVar> dPI_dU;
+      dPI_dU(0) = 0.5*(gamma-1)*sqVel;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) dPI_dU(iDim+1) = -(gamma-1)*v.velocity(iDim);
+      dPI_dU(nVar-1) = gamma-1;
+      return dPI_dU;
+    };
+
+    /*--- Derivatives of the contact speed w.r.t. the conservatives of a side, "sign" is 1 for left. ---*/
+
+    auto contactSpeedDerivatives = [&](const VectorDbl<nVar>& dPI_dU, Double projVel, Double s, Double sign) {
+      VectorDbl<nVar> dSm_dU;
+      dSm_dU(0) = sign * (-projVel*projVel + sM*s + dPI_dU(0)) / RHO;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        dSm_dU(iDim+1) = sign * (unitNormal(iDim)*(2*projVel - s - sM) + dPI_dU(iDim+1)) / RHO;
+      }
+      dSm_dU(nVar-1) = sign * dPI_dU(nVar-1) / RHO;
+      return dSm_dU;
+    };
+
+    const auto dPI_dU_i = pressureDerivatives(V.i, sqVel_i);
+    const auto dPI_dU_j = pressureDerivatives(V.j, sqVel_j);
+
+    const auto dSm_dU_i = contactSpeedDerivatives(dPI_dU_i, projVel_i, sL, 1.0);
+    const auto dSm_dU_j = contactSpeedDerivatives(dPI_dU_j, projVel_j, sR, -1.0);
+
+    /*--- Derivatives of the star pressure (the same expressions are used for both star states). ---*/
+
+    VectorDbl<nVar> dpStar_dU_i, dpStar_dU_j;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dpStar_dU_i(iVar) = V.i.density() * (sR-projVel_j) * dSm_dU_i(iVar);
+      dpStar_dU_j(iVar) = V.j.density() * (sL-projVel_i) * dSm_dU_j(iVar);
+    }
+
+    /*--- Select the upwind (K) and downwind (D) quantities. ---*/
+
+    const Double sK = select(useLeft, sL, sR);
+    const Double projVel_k = select(useLeft, projVel_i, projVel_j);
+    const Double H_k = select(useLeft, V.i.enthalpy(), V.j.enthalpy());
+    VectorDbl<nDim> vel_k;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      vel_k(iDim) = select(useLeft, V.i.velocity(iDim), V.j.velocity(iDim));
+    }
+
+    VectorDbl<nVar> dPI_dU_k, dSm_dU_k, dSm_dU_d, dpStar_dU_k, dpStar_dU_d;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      dPI_dU_k(iVar) = select(useLeft, dPI_dU_i(iVar), dPI_dU_j(iVar));
+      dSm_dU_k(iVar) = select(useLeft, dSm_dU_i(iVar), dSm_dU_j(iVar));
+      dSm_dU_d(iVar) = select(useLeft, dSm_dU_j(iVar), dSm_dU_i(iVar));
+      dpStar_dU_k(iVar) = select(useLeft, dpStar_dU_i(iVar), dpStar_dU_j(iVar));
+      dpStar_dU_d(iVar) = select(useLeft, dpStar_dU_j(iVar), dpStar_dU_i(iVar));
+    }
+
+    const Double EStar = UStar(nVar-1);
+    const Double omega = 1 / (sK-sM);
+    const Double omegaSM = omega * sM;
+
+    /*--- Jacobian of the star flux w.r.t. the downwind state, which only depends on it via sM and pStar. ---*/
+
+    MatrixDbl<nVar> jac_d;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      const Double dEStar_dU = omega * (sM*dpStar_dU_d(iVar) + (EStar+pStar)*dSm_dU_d(iVar));
+
+      jac_d(0,iVar) = UStar(0) * (omegaSM+1) * dSm_dU_d(iVar);
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jac_d(iDim+1,iVar) = (omegaSM+1) * (UStar(iDim+1)*dSm_dU_d(iVar) + unitNormal(iDim)*dpStar_dU_d(iVar));
+      }
+      jac_d(nVar-1,iVar) = sM*(dEStar_dU + dpStar_dU_d(iVar)) + (EStar+pStar)*dSm_dU_d(iVar);
+    }
+
+    /*--- Jacobian of the star flux w.r.t. the upwind state. ---*/
+
+    VectorDbl<nVar> drhoStar_dU, dEStar_dU;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      drhoStar_dU(iVar) = omega * UStar(0) * dSm_dU_k(iVar);
+      dEStar_dU(iVar) = omega * (sM*dpStar_dU_k(iVar) + (EStar+pStar)*dSm_dU_k(iVar));
+    }
+    drhoStar_dU(0) += omega * sK;
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      drhoStar_dU(iDim+1) -= omega * unitNormal(iDim);
+    }
+    dEStar_dU(0) += omega * projVel_k * (H_k - dPI_dU_k(0));
+    for (size_t iDim = 0; iDim < nDim; ++iDim) {
+      dEStar_dU(iDim+1) += omega * (-unitNormal(iDim)*H_k - projVel_k*dPI_dU_k(iDim+1));
+    }
+    dEStar_dU(nVar-1) += omega * (sK - projVel_k - projVel_k*dPI_dU_k(nVar-1));
+
+    MatrixDbl<nVar> jac_k;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      jac_k(0,iVar) = sM*drhoStar_dU(iVar) + UStar(0)*dSm_dU_k(iVar);
+    }
+    for (size_t jDim = 0; jDim < nDim; ++jDim) {
+      for (size_t iVar = 0; iVar < nVar; ++iVar) {
+        jac_k(jDim+1,iVar) = (omegaSM+1) * (unitNormal(jDim)*dpStar_dU_k(iVar) + UStar(jDim+1)*dSm_dU_k(iVar)) -
+                             omegaSM * dPI_dU_k(iVar) * unitNormal(jDim);
+      }
+      jac_k(jDim+1,0) += omegaSM * vel_k(jDim) * projVel_k;
+      jac_k(jDim+1,jDim+1) += omegaSM * (sK - projVel_k);
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        jac_k(jDim+1,iDim+1) -= omegaSM * vel_k(jDim) * unitNormal(iDim);
+      }
+    }
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      jac_k(nVar-1,iVar) = sM*(dEStar_dU(iVar) + dpStar_dU_k(iVar)) + (EStar+pStar)*dSm_dU_k(iVar);
+    }
+
+    /*--- Supersonic case, the flux only depends on the upwind state. ---*/
+
+    const Double energy_k = select(useLeft, U.i.energy(), U.j.energy());
+    const auto jac_sup = inviscidProjJac(gamma, vel_k.data(), energy_k, unitNormal, 1.0);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        const Double upwind = scale * select(supersonic, jac_sup(iVar,jVar), jac_k(iVar,jVar));
+        const Double downwind = scale * (1-supersonic) * jac_d(iVar,jVar);
+        jac_i(iVar,jVar) = select(useLeft, upwind, downwind);
+        jac_j(iVar,jVar) = select(useLeft, downwind, upwind);
+      }
+    }
+  }
+};
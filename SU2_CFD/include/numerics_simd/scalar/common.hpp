@@ -0,0 +1,74 @@
+/*!
+ * \file common.hpp
+ * \brief Common classes and functions of the scalar transport numerics.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../CNumericsSIMD.hpp"
+#include "../util.hpp"
+#include "../../variables/CPrimitiveIndices.hpp"
+#include "../../../../Common/include/geometry/CGeometry.hpp"
+
+/*!
+ * \class CScalarNumericsBase
+ * \ingroup ConvDiscr
+ * \brief Root of the scalar transport numerics, it gives the convective
+ * schemes and the diffusion decorators access to the flow variables.
+ * \note Unlike the flow numerics, the "solution" passed to ComputeFlux
+ * holds the scalar variables, the flow variables are stored at construction.
+ */
+template<size_t NDIM, size_t NVAR>
+class CScalarNumericsBase : public CNumericsSIMD {
+protected:
+  static constexpr size_t nDim = NDIM;
+  static constexpr size_t nVar = NVAR;
+
+  const CVariable* flowVars;
+  const unsigned short idxVelocity;
+  const unsigned short idxDensity;
+  const unsigned short idxLaminarVisc;
+  const unsigned short idxEddyVisc;
+
+  /*!
+   * \brief Constructor, store the flow variables and the position of the primitives used by the scalar numerics.
+   */
+  template<class... Ts>
+  CScalarNumericsBase(const CConfig& config, int iMesh, const CVariable* flowVars_,
+                      const CPrimitiveIndices<unsigned short>& flowIdx, Ts&...) :
+    flowVars(flowVars_),
+    idxVelocity(flowIdx.Velocity()),
+    idxDensity(flowIdx.Density()),
+    idxLaminarVisc(flowIdx.LaminarViscosity()),
+    idxEddyVisc(flowIdx.EddyViscosity()) {
+  }
+};
+
+/*!
+ * \brief Gather a single variable from column iVar of a 2D container.
+ */
+template<class Container>
+FORCEINLINE Double gatherVariable(Int iPoint, size_t iVar, const Container& vars) {
+  return gatherVariables<1>(iPoint, vars, iVar)(0);
+}
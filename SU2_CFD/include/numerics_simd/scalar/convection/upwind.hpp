@@ -0,0 +1,194 @@
+/*!
+ * \file upwind.hpp
+ * \brief First order upwind convective scheme of scalar transport equations.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../common.hpp"
+#include "../../flow/convection/common.hpp"
+
+/*!
+ * \class CUpwScalarScheme
+ * \ingroup ConvDiscr
+ * \brief Vectorized version of CUpwScalar (not the bounded scalar variant).
+ * The diffusion decorator is the base class and it defines nDim and nVar.
+ * \tparam Base - Diffusion decorator, e.g. CSSTDiffusion.
+ * \tparam CONSERVATIVE - The transported quantity is rho*scalar (e.g. SST) or the scalar (e.g. SA).
+ * \note Reconstruction is done as in CScalarSolver::Upwind_Residual.
+ */
+template<class Base, bool CONSERVATIVE>
+class CUpwScalarScheme : public Base {
+protected:
+  using Base::nDim;
+  using Base::nVar;
+  using Base::flowVars;
+  using Base::idxVelocity;
+  using Base::idxDensity;
+
+  const bool dynamicGrid;
+  const bool muscl;
+  const bool musclFlow;
+  const bool limiterFlow;
+  const bool limiterScalar;
+
+public:
+  /*!
+   * \brief Constructor, store some constants and forward args to base.
+   */
+  template<class... Ts>
+  CUpwScalarScheme(const CConfig& config, int iMesh, Ts&... args) : Base(config, iMesh, args...),
+    dynamicGrid(config.GetDynamic_Grid()),
+    muscl(config.GetMUSCL()),
+    musclFlow(config.GetMUSCL_Flow() && muscl && (config.GetKind_ConvNumScheme_Flow() == SPACE_UPWIND)),
+    limiterFlow((config.GetKind_SlopeLimit_Flow() != LIMITER::NONE) &&
+                (config.GetKind_SlopeLimit_Flow() != LIMITER::VAN_ALBADA_EDGE)),
+    limiterScalar(config.GetKind_SlopeLimit() != LIMITER::NONE) {
+  }
+
+  /*!
+   * \brief Implementation of the upwind flux plus the diffusive terms of the decorator.
+   */
+  void ComputeFlux(Int iEdge,
+                   const CConfig& config,
+                   const CGeometry& geometry,
+                   const CVariable& solution,
+                   UpdateType updateType,
+                   Double updateMask,
+                   CSysVector<su2double>& vector,
+                   SparseMatrixType& matrix) const final {
+
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
+    const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+    const bool limiter = limiterScalar && (config.GetInnerIter() <= config.GetLimiterIter());
+
+    const auto iPoint = geometry.edges->GetNode(iEdge,0);
+    const auto jPoint = geometry.edges->GetNode(iEdge,1);
+
+    /*--- Geometric properties. ---*/
+
+    const auto vector_ij = distanceVector<nDim>(iPoint, jPoint, geometry.nodes->GetCoord());
+    const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
+
+    /*--- Scalar and flow variables. ---*/
+
+    CPair<VectorDbl<nVar> > scalars1st;
+    scalars1st.i = gatherVariables<nVar>(iPoint, solution.GetSolution());
+    scalars1st.j = gatherVariables<nVar>(jPoint, solution.GetSolution());
+
+    const auto& primitives = flowVars->GetPrimitive();
+    CPair<VectorDbl<nDim> > velocity;
+    CPair<VectorDbl<1> > density;
+    velocity.i = gatherVariables<nDim>(iPoint, primitives, idxVelocity);
+    velocity.j = gatherVariables<nDim>(jPoint, primitives, idxVelocity);
+    density.i = gatherVariables<1>(iPoint, primitives, idxDensity);
+    density.j = gatherVariables<1>(jPoint, primitives, idxDensity);
+
+    /*--- Reconstruction. ---*/
+
+    auto scalars = scalars1st;
+
+    if (musclFlow) {
+      const auto& gradients = flowVars->GetGradient_Reconstruction();
+      const auto& limiters = flowVars->GetLimiter_Primitive();
+
+      if (limiterFlow) {
+        musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, velocity.i, idxVelocity);
+        musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, velocity.j, idxVelocity);
+        if (CONSERVATIVE) {
+          musclPointLimited(iPoint, vector_ij, 0.5, limiters, gradients, density.i, idxDensity);
+          musclPointLimited(jPoint, vector_ij,-0.5, limiters, gradients, density.j, idxDensity);
+        }
+      } else {
+        musclUnlimited(iPoint, vector_ij, 0.5, gradients, velocity.i, idxVelocity);
+        musclUnlimited(jPoint, vector_ij,-0.5, gradients, velocity.j, idxVelocity);
+        if (CONSERVATIVE) {
+          musclUnlimited(iPoint, vector_ij, 0.5, gradients, density.i, idxDensity);
+          musclUnlimited(jPoint, vector_ij,-0.5, gradients, density.j, idxDensity);
+        }
+      }
+    }
+
+    if (muscl) {
+      const auto& gradients = solution.GetGradient_Reconstruction();
+
+      if (limiter) {
+        musclPointLimited(iPoint, vector_ij, 0.5, solution.GetLimiter(), gradients, scalars.i);
+        musclPointLimited(jPoint, vector_ij,-0.5, solution.GetLimiter(), gradients, scalars.j);
+      } else {
+        musclUnlimited(iPoint, vector_ij, 0.5, gradients, scalars.i);
+        musclUnlimited(jPoint, vector_ij,-0.5, gradients, scalars.j);
+      }
+    }
+
+    /*--- Face-normal velocity, relative to the grid if it moves. ---*/
+
+    Double q_ij = 0.5 * (dot(velocity.i, normal) + dot(velocity.j, normal));
+
+    if (dynamicGrid) {
+      const auto& gridVel = geometry.nodes->GetGridVel();
+      q_ij -= 0.5 * (dot(gatherVariables<nDim>(iPoint, gridVel), normal) +
+                     dot(gatherVariables<nDim>(jPoint, gridVel), normal));
+    }
+    const Double a0 = fmax(0.0, q_ij);
+    const Double a1 = fmin(0.0, q_ij);
+
+    /*--- Flux and Jacobians, the latter are w.r.t. the conservative variables and diagonal. ---*/
+
+    const Double rho_i = CONSERVATIVE ? density.i(0) : Double(1.0);
+    const Double rho_j = CONSERVATIVE ? density.j(0) : Double(1.0);
+
+    VectorDbl<nVar> flux, diag_i, diag_j;
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) = a0 * rho_i * scalars.i(iVar) + a1 * rho_j * scalars.j(iVar);
+      diag_i(iVar) = a0;
+      diag_j(iVar) = a1;
+    }
+
+    /*--- Diffusive fluxes. ---*/
+
+    Base::viscousTerms(iEdge, iPoint, jPoint, scalars1st, solution, vector_ij,
+                       normal, implicit, flux, diag_i, diag_j);
+
+    /*--- Stop preaccumulation. ---*/
+
+    stopPreacc(flux);
+
+    /*--- Update the vector and system matrix. ---*/
+
+    MatrixDbl<nVar> jac_i, jac_j;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      for (size_t jVar = 0; jVar < nVar; ++jVar) {
+        jac_i.data()[iVar*nVar+jVar] = (iVar == jVar) ? diag_i(iVar) : Double(0.0);
+        jac_j.data()[iVar*nVar+jVar] = (iVar == jVar) ? diag_j(iVar) : Double(0.0);
+      }
+    }
+    updateLinearSystem(iEdge, iPoint, jPoint, implicit, updateType,
+                       updateMask, flux, jac_i, jac_j, vector, matrix);
+  }
+};
@@ -0,0 +1,116 @@
+/*!
+ * \file common.hpp
+ * \brief Common diffusion infrastructure of the scalar transport equations.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "../common.hpp"
+
+/*!
+ * \class CScalarDiffusionBase
+ * \ingroup ViscDiscr
+ * \brief Decorator class to add the diffusive fluxes of scalar equations, i.e.
+ * the scalar counterpart of CCompressibleViscousFluxBase. The derived class
+ * implements the diffusion coefficients in a const "finalizeDiffusion" method.
+ * \note Same approximations as CAvgGrad_Scalar, corrected average gradient
+ * and Thin Shear Layer Jacobians, the latter are diagonal for all models.
+ */
+template<size_t NDIM, size_t NVAR, class Derived>
+class CScalarDiffusionBase : public CScalarNumericsBase<NDIM,NVAR> {
+protected:
+  using Base = CScalarNumericsBase<NDIM,NVAR>;
+  using Base::nDim;
+  using Base::nVar;
+  using Base::flowVars;
+  using Base::idxDensity;
+  using Base::idxLaminarVisc;
+  using Base::idxEddyVisc;
+
+  /*!
+   * \brief Flow properties used by the diffusion coefficients.
+   */
+  struct CFlowProperties {
+    Double density, laminarVisc, eddyVisc;
+  };
+
+  /*!
+   * \brief Constructor, forward everything to the base.
+   */
+  template<class... Ts>
+  CScalarDiffusionBase(const CConfig& config, int iMesh, Ts&... args) : Base(config, iMesh, args...) {}
+
+  /*!
+   * \brief Add diffusive contributions to flux and Jacobians.
+   * \param[in] scalars - Scalar variables at i/j (not reconstructed).
+   * \param[in,out] jac_i, jac_j - Diagonal of the Jacobians.
+   */
+  FORCEINLINE void viscousTerms(Int iEdge,
+                                Int iPoint,
+                                Int jPoint,
+                                const CPair<VectorDbl<nVar> >& scalars,
+                                const CVariable& solution,
+                                const VectorDbl<nDim>& vector_ij,
+                                const VectorDbl<nDim>& normal,
+                                bool implicit,
+                                VectorDbl<nVar>& flux,
+                                VectorDbl<nVar>& jac_i,
+                                VectorDbl<nVar>& jac_j) const {
+
+    /*--- Projection of the edge vector (see CNumerics::ComputeProjectedGradient). ---*/
+
+    const Double proj_vector_ij = dot(vector_ij, normal) / fmax(squaredNorm(vector_ij), EPS);
+
+    /*--- Corrected mean gradient projected on the normal. The rows are accessed
+     *    via pointers as single-row matrices are stored as vectors. ---*/
+
+    const auto& gradient = solution.GetGradient();
+    const auto grad_i = gatherVariables<nVar,nDim>(iPoint, gradient);
+    const auto grad_j = gatherVariables<nVar,nDim>(jPoint, gradient);
+
+    VectorDbl<nVar> projGrad;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      VectorDbl<nDim> avgGrad;
+      for (size_t iDim = 0; iDim < nDim; ++iDim) {
+        avgGrad(iDim) = 0.5 * (grad_i.data()[iVar*nDim+iDim] + grad_j.data()[iVar*nDim+iDim]);
+      }
+      const Double edgeProj = dot(avgGrad, vector_ij);
+      projGrad(iVar) = dot(avgGrad, normal) - (edgeProj - (scalars.j(iVar) - scalars.i(iVar))) * proj_vector_ij;
+    }
+
+    /*--- Flow properties w/o reconstruction. ---*/
+
+    const auto& primitives = flowVars->GetPrimitive();
+    CPair<CFlowProperties> V;
+    V.i.density = gatherVariable(iPoint, idxDensity, primitives);
+    V.j.density = gatherVariable(jPoint, idxDensity, primitives);
+    V.i.laminarVisc = gatherVariable(iPoint, idxLaminarVisc, primitives);
+    V.j.laminarVisc = gatherVariable(jPoint, idxLaminarVisc, primitives);
+    V.i.eddyVisc = gatherVariable(iPoint, idxEddyVisc, primitives);
+    V.j.eddyVisc = gatherVariable(jPoint, idxEddyVisc, primitives);
+
+    static_cast<const Derived*>(this)->finalizeDiffusion(iPoint, jPoint, solution, V, scalars, projGrad,
+                                                         proj_vector_ij, implicit, flux, jac_i, jac_j);
+  }
+};
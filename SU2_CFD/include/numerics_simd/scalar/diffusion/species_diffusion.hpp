@@ -0,0 +1,92 @@
+/*!
+ * \file species_diffusion.hpp
+ * \brief Decorator to add the diffusive fluxes of the species transport equations.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "../../../variables/CSpeciesVariable.hpp"
+
+/*!
+ * \class CSpeciesDiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusive flux of the species transport equations (mass diffusivity plus turbulent Schmidt number).
+ */
+template<size_t NDIM, size_t NVAR>
+class CSpeciesDiffusion : public CScalarDiffusionBase<NDIM, NVAR, CSpeciesDiffusion<NDIM,NVAR> > {
+protected:
+  using Base = CScalarDiffusionBase<NDIM, NVAR, CSpeciesDiffusion<NDIM,NVAR> >;
+  using Base::nVar;
+  using typename Base::CFlowProperties;
+  friend Base;
+
+  const bool turbulence;
+  const su2double Sc_t;
+
+  /*!
+   * \brief Constructor, store the turbulent Schmidt number.
+   */
+  template<class... Ts>
+  CSpeciesDiffusion(const CConfig& config, int iMesh, Ts&... args) : Base(config, iMesh, args...),
+    turbulence(config.GetKind_Turb_Model() != TURB_MODEL::NONE),
+    Sc_t(config.GetSchmidt_Number_Turbulent()) {
+  }
+
+  /*!
+   * \brief Mean diffusivity times the projected gradient, and TSL Jacobians.
+   */
+  FORCEINLINE void finalizeDiffusion(Int iPoint, Int jPoint,
+                                     const CVariable& solution,
+                                     const CPair<CFlowProperties>& V,
+                                     const CPair<VectorDbl<nVar> >&,
+                                     const VectorDbl<nVar>& projGrad,
+                                     Double proj_vector_ij,
+                                     bool implicit,
+                                     VectorDbl<nVar>& flux,
+                                     VectorDbl<nVar>& jac_i,
+                                     VectorDbl<nVar>& jac_j) const {
+
+    const auto& diffusivity = static_cast<const CSpeciesVariable&>(solution).GetDiffusivity();
+    const auto diffusivity_i = gatherVariables<nVar>(iPoint, diffusivity);
+    const auto diffusivity_j = gatherVariables<nVar>(jPoint, diffusivity);
+
+    const Double diff_turb = turbulence ? Double(0.5 * (V.i.eddyVisc + V.j.eddyVisc) / Sc_t) : Double(0.0);
+
+    VectorDbl<nVar> diff;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      diff(iVar) = 0.5 * (V.i.density * diffusivity_i(iVar) + V.j.density * diffusivity_j(iVar)) + diff_turb;
+      flux(iVar) -= diff(iVar) * projGrad(iVar);
+    }
+
+    if (!implicit) return;
+
+    const Double proj_on_rho_i = proj_vector_ij / V.i.density;
+    const Double proj_on_rho_j = proj_vector_ij / V.j.density;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      jac_i(iVar) += diff(iVar) * proj_on_rho_i;
+      jac_j(iVar) -= diff(iVar) * proj_on_rho_j;
+    }
+  }
+};
@@ -0,0 +1,206 @@
+/*!
+ * \file turb_diffusion.hpp
+ * \brief Decorators to add the diffusive fluxes of turbulence models.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "common.hpp"
+#include "../../../variables/CTurbSSTVariable.hpp"
+
+/*!
+ * \class CSADiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusive flux of the Spalart-Allmaras model (and the negative variant).
+ */
+template<size_t NDIM, bool NEGATIVE>
+class CSADiffusion : public CScalarDiffusionBase<NDIM, 1, CSADiffusion<NDIM,NEGATIVE> > {
+protected:
+  using Base = CScalarDiffusionBase<NDIM, 1, CSADiffusion<NDIM,NEGATIVE> >;
+  using Base::nVar;
+  using typename Base::CFlowProperties;
+  friend Base;
+
+  /*!
+   * \brief Constructor, forward everything to the base.
+   */
+  template<class... Ts>
+  CSADiffusion(const CConfig& config, int iMesh, Ts&... args) : Base(config, iMesh, args...) {}
+
+  /*!
+   * \brief Mean effective viscosity times the projected gradient, and TSL Jacobians.
+   */
+  FORCEINLINE void finalizeDiffusion(Int, Int, const CVariable&,
+                                     const CPair<CFlowProperties>& V,
+                                     const CPair<VectorDbl<nVar> >& scalars,
+                                     const VectorDbl<nVar>& projGrad,
+                                     Double proj_vector_ij,
+                                     bool implicit,
+                                     VectorDbl<nVar>& flux,
+                                     VectorDbl<nVar>& jac_i,
+                                     VectorDbl<nVar>& jac_j) const {
+    constexpr passivedouble sigma = 2.0/3.0;
+
+    const Double nu_ij = 0.5 * (V.i.laminarVisc / V.i.density + V.j.laminarVisc / V.j.density);
+    const Double nu_tilde_ij = 0.5 * (scalars.i(0) + scalars.j(0));
+    Double nu_e = nu_ij + nu_tilde_ij;
+
+    if (NEGATIVE) {
+      constexpr passivedouble cn1 = 16.0;
+      /*--- fn is 1 for positive nu_tilde, which recovers the standard model. ---*/
+      const Double Xi3 = pow(fmin(nu_tilde_ij, 0.0) / nu_ij, 3);
+      const Double fn = (cn1 + Xi3) / (cn1 - Xi3);
+      nu_e += (fn - 1) * nu_tilde_ij;
+    }
+
+    flux(0) -= nu_e * projGrad(0) / sigma;
+
+    if (!implicit) return;
+
+    jac_i(0) -= (0.5 * projGrad(0) - nu_e * proj_vector_ij) / sigma;
+    jac_j(0) -= (0.5 * projGrad(0) + nu_e * proj_vector_ij) / sigma;
+  }
+};
+
+/*!
+ * \class CSSTDiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusive flux of the SST model, the diffusion constants are blended with F1.
+ */
+template<size_t NDIM>
+class CSSTDiffusion : public CScalarDiffusionBase<NDIM, 2, CSSTDiffusion<NDIM> > {
+protected:
+  using Base = CScalarDiffusionBase<NDIM, 2, CSSTDiffusion<NDIM> >;
+  using Base::nVar;
+  using typename Base::CFlowProperties;
+  friend Base;
+
+  const su2double sigma_k1, sigma_k2, sigma_om1, sigma_om2;
+
+  /*!
+   * \brief Constructor, store the diffusion constants (first four SST constants).
+   */
+  template<class... Ts>
+  CSSTDiffusion(const CConfig& config, int iMesh, const CVariable* flowVars,
+                const CPrimitiveIndices<unsigned short>& flowIdx, const su2double* constants, Ts&... args) :
+    Base(config, iMesh, flowVars, flowIdx, args...),
+    sigma_k1(constants[0]),
+    sigma_k2(constants[1]),
+    sigma_om1(constants[2]),
+    sigma_om2(constants[3]) {
+  }
+
+  /*!
+   * \brief Mean effective dynamic viscosity times the projected gradient, and TSL Jacobians.
+   */
+  FORCEINLINE void finalizeDiffusion(Int iPoint, Int jPoint,
+                                     const CVariable& solution,
+                                     const CPair<CFlowProperties>& V,
+                                     const CPair<VectorDbl<nVar> >&,
+                                     const VectorDbl<nVar>& projGrad,
+                                     Double proj_vector_ij,
+                                     bool implicit,
+                                     VectorDbl<nVar>& flux,
+                                     VectorDbl<nVar>& jac_i,
+                                     VectorDbl<nVar>& jac_j) const {
+
+    const auto& F1 = static_cast<const CTurbSSTVariable&>(solution).GetF1blending();
+    const Double F1_i = gatherVariables(iPoint, F1);
+    const Double F1_j = gatherVariables(jPoint, F1);
+
+    const Double sigma_kine_i = F1_i * sigma_k1 + (1 - F1_i) * sigma_k2;
+    const Double sigma_kine_j = F1_j * sigma_k1 + (1 - F1_j) * sigma_k2;
+    const Double sigma_omega_i = F1_i * sigma_om1 + (1 - F1_i) * sigma_om2;
+    const Double sigma_omega_j = F1_j * sigma_om1 + (1 - F1_j) * sigma_om2;
+
+    VectorDbl<nVar> diff;
+    diff(0) = 0.5 * (V.i.laminarVisc + sigma_kine_i * V.i.eddyVisc +
+                     V.j.laminarVisc + sigma_kine_j * V.j.eddyVisc);
+    diff(1) = 0.5 * (V.i.laminarVisc + sigma_omega_i * V.i.eddyVisc +
+                     V.j.laminarVisc + sigma_omega_j * V.j.eddyVisc);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) -= diff(iVar) * projGrad(iVar);
+    }
+
+    if (!implicit) return;
+
+    const Double proj_on_rho_i = proj_vector_ij / V.i.density;
+    const Double proj_on_rho_j = proj_vector_ij / V.j.density;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      jac_i(iVar) += diff(iVar) * proj_on_rho_i;
+      jac_j(iVar) -= diff(iVar) * proj_on_rho_j;
+    }
+  }
+};
+
+/*!
+ * \class CLMDiffusion
+ * \ingroup ViscDiscr
+ * \brief Diffusive flux of the Langtry-Menter transition model (intermittency and momentum thickness Reynolds number).
+ */
+template<size_t NDIM>
+class CLMDiffusion : public CScalarDiffusionBase<NDIM, 2, CLMDiffusion<NDIM> > {
+protected:
+  using Base = CScalarDiffusionBase<NDIM, 2, CLMDiffusion<NDIM> >;
+  using Base::nVar;
+  using typename Base::CFlowProperties;
+  friend Base;
+
+  /*!
+   * \brief Constructor, forward everything to the base.
+   */
+  template<class... Ts>
+  CLMDiffusion(const CConfig& config, int iMesh, Ts&... args) : Base(config, iMesh, args...) {}
+
+  /*!
+   * \brief Mean effective dynamic viscosity times the projected gradient, and TSL Jacobians.
+   */
+  FORCEINLINE void finalizeDiffusion(Int, Int, const CVariable&,
+                                     const CPair<CFlowProperties>& V,
+                                     const CPair<VectorDbl<nVar> >&,
+                                     const VectorDbl<nVar>& projGrad,
+                                     Double proj_vector_ij,
+                                     bool implicit,
+                                     VectorDbl<nVar>& flux,
+                                     VectorDbl<nVar>& jac_i,
+                                     VectorDbl<nVar>& jac_j) const {
+    VectorDbl<nVar> diff;
+    diff(0) = 0.5 * (V.i.laminarVisc + V.i.eddyVisc + V.j.laminarVisc + V.j.eddyVisc);
+    diff(1) = 2.0 * diff(0);
+
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      flux(iVar) -= diff(iVar) * projGrad(iVar);
+    }
+
+    if (!implicit) return;
+
+    const Double proj_on_rho_i = proj_vector_ij / V.i.density;
+    const Double proj_on_rho_j = proj_vector_ij / V.j.density;
+    for (size_t iVar = 0; iVar < nVar; ++iVar) {
+      jac_i(iVar) += diff(iVar) * proj_on_rho_i;
+      jac_j(iVar) -= diff(iVar) * proj_on_rho_j;
+    }
+  }
+};
@@ -144,18 +144,20 @@ FORCEINLINE Double gatherVariables(Int iPoint, const Container& vars) {
 
 /*!
  * \brief Gather a vector of variables (size nVar) from row iPoint of a 2D container.
+ * \note Optionally, starting at column "start".
  */
 template<size_t nVar, class Container>
-FORCEINLINE VectorDbl<nVar> gatherVariables(Int iPoint, const Container& vars) {
-  return vars.template get<VectorDbl<nVar> >(iPoint);
+FORCEINLINE VectorDbl<nVar> gatherVariables(Int iPoint, const Container& vars, size_t start = 0) {
+  return vars.template get<VectorDbl<nVar> >(iPoint, start);
 }
 
 /*!
  * \brief Gather a matrix of variables from outer index iPoint of a 3D container.
+ * \note Optionally, starting at middle index "start".
  */
 template<size_t nRows, size_t nCols, class Container>
-FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars) {
-  return vars.template get<MatrixDbl<nRows,nCols> >(iPoint);
+FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars, size_t start = 0) {
+  return vars.template get<MatrixDbl<nRows,nCols> >(iPoint, start);
 }
 #else
 
@@ -179,25 +181,25 @@ FORCEINLINE Double gatherVariables(Int iPoint, const Container& vars) {
 }
 
 template<size_t nVar, class Container>
-FORCEINLINE VectorDbl<nVar> gatherVariables(Int iPoint, const Container& vars) {
+FORCEINLINE VectorDbl<nVar> gatherVariables(Int iPoint, const Container& vars, size_t start = 0) {
   VectorDbl<nVar> x;
   for (size_t i=0; i<nVar; ++i) {
     for (size_t k=0; k<Double::Size; ++k) {
-      AD::SetPreaccIn(vars(iPoint[k],i));
-      x[i][k] = vars(iPoint[k],i);
+      AD::SetPreaccIn(vars(iPoint[k],i+start));
+      x[i][k] = vars(iPoint[k],i+start);
     }
   }
   return x;
 }
 
 template<size_t nRows, size_t nCols, class Container>
-FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars) {
+FORCEINLINE MatrixDbl<nRows,nCols> gatherVariables(Int iPoint, const Container& vars, size_t start = 0) {
   MatrixDbl<nRows,nCols> x;
   for (size_t i=0; i<nRows; ++i) {
     for (size_t j=0; j<nCols; ++j) {
       for (size_t k=0; k<Double::Size; ++k) {
-        AD::SetPreaccIn(vars(iPoint[k],i,j));
-        x(i,j)[k] = vars(iPoint[k],i,j);
+        AD::SetPreaccIn(vars(iPoint[k],i+start,j));
+        x.data()[i*nCols+j][k] = vars(iPoint[k],i+start,j);
       }
     }
   }
@@ -34,6 +34,7 @@
 #include <iomanip>
 #include <limits>
 #include <vector>
+#include <thread>
 
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "tools/CWindowingTools.hpp"
@@ -243,6 +244,12 @@ protected:
   CParallelDataSorter* volumeDataSorter;    //!< Volume data sorter
   CParallelDataSorter* surfaceDataSorter;   //!< Surface data sorter
 
+  bool asyncOutput;                   //!< Write the files in a background thread
+  std::thread asyncWriter;            //!< Background thread writing the last requested file
+  passivedouble asyncBandwidth = 0.0; //!< Bandwidth of the last background write (MB/s)
+  bool asyncRestart = false;          //!< The background write is a binary restart, its bandwidth is aggregated
+  SU2_MPI::Comm asyncComm;            //!< Duplicate communicator used by the background thread
+
   vector<string> volumeFieldNames;     //!< Vector containing the volume field names
   unsigned short nVolumeFields;        //!< Number of fields in the volume output
 
@@ -590,6 +597,18 @@ public:
    */
   void WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE format, string fileName = "");
 
+  /*!
+   * \brief Wait until the file that is being written in the background (ASYNC_OUTPUT= YES) is complete.
+   * \param[in,out] config - If given, the restart bandwidth of the completed write is aggregated in it.
+   */
+  void WaitForAsyncOutput(CConfig *config = nullptr);
+
+  /*!
+   * \brief Delete the data sorters (after waiting for background output), they are allocated again for the
+   *        current geometry by the next volume output, e.g. after the grid is repartitioned.
+   */
+  void DeallocateDataSorters();
+
 protected:
 
   /*----------------------------- Protected member functions ----------------------------*/
@@ -0,0 +1,82 @@
+/*!
+ * \file CDataSorterSnapshot.hpp
+ * \brief Header of the data sorter snapshot class used for asynchronous output.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "CParallelDataSorter.hpp"
+#include <vector>
+
+/*!
+ * \class CDataSorterSnapshot
+ * \brief Frozen copy of the sorted data and connectivity of another data sorter.
+ * \note The file writers only query the sorted data, therefore a snapshot can be written by a
+ * background thread while the original sorter is loaded and sorted again by the solver.
+ * The partition dependent virtual functions of the original sorter are evaluated once and stored.
+ */
+class CDataSorterSnapshot final: public CParallelDataSorter{
+
+private:
+
+  vector<unsigned long> globalIndex;      //!< Global index of each local point
+  vector<unsigned long> nodeBegin;        //!< First node ID owned by each rank
+  vector<unsigned long> nPointCumulative; //!< Cumulated number of points before each rank
+
+public:
+  /*!
+   * \brief Constructor
+   * \param[in] sorter - The data sorter to copy, its data must be sorted.
+   */
+  explicit CDataSorterSnapshot(const CParallelDataSorter& sorter);
+
+  /*!
+   * \brief Get the global index of a point.
+   * \input iPoint - the point ID.
+   * \return Global index of a specific point.
+   */
+  unsigned long GetGlobalIndex(unsigned long iPoint) const override { return globalIndex[iPoint]; }
+
+  /*!
+   * \brief Beginning node ID of the linear partition owned by a specific processor.
+   * \input rank - the processor rank.
+   * \return The beginning node ID.
+   */
+  unsigned long GetNodeBegin(unsigned short rank) const override { return nodeBegin[rank]; }
+
+  /*!
+   * \brief Get the cumulated number of points
+   * \input rank - the processor rank.
+   * \return The cumulated number of points up to certain processor rank.
+   */
+  unsigned long GetnPointCumulative(unsigned short rank) const override { return nPointCumulative[rank]; }
+
+  /*!
+   * \brief Get the Processor ID a Point belongs to.
+   * \param[in] iPoint - global renumbered ID of the point
+   * \return The rank/processor number.
+   */
+  unsigned short FindProcessor(unsigned long iPoint) const override;
+
+};
@@ -78,6 +78,11 @@ protected:
    */
   CParallelDataSorter* dataSorter;
 
+  /*!
+   * \brief The communicator used for writing, a duplicate of the solver communicator for asynchronous output.
+   */
+  SU2_MPI::Comm comm;
+
 #ifdef HAVE_MPI
   /*!
    * \brief The displacement that every process has in the current file view
@@ -137,6 +142,24 @@ public:
    */
   su2double GetUsedTime() const {return usedTime;}
 
+  /*!
+   * \brief Get the data sorter of the writer.
+   * \return Pointer to the data sorter.
+   */
+  CParallelDataSorter* GetDataSorter() const {return dataSorter;}
+
+  /*!
+   * \brief Set the data sorter of the writer, e.g. to write from a snapshot of the sorted data.
+   * \param[in] valDataSorter - The parallel sorted data to write.
+   */
+  void SetDataSorter(CParallelDataSorter* valDataSorter) {dataSorter = valDataSorter;}
+
+  /*!
+   * \brief Set the communicator used by the writer, all collective calls of WriteData use it.
+   * \param[in] valComm - The communicator.
+   */
+  void SetCommunicator(SU2_MPI::Comm valComm) {comm = valComm;}
+
 protected:
 
   /*!
@@ -120,6 +120,12 @@ protected:
    */
   void PrepareSendBuffers(std::vector<unsigned long>& globalID);
 
+  /*!
+   * \brief Deep copy of the sorted data and connectivity, the send buffers are not copied.
+   * \param[in] other - The data sorter to copy.
+   */
+  CParallelDataSorter(const CParallelDataSorter& other);
+
 public:
 
   /*!
@@ -122,9 +122,11 @@ public:
    * \param[in] name - The name of the dataset
    * \param[in] file - The name of the vtu dataset file to write
    * \param[in] dataSorter - Datasorter object containing the actual data. Note, data must be sorted.
+   * \param[in] compression - Compression of the appended data of the vtu file.
    */
   //void AddDataset(string name, string file, CParallelDataSorter* dataSorter);
-  void AddDataset(const string& foldername, string name, const string& file, CParallelDataSorter* dataSorter);
+  void AddDataset(const string& foldername, string name, const string& file, CParallelDataSorter* dataSorter,
+                  VTU_COMPRESSION compression = VTU_COMPRESSION::NONE);
 
   /*!
    * \brief Start a new block
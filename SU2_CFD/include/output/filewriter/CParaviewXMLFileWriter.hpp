@@ -52,6 +52,37 @@ private:
    */
   unsigned long dataOffset;
 
+  /*!
+   * \brief Compression of the appended data blocks.
+   */
+  VTU_COMPRESSION compression;
+
+  /*!
+   * \brief Uncompressed size in bytes of the blocks of a compressed data array.
+   */
+  static constexpr unsigned long compressionBlockSize = 32768;
+
+  /*!
+   * \brief Part of a compressed data array that is written by this rank.
+   */
+  struct CompressedArray {
+    vector<unsigned long> header; /*!< \brief Block count, block sizes, and compressed sizes (master node only). */
+    vector<char> payload;         /*!< \brief Compressed blocks owned by this rank. */
+    unsigned long headerBytes;    /*!< \brief Size of the header in bytes. */
+    unsigned long offset;         /*!< \brief Displacement of the payload of this rank in bytes. */
+    unsigned long totalBytes;     /*!< \brief Size of the compressed blocks over all ranks in bytes. */
+  };
+
+  /*!
+   * \brief Compressed data arrays, in the order they are defined with ::AddDataArray.
+   */
+  vector<CompressedArray> compressedArrays;
+
+  /*!
+   * \brief Number of data arrays defined so far.
+   */
+  unsigned long nDataArrays;
+
 public:
 
   /*!
@@ -69,8 +100,9 @@ public:
   /*!
    * \brief Construct a file writer using field names and the data sorter.
    * \param[in] valDataSorter - The parallel sorted data to write
+   * \param[in] valCompression - Compression of the appended data
    */
-  CParaviewXMLFileWriter(CParallelDataSorter* valDataSorter);
+  CParaviewXMLFileWriter(CParallelDataSorter* valDataSorter, VTU_COMPRESSION valCompression = VTU_COMPRESSION::NONE);
 
   /*!
    * \brief Destructor
@@ -84,6 +116,11 @@ public:
 
 private:
 
+  /*!
+   * \brief Load the point coordinates, connectivity, and fields into 1D buffers and pass them to ::WriteDataArray.
+   */
+  void LoadDataArrays();
+
   /*!
    * \brief Add a new data array definition to the vtu file.
    * \param[in] type - The vtk datatype
@@ -104,6 +141,26 @@ private:
    */
   void WriteDataArray(void *data, VTKDatatype type, unsigned long size, unsigned long globalSize, unsigned long offset);
 
+  /*!
+   * \brief Compress an array in blocks of ::compressionBlockSize bytes. The blocks are aligned with the global
+   * array, each is compressed by the rank that owns its first byte after receiving the remainder from the next ranks.
+   * \param[in] data - Pointer to the data
+   * \param[in] byteSize - The size of the local part of the array in bytes
+   * \param[in] totalByteSize - The global size of the array in bytes
+   * \param[in] byteOffset - The displacement of the local part in the global array in bytes
+   * \return The compressed blocks of this rank and the information needed to write them.
+   */
+  CompressedArray CompressDataArray(const void *data, unsigned long byteSize, unsigned long totalByteSize,
+                                    unsigned long byteOffset) const;
+
+  /*!
+   * \brief Compress one block with the selected compressor.
+   * \param[in] data - Pointer to the block
+   * \param[in] byteSize - The size of the block in bytes
+   * \param[out] compressed - The compressed block
+   */
+  void CompressBlock(const char *data, unsigned long byteSize, vector<char>& compressed) const;
+
   /*!
    * \brief Get the type string and size of a VTK datatype
    * \param[in]  type - The VTK datatype
@@ -32,6 +32,21 @@ class CSU2MeshFileWriter final: public CFileWriter{
 private:
   unsigned short iZone, //!< Index of the current zone
   nZone;                //!< Number of zones
+  bool binary;          //!< Write the native binary format (see CSU2BinaryMeshReaderFVM)
+
+  /*!
+   * \brief Write sorted data to file in SU2 binary mesh format
+   * \param[in] val_filename - The name of the file (without extension)
+   */
+  void WriteDataBinary(const string& val_filename);
+
+  /*!
+   * \brief Read the markers from the boundary file written by SU2_DEF (master node only).
+   * \param[out] names - Marker names, CGNS_STRING_SIZE characters per marker.
+   * \param[out] nElemMarker - Number of elements of each marker.
+   * \param[out] conn - Element connectivity of all markers, [vtkType n0 n1 n2 n3] per element.
+   */
+  void ReadBoundaryFile(vector<char>& names, vector<unsigned long>& nElemMarker, vector<unsigned long>& conn) const;
 
 public:
 
@@ -40,14 +55,20 @@ public:
    */
   const static string fileExt;
 
+  /*!
+   * \brief File extension of the binary format
+   */
+  const static string fileExtBinary;
+
   /*!
    * \brief Construct a file writer using field names, dimension.
    * \param[in] valDataSorter - The parallel sorted data to write
    * \param[in] valiZone - The index of the current zone
    * \param[in] valnZone - The total number of zones
+   * \param[in] valBinary - Write the native binary format instead of ASCII
    */
   CSU2MeshFileWriter(CParallelDataSorter* valDataSorter,
-                     unsigned short valiZone, unsigned short valnZone);
+                     unsigned short valiZone, unsigned short valnZone, bool valBinary = false);
 
   /*!
    * \brief Write sorted data to file in SU2 mesh file format
@@ -56,4 +77,3 @@ public:
   void WriteData(string val_filename) override ;
 
 };
-
@@ -204,6 +204,12 @@ class CFVMFlowSolverBase : public CSolver {
   static constexpr bool ReducerStrategy = false;
 #endif
 
+  /*--- Edge colors split to overlap halo exchanges with the computation of edge fluxes. The first
+   * set contains the edges that only connect domain points, the second those that touch halo points. ---*/
+
+  vector<unsigned long> HaloSplitEdges;             /*!< \brief Edge indices of the split colors. */
+  array<vector<GridColor<> >, 2> HaloSplitColoring; /*!< \brief Interior and halo edge colors. */
+
   /*--- Edge fluxes, for OpenMP parallelization of difficult-to-color grids.
    * We first store the fluxes and then compute the sum for each cell.
    * This strategy is thread-safe but lower performance than writting to both
@@ -257,6 +263,63 @@ class CFVMFlowSolverBase : public CSolver {
    */
   void HybridParallelInitialization(const CConfig& config, CGeometry& geometry);
 
+  /*!
+   * \brief Split the edge colors into the edges that only connect domain points, and those that touch halo points.
+   * \note Whole groups of edges are moved to preserve the thread safety of the coloring.
+   */
+  void SetHaloSplitColoring(const CGeometry& geometry);
+
+  /*!
+   * \brief Check if the edge loops of the residual can overlap the halo exchange left in flight by Preprocessing.
+   * \note Only the compressible solvers defer the exchanges, on the finest grid where MUSCL is used.
+   */
+  inline bool OverlapHaloComms(const CConfig& config) const {
+    return (FlowRegime == ENUM_REGIME::COMPRESSIBLE) && config.GetHaloCommOverlap() && (MGLevel == MESH_0) &&
+           (size > 1);
+  }
+
+  /*!
+   * \brief Apply "edgeFunc" to the edges of each color, in parallel.
+   */
+  template <class ColoringType, class EdgeFunc>
+  static void ColorLoop(const ColoringType& coloring, const EdgeFunc& edgeFunc) {
+    for (const auto& color : coloring) {
+      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+      for (auto k = 0ul; k < color.size; ++k) {
+        edgeFunc(color.indices[k]);
+      }
+      END_SU2_OMP_FOR
+    }
+  }
+
+  /*!
+   * \brief Apply "edgeFunc" to all edges, in parallel. If a halo exchange was left in flight, the edges that only
+   * connect domain points are processed first, then the exchange is completed, and the other edges are processed.
+   * \param[in] edgeFunc - Function of the edge index.
+   */
+  template <class EdgeFunc>
+  void EdgeLoop(CGeometry* geometry, const CConfig* config, const EdgeFunc& edgeFunc) {
+    if (!GetDeferredCommsPending() || HaloSplitColoring[0].empty()) {
+      CompleteDeferredComms(geometry, config);
+      ColorLoop(EdgeColoring, edgeFunc);
+      return;
+    }
+    ColorLoop(HaloSplitColoring[0], edgeFunc);
+    CompleteDeferredComms(geometry, config);
+    ColorLoop(HaloSplitColoring[1], edgeFunc);
+  }
+
+  /*!
+   * \brief Vectorized versions of ColorLoop and EdgeLoop, "edgeFunc" is applied to packs of edges (Int) with a
+   * mask (Double) that is 0 for the padding at the end of each color.
+   */
+  template <class ColoringType, class EdgeFunc>
+  static void ColorLoopSIMD(const ColoringType& coloring, const EdgeFunc& edgeFunc);
+
+  template <class EdgeFunc>
+  void EdgeLoopSIMD(CGeometry* geometry, const CConfig* config, const EdgeFunc& edgeFunc);
+
   /*!
    * \brief Move solution to previous time levels (for restarts).
    */
@@ -271,7 +334,7 @@ class CFVMFlowSolverBase : public CSolver {
   /*!
    * \brief Method to compute convective and viscous residual contribution using vectorized numerics.
    */
-  void EdgeFluxResidual(const CGeometry *geometry, const CSolver* const* solvers, CConfig *config);
+  void EdgeFluxResidual(CGeometry *geometry, const CSolver* const* solvers, CConfig *config);
 
   /*!
    * \brief Sum the edge fluxes for each cell to populate the residual vector, only used on coarse grids.
@@ -906,7 +969,9 @@ class CFVMFlowSolverBase : public CSolver {
   template<class DiagonalPrecond>
   void PrepareImplicitIteration_impl(DiagonalPrecond& preconditioner, CGeometry *geometry, CConfig *config) {
 
-    const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+    /*--- The Newton-Krylov integration forces explicit mode to prepare the right hand side without modifying
+     * the Jacobian of a lagged preconditioner. ---*/
+    const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
 
     /*--- Local residual variables for current thread ---*/
     su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
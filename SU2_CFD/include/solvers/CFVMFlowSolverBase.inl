@@ -333,6 +333,95 @@ void CFVMFlowSolverBase<V, R>::HybridParallelInitialization(const CConfig& confi
 #else
   EdgeColoring[0] = DummyGridColor<>(geometry.GetnEdge());
 #endif
+
+  if (OverlapHaloComms(config)) SetHaloSplitColoring(geometry);
+}
+
+template <class V, ENUM_REGIME R>
+void CFVMFlowSolverBase<V, R>::SetHaloSplitColoring(const CGeometry& geometry) {
+  /*--- Fluxes on edges between domain points only need data computed by this rank. ---*/
+  auto interiorEdge = [&geometry](unsigned long iEdge) {
+    return geometry.nodes->GetDomain(geometry.edges->GetNode(iEdge, 0)) &&
+           geometry.nodes->GetDomain(geometry.edges->GetNode(iEdge, 1));
+  };
+
+  /*--- Groups of the coloring are identified by index, the last group of the grid is the
+   *    only one that may be incomplete, and it is always at the end of its color. ---*/
+#ifdef HAVE_OMP
+  const auto groupSize = EdgeColoring.empty() ? 1ul : EdgeColoring[0].groupSize;
+#else
+  const auto groupSize = 1ul;
+#endif
+
+  HaloSplitEdges.clear();
+  HaloSplitEdges.reserve(geometry.GetnEdge());
+
+  /*--- Offsets of the split colors in HaloSplitEdges, the pointers are only set at the
+   *    end since the vector is being filled. ---*/
+  vector<unsigned long> colorBegin[2], colorSize[2];
+  vector<unsigned long> groupEdges[2];
+
+  for (const auto& color : EdgeColoring) {
+    for (auto& edges : groupEdges) edges.clear();
+
+    for (auto k = 0ul; k < color.size;) {
+      const auto iGroup = color.indices[k] / groupSize;
+      auto interior = true;
+      auto kEnd = k;
+      for (; kEnd < color.size && color.indices[kEnd] / groupSize == iGroup; ++kEnd) {
+        interior = interior && interiorEdge(color.indices[kEnd]);
+      }
+      for (; k < kEnd; ++k) groupEdges[!interior].push_back(color.indices[k]);
+    }
+
+    for (int iSet = 0; iSet < 2; ++iSet) {
+      if (groupEdges[iSet].empty()) continue;
+      colorBegin[iSet].push_back(HaloSplitEdges.size());
+      colorSize[iSet].push_back(groupEdges[iSet].size());
+      HaloSplitEdges.insert(HaloSplitEdges.end(), groupEdges[iSet].begin(), groupEdges[iSet].end());
+    }
+  }
+
+  for (int iSet = 0; iSet < 2; ++iSet) {
+    HaloSplitColoring[iSet].clear();
+    for (auto iColor = 0ul; iColor < colorBegin[iSet].size(); ++iColor) {
+      HaloSplitColoring[iSet].emplace_back(HaloSplitEdges.data() + colorBegin[iSet][iColor],
+                                           colorSize[iSet][iColor], groupSize);
+    }
+  }
+}
+
+template <class V, ENUM_REGIME R>
+template <class ColoringType, class EdgeFunc>
+void CFVMFlowSolverBase<V, R>::ColorLoopSIMD(const ColoringType& coloring, const EdgeFunc& edgeFunc) {
+  for (const auto& color : coloring) {
+    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for(auto k = 0ul; k < color.size; k += Double::Size) {
+      Int iEdge;
+      Double mask;
+      for (auto j = 0ul; j < Double::Size; ++j) {
+        bool in = (k+j < color.size);
+        mask[j] = in;
+        iEdge[j] = color.indices[k+j*in];
+      }
+      edgeFunc(iEdge, mask);
+    }
+    END_SU2_OMP_FOR
+  }
+}
+
+template <class V, ENUM_REGIME R>
+template <class EdgeFunc>
+void CFVMFlowSolverBase<V, R>::EdgeLoopSIMD(CGeometry* geometry, const CConfig* config, const EdgeFunc& edgeFunc) {
+  if (!GetDeferredCommsPending() || HaloSplitColoring[0].empty()) {
+    CompleteDeferredComms(geometry, config);
+    ColorLoopSIMD(EdgeColoring, edgeFunc);
+    return;
+  }
+  ColorLoopSIMD(HaloSplitColoring[0], edgeFunc);
+  CompleteDeferredComms(geometry, config);
+  ColorLoopSIMD(HaloSplitColoring[1], edgeFunc);
 }
 
 template <class V, ENUM_REGIME R>
@@ -807,7 +896,7 @@ void CFVMFlowSolverBase<V, R>::LoadRestart_impl(CGeometry **geometry, CSolver **
     /*--- Load data from the restart into correct containers. ---*/
 
     unsigned long counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+    for (const auto iPoint_Global : geometry[MESH_0]->GetGlobal_Domain_Points()) {
 
       /*--- Retrieve local index. If this node from the restart file lives
       on the current processor, we will load and instantiate the vars. ---*/
@@ -1548,7 +1637,7 @@ void CFVMFlowSolverBase<V, R>::BC_Custom(CGeometry* geometry, CSolver** solver_c
 }
 
 template <class V, ENUM_REGIME R>
-void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
+void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(CGeometry *geometry,
                                                 const CSolver* const* solvers,
                                                 CConfig *config) {
   if (!edgeNumerics) {
@@ -1573,30 +1662,18 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
   else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring) {
-    /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-    for(auto k = 0ul; k < color.size; k += Double::Size) {
-      Int iEdge;
-      Double mask;
-      for (auto j = 0ul; j < Double::Size; ++j) {
-        bool in = (k+j < color.size);
-        mask[j] = in;
-        iEdge[j] = color.indices[k+j*in];
-      }
-
-      if (ReducerStrategy) {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
-      } else {
-        edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
-      }
-      if (MGLevel == MESH_0) {
-        for (auto j = 0ul; j < Double::Size; ++j)
-          counterLocal += (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
-      }
+  auto computeFlux = [&](const Int& iEdge, const Double& mask) {
+    if (ReducerStrategy) {
+      edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
+    } else {
+      edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::COLORING, mask, LinSysRes, Jacobian);
     }
-    END_SU2_OMP_FOR
-  }
+    if (MGLevel == MESH_0) {
+      for (auto j = 0ul; j < Double::Size; ++j)
+        counterLocal += (nodes->NonPhysicalEdgeCounter[iEdge[j]] > 0);
+    }
+  };
+  EdgeLoopSIMD(geometry, config, computeFlux);
 
   FinalizeResidualComputation(geometry, pausePreacc, counterLocal, config);
 }
@@ -56,10 +56,14 @@ protected:
 
   unsigned long ErrorCounter = 0; /*!< \brief Counter for number of un-physical states. */
 
+  su2activematrix SplitSource;    /*!< \brief Chemistry and VT sources per unit volume in the last residual (point-implicit splitting). */
+  su2activematrix SplitSourceRK;  /*!< \brief Sum of SplitSource over the Runge-Kutta stages, weighted as in the flow update. */
+
   su2double Global_Delta_Time = 0.0, /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
   CNEMOGas  *FluidModel;          /*!< \brief fluid model used in the solver */
+  vector<unique_ptr<CNEMOGas> > ThreadFluidModels; /*!< \brief Fluid models of the threads in the point-implicit integration. */
 
   CNEMOEulerVariable* node_infty = nullptr;
 
@@ -90,7 +94,59 @@ protected:
    */
   void SetReferenceValues(const CConfig& config) final;
 
+  /*!
+   * \brief Create the fluid model selected in the config.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nDim - Number of dimensions.
+   * \return Fluid model, owned by the caller.
+   */
+  static CNEMOGas* CreateFluidModel(const CConfig* config, unsigned short nDim);
+
+  /*!
+   * \brief Add the sources of the current Runge-Kutta stage to SplitSourceRK, with the weight of the stage
+   *        residual in the flow update, such that the point-implicit integration removes what the update included.
+   * \param[in] iRKStep - Runge-Kutta stage, the sum is restarted at the first one.
+   * \param[in] weight - Weight of the stage residual.
+   */
+  void AccumulateSplitSource(unsigned short iRKStep, su2double weight);
+
 public:
+  /*!
+   * \brief Work arrays of the point-implicit source integration (one set per thread).
+   */
+  struct PointImplicitWorkspace {
+    const unsigned short nSpecies, nVar;
+    vector<su2double> U_flow, forcing, V, dPdU, dTdU, dTvedU, eves, cvves, rhs;
+    su2activematrix jacobian, sysMatrix;
+    vector<su2double*> jacobianRows, sysRows;
+
+    PointImplicitWorkspace(unsigned short nspecies, unsigned short nvar, unsigned short nprimvar);
+  };
+
+  /*!
+   * \brief Point-implicit integration of the chemistry and VT sources of one point, with the flow update as forcing.
+   * \details Integrates dU/dt = S(U) + (U_flow - U_start) / dt - S_explicit from U_start over dt, where U_flow is the
+   * result of the flow update from U_start, which included the explicit sources S_explicit. Each of the nSubsteps
+   * sub-steps is a backward Euler step linearized with the source Jacobians of the fluid model (species densities
+   * and vib.-el. energy). The forcing vanishes at a steady state of the unsplit problem, independently of dt.
+   * \param[in] variable - Variable used for the conservative to primitive conversion (any point).
+   * \param[in] fluidmodel - Fluid model providing the sources and their Jacobians, it holds the state of the point
+   *            and therefore must not be shared by threads.
+   * \param[in] frozen - Whether the chemistry is frozen (only VT relaxation).
+   * \param[in] nSubsteps - Number of sub-steps.
+   * \param[in] dt - Time step.
+   * \param[in] U_start - Conservative variables before the flow update.
+   * \param[in] V_guess - Primitive variables of the point, their temperatures start the temperature iterations
+   *            (the result does not depend on the point previously integrated with the same work arrays).
+   * \param[in] explicitSource - Sources included in the flow update, per unit volume (species, then the VT term).
+   * \param[in,out] U - Conservative variables after the flow update, and then after the integration.
+   * \param[in] work - Work arrays.
+   * \return False if the integration met a non-physical state, U is then the flow update.
+   */
+  static bool IntegrateSplitSources(CNEMOEulerVariable* variable, CNEMOGas* fluidmodel, bool frozen,
+                                    unsigned short nSubsteps, su2double dt, const su2double* U_start,
+                                    const su2double* V_guess, const su2double* explicitSource, su2double* U, PointImplicitWorkspace& work);
+
   CNEMOEulerSolver() = delete;
 
   /*!
@@ -150,6 +206,17 @@ public:
   static su2double ComputeConsistentExtrapolation(CNEMOGas *fluidmodel, unsigned short nSpecies, su2double *V,
                                                   su2double* dPdU, su2double* dTdU, su2double* dTvedU,
                                                   su2double* val_eves, su2double* val_cvves);
+  /*!
+   * \brief Correct the flow update of each point with the implicit integration of its chemistry and VT sources.
+   * \details Balanced splitting, the sources stay explicit in the flow residual (not in the Jacobian) and the
+   * correction integrates them implicitly over the local time step (the physical time step with dual time),
+   * with the rest of the flow update as constant forcing. The steady state does not depend on the CFL number.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] explicitSource - Sources per unit volume included in the flow update (SplitSource or SplitSourceRK).
+   */
+  void PointImplicit_Chemistry(CGeometry *geometry, const CConfig *config, const su2activematrix& explicitSource);
+
   /*!
    * \brief Source term integration.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -35,6 +35,8 @@
 #include "../variables/CPrimitiveIndices.hpp"
 #include "CSolver.hpp"
 
+class CNumericsSIMD;
+
 /*!
  * \brief Main class for defining a scalar solver.
  * \tparam VariableType - Class of variable used by the solver inheriting from this template.
@@ -78,6 +80,9 @@ class CScalarSolver : public CSolver {
   /*--- Edge fluxes for reducer strategy (see the notes in CEulerSolver.hpp). ---*/
   CSysVector<su2double> EdgeFluxes; /*!< \brief Flux across each edge. */
 
+  CNumericsSIMD* edgeNumerics = nullptr; /*!< \brief Object for vectorized edge flux computation (if supported). */
+  bool edgeNumericsCreated = false;      /*!< \brief If the creation of edgeNumerics was attempted. */
+
   /*!
    * \brief The highest level in the variable hierarchy this solver can safely use.
    */
@@ -297,6 +302,23 @@ class CScalarSolver : public CSolver {
    */
   void SumEdgeFluxes(CGeometry* geometry);
 
+  /*!
+   * \brief Create the object used to compute the convective and viscous edge fluxes with vectorization.
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \return nullptr if the model (or its options) is not supported, which is the default.
+   */
+  inline virtual CNumericsSIMD* CreateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) const {
+    return nullptr;
+  }
+
+  /*!
+   * \brief Vectorized version of the edge loop of Upwind_Residual, which includes the viscous fluxes.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void EdgeFluxResidual(CGeometry* geometry, const CConfig* config);
+
  private:
   /*!
    * \brief Compute the viscous flux for the scalar equation at a particular edge.
@@ -103,6 +103,9 @@ protected:
   su2double Total_Custom_ObjFunc = 0.0; /*!< \brief Total custom objective function. */
   su2double Total_ComboObj = 0.0;       /*!< \brief Total 'combo' objective for all monitored boundaries */
 
+  bool deferCompleteComms = false; /*!< \brief The next call to CompleteComms leaves the exchange in flight. */
+  int pendingComms = -1;           /*!< \brief Type of the exchange left in flight, -1 if there is none. */
+
   /*--- Variables that need to go. ---*/
 
   su2double *Residual,      /*!< \brief Auxiliary nVar vector. */
@@ -264,6 +267,25 @@ public:
                      const CConfig *config,
                      unsigned short commType);
 
+  /*!
+   * \brief Leave the next exchange in flight when CompleteComms is called, to overlap it with work that only
+   *        needs data owned by this rank. The exchange is completed by CompleteDeferredComms, or at the latest
+   *        when the next exchange is initiated.
+   */
+  void DeferCompleteComms();
+
+  /*!
+   * \brief Complete the exchange left in flight by DeferCompleteComms, if there is one.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config   - Definition of the particular problem.
+   */
+  void CompleteDeferredComms(CGeometry *geometry, const CConfig *config);
+
+  /*!
+   * \brief Check if there is an exchange in flight that was left by DeferCompleteComms.
+   */
+  inline bool GetDeferredCommsPending() const { return pendingComms >= 0; }
+
   /*!
    * \brief Helper function to define the type and number of variables per point for each communication type.
    * \param[in] config - Definition of the particular problem.
@@ -1418,6 +1440,35 @@ public:
    */
   void ResetCFLAdapt();
 
+  /*!
+   * \brief State of the CFL adaptation that is not stored per point.
+   */
+  struct CFLAdaptState {
+    unsigned short NonLinRes_Counter;
+    vector<su2double> NonLinRes_Series;
+    su2double Old_Func, New_Func, Min_CFL_Local, Max_CFL_Local, Avg_CFL_Local;
+  };
+
+  /*!
+   * \brief Get the state of the CFL adaptation, e.g. to transfer it to another instance of the solver.
+   */
+  inline CFLAdaptState GetCFLAdaptState() const {
+    return {NonLinRes_Counter, NonLinRes_Series, Old_Func, New_Func, Min_CFL_Local, Max_CFL_Local, Avg_CFL_Local};
+  }
+
+  /*!
+   * \brief Set the state of the CFL adaptation.
+   */
+  inline void SetCFLAdaptState(const CFLAdaptState& state) {
+    NonLinRes_Counter = state.NonLinRes_Counter;
+    NonLinRes_Series = state.NonLinRes_Series;
+    Old_Func = state.Old_Func;
+    New_Func = state.New_Func;
+    Min_CFL_Local = state.Min_CFL_Local;
+    Max_CFL_Local = state.Max_CFL_Local;
+    Avg_CFL_Local = state.Avg_CFL_Local;
+  }
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -3458,9 +3509,9 @@ public:
    * \param[in] rhs - Right hand side.
    * \param[in] nVar - Number of variables.
    */
-  void Gauss_Elimination(su2double** A,
-                         su2double* rhs,
-                         unsigned short nVar);
+  static void Gauss_Elimination(su2double** A,
+                                su2double* rhs,
+                                unsigned short nVar);
 
   /*!
    * \brief Prepares and solves the aeroelastic equations.
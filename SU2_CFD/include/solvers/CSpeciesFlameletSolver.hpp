@@ -75,27 +75,22 @@ class CSpeciesFlameletSolver final : public CSpeciesSolver {
   su2double GetBurntProgressVariable(CFluidModel* fluid_model, const su2double* scalars);
 
   /*!
-   * \brief Retrieve scalar source terms from manifold.
+   * \brief Set the scalar source terms from the manifold source terms.
    * \param[in] config - definition of particular problem.
-   * \param[in] fluid_model_local - pointer to flamelet fluid model.
    * \param[in] iPoint - node ID.
    * \param[in] scalars - local scalar solution.
-   * \param[in] table_source_names - variable names of scalar source terms.
-   * \return - within manifold bounds (0) or outside manifold bounds (1).
+   * \param[in] table_sources - production and consumption terms obtained from the manifold.
    */
-  unsigned long SetScalarSources(const CConfig* config, CFluidModel* fluid_model_local, unsigned long iPoint,
-                                 const vector<su2double>& scalars);
+  void SetScalarSources(const CConfig* config, unsigned long iPoint, const su2double* scalars,
+                        const su2double* table_sources);
 
   /*!
-   * \brief Retrieve passive look-up data from manifold.
+   * \brief Set the passive look-up data obtained from the manifold.
    * \param[in] config - definition of particular problem.
-   * \param[in] fluid_model_local - pointer to flamelet fluid model.
    * \param[in] iPoint - node ID.
-   * \param[in] scalars - local scalar solution.
-   * \return - within manifold bounds (0) or outside manifold bounds (1).
+   * \param[in] lookup_scalar - passive look-up data.
    */
-  unsigned long SetScalarLookUps(const CConfig* config, CFluidModel* fluid_model_local, unsigned long iPoint,
-                                 const vector<su2double>& scalars);
+  void SetScalarLookUps(const CConfig* config, unsigned long iPoint, const su2double* lookup_scalar);
 
  public:
   /*!
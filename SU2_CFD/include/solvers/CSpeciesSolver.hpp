@@ -92,6 +92,13 @@ class CSpeciesSolver : public CScalarSolver<CSpeciesVariable> {
   void Viscous_Residual(unsigned long iEdge, CGeometry* geometry, CSolver** solver_container, CNumerics* numerics,
                         CConfig* config) final;
 
+  /*!
+   * \brief Create the vectorized convective and viscous edge numerics (see CScalarSolver::EdgeFluxResidual).
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CNumericsSIMD* CreateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) const override;
+
   /*!
    * \brief Impose the inlet boundary condition.
    * \param[in] geometry - Geometrical definition of the problem.
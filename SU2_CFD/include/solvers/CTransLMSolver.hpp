@@ -101,6 +101,13 @@ public:
   void Viscous_Residual(unsigned long iEdge, CGeometry* geometry, CSolver** solver_container,
                         CNumerics* numerics, CConfig* config) override;
 
+  /*!
+   * \brief Create the vectorized convective and viscous edge numerics (see CScalarSolver::EdgeFluxResidual).
+   * \param[in] solvers - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  CNumericsSIMD* CreateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) const override;
+
   /*!
    * \brief Source term computation.
    * \param[in] geometry - Geometrical definition of the problem.
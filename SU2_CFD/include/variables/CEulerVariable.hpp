@@ -140,6 +140,16 @@ class CEulerVariable : public CFlowVariable {
    */
   void SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidModel) override;
 
+  /*!
+   * \brief Set the primitive and secondary variables of a contiguous range of points, evaluating the fluid model
+   *        once per range via its batched interface (equivalent to SetPrimVar followed by SetSecondaryVar).
+   * \param[in] iPointBegin - First point of the range.
+   * \param[in] nPoints - Number of points, at most CFluidStateBatch::MAXSIZE.
+   * \param[in] FluidModel - Fluid model.
+   * \return Number of points with non-physical states, for which the old solution was restored.
+   */
+  unsigned long SetPrimVar_Batch(unsigned long iPointBegin, unsigned long nPoints, CFluidModel *FluidModel);
+
   /*!
    * \brief Get all the secondary variables.
    */
@@ -179,9 +179,19 @@ class CNEMOEulerVariable : public CFlowVariable {
    /*!
   * \brief Set all the primitive and secondary variables from the conserved vector.
   */
-  bool Cons2PrimVar(su2double *U, su2double *V, su2double *dPdU,
+  inline bool Cons2PrimVar(su2double *U, su2double *V, su2double *dPdU,
+                           su2double *dTdU, su2double *dTvedU, su2double *val_eves,
+                           su2double *val_Cvves) {
+    return Cons2PrimVar(fluidmodel, U, V, dPdU, dTdU, dTvedU, val_eves, val_Cvves);
+  }
+
+  /*!
+   * \overload
+   * \brief Conversion with a given fluid model, which is left at the state of U (e.g. one model per thread).
+   */
+  bool Cons2PrimVar(CNEMOGas *val_fluidmodel, su2double *U, su2double *V, su2double *dPdU,
                     su2double *dTdU, su2double *dTvedU, su2double *val_eves,
-                    su2double *val_Cvves);
+                    su2double *val_Cvves) const;
 
   /*---------------------------------------*/
   /*---   Specific variable routines    ---*/
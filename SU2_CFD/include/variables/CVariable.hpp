@@ -581,6 +581,11 @@ public:
    */
   inline su2double GetLocalCFL(unsigned long iPoint) const { return LocalCFL(iPoint); }
 
+  /*!
+   * \brief Get the local CFL numbers of all points.
+   */
+  inline VectorType& GetLocalCFL() { return LocalCFL; }
+
   /*!
    * \brief Get the entire Aux matrix of the problem.
    * \return Reference to the aux var  matrix.
@@ -718,6 +723,7 @@ public:
    * \return Reference to gradient.
    */
   inline CVectorOfMatrix& GetGradient(void) { return Gradient; }
+  inline const CVectorOfMatrix& GetGradient(void) const { return Gradient; }
 
   /*!
    * \brief Get the value of the solution gradient.
@@ -764,6 +770,7 @@ public:
    * \return Reference to the limiters vector.
    */
   inline MatrixType& GetLimiter(void) { return Limiter; }
+  inline const MatrixType& GetLimiter(void) const { return Limiter; }
 
   /*!
    * \brief Get the value of the slope limiter.
@@ -95,6 +95,8 @@
 #include "../../include/iteration/CIterationFactory.hpp"
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
+#include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
 
 #include <cassert>
 
@@ -118,6 +120,10 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   PreprocessInput(config_container, driver_config);
 
+  /*--- Start profiling the regions of the iterations if requested. ---*/
+
+  CProfiler::Enable(config_container[ZONE_0]->GetWrt_Profiling());
+
   /*--- Retrieve dimension from mesh file ---*/
 
   nDim = CConfig::GetnDim(config_container[ZONE_0]->GetMesh_FileName(),
@@ -165,7 +171,10 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
   if (rank == MASTER_NODE)
     cout << "Computing wall distances." << endl;
 
-  CGeometry::ComputeWallDistance(config_container, geometry_container);
+  {
+    SU2_PROFILE_REGION("Wall_Distance");
+    CGeometry::ComputeWallDistance(config_container, geometry_container);
+  }
 
   for (iZone = 0; iZone < nZone; iZone++) {
 
@@ -452,11 +461,18 @@ void CDriver::Finalize() {
   delete [] grid_movement;
   if (rank == MASTER_NODE) cout << "Deleted CVolumetricMovement class." << endl;
 
-  /*--- Output profiling information ---*/
-  // Note that for now this is called only by a single thread, but all
-  // necessary variables have been made thread private for safety (tick/tock)!!
+  /*--- Complete the files written in the background, their restart bandwidth is part of the summary. ---*/
+
+  if (output_container != nullptr) {
+    for (iZone = 0; iZone < nZone; iZone++)
+      output_container[iZone]->WaitForAsyncOutput(config_container[iZone]);
+    BandwidthSum = config_container[ZONE_0]->GetRestart_Bandwidth_Agg();
+  }
+
+  /*--- Output profiling information (reduced over threads and ranks). ---*/
 
-  config_container[ZONE_0]->SetProfilingCSV();
+  if (config_container[ZONE_0]->GetBenchmark_Iter() > 0) PrintBenchmarkSummary();
+  CProfiler::WriteReport("profiling.csv");
   config_container[ZONE_0]->GEMMProfilingCSV();
 
   /*--- Deallocate config container ---*/
@@ -543,6 +559,356 @@ void CDriver::Finalize() {
 }
 
 
+void CDriver::PrintBenchmarkSummary() const {
+
+  /*--- Collective reduction of the timings of all regions. ---*/
+
+  const auto summary = CProfiler::GetSummary();
+
+  if (rank != MASTER_NODE || IterCount == 0) return;
+
+  const int nThreads = omp_get_max_threads();
+  const auto nPoint = static_cast<unsigned long>(round(1e6 * SU2_TYPE::GetValue(MpointsDomain)));
+  const auto computeTime = SU2_TYPE::GetValue(UsedTimeCompute);
+
+  cout << "\n--------------------------- Benchmark Summary ---------------------------" << endl;
+  cout << setw(25) << "Ranks:" << setw(12) << size << " | ";
+  cout << setw(20) << "Threads/rank:" << setw(12) << nThreads << endl;
+  cout << setw(25) << "Points:" << setw(12) << nPoint << " | ";
+  cout << setw(20) << "Points/rank:" << setw(12) << nPoint / size << endl;
+  cout << setw(25) << "Iterations:" << setw(12) << IterCount << " | ";
+  cout << setw(20) << "Mpoints/s:" << setw(12) << SU2_TYPE::GetValue(MpointsDomain) * IterCount / computeTime << endl;
+
+  /*--- Per-phase table, time per iteration is the average over ranks, the share is relative to the compute
+   * time (i.e. the preprocessing phases can exceed 100%), imbalance is max/avg over ranks and threads. ---*/
+
+  cout << "\n" << setw(40) << left << "Region" << right << setw(12) << "Time/iter" << setw(10) << "% comp."
+       << setw(11) << "Rank imb." << setw(10) << "Thr. imb." << endl;
+
+  for (const auto& region : summary) {
+    const auto depth = count(region.path.begin(), region.path.end(), '/');
+    const auto name = string(2 * depth, ' ') + region.path.substr(region.path.find_last_of('/') + 1);
+    const auto imbalance = (region.avgTime > 0.0) ? region.maxTime / region.avgTime : 1.0;
+    cout << setw(40) << left << name.substr(0, 39) << right << scientific << setprecision(3) << setw(12)
+         << region.avgTime / IterCount << fixed << setprecision(1) << setw(10) << 100 * region.avgTime / computeTime
+         << setprecision(2) << setw(11) << imbalance << setw(10) << region.threadImbalance << endl;
+  }
+  cout << "-------------------------------------------------------------------------" << endl;
+  cout.unsetf(ios::floatfield);
+
+  /*--- Append to a CSV file such that runs with different numbers of ranks or grid sizes
+   * (strong and weak scaling series) can be compared. ---*/
+
+  const string fileName = "scaling_benchmark.csv";
+  const bool newFile = !ifstream(fileName).good();
+  ofstream file(fileName, ios::app);
+  if (newFile) {
+    file << "\"Ranks\",\"Threads\",\"Points\",\"Points_Per_Rank\",\"Iterations\",\"Region\",\"Calls\","
+            "\"Avg_Time\",\"Max_Time\",\"Time_Per_Iter\",\"MPoints_Per_Second\"\n";
+  }
+  file.precision(6);
+  for (const auto& region : summary) {
+    file << size << ',' << nThreads << ',' << nPoint << ',' << nPoint / size << ',' << IterCount << ",\""
+         << region.path << "\"," << region.calls << ',' << scientific << region.avgTime << ',' << region.maxTime
+         << ',' << region.avgTime / IterCount << ','
+         << (region.maxTime > 0.0 ? SU2_TYPE::GetValue(MpointsDomain) * IterCount / region.maxTime : 0.0)
+         << defaultfloat << '\n';
+  }
+  cout << "Benchmark timings appended to " << fileName << "." << endl;
+}
+
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+namespace {
+/*--- Send one buffer to each rank and receive the buffers sent to this rank, concatenated in rank order.
+ * The number of entries received from each rank is returned in "recvCounts". ---*/
+template <class T>
+vector<T> ExchangeBuffers(const vector<vector<T> >& sendBuffers, MPI_Datatype type, vector<int>& recvCounts) {
+  const int size = SU2_MPI::GetSize();
+  const auto comm = SU2_MPI::GetComm();
+
+  vector<int> sendCounts(size), sendDispls(size, 0), recvDispls(size, 0);
+  vector<T> send;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendCounts[iRank] = sendBuffers[iRank].size();
+    if (iRank > 0) sendDispls[iRank] = sendDispls[iRank - 1] + sendCounts[iRank - 1];
+    send.insert(send.end(), sendBuffers[iRank].begin(), sendBuffers[iRank].end());
+  }
+  recvCounts.resize(size);
+  MPI_Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+  for (int iRank = 1; iRank < size; ++iRank) recvDispls[iRank] = recvDispls[iRank - 1] + recvCounts[iRank - 1];
+
+  vector<T> recv(recvDispls[size - 1] + recvCounts[size - 1]);
+  MPI_Alltoallv(send.data(), sendCounts.data(), sendDispls.data(), type, recv.data(), recvCounts.data(),
+                recvDispls.data(), type, comm);
+  return recv;
+}
+
+/*--- Row-major view of a per-point field of the solver variables. ---*/
+struct MigratedField {
+  su2double* data;
+  unsigned long nCols;
+  unsigned long cols() const { return nCols; }
+  su2double& operator()(unsigned long iPoint, unsigned long iVar) const { return data[iPoint * nCols + iVar]; }
+};
+
+/*--- Fields that are migrated when rebalancing, the solution, the time levels of dual time stepping when they
+ * are allocated, and the local CFL numbers (which CFL_ADAPT evolves). The order only depends on the kind of
+ * problem, not on the grid. ---*/
+vector<MigratedField> MigratedFields(CSolver** solvers) {
+  vector<MigratedField> fields;
+  for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) {
+    if (solvers[iSol] == nullptr || solvers[iSol]->GetNodes() == nullptr) continue;
+    auto* nodes = solvers[iSol]->GetNodes();
+    for (auto* field : {&nodes->GetSolution(), &nodes->GetSolution_time_n(), &nodes->GetSolution_time_n1()}) {
+      if (field->size() > 0) fields.push_back({field->data(), field->cols()});
+    }
+    if (nodes->GetLocalCFL().size() > 0) fields.push_back({nodes->GetLocalCFL().data(), 1});
+  }
+  return fields;
+}
+}  // namespace
+#endif
+
+void CDriver::StartCostMeasurement() {
+
+  geometry_container[ZONE_0][INST_0][MESH_0]->StartPointCostMeasurement();
+  costMeasurementStart = SU2_MPI::Wtime();
+
+}
+
+void CDriver::Rebalance() {
+
+  const passivedouble measuredTime = SU2_MPI::Wtime() - costMeasurementStart;
+  geometry_container[ZONE_0][INST_0][MESH_0]->StopPointCostMeasurement();
+
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+
+  SU2_PROFILE_REGION("Rebalancing");
+
+  CConfig* config = config_container[ZONE_0];
+  CGeometry**& geometry = geometry_container[ZONE_0][INST_0];
+  CSolver***& solver = solver_container[ZONE_0][INST_0];
+
+  const auto comm = SU2_MPI::GetComm();
+  const auto nPointDomain = geometry[MESH_0]->GetnPointDomain();
+
+  /*--- The cost of each point is its measured point-specific work (CPU time, hence divided by the number of
+   * threads) plus a uniform cost per point and per neighbor, weighted as in the static partitioning. The
+   * uniform cost is calibrated such that the total cost of the slowest rank is the measured wall time, the
+   * other ranks were waiting for the remaining time. ---*/
+
+  const auto& measuredCost = geometry[MESH_0]->GetPointCost();
+  const passivedouble wp = config->GetParMETIS_PointWeight();
+  const passivedouble we = config->GetParMETIS_EdgeWeight();
+  const passivedouble nThreads = omp_get_max_threads();
+
+  vector<passivedouble> cost(nPointDomain);
+  passivedouble staticSum = 0.0, measuredSum = 0.0;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    cost[iPoint] = wp + we * geometry[MESH_0]->nodes->GetnPoint(iPoint);
+    staticSum += cost[iPoint];
+    measuredSum += measuredCost[iPoint] / nThreads;
+  }
+
+  passivedouble uniformCost = 0.0;
+  const passivedouble rankUniformCost =
+      (staticSum > 0.0) ? (measuredTime - measuredSum) / staticSum : numeric_limits<passivedouble>::max();
+  MPI_Allreduce(&rankUniformCost, &uniformCost, 1, MPI_DOUBLE, MPI_MIN, comm);
+  uniformCost = max(uniformCost, 0.0);
+
+  passivedouble rankCost = 0.0;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    cost[iPoint] = uniformCost * cost[iPoint] + measuredCost[iPoint] / nThreads;
+    rankCost += cost[iPoint];
+  }
+
+  passivedouble maxCost = 0.0, totalCost = 0.0, totalMeasured = 0.0;
+  MPI_Allreduce(&rankCost, &maxCost, 1, MPI_DOUBLE, MPI_MAX, comm);
+  MPI_Allreduce(&rankCost, &totalCost, 1, MPI_DOUBLE, MPI_SUM, comm);
+  MPI_Allreduce(&measuredSum, &totalMeasured, 1, MPI_DOUBLE, MPI_SUM, comm);
+  const passivedouble imbalance = (totalCost > 0.0) ? maxCost * size / totalCost : 1.0;
+
+  if (rank == MASTER_NODE) {
+    cout << "\n------------------------- Dynamic Load Balancing ------------------------" << endl;
+    cout << "Point-specific work: " << setprecision(3) << 100 * totalMeasured / (size * measuredTime)
+         << "% of the time. Predicted load imbalance (max/avg): " << imbalance << "." << endl;
+  }
+  if (imbalance <= 1.0 + config->GetRebalance_Tolerance()) {
+    if (rank == MASTER_NODE) cout << "The imbalance is within REBALANCE_TOLERANCE, the grid is not repartitioned." << endl;
+    return;
+  }
+
+  /*--- Send the cost and the solution of each point to the rank that owns its global index in the linear
+   * partitioning, i.e. how the grid is distributed when it is read again, this is then used as a directory
+   * from which the new owner of each point fetches its solution. ---*/
+
+  const CLinearPartitioner partitioner(geometry[MESH_0]->GetGlobal_nPointDomain(), 0);
+  const auto firstIndex = partitioner.GetFirstIndexOnRank(rank);
+  const auto nPointLinear = partitioner.GetSizeOnRank(rank);
+
+  auto fields = MigratedFields(solver[MESH_0]);
+  unsigned long nValues = 1;
+  for (const auto& field : fields) nValues += field.cols();
+
+  vector<passivedouble> directory(nPointLinear * nValues, 0.0);
+  {
+    vector<vector<unsigned long> > sendIndices(size);
+    vector<vector<passivedouble> > sendValues(size);
+
+    for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+      const auto globalIndex = geometry[MESH_0]->nodes->GetGlobalIndex(iPoint);
+      const auto iRank = partitioner.GetRankContainingIndex(globalIndex);
+      sendIndices[iRank].push_back(globalIndex);
+      sendValues[iRank].push_back(cost[iPoint]);
+      for (const auto& field : fields) {
+        for (auto iVar = 0ul; iVar < field.cols(); ++iVar)
+          sendValues[iRank].push_back(SU2_TYPE::GetValue(field(iPoint, iVar)));
+      }
+    }
+    vector<int> recvCounts;
+    const auto recvIndices = ExchangeBuffers(sendIndices, MPI_UNSIGNED_LONG, recvCounts);
+    const auto recvValues = ExchangeBuffers(sendValues, MPI_DOUBLE, recvCounts);
+
+    for (auto i = 0ul; i < recvIndices.size(); ++i) {
+      const auto offset = recvIndices[i] - firstIndex;
+      copy_n(&recvValues[i * nValues], nValues, &directory[offset * nValues]);
+    }
+  }
+
+  rebalanceWeights.resize(nPointLinear);
+  for (auto i = 0ul; i < nPointLinear; ++i) rebalanceWeights[i] = directory[i * nValues];
+
+  /*--- Rebuild the zone, the grid is read again and partitioned with the measured costs. ---*/
+
+  if (rank == MASTER_NODE) cout << "Repartitioning the grid with the measured cost of the points." << endl;
+
+  output_container[ZONE_0]->DeallocateDataSorters();
+
+  /*--- The CFL adaptation continues where it stopped. ---*/
+  const auto cflAdaptState = solver[MESH_0][FLOW_SOL]->GetCFLAdaptState();
+
+  FinalizeNumerics(numerics_container[ZONE_0], solver, geometry, config, INST_0);
+  FinalizeIntegration(integration_container[ZONE_0], geometry, config, INST_0);
+  FinalizeSolver(solver_container[ZONE_0], geometry, config, INST_0);
+  for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) delete geometry[iMesh];
+  delete [] geometry;
+
+  InitializeGeometry(config, geometry, false);
+
+  CGeometry::ComputeWallDistance(config_container, geometry_container);
+
+  /*--- The solution is migrated below, the solvers must not read the restart files again. ---*/
+  const bool restart = config->GetRestart();
+  config->SetRestart(false);
+  InitializeSolver(config, geometry, solver);
+  config->SetRestart(restart);
+
+  InitializeNumerics(config, geometry, solver, numerics_container[ZONE_0][INST_0]);
+  InitializeIntegration(config, solver[MESH_0], integration_container[ZONE_0][INST_0]);
+  PreprocessStaticMesh(config, geometry);
+
+  /*--- Fetch the solution of the points of this rank from the directory, the replies of each rank follow
+   * the order of the requests (i.e. of the local points). ---*/
+
+  const auto nNewPointDomain = geometry[MESH_0]->GetnPointDomain();
+
+  fields = MigratedFields(solver[MESH_0]);
+  unsigned long nNewValues = 1;
+  for (const auto& field : fields) nNewValues += field.cols();
+  if (nNewValues != nValues) SU2_MPI::Error("The solver variables changed while rebalancing.", CURRENT_FUNCTION);
+
+  vector<vector<unsigned long> > requests(size);
+  for (auto iPoint = 0ul; iPoint < nNewPointDomain; ++iPoint) {
+    const auto globalIndex = geometry[MESH_0]->nodes->GetGlobalIndex(iPoint);
+    requests[partitioner.GetRankContainingIndex(globalIndex)].push_back(globalIndex);
+  }
+  vector<int> requestCounts;
+  const auto requested = ExchangeBuffers(requests, MPI_UNSIGNED_LONG, requestCounts);
+
+  vector<vector<passivedouble> > replies(size);
+  unsigned long iRequest = 0;
+  for (int iRank = 0; iRank < size; ++iRank) {
+    for (int i = 0; i < requestCounts[iRank]; ++i, ++iRequest) {
+      const auto offset = requested[iRequest] - firstIndex;
+      const auto first = directory.begin() + offset * nValues;
+      replies[iRank].insert(replies[iRank].end(), first + 1, first + nValues);
+    }
+  }
+  decltype(directory)().swap(directory);
+
+  vector<int> replyCounts;
+  const auto values = ExchangeBuffers(replies, MPI_DOUBLE, replyCounts);
+
+  vector<unsigned long> position(size, 0);
+  for (int iRank = 1; iRank < size; ++iRank) position[iRank] = position[iRank - 1] + replyCounts[iRank - 1];
+
+  for (auto iPoint = 0ul; iPoint < nNewPointDomain; ++iPoint) {
+    auto& pos = position[partitioner.GetRankContainingIndex(geometry[MESH_0]->nodes->GetGlobalIndex(iPoint))];
+    for (const auto& field : fields) {
+      for (auto iVar = 0ul; iVar < field.cols(); ++iVar) field(iPoint, iVar) = values[pos++];
+    }
+  }
+  solver[MESH_0][FLOW_SOL]->SetCFLAdaptState(cflAdaptState);
+
+  /*--- Communicate the solution, restrict it to the coarse grids, and update the variables that depend on it
+   * (as after loading a restart). ---*/
+
+  for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+    for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) {
+      auto* sol = solver[iMesh][iSol];
+      if (sol == nullptr || sol->GetNodes() == nullptr) continue;
+
+      if (iMesh > MESH_0) {
+        auto* fineNodes = solver[iMesh - 1][iSol]->GetNodes();
+        auto* coarseNodes = sol->GetNodes();
+        CSolver::MultigridRestriction(*geometry[iMesh - 1], fineNodes->GetSolution(), *geometry[iMesh],
+                                      coarseNodes->GetSolution());
+        if (coarseNodes->GetSolution_time_n().size() > 0)
+          CSolver::MultigridRestriction(*geometry[iMesh - 1], fineNodes->GetSolution_time_n(), *geometry[iMesh],
+                                        coarseNodes->GetSolution_time_n());
+        if (coarseNodes->GetSolution_time_n1().size() > 0)
+          CSolver::MultigridRestriction(*geometry[iMesh - 1], fineNodes->GetSolution_time_n1(), *geometry[iMesh],
+                                        coarseNodes->GetSolution_time_n1());
+
+        /*--- The CFL of the coarse grids keeps its ratio to the fine grid CFL (see AdaptCFLNumber). ---*/
+        const su2double cflRatio = config->GetCFL(iMesh) / config->GetCFL(iMesh - 1);
+        for (auto iPoint = 0ul; iPoint < geometry[iMesh]->GetnPointDomain(); ++iPoint) {
+          su2double cfl = 0.0;
+          for (auto iChild = 0ul; iChild < geometry[iMesh]->nodes->GetnChildren_CV(iPoint); ++iChild) {
+            const auto iPointFine = geometry[iMesh]->nodes->GetChildren_CV(iPoint, iChild);
+            cfl += geometry[iMesh - 1]->nodes->GetVolume(iPointFine) * fineNodes->GetLocalCFL(iPointFine);
+          }
+          coarseNodes->SetLocalCFL(iPoint, cflRatio * cfl / geometry[iMesh]->nodes->GetVolume(iPoint));
+        }
+      }
+      sol->InitiateComms(geometry[iMesh], config, SOLUTION);
+      sol->CompleteComms(geometry[iMesh], config, SOLUTION);
+    }
+  }
+
+  SU2_OMP_PARALLEL_(if(solver[MESH_0][FLOW_SOL]->GetHasHybridParallel()))
+  for (unsigned short iMG = 0; iMG <= config->GetnMGLevels(); iMG++) {
+    solver[iMG][FLOW_SOL]->Preprocessing(geometry[iMG], solver[iMG], config, iMG, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    if (solver[iMG][TURB_SOL] != nullptr)
+      solver[iMG][TURB_SOL]->Postprocessing(geometry[iMG], solver[iMG], config, iMG);
+  }
+  END_SU2_OMP_PARALLEL
+
+  /*--- Update the grid sizes used for performance monitoring (the number of halo points changes). ---*/
+
+  Mpoints = geometry[MESH_0]->GetGlobal_nPoint() / 1.0e6;
+  MpointsDomain = geometry[MESH_0]->GetGlobal_nPointDomain() / 1.0e6;
+  MDOFs = DOFsPerPoint * Mpoints;
+  MDOFsDomain = DOFsPerPoint * MpointsDomain;
+
+  if (rank == MASTER_NODE) cout << "The grid was repartitioned and the solution migrated." << endl;
+
+#else
+  if (rank == MASTER_NODE) cout << "WARNING: Rebalancing requires ParMETIS, the grid is not repartitioned." << endl;
+  (void)measuredTime;
+#endif
+}
+
 void CDriver::PreprocessInput(CConfig **&config, CConfig *&driver_config) {
 
   char zone_file_name[MAX_STRING_SIZE];
@@ -597,6 +963,8 @@ void CDriver::PreprocessInput(CConfig **&config, CConfig *&driver_config) {
 
 void CDriver::InitializeGeometry(CConfig* config, CGeometry **&geometry, bool dummy){
 
+  SU2_PROFILE_REGION("Geometry_Preprocessing");
+
   if (!dummy){
     if (rank == MASTER_NODE)
       cout << endl <<"------------------- Geometry Preprocessing ( Zone " << config->GetiZone() <<" ) -------------------" << endl;
@@ -702,31 +1070,57 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
   unsigned short requestedMGlevels = config->GetnMGLevels();
   const bool fea = config->GetStructuralProblem();
 
-  /*--- Definition of the geometry class to store the primal grid in the partitioning process.
-   *    All ranks process the grid and call ParMETIS for partitioning ---*/
+  /*--- Allocate the memory of the current domain, and divide the grid
+     between the ranks. ---*/
 
-  CGeometry *geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+  geometry = new CGeometry *[config->GetnMGLevels()+1] ();
 
-  /*--- Set the dimension --- */
+  /*--- Reuse the partitioned grid of a previous run if possible (not when rebalancing). ---*/
 
-  nDim = geometry_aux->GetnDim();
+  string cacheFileName;
+  if (config->GetPartition_Cache() && rebalanceWeights.empty()) cacheFileName = CPhysicalGeometry::GetPartitionCacheFileName(config);
 
-  /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+  if (CPhysicalGeometry::CheckPartitionCache(cacheFileName)) {
 
-  geometry_aux->SetColorGrid_Parallel(config);
+    geometry[MESH_0] = new CPhysicalGeometry(config, cacheFileName);
 
-  /*--- Allocate the memory of the current domain, and divide the grid
-     between the ranks. ---*/
+    nDim = geometry[MESH_0]->GetnDim();
 
-  geometry = new CGeometry *[config->GetnMGLevels()+1] ();
+  } else {
 
-  /*--- Build the grid data structures using the ParMETIS coloring. ---*/
+    /*--- Definition of the geometry class to store the primal grid in the partitioning process.
+     *    All ranks process the grid and call ParMETIS for partitioning ---*/
 
-  geometry[MESH_0] = new CPhysicalGeometry(geometry_aux, config);
+    CGeometry *geometry_aux = nullptr;
+    {
+      SU2_PROFILE_REGION("Mesh_Reading");
+      geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
+    }
 
-  /*--- Deallocate the memory of geometry_aux and solver_aux ---*/
+    /*--- Set the dimension --- */
 
-  delete geometry_aux;
+    nDim = geometry_aux->GetnDim();
+
+    /*--- Color the initial grid and set the send-receive domains (ParMETIS) ---*/
+
+    {
+      SU2_PROFILE_REGION("Partitioning");
+
+      /*--- When rebalancing, use the measured cost of the points as the partitioning weights. ---*/
+      if (!rebalanceWeights.empty()) geometry_aux->SetPartitionWeights(std::move(rebalanceWeights));
+      rebalanceWeights.clear();
+
+      geometry_aux->SetColorGrid_Parallel(config);
+
+      /*--- Build the grid data structures using the ParMETIS coloring. ---*/
+
+      geometry[MESH_0] = new CPhysicalGeometry(geometry_aux, config);
+    }
+
+    /*--- Deallocate the memory of geometry_aux and solver_aux ---*/
+
+    delete geometry_aux;
+  }
 
   /*--- Add the Send/Receive boundaries ---*/
   geometry[MESH_0]->SetSendReceive(config);
@@ -739,10 +1133,14 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
   if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
   geometry[MESH_0]->SetPoint_Connectivity();
 
-  /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+  /*--- Renumbering points for memory locality (Reverse Cuthill McKee or space-filling curve ordering) ---*/
 
-  if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
-  geometry[MESH_0]->SetRCM_Ordering(config);
+  if (rank == MASTER_NODE && config->GetKind_PointOrdering() != POINT_ORDERING::NONE) {
+    cout << "Renumbering points ("
+         << (config->GetKind_PointOrdering() == POINT_ORDERING::RCM ? "Reverse Cuthill McKee" : "Space-Filling Curve")
+         << " Ordering)." << endl;
+  }
+  geometry[MESH_0]->SetPoint_Ordering(config);
 
   /*--- recompute elements surrounding points, points surrounding points ---*/
 
@@ -767,8 +1165,19 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   if (rank == MASTER_NODE) cout << "Identifying edges and vertices." << endl;
   geometry[MESH_0]->SetEdges();
+  geometry[MESH_0]->SetEdge_Ordering(config->GetKind_EdgeOrdering());
   geometry[MESH_0]->SetVertex(config);
 
+  /*--- Report the locality of the ordering, the edge loops and the sparse matrix products are memory bound. ---*/
+
+  unsigned long bandwidth = 0;
+  passivedouble edgeGap = 0.0;
+  geometry[MESH_0]->GetOrdering_Metrics(bandwidth, edgeGap);
+  if (rank == MASTER_NODE) {
+    cout << "Bandwidth of the sparse pattern: " << bandwidth << ", average index gap between consecutive edges: "
+         << edgeGap << "." << endl;
+  }
+
   /*--- Create the control volume structures ---*/
 
   if (rank == MASTER_NODE) cout << "Setting the control volume structure." << endl;
@@ -837,6 +1246,7 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
     /*--- Create the edge structure ---*/
 
     geometry[iMGlevel]->SetEdges();
+    geometry[iMGlevel]->SetEdge_Ordering(config->GetKind_EdgeOrdering());
     geometry[iMGlevel]->SetVertex(geometry[iMGlevel-1], config);
 
     /*--- Create the control volume structures ---*/
@@ -1010,6 +1420,8 @@ void CDriver::InitializeGeometryDGFEM(CConfig* config, CGeometry **&geometry) {
 
 void CDriver::InitializeSolver(CConfig* config, CGeometry** geometry, CSolver ***&solver) {
 
+  SU2_PROFILE_REGION("Solver_Preprocessing");
+
   MAIN_SOLVER kindSolver = config->GetKind_Solver();
 
   if (rank == MASTER_NODE)
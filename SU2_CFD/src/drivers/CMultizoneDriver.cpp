@@ -445,7 +445,9 @@ bool CMultizoneDriver::OuterConvergence(unsigned long OuterIter) {
   driver_output->SetMultizoneHistoryOutput(output_container, config_container, driver_config,
                                             driver_config->GetTimeIter(), driver_config->GetOuterIter());
 
-  return driver_output->GetConvergence();
+  /*--- In benchmark mode all iterations are run regardless of convergence. ---*/
+
+  return driver_output->GetConvergence() && driver_config->GetBenchmark_Iter() == 0;
 
 }
 
@@ -652,7 +654,7 @@ bool CMultizoneDriver::Monitor(unsigned long TimeIter) {
     const auto OuterIter  = driver_config->GetOuterIter();
     const auto nOuterIter = driver_config->GetnOuter_Iter();
 
-    const auto InnerConvergence = driver_output->GetConvergence();
+    const auto InnerConvergence = driver_output->GetConvergence() && driver_config->GetBenchmark_Iter() == 0;
     const bool MaxIterationsReached = (OuterIter+1 >= nOuterIter);
 
     if ((MaxIterationsReached || InnerConvergence) && (rank == MASTER_NODE)) {
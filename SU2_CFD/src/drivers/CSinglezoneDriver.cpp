@@ -65,6 +65,18 @@ void CSinglezoneDriver::StartSolver() {
   if (config_container[ZONE_0]->GetRestart() && driver_config->GetTime_Domain())
     TimeIter = config_container[ZONE_0]->GetRestart_Iter();
 
+  /*--- Measure the cost of the first iterations (inner iterations for steady problems, time steps
+   * otherwise) and then repartition the grid if the load is imbalanced. Nothing is done if the
+   * measurement window reaches the end of the run. ---*/
+
+  const unsigned long rebalanceIter = config_container[ZONE_0]->GetRebalance_Iter();
+  const unsigned long rebalanceTimeIter = TimeIter + rebalanceIter;
+  const bool rebalanceSteady = !driver_config->GetTime_Domain() && rebalanceIter > 0 &&
+                               rebalanceIter < config_container[ZONE_0]->GetnInner_Iter();
+  const bool rebalanceUnsteady = driver_config->GetTime_Domain() && rebalanceIter > 0 &&
+                                 rebalanceTimeIter < config_container[ZONE_0]->GetnTime_Iter();
+  if (rebalanceSteady || rebalanceUnsteady) StartCostMeasurement();
+
   /*--- Run the problem until the number of time iterations required is reached. ---*/
   while ( TimeIter < config_container[ZONE_0]->GetnTime_Iter() ) {
 
@@ -74,7 +86,22 @@ void CSinglezoneDriver::StartSolver() {
 
     /*--- Run a time-step iteration of the single-zone problem. ---*/
 
-    Run();
+    if (rebalanceSteady) {
+      /*--- Split the inner iterations around the rebalancing, the solution is migrated
+       * with the grid hence the second part continues from where the first stopped. ---*/
+      auto* iteration = iteration_container[ZONE_0][INST_0];
+      iteration->SetInnerIterRange(0, rebalanceIter);
+      Run();
+      if (!output_container[ZONE_0]->GetConvergence()) {
+        Rebalance();
+        iteration->SetInnerIterRange(rebalanceIter, numeric_limits<unsigned long>::max());
+        Run();
+      }
+      iteration->SetInnerIterRange(0, numeric_limits<unsigned long>::max());
+    }
+    else {
+      Run();
+    }
 
     /*--- Perform some postprocessing on the solution before the update ---*/
 
@@ -96,6 +123,8 @@ void CSinglezoneDriver::StartSolver() {
 
     if (StopCalc) break;
 
+    if (rebalanceUnsteady && TimeIter + 1 == rebalanceTimeIter) Rebalance();
+
     TimeIter++;
 
   }
@@ -262,12 +291,16 @@ bool CSinglezoneDriver::Monitor(unsigned long TimeIter){
 
   TimeDomain = config_container[ZONE_0]->GetTime_Domain();
 
+  /*--- In benchmark mode all iterations are run regardless of convergence. ---*/
+
+  const bool Benchmark = config_container[ZONE_0]->GetBenchmark_Iter() > 0;
+
 
   /*--- Check whether the inner solver has converged --- */
 
   if (TimeDomain == NO){
 
-    InnerConvergence = output_container[ZONE_0]->GetConvergence();
+    InnerConvergence = output_container[ZONE_0]->GetConvergence() && !Benchmark;
     MaxIterationsReached = InnerIter+1 >= nInnerIter;
 
     if ((MaxIterationsReached || InnerConvergence) && (rank == MASTER_NODE)) {
@@ -285,7 +318,7 @@ bool CSinglezoneDriver::Monitor(unsigned long TimeIter){
 
     /*--- Check whether the outer time integration has reached the final time ---*/
 
-    TimeConvergence = GetTimeConvergence();
+    TimeConvergence = GetTimeConvergence() && !Benchmark;
 
     FinalTimeReached = CurTime >= MaxTime;
     MaxIterationsReached = TimeIter+1 >= nTimeIter;
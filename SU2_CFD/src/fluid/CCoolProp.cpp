@@ -31,17 +31,357 @@
 #include "AbstractState.h"
 #include "CoolProp.h"
 
-CCoolProp::CCoolProp(const string &fluidname) : CFluidModel() {
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <map>
+
+namespace {
+
+/*--- Tables are shared by the fluid model objects of all threads and zones, keyed by cache file name. ---*/
+std::map<string, std::shared_ptr<const CCoolPropTable>> table_cache;
+
+constexpr char TABLE_MAGIC[8] = {'S', 'U', '2', 'C', 'P', 'T', 'B', '1'};
+
+/*--- Newton solvers on the table. ---*/
+constexpr unsigned short TABLE_NEWTON_ITER = 50;
+constexpr passivedouble TABLE_NEWTON_TOL = 1e-10;
+
+bool SameLayout(const CCoolPropTable& a, const CCoolPropTable& b) {
+  return a.fluid == b.fluid && a.n_rho == b.n_rho && a.n_e == b.n_e && a.rho_min == b.rho_min &&
+         a.rho_max == b.rho_max && a.e_min == b.e_min && a.e_max == b.e_max;
+}
+
+template <class T>
+void ReadValue(std::ifstream& file, T& value) {
+  file.read(reinterpret_cast<char*>(&value), sizeof(T));
+}
+
+template <class T>
+void WriteValue(std::ofstream& file, const T& value) {
+  file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/*!
+ * \brief Read the data of a table from file, if the file was written for the same layout.
+ */
+bool ReadTable(const string& file_name, CCoolPropTable& table) {
+  std::ifstream file(file_name, std::ios::binary);
+  if (!file) return false;
+
+  char magic[sizeof(TABLE_MAGIC)] = {};
+  file.read(magic, sizeof(magic));
+  unsigned long name_size = 0;
+  ReadValue(file, name_size);
+  if (!file || memcmp(magic, TABLE_MAGIC, sizeof(magic)) != 0 || name_size > 1024) return false;
+
+  CCoolPropTable stored;
+  stored.fluid.resize(name_size);
+  file.read(&stored.fluid[0], name_size);
+  ReadValue(file, stored.n_rho);
+  ReadValue(file, stored.n_e);
+  ReadValue(file, stored.rho_min);
+  ReadValue(file, stored.rho_max);
+  ReadValue(file, stored.e_min);
+  ReadValue(file, stored.e_max);
+  if (!file || !SameLayout(stored, table)) return false;
+
+  table.data.resize(table.n_rho * table.n_e * CCoolPropTable::N_DATA);
+  file.read(reinterpret_cast<char*>(table.data.data()), table.data.size() * sizeof(passivedouble));
+  return static_cast<bool>(file);
+}
+
+/*!
+ * \brief Write a table to file, via a temporary file such that other processes never read a partial table.
+ */
+void WriteTable(const string& file_name, const CCoolPropTable& table) {
+  const string tmp_name = file_name + ".tmp";
+  {
+    std::ofstream file(tmp_name, std::ios::binary);
+    if (!file) return;
+    file.write(TABLE_MAGIC, sizeof(TABLE_MAGIC));
+    WriteValue(file, static_cast<unsigned long>(table.fluid.size()));
+    file.write(table.fluid.data(), table.fluid.size());
+    WriteValue(file, table.n_rho);
+    WriteValue(file, table.n_e);
+    WriteValue(file, table.rho_min);
+    WriteValue(file, table.rho_max);
+    WriteValue(file, table.e_min);
+    WriteValue(file, table.e_max);
+    file.write(reinterpret_cast<const char*>(table.data.data()), table.data.size() * sizeof(passivedouble));
+    if (!file) return;
+  }
+  std::rename(tmp_name.c_str(), file_name.c_str());
+}
+
+/*!
+ * \brief Bicubic Hermite interpolation of a variable (value, x, e, and cross derivatives stored consecutively from
+ * iVar) in a cell, and of its derivatives w.r.t. x and e.
+ * \param[in] corner - Node data of the cell corners, [x][e].
+ * \param[in] u, v - Local coordinates in the cell, in [0, 1].
+ */
+void InterpolateHermite(const passivedouble* const corner[2][2], unsigned short iVar, su2double u, su2double v,
+                        su2double hx, su2double he, su2double& f, su2double& dfdx, su2double& dfde) {
+  /*--- Basis of the end values (A) and slopes (B) of the interval, and their derivatives. ---*/
+  const su2double Au[] = {(1 + 2 * u) * (1 - u) * (1 - u), u * u * (3 - 2 * u)};
+  const su2double Bu[] = {u * (1 - u) * (1 - u), u * u * (u - 1)};
+  const su2double dAu[] = {6 * u * u - 6 * u, 6 * u - 6 * u * u};
+  const su2double dBu[] = {3 * u * u - 4 * u + 1, 3 * u * u - 2 * u};
+  const su2double Av[] = {(1 + 2 * v) * (1 - v) * (1 - v), v * v * (3 - 2 * v)};
+  const su2double Bv[] = {v * (1 - v) * (1 - v), v * v * (v - 1)};
+  const su2double dAv[] = {6 * v * v - 6 * v, 6 * v - 6 * v * v};
+  const su2double dBv[] = {3 * v * v - 4 * v + 1, 3 * v * v - 2 * v};
+
+  f = dfdx = dfde = 0.0;
+  for (int a = 0; a < 2; a++) {
+    for (int b = 0; b < 2; b++) {
+      const passivedouble* node = corner[a][b] + iVar;
+      const su2double f0 = node[0], fx = hx * node[1], fe = he * node[2], fxe = hx * he * node[3];
+      f += f0 * Au[a] * Av[b] + fx * Bu[a] * Av[b] + fe * Au[a] * Bv[b] + fxe * Bu[a] * Bv[b];
+      dfdx += f0 * dAu[a] * Av[b] + fx * dBu[a] * Av[b] + fe * dAu[a] * Bv[b] + fxe * dBu[a] * Bv[b];
+      dfde += f0 * Au[a] * dAv[b] + fx * Bu[a] * dAv[b] + fe * Au[a] * dBv[b] + fxe * Bu[a] * dBv[b];
+    }
+  }
+  dfdx /= hx;
+  dfde /= he;
+}
+
+}  // namespace
+
+CCoolProp::CCoolProp(const string& fluidname, const CConfig* config) : CFluidModel() {
   fluid_entity = std::unique_ptr<CoolProp::AbstractState>(CoolProp::AbstractState::factory("HEOS", fluidname));
   Gas_Constant = fluid_entity->gas_constant() / fluid_entity->molar_mass();
   Pressure_Critical = fluid_entity->p_critical();
   Temperature_Critical = fluid_entity->T_critical();
   acentric_factor = fluid_entity->acentric_factor();
+
+  if (config == nullptr || !config->GetCoolProp_Tabulation()) return;
+
+  CCoolPropTable layout;
+  layout.fluid = fluidname;
+  layout.n_rho = config->GetCoolProp_Table_Size()[0];
+  layout.n_e = config->GetCoolProp_Table_Size()[1];
+  layout.rho_min = SU2_TYPE::GetValue(config->GetCoolProp_Table_Density()[0]);
+  layout.rho_max = SU2_TYPE::GetValue(config->GetCoolProp_Table_Density()[1]);
+  layout.e_min = SU2_TYPE::GetValue(config->GetCoolProp_Table_Energy()[0]);
+  layout.e_max = SU2_TYPE::GetValue(config->GetCoolProp_Table_Energy()[1]);
+  layout.log_rho_min = log(layout.rho_min);
+  layout.dx = (log(layout.rho_max) - layout.log_rho_min) / (layout.n_rho - 1);
+  layout.de = (layout.e_max - layout.e_min) / (layout.n_e - 1);
+
+  /*--- The fluid models of all threads are constructed concurrently, the first one builds the table. Building is
+   *    collective over the ranks, this first model is the auxiliary one of the solver, created outside parallel
+   *    regions, the models of the threads then find the table in the cache. ---*/
+  SU2_OMP_CRITICAL
+  {
+    auto& cached = table_cache[config->GetCoolProp_Table_FileName()];
+    if (!cached || !SameLayout(*cached, layout)) {
+      cached = BuildTable(layout, config->GetCoolProp_Table_FileName());
+    }
+    table = cached;
+  }
+  END_SU2_OMP_CRITICAL
 }
 
 CCoolProp::~CCoolProp() {}
 
+std::shared_ptr<const CCoolPropTable> CCoolProp::BuildTable(CCoolPropTable layout, const string& file_name) {
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  const bool master = (rank == MASTER_NODE);
+  auto table = std::make_shared<CCoolPropTable>(std::move(layout));
+
+  const auto n_rho = table->n_rho, n_e = table->n_e;
+  table->data.resize(n_rho * n_e * CCoolPropTable::N_DATA);
+
+  /*--- The data is passive, it is communicated as bytes, one density row at a time to keep the counts small. ---*/
+  const int row_bytes = n_e * CCoolPropTable::N_DATA * sizeof(passivedouble);
+
+  /*--- The master reads the cache file and broadcasts the table, such that all ranks take the same path. ---*/
+  int read = master && ReadTable(file_name, *table);
+  SU2_MPI::Bcast(&read, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+  if (read) {
+    for (auto iRho = 0ul; iRho < n_rho; iRho++) {
+      SU2_MPI::Bcast(table->Node(iRho, 0), row_bytes, MPI_CHAR, MASTER_NODE, SU2_MPI::GetComm());
+    }
+    if (master) cout << "Read CoolProp table of " << table->fluid << " from " << file_name << "." << endl;
+    return table;
+  }
+  if (master) {
+    cout << "Building CoolProp table of " << table->fluid << " (" << table->n_rho << " x " << table->n_e
+         << " nodes)." << endl;
+  }
+
+  /*--- Each rank evaluates a contiguous block of density rows, the blocks are then gathered on all ranks. ---*/
+  vector<int> counts(size), displs(size);
+  for (int iRank = 0; iRank < size; iRank++) {
+    const auto begin = n_rho * iRank / size, end = n_rho * (iRank + 1) / size;
+    counts[iRank] = (end - begin) * row_bytes;
+    displs[iRank] = begin * row_bytes;
+  }
+  const auto rho_begin = n_rho * rank / size, rho_end = n_rho * (rank + 1) / size;
+
+  for (auto iRho = rho_begin; iRho < rho_end; iRho++) {
+    const su2double rho = exp(table->log_rho_min + iRho * table->dx);
+    for (auto iE = 0ul; iE < n_e; iE++) {
+      const su2double e = table->e_min + iE * table->de;
+      auto* node = table->Node(iRho, iE);
+      try {
+        SetTDState_rhoe_CoolProp(rho, e);
+        node[CCoolPropTable::I_P] = Pressure;
+        node[CCoolPropTable::I_DPDX] = rho * dPdrho_e;
+        node[CCoolPropTable::I_DPDE] = dPde_rho;
+        node[CCoolPropTable::I_T] = Temperature;
+        node[CCoolPropTable::I_DTDX] = rho * dTdrho_e;
+        node[CCoolPropTable::I_DTDE] = dTde_rho;
+        node[CCoolPropTable::I_C2] = SoundSpeed2;
+        node[CCoolPropTable::I_S] = Entropy;
+        node[CCoolPropTable::I_CP] = Cp;
+      } catch (const std::exception&) {
+        /*--- Outside the validity range of the equation of state, CoolProp is called (and fails) at runtime. ---*/
+        node[CCoolPropTable::I_P] = std::numeric_limits<passivedouble>::quiet_NaN();
+      }
+    }
+  }
+
+  const auto* local_begin = reinterpret_cast<const char*>(table->data.data()) + displs[rank];
+  const vector<char> local_rows(local_begin, local_begin + counts[rank]);
+  SU2_MPI::Allgatherv(local_rows.data(), counts[rank], MPI_CHAR, table->data.data(), counts.data(), displs.data(),
+                      MPI_CHAR, SU2_MPI::GetComm());
+
+  /*--- Cross derivatives from differences of the energy derivatives (one-sided at the boundaries). ---*/
+  for (auto iRho = 0ul; iRho < n_rho; iRho++) {
+    const auto iRho0 = (iRho > 0) ? iRho - 1 : 0ul;
+    const auto iRho1 = min(iRho + 1, n_rho - 1);
+    const auto dx = (iRho1 - iRho0) * table->dx;
+    for (auto iE = 0ul; iE < n_e; iE++) {
+      const auto* node0 = table->Node(iRho0, iE);
+      const auto* node1 = table->Node(iRho1, iE);
+      auto* node = table->Node(iRho, iE);
+      node[CCoolPropTable::I_D2PDXDE] = (node1[CCoolPropTable::I_DPDE] - node0[CCoolPropTable::I_DPDE]) / dx;
+      node[CCoolPropTable::I_D2TDXDE] = (node1[CCoolPropTable::I_DTDE] - node0[CCoolPropTable::I_DTDE]) / dx;
+      if (!std::isfinite(node0[CCoolPropTable::I_P]) || !std::isfinite(node1[CCoolPropTable::I_P])) {
+        node[CCoolPropTable::I_D2PDXDE] = node[CCoolPropTable::I_D2TDXDE] = 0.0;
+      }
+    }
+  }
+
+  /*--- Invalidate the nodes with any non-finite data, the cells that contain them fall back to CoolProp. ---*/
+  unsigned long n_invalid = 0;
+  for (auto iNode = 0ul; iNode < n_rho * n_e; iNode++) {
+    auto* node = &table->data[iNode * CCoolPropTable::N_DATA];
+    bool valid = true;
+    for (auto iVar = 0u; iVar < CCoolPropTable::N_DATA; iVar++) valid &= std::isfinite(node[iVar]);
+    if (!valid) {
+      node[CCoolPropTable::I_P] = std::numeric_limits<passivedouble>::quiet_NaN();
+      n_invalid++;
+    }
+  }
+  if (master && n_invalid > 0) {
+    cout << "CoolProp failed at " << n_invalid << " table nodes, CoolProp is called directly around them." << endl;
+  }
+
+  if (master) WriteTable(file_name, *table);
+
+  return table;
+}
+
+bool CCoolProp::SetTDState_rhoe_Table(su2double rho, su2double e) {
+  const auto& tab = *table;
+  if (!(rho >= tab.rho_min && rho <= tab.rho_max && e >= tab.e_min && e <= tab.e_max)) return false;
+
+  /*--- Cell and local coordinates. ---*/
+  const su2double x = (log(rho) - tab.log_rho_min) / tab.dx;
+  const su2double y = (e - tab.e_min) / tab.de;
+  const auto iRho = min(static_cast<unsigned long>(x), tab.n_rho - 2);
+  const auto iE = min(static_cast<unsigned long>(y), tab.n_e - 2);
+  const su2double u = x - iRho, v = y - iE;
+
+  const passivedouble* const corner[2][2] = {{tab.Node(iRho, iE), tab.Node(iRho, iE + 1)},
+                                             {tab.Node(iRho + 1, iE), tab.Node(iRho + 1, iE + 1)}};
+  for (int a = 0; a < 2; a++)
+    for (int b = 0; b < 2; b++)
+      if (!std::isfinite(corner[a][b][CCoolPropTable::I_P])) return false;
+
+  /*--- Pressure and temperature with their (consistent) derivatives, x = log(rho). ---*/
+  su2double dPdx, dTdx;
+  InterpolateHermite(corner, CCoolPropTable::I_P, u, v, tab.dx, tab.de, Pressure, dPdx, dPde_rho);
+  InterpolateHermite(corner, CCoolPropTable::I_T, u, v, tab.dx, tab.de, Temperature, dTdx, dTde_rho);
+  dPdrho_e = dPdx / rho;
+  dTdrho_e = dTdx / rho;
+
+  /*--- Remaining properties are bilinear. ---*/
+  const su2double w[2][2] = {{(1 - u) * (1 - v), (1 - u) * v}, {u * (1 - v), u * v}};
+  SoundSpeed2 = Entropy = Cp = 0.0;
+  for (int a = 0; a < 2; a++) {
+    for (int b = 0; b < 2; b++) {
+      SoundSpeed2 += w[a][b] * corner[a][b][CCoolPropTable::I_C2];
+      Entropy += w[a][b] * corner[a][b][CCoolPropTable::I_S];
+      Cp += w[a][b] * corner[a][b][CCoolPropTable::I_CP];
+    }
+  }
+  Cv = 1.0 / dTde_rho;
+  Gamma = Cp / Cv;
+  Density = rho;
+  StaticEnergy = e;
+  return true;
+}
+
+bool CCoolProp::SetTDState_PT_Table(su2double P, su2double T) {
+  const auto& tab = *table;
+
+  /*--- Start from the current state (usually a neighbor point or the previous iteration) or the table center. ---*/
+  su2double rho = Density, e = StaticEnergy;
+  if (!(rho >= tab.rho_min && rho <= tab.rho_max && e >= tab.e_min && e <= tab.e_max)) {
+    rho = sqrt(tab.rho_min * tab.rho_max);
+    e = 0.5 * (tab.e_min + tab.e_max);
+  }
+
+  for (auto iter = 0u; iter < TABLE_NEWTON_ITER; iter++) {
+    if (!SetTDState_rhoe_Table(rho, e)) return false;
+
+    const su2double res_P = Pressure - P, res_T = Temperature - T;
+    if (fabs(res_P) < TABLE_NEWTON_TOL * fabs(P) && fabs(res_T) < TABLE_NEWTON_TOL * fabs(T)) return true;
+
+    const su2double det = dPdrho_e * dTde_rho - dPde_rho * dTdrho_e;
+    const su2double drho = (dTde_rho * res_P - dPde_rho * res_T) / det;
+    const su2double de = (dPdrho_e * res_T - dTdrho_e * res_P) / det;
+    if (!std::isfinite(drho) || !std::isfinite(de)) return false;
+
+    /*--- Limit the density update to keep it positive, and stay inside the table. ---*/
+    rho -= max(-0.5 * rho, min(0.5 * rho, drho));
+    e -= de;
+    rho = min(su2double(tab.rho_max), max(su2double(tab.rho_min), rho));
+    e = min(su2double(tab.e_max), max(su2double(tab.e_min), e));
+  }
+  return false;
+}
+
+bool CCoolProp::SetTDState_rhoX_Table(su2double rho, su2double target, bool temperature) {
+  const auto& tab = *table;
+
+  su2double e = StaticEnergy;
+  if (!(e >= tab.e_min && e <= tab.e_max)) e = 0.5 * (tab.e_min + tab.e_max);
+
+  for (auto iter = 0u; iter < TABLE_NEWTON_ITER; iter++) {
+    if (!SetTDState_rhoe_Table(rho, e)) return false;
+
+    const su2double res = (temperature ? Temperature : Pressure) - target;
+    if (fabs(res) < TABLE_NEWTON_TOL * fabs(target)) return true;
+
+    const su2double de = res / (temperature ? dTde_rho : dPde_rho);
+    if (!std::isfinite(de)) return false;
+    e = min(su2double(tab.e_max), max(su2double(tab.e_min), e - de));
+  }
+  return false;
+}
+
 void CCoolProp::SetTDState_rhoe(su2double rho, su2double e) {
+  if (table && SetTDState_rhoe_Table(rho, e)) return;
+  SetTDState_rhoe_CoolProp(rho, e);
+}
+
+void CCoolProp::SetTDState_rhoe_CoolProp(su2double rho, su2double e) {
   Density = rho;
   StaticEnergy = e;
   fluid_entity->update(CoolProp::DmassUmass_INPUTS, Density, StaticEnergy);
@@ -70,6 +410,7 @@ void CCoolProp::SetTDState_rhoe(su2double rho, su2double e) {
 void CCoolProp::SetTDState_PT(su2double P, su2double T) {
   CheckPressure(P);
   CheckTemperature(T);
+  if (table && SetTDState_PT_Table(P, T)) return;
   fluid_entity->update(CoolProp::PT_INPUTS, P, T);
   su2double rho = fluid_entity->rhomass();
   su2double e = fluid_entity->umass();
@@ -78,6 +419,7 @@ void CCoolProp::SetTDState_PT(su2double P, su2double T) {
 
 void CCoolProp::SetTDState_Prho(su2double P, su2double rho) {
   CheckPressure(P);
+  if (table && SetTDState_rhoX_Table(rho, P, false)) return;
   fluid_entity->update(CoolProp::DmassP_INPUTS, rho, P);
   su2double e = fluid_entity->umass();
   SetTDState_rhoe(rho, e);
@@ -85,6 +427,7 @@ void CCoolProp::SetTDState_Prho(su2double P, su2double rho) {
 
 void CCoolProp::SetEnergy_Prho(su2double P, su2double rho) {
   CheckPressure(P);
+  if (table && SetTDState_rhoX_Table(rho, P, false)) return;
   fluid_entity->update(CoolProp::DmassP_INPUTS, rho, P);
   StaticEnergy = fluid_entity->umass();
 }
@@ -105,6 +448,7 @@ void CCoolProp::SetTDState_Ps(su2double P, su2double s) {
 }
 
 void CCoolProp::SetTDState_rhoT(su2double rho, su2double T) {
+  if (table && SetTDState_rhoX_Table(rho, T, true)) return;
   fluid_entity->update(CoolProp::DmassT_INPUTS, rho, T);
   su2double e = fluid_entity->umass();
   SetTDState_rhoe(rho, e);
@@ -112,6 +456,8 @@ void CCoolProp::SetTDState_rhoT(su2double rho, su2double T) {
 
 void CCoolProp::ComputeDerivativeNRBC_Prho(su2double P, su2double rho) {
   SetTDState_Prho(P, rho);
+  /*--- The state may come from the table, CoolProp is needed for these derivatives. ---*/
+  if (table) fluid_entity->update(CoolProp::DmassUmass_INPUTS, Density, StaticEnergy);
   dhdrho_P = fluid_entity->first_partial_deriv(CoolProp::iHmass, CoolProp::iDmass, CoolProp::iP);
   dhdP_rho = fluid_entity->first_partial_deriv(CoolProp::iHmass, CoolProp::iP, CoolProp::iDmass);
   dsdP_rho = fluid_entity->first_partial_deriv(CoolProp::iSmass, CoolProp::iP, CoolProp::iDmass);
@@ -119,7 +465,7 @@ void CCoolProp::ComputeDerivativeNRBC_Prho(su2double P, su2double rho) {
 }
 
 #else
-CCoolProp::CCoolProp(const string& fluidname) {
+CCoolProp::CCoolProp(const string& fluidname, const CConfig* config) {
   SU2_MPI::Error(
       "SU2 was not compiled with CoolProp (-Denable-coolprop=true). Note that CoolProp cannot be used with directdiff "
       "or autodiff",
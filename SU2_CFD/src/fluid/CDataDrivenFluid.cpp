@@ -26,10 +26,6 @@
  */
 
 #include "../../include/fluid/CDataDrivenFluid.hpp"
-#if defined(HAVE_MLPCPP)
-#include "../../../subprojects/MLPCpp/include/CLookUp_ANN.hpp"
-#define USE_MLPCPP
-#endif
 
 CDataDrivenFluid::CDataDrivenFluid(const CConfig* config, bool display) : CFluidModel() {
   rank = SU2_MPI::GetRank();
@@ -38,18 +34,27 @@ CDataDrivenFluid::CDataDrivenFluid(const CConfig* config, bool display) : CFluid
   varname_rho = "Density";
   varname_e = "Energy";
 
-  /*--- Set up interpolation algorithm according to data-driven method. Currently only MLP's are supported. ---*/
+  /*--- Set up interpolation algorithm according to data-driven method. ---*/
   switch (Kind_DataDriven_Method) {
     case ENUM_DATADRIVEN_METHOD::MLP:
-#ifdef USE_MLPCPP
-      lookup_mlp = new MLPToolbox::CLookUp_ANN(config->GetNDataDriven_Files(), config->GetDataDriven_FileNames());
-      if ((rank == MASTER_NODE) && display) lookup_mlp->DisplayNetworkInfo();
-#else
-      SU2_MPI::Error("SU2 was not compiled with MLPCpp enabled (-Denable-mlpcpp=true).", CURRENT_FUNCTION);
-#endif
+      for (auto iFile = 0u; iFile < config->GetNDataDriven_Files(); iFile++) {
+        mlp_networks.emplace_back(config->GetDataDriven_FileNames()[iFile]);
+      }
+      if ((rank == MASTER_NODE) && display) {
+        for (const auto& mlp : mlp_networks) {
+          cout << "Multi-layer perceptron with inputs (";
+          for (auto iInput = 0u; iInput < mlp.GetnInputs(); iInput++)
+            cout << (iInput ? ", " : "") << mlp.GetInputName(iInput);
+          cout << ") and outputs (";
+          for (auto iOutput = 0u; iOutput < mlp.GetnOutputs(); iOutput++)
+            cout << (iOutput ? ", " : "") << mlp.GetOutputName(iOutput);
+          cout << ")." << endl;
+        }
+      }
       break;
     case ENUM_DATADRIVEN_METHOD::LUT:
-      lookup_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], varname_rho, varname_e);
+      lookup_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], varname_rho, varname_e,
+                                      config->GetLUT_BinaryCache());
       break;
     default:
       break;
@@ -67,21 +72,8 @@ CDataDrivenFluid::CDataDrivenFluid(const CConfig* config, bool display) : CFluid
   ComputeIdealGasQuantities();
 }
 
-CDataDrivenFluid::~CDataDrivenFluid() {
-  switch (Kind_DataDriven_Method) {
-    case ENUM_DATADRIVEN_METHOD::MLP:
-#ifdef USE_MLPCPP
-      delete iomap_rhoe;
-      delete lookup_mlp;
-#endif
-      break;
-    case ENUM_DATADRIVEN_METHOD::LUT:
-      delete lookup_table;
-      break;
-    default:
-      break;
-  }
-}
+CDataDrivenFluid::~CDataDrivenFluid() { delete lookup_table; }
+
 void CDataDrivenFluid::MapInputs_to_Outputs() {
   /*--- Inputs of the data-driven method are density and internal energy. ---*/
   input_names_rhoe.resize(2);
@@ -92,35 +84,80 @@ void CDataDrivenFluid::MapInputs_to_Outputs() {
 
   /*--- Required outputs for the interpolation method are entropy and its partial derivatives with respect to energy and
    * density. ---*/
-  size_t n_outputs = 6;
-  size_t idx_s = 0, idx_dsde_rho = 1, idx_dsdrho_e = 2, idx_d2sde2 = 3, idx_d2sdedrho = 4, idx_d2sdrho2 = 5;
-
-  outputs_rhoe.resize(n_outputs);
-  output_names_rhoe.resize(n_outputs);
-  output_names_rhoe[idx_s] = "s";
-  outputs_rhoe[idx_s] = &Entropy;
-  output_names_rhoe[idx_dsde_rho] = "dsde_rho";
-  outputs_rhoe[idx_dsde_rho] = &dsde_rho;
-  output_names_rhoe[idx_dsdrho_e] = "dsdrho_e";
-  outputs_rhoe[idx_dsdrho_e] = &dsdrho_e;
-  output_names_rhoe[idx_d2sde2] = "d2sde2";
-  outputs_rhoe[idx_d2sde2] = &d2sde2;
-  output_names_rhoe[idx_d2sdedrho] = "d2sdedrho";
-  outputs_rhoe[idx_d2sdedrho] = &d2sdedrho;
-  output_names_rhoe[idx_d2sdrho2] = "d2sdrho2";
-  outputs_rhoe[idx_d2sdrho2] = &d2sdrho2;
+  outputs_rhoe.resize(N_ENTROPY_DATA);
+  output_names_rhoe.resize(N_ENTROPY_DATA);
+  output_names_rhoe[I_S] = "s";
+  outputs_rhoe[I_S] = &Entropy;
+  output_names_rhoe[I_DSDE_RHO] = "dsde_rho";
+  outputs_rhoe[I_DSDE_RHO] = &dsde_rho;
+  output_names_rhoe[I_DSDRHO_E] = "dsdrho_e";
+  outputs_rhoe[I_DSDRHO_E] = &dsdrho_e;
+  output_names_rhoe[I_D2SDE2] = "d2sde2";
+  outputs_rhoe[I_D2SDE2] = &d2sde2;
+  output_names_rhoe[I_D2SDEDRHO] = "d2sdedrho";
+  outputs_rhoe[I_D2SDEDRHO] = &d2sdedrho;
+  output_names_rhoe[I_D2SDRHO2] = "d2sdrho2";
+  outputs_rhoe[I_D2SDRHO2] = &d2sdrho2;
 
   /*--- Further preprocessing of input and output variables. ---*/
+  if (Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::LUT) {
+    idx_vars_LUT = lookup_table->GetVarIndices(output_names_rhoe);
+  }
+
   if (Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::MLP) {
-/*--- Map MLP inputs to outputs. ---*/
-#ifdef USE_MLPCPP
-    iomap_rhoe = new MLPToolbox::CIOMap(input_names_rhoe, output_names_rhoe);
-    lookup_mlp->PairVariableswithMLPs(*iomap_rhoe);
-    MLP_inputs.resize(2);
-#endif
+    /*--- Every network takes density and energy as inputs, in any order. ---*/
+    for (const auto& mlp : mlp_networks) {
+      const int iRho = mlp.GetInputIndex(varname_rho), iE = mlp.GetInputIndex(varname_e);
+      if (mlp.GetnInputs() != 2 || iRho < 0 || iE < 0) {
+        SU2_MPI::Error("The networks of the data-driven fluid model need " + varname_rho + " and " + varname_e +
+                       " as their only inputs.", CURRENT_FUNCTION);
+      }
+      mlp_idx_rho.push_back(iRho);
+      mlp_idx_e.push_back(iE);
+    }
+
+    /*--- Use the network outputs directly if all entries of the data set are available. ---*/
+    int iNetwork_s = -1, iOutput_s = -1;
+    mlp_output_map.clear();
+    for (const auto& name : output_names_rhoe) {
+      for (auto iNetwork = 0u; iNetwork < mlp_networks.size(); iNetwork++) {
+        const int iOutput = mlp_networks[iNetwork].GetOutputIndex(name);
+        if (iOutput < 0) continue;
+        mlp_output_map.emplace_back(iNetwork, iOutput);
+        if (name == output_names_rhoe[I_S]) {
+          iNetwork_s = iNetwork;
+          iOutput_s = iOutput;
+        }
+        break;
+      }
+    }
+
+    /*--- Otherwise differentiate the entropy network analytically. ---*/
+    if (mlp_output_map.size() != N_ENTROPY_DATA) {
+      if (iNetwork_s < 0) {
+        SU2_MPI::Error("The networks of the data-driven fluid model need to provide the entropy (s), and optionally "
+                       "its first and second derivatives w.r.t. density and energy.", CURRENT_FUNCTION);
+      }
+      mlp_output_map.clear();
+      mlp_entropy_network = iNetwork_s;
+      mlp_idx_s = iOutput_s;
+    }
   }
 }
 
+void CDataDrivenFluid::EntropyToPT(su2double rho, const su2double* data, su2double* PT) {
+  const su2double T = 1.0 / data[I_DSDE_RHO];
+  const su2double dTde_rho = -pow(data[I_DSDE_RHO], -2) * data[I_D2SDE2];
+  const su2double dTdrho_e = -pow(data[I_DSDE_RHO], -2) * data[I_D2SDEDRHO];
+
+  PT[0] = -pow(rho, 2) * T * data[I_DSDRHO_E];
+  PT[1] = T;
+  PT[2] = -2 * rho * T * data[I_DSDRHO_E] - pow(rho, 2) * (dTdrho_e * data[I_DSDRHO_E] + T * data[I_D2SDRHO2]);
+  PT[3] = -pow(rho, 2) * (dTde_rho * data[I_DSDRHO_E] + T * data[I_D2SDEDRHO]);
+  PT[4] = dTdrho_e;
+  PT[5] = dTde_rho;
+}
+
 void CDataDrivenFluid::SetTDState_rhoe(su2double rho, su2double e) {
   /*--- Compute thermodynamic state based on density and energy. ---*/
   Density = rho;
@@ -138,20 +175,20 @@ void CDataDrivenFluid::SetTDState_rhoe(su2double rho, su2double e) {
 
   SoundSpeed2 = -rho * pow(dsde_rho, -1) * (blue_term - rho * green_term * (dsdrho_e / dsde_rho));
 
-  /*--- Compute primary flow variables. ---*/
-  Temperature = 1.0 / dsde_rho;
-  Pressure = -pow(rho, 2) * Temperature * dsdrho_e;
+  /*--- Compute primary and secondary flow variables. ---*/
+  su2double PT[6];
+  EntropyToPT(rho, dataset, PT);
+  Pressure = PT[0];
+  Temperature = PT[1];
+  dPdrho_e = PT[2];
+  dPde_rho = PT[3];
+  dTdrho_e = PT[4];
+  dTde_rho = PT[5];
+
   Density = rho;
   StaticEnergy = e;
   Enthalpy = e + Pressure / rho;
 
-  /*--- Compute secondary flow variables ---*/
-  dTde_rho = -pow(dsde_rho, -2) * d2sde2;
-  dTdrho_e = -pow(dsde_rho, -2) * d2sdedrho;
-
-  dPde_rho = -pow(rho, 2) * (dTde_rho * dsdrho_e + Temperature * d2sdedrho);
-  dPdrho_e = -2 * rho * Temperature * dsdrho_e - pow(rho, 2) * (dTdrho_e * dsdrho_e + Temperature * d2sdrho2);
-
   /*--- Compute enthalpy and entropy derivatives required for Giles boundary conditions. ---*/
   dhdrho_e = -Pressure * pow(rho, -2) + dPdrho_e / rho;
   dhde_rho = 1 + dPde_rho / rho;
@@ -162,12 +199,82 @@ void CDataDrivenFluid::SetTDState_rhoe(su2double rho, su2double e) {
   dsdP_rho = dsde_rho / dPde_rho;
 }
 
+void CDataDrivenFluid::SetTDState_rhoe_Batch(CFluidStateBatch& states) {
+  const auto n = states.size;
+
+  /*--- Clip density and energy values to prevent extrapolation, and evaluate the data set once for all states. ---*/
+  su2double rho_clip[CFluidStateBatch::MAXSIZE], e_clip[CFluidStateBatch::MAXSIZE];
+  su2double data[CFluidStateBatch::MAXSIZE * N_ENTROPY_DATA];
+  for (auto i = 0ul; i < n; i++) {
+    rho_clip[i] = min(rho_max, max(rho_min, states.Density[i]));
+    e_clip[i] = min(e_max, max(e_min, states.StaticEnergy[i]));
+  }
+  Evaluate_Dataset(n, rho_clip, e_clip, data, states.Extrapolation);
+
+  /*--- Same as SetTDState_rhoe, with the unclipped density. ---*/
+  for (auto i = 0ul; i < n; i++) {
+    const su2double rho = states.Density[i];
+    const su2double* s = &data[i * N_ENTROPY_DATA];
+
+    const su2double blue_term = s[I_DSDRHO_E] * (2 - rho / s[I_DSDE_RHO] * s[I_D2SDEDRHO]) + rho * s[I_D2SDRHO2];
+    const su2double green_term = -s[I_D2SDE2] * s[I_DSDRHO_E] / s[I_DSDE_RHO] + s[I_D2SDEDRHO];
+    states.SoundSpeed2[i] =
+        -rho / s[I_DSDE_RHO] * (blue_term - rho * green_term * (s[I_DSDRHO_E] / s[I_DSDE_RHO]));
+
+    su2double PT[6];
+    EntropyToPT(rho, s, PT);
+    states.Pressure[i] = PT[0];
+    states.Temperature[i] = PT[1];
+    states.dPdrho_e[i] = PT[2];
+    states.dPde_rho[i] = PT[3];
+    states.dTdrho_e[i] = PT[4];
+    states.dTde_rho[i] = PT[5];
+    states.Entropy[i] = s[I_S];
+  }
+}
+
+void CDataDrivenFluid::SetTDState_PT_Batch(CFluidStateBatch& states) {
+  ComputeDensityEnergy_PT(states.size, states.Pressure, states.Temperature, states.Density, states.StaticEnergy);
+  SetTDState_rhoe_Batch(states);
+}
+
+bool CDataDrivenFluid::WarmStart(su2double P, su2double T, su2double& rho, su2double& e, bool fix_rho) const {
+  /*--- One Newton step from the current state, i.e. the solution of the previous call. ---*/
+  const su2double dP = P - Pressure;
+  const su2double dT = T - Temperature;
+  su2double drho, de;
+  if (fix_rho) {
+    drho = rho - Density;
+    de = (dP - dPdrho_e * drho) / dPde_rho;
+  } else {
+    const su2double det = dPdrho_e * dTde_rho - dPde_rho * dTdrho_e;
+    drho = (dTde_rho * dP - dPde_rho * dT) / det;
+    de = (-dTdrho_e * dP + dPdrho_e * dT) / det;
+  }
+
+  /*--- The linearization is only trusted close to the current state, the ideal gas estimate is used otherwise. ---*/
+  const su2double max_change = 0.2;
+  const su2double rho_new = Density + drho, e_new = StaticEnergy + de;
+  const bool usable = std::isfinite(SU2_TYPE::GetValue(rho_new)) && std::isfinite(SU2_TYPE::GetValue(e_new)) &&
+                      (abs(drho) < max_change * abs(Density)) && (abs(de) < max_change * abs(StaticEnergy)) &&
+                      (rho_new >= rho_min) && (rho_new <= rho_max) && (e_new >= e_min) && (e_new <= e_max);
+  if (usable) {
+    /*--- Only the values are used, the initial guess does not carry derivative information. ---*/
+    rho = SU2_TYPE::GetValue(rho_new);
+    e = SU2_TYPE::GetValue(e_new);
+  }
+  return usable;
+}
+
 void CDataDrivenFluid::SetTDState_PT(su2double P, su2double T) {
 
-  /*--- Approximate density and static energy with ideal gas law. ---*/
-  rho_start = P / (R_idealgas * T);
-  e_start = Cv_idealgas * T;
-  
+  /*--- Start from the previous solution if it is close, approximate density and static energy with ideal gas law
+   * otherwise. ---*/
+  if (!WarmStart(P, T, rho_start, e_start, false)) {
+    rho_start = P / (R_idealgas * T);
+    e_start = Cv_idealgas * T;
+  }
+
   /*--- Run 2D Newton solver for pressure and temperature ---*/
   Run_Newton_Solver(P, T, &Pressure, &Temperature, &dPdrho_e, &dPde_rho, &dTdrho_e, &dTde_rho);
 }
@@ -179,11 +286,16 @@ void CDataDrivenFluid::SetTDState_Prho(su2double P, su2double rho) {
 
 void CDataDrivenFluid::SetEnergy_Prho(su2double P, su2double rho) {
   /*--- Run 1D Newton solver for pressure at constant density. ---*/
-  Density = rho;
 
-  /*--- Approximate static energy through ideal gas law. ---*/
-  su2double e_idealgas = Cv_idealgas * (P / (R_idealgas * rho));
-  StaticEnergy = min(e_max, max(e_idealgas, e_min));
+  /*--- Start from the previous solution if it is close, approximate static energy through ideal gas law
+   * otherwise. ---*/
+  su2double e_init;
+  if (!WarmStart(P, 0.0, rho, e_init, true)) {
+    const su2double e_idealgas = Cv_idealgas * (P / (R_idealgas * rho));
+    e_init = min(e_max, max(e_idealgas, e_min));
+  }
+  Density = rho;
+  StaticEnergy = e_init;
 
   Run_Newton_Solver(P, &Pressure, &StaticEnergy, &dPde_rho);
 }
@@ -221,49 +333,99 @@ void CDataDrivenFluid::SetTDState_Ps(su2double P, su2double s) {
   Run_Newton_Solver(P, s, &Pressure, &Entropy, &dPdrho_e, &dPde_rho, &dsdrho_e, &dsde_rho);
 }
 
-unsigned long CDataDrivenFluid::Predict_MLP(su2double rho, su2double e) {
-  unsigned long exit_code = 0;
-/*--- Evaluate MLP collection for the given values for density and energy. ---*/
-#ifdef USE_MLPCPP
-  MLP_inputs[idx_rho] = rho;
-  MLP_inputs[idx_e] = e;
-  exit_code = lookup_mlp->PredictANN(iomap_rhoe, MLP_inputs, outputs_rhoe);
-#endif
-  return exit_code;
-}
+unsigned long CDataDrivenFluid::Predict_MLP(unsigned long n_points, const su2double* rho, const su2double* e,
+                                            su2double* data) {
+  unsigned long n_outside = 0;
+
+  /*--- Evaluate each network once for the whole batch of density and energy values. ---*/
+  for (auto iNetwork = 0u; iNetwork < mlp_networks.size(); iNetwork++) {
+    const bool entropy_network = (static_cast<int>(iNetwork) == mlp_entropy_network);
+    bool used = entropy_network;
+    for (const auto& map : mlp_output_map) used |= (map.first == iNetwork);
+    if (!used) continue;
+
+    auto& mlp = mlp_networks[iNetwork];
+    const auto n_outputs = mlp.GetnOutputs();
+    const auto n_hessian = mlp.GetnHessianEntries();
+    const auto iRho = mlp_idx_rho[iNetwork], iE = mlp_idx_e[iNetwork];
+
+    mlp_inputs.resize(2 * n_points);
+    mlp_outputs.resize(n_points * n_outputs);
+    for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+      mlp_inputs[2 * iPoint + iRho] = rho[iPoint];
+      mlp_inputs[2 * iPoint + iE] = e[iPoint];
+    }
 
-unsigned long CDataDrivenFluid::Predict_LUT(su2double rho, su2double e) {
-  unsigned long exit_code;
-  std::vector<std::string> output_names_rhoe_LUT;
-  std::vector<su2double*> outputs_LUT;
-  output_names_rhoe_LUT.resize(output_names_rhoe.size());
-  for (auto iOutput = 0u; iOutput < output_names_rhoe.size(); iOutput++) {
-    output_names_rhoe_LUT[iOutput] = output_names_rhoe[iOutput];
-  }
+    if (!entropy_network) {
+      n_outside = max(n_outside, mlp.Predict(n_points, mlp_inputs.data(), 0, mlp_outputs.data()));
+
+      for (auto iVar = 0u; iVar < mlp_output_map.size(); iVar++) {
+        if (mlp_output_map[iVar].first != iNetwork) continue;
+        const auto iOutput = mlp_output_map[iVar].second;
+        for (auto iPoint = 0ul; iPoint < n_points; iPoint++)
+          data[iPoint * N_ENTROPY_DATA + iVar] = mlp_outputs[iPoint * n_outputs + iOutput];
+      }
+      continue;
+    }
 
-  outputs_LUT.resize(outputs_rhoe.size());
-  for (auto iOutput = 0u; iOutput < outputs_rhoe.size(); iOutput++) {
-    outputs_LUT[iOutput] = outputs_rhoe[iOutput];
+    /*--- Entropy derivatives from the analytic derivatives of the network. ---*/
+    mlp_d_outputs.resize(n_points * n_outputs * 2);
+    mlp_d2_outputs.resize(n_points * n_outputs * n_hessian);
+    n_outside = max(n_outside, mlp.Predict(n_points, mlp_inputs.data(), 2, mlp_outputs.data(), mlp_d_outputs.data(),
+                                           mlp_d2_outputs.data()));
+
+    const auto iHess_ee = mlp.GetHessianIndex(iE, iE);
+    const auto iHess_erho = mlp.GetHessianIndex(iE, iRho);
+    const auto iHess_rhorho = mlp.GetHessianIndex(iRho, iRho);
+
+    for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+      const auto iValue = iPoint * n_outputs + mlp_idx_s;
+      const su2double* ds = &mlp_d_outputs[iValue * 2];
+      const su2double* d2s = &mlp_d2_outputs[iValue * n_hessian];
+      su2double* point_data = &data[iPoint * N_ENTROPY_DATA];
+
+      point_data[I_S] = mlp_outputs[iValue];
+      point_data[I_DSDE_RHO] = ds[iE];
+      point_data[I_DSDRHO_E] = ds[iRho];
+      point_data[I_D2SDE2] = d2s[iHess_ee];
+      point_data[I_D2SDEDRHO] = d2s[iHess_erho];
+      point_data[I_D2SDRHO2] = d2s[iHess_rhorho];
+    }
   }
+  return n_outside;
+}
 
-  exit_code = lookup_table->LookUp_XY(output_names_rhoe_LUT, outputs_LUT, rho, e);
-  return exit_code;
+unsigned long CDataDrivenFluid::Predict_LUT(unsigned long n_points, const su2double* rho, const su2double* e,
+                                            su2double* data, unsigned long* exit_codes) {
+  return lookup_table->LookUp_Batch(idx_vars_LUT, n_points, rho, e, nullptr, data, exit_codes);
 }
 
-void CDataDrivenFluid::Evaluate_Dataset(su2double rho, su2double e) {
+unsigned long CDataDrivenFluid::Evaluate_Dataset(unsigned long n_points, const su2double* rho, const su2double* e,
+                                                 su2double* data, unsigned long* exit_codes) {
   /*--- Evaluate dataset based on regression method. ---*/
   switch (Kind_DataDriven_Method) {
     case ENUM_DATADRIVEN_METHOD::LUT:
-      outside_dataset = Predict_LUT(rho, e);
-      break;
+      return Predict_LUT(n_points, rho, e, data, exit_codes);
     case ENUM_DATADRIVEN_METHOD::MLP:
-      outside_dataset = Predict_MLP(rho, e);
-      break;
+      /*--- The MLP range is the intersection of the network input ranges, i.e. the data set limits. ---*/
+      if (exit_codes) {
+        for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+          exit_codes[iPoint] = (rho[iPoint] < rho_min) || (rho[iPoint] > rho_max) || (e[iPoint] < e_min) ||
+                               (e[iPoint] > e_max);
+        }
+      }
+      return Predict_MLP(n_points, rho, e, data);
     default:
-      break;
+      if (exit_codes) for (auto iPoint = 0ul; iPoint < n_points; iPoint++) exit_codes[iPoint] = 0;
+      return 0;
   }
 }
 
+void CDataDrivenFluid::Evaluate_Dataset(su2double rho, su2double e) {
+  outside_dataset = Evaluate_Dataset(1, &rho, &e, dataset);
+  for (auto iVar = 0u; iVar < N_ENTROPY_DATA; iVar++) *outputs_rhoe[iVar] = dataset[iVar];
+}
+
 void CDataDrivenFluid::Run_Newton_Solver(su2double Y1_target, su2double Y2_target, su2double* Y1, su2double* Y2,
                                          su2double* dY1drho, su2double* dY1de, su2double* dY2drho, su2double* dY2de) {
   /*--- 2D Newton solver, computing the density and internal energy values corresponding to Y1_target and Y2_target.
@@ -342,6 +504,82 @@ void CDataDrivenFluid::Run_Newton_Solver(su2double Y_target, su2double* Y, su2do
   nIter_Newton = Iter;
 }
 
+unsigned long CDataDrivenFluid::Run_Newton_Solver_Batch(unsigned long n_points, const su2double* P, const su2double* T,
+                                                        const su2double* rho_fixed, su2double* rho_var, su2double* e) {
+  /*--- Pressure-temperature inversion for (rho, e), or pressure inversion for e at fixed density. ---*/
+  const bool fix_rho = (rho_fixed != nullptr);
+  const su2double* rho = fix_rho ? rho_fixed : rho_var;
+
+  /*--- Keep initial values inside the data set (warm start), approximate the others through ideal gas law. ---*/
+  for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+    const bool inside = (fix_rho || (rho[iPoint] >= rho_min && rho[iPoint] <= rho_max)) &&
+                        (e[iPoint] >= e_min && e[iPoint] <= e_max);
+    if (inside) continue;
+    const su2double T_init = fix_rho ? P[iPoint] / (R_idealgas * rho[iPoint]) : T[iPoint];
+    if (!fix_rho) rho_var[iPoint] = P[iPoint] / (R_idealgas * T_init);
+    e[iPoint] = min(e_max, max(e_min, Cv_idealgas * T_init));
+  }
+
+  batch_active.resize(n_points);
+  for (auto iPoint = 0ul; iPoint < n_points; iPoint++) batch_active[iPoint] = iPoint;
+
+  /*--- Each iteration evaluates the data set for all unconverged states at once. ---*/
+  unsigned long Iter = 0;
+  while (!batch_active.empty() && (Iter < MaxIter_Newton)) {
+    const auto n_active = batch_active.size();
+    batch_rho.resize(n_active);
+    batch_e.resize(n_active);
+    batch_dataset.resize(n_active * N_ENTROPY_DATA);
+
+    /*--- Clip density and energy values to prevent extrapolation. ---*/
+    for (auto k = 0ul; k < n_active; k++) {
+      const auto iPoint = batch_active[k];
+      batch_rho[k] = min(rho_max, max(rho_min, rho[iPoint]));
+      batch_e[k] = min(e_max, max(e_min, e[iPoint]));
+    }
+    Evaluate_Dataset(n_active, batch_rho.data(), batch_e.data(), batch_dataset.data());
+
+    unsigned long n_unconverged = 0;
+    for (auto k = 0ul; k < n_active; k++) {
+      const auto iPoint = batch_active[k];
+      su2double PT[6];
+      EntropyToPT(rho[iPoint], &batch_dataset[k * N_ENTROPY_DATA], PT);
+
+      /*--- Determine residuals and drop converged states from the batch. ---*/
+      const su2double delta_P = PT[0] - P[iPoint];
+      if (fix_rho) {
+        if (abs(delta_P / PT[0]) < Newton_Tolerance) continue;
+        e[iPoint] -= Newton_Relaxation * delta_P / PT[3];
+      } else {
+        const su2double delta_T = PT[1] - T[iPoint];
+        if ((abs(delta_P / PT[0]) < Newton_Tolerance) && (abs(delta_T / PT[1]) < Newton_Tolerance)) continue;
+
+        const su2double determinant = PT[2] * PT[5] - PT[3] * PT[4];
+        const su2double delta_rho = (PT[5] * delta_P - PT[3] * delta_T) / determinant;
+        const su2double delta_e = (-PT[4] * delta_P + PT[2] * delta_T) / determinant;
+        rho_var[iPoint] -= Newton_Relaxation * delta_rho;
+        e[iPoint] -= Newton_Relaxation * delta_e;
+      }
+      batch_active[n_unconverged++] = iPoint;
+    }
+    batch_active.resize(n_unconverged);
+    Iter++;
+  }
+  nIter_Newton = Iter;
+
+  return batch_active.size();
+}
+
+unsigned long CDataDrivenFluid::ComputeDensityEnergy_PT(unsigned long n_points, const su2double* P,
+                                                        const su2double* T, su2double* rho, su2double* e) {
+  return Run_Newton_Solver_Batch(n_points, P, T, nullptr, rho, e);
+}
+
+unsigned long CDataDrivenFluid::ComputeEnergy_Prho(unsigned long n_points, const su2double* P, const su2double* rho,
+                                                   su2double* e) {
+  return Run_Newton_Solver_Batch(n_points, P, nullptr, rho, nullptr, e);
+}
+
 void CDataDrivenFluid::ComputeIdealGasQuantities() {
   /*--- Compute approximate ideal gas properties from the middle of the reference data set. These properties are used to approximate the initial condition of the Newton solvers using the ideal gas law. ---*/
   su2double rho_average = 1.0, e_average = 1.0;
@@ -358,14 +596,19 @@ void CDataDrivenFluid::ComputeIdealGasQuantities() {
     e_average = 0.5*(*lookup_table->GetTableLimitsY().first + *lookup_table->GetTableLimitsY().second);
     break;
   case ENUM_DATADRIVEN_METHOD::MLP:
-#ifdef USE_MLPCPP
-    rho_min = lookup_mlp->GetInputNorm(iomap_rhoe, idx_rho).first;
-    e_min = lookup_mlp->GetInputNorm(iomap_rhoe, idx_e).first;
-    rho_max = lookup_mlp->GetInputNorm(iomap_rhoe, idx_rho).second;
-    e_max = lookup_mlp->GetInputNorm(iomap_rhoe, idx_e).second;
-    rho_average = 0.5*(lookup_mlp->GetInputNorm(iomap_rhoe, idx_rho).first + lookup_mlp->GetInputNorm(iomap_rhoe, idx_rho).second);
-    e_average = 0.5*(lookup_mlp->GetInputNorm(iomap_rhoe, idx_e).first + lookup_mlp->GetInputNorm(iomap_rhoe, idx_e).second);
-#endif
+    /*--- Intersection of the training data ranges of all networks. ---*/
+    rho_min = e_min = -std::numeric_limits<passivedouble>::max();
+    rho_max = e_max = std::numeric_limits<passivedouble>::max();
+    for (auto iNetwork = 0u; iNetwork < mlp_networks.size(); iNetwork++) {
+      const auto& norm_rho = mlp_networks[iNetwork].GetInputNorm(mlp_idx_rho[iNetwork]);
+      const auto& norm_e = mlp_networks[iNetwork].GetInputNorm(mlp_idx_e[iNetwork]);
+      rho_min = max(rho_min, su2double(norm_rho.first));
+      rho_max = min(rho_max, su2double(norm_rho.second));
+      e_min = max(e_min, su2double(norm_e.first));
+      e_max = min(e_max, su2double(norm_e.second));
+    }
+    rho_average = 0.5*(rho_min + rho_max);
+    e_average = 0.5*(e_min + e_max);
     break;
   default:
     break;
@@ -380,4 +623,4 @@ void CDataDrivenFluid::ComputeIdealGasQuantities() {
   Cv_idealgas = e_average / T_middle;
   Cp_idealgas = Enthalpy / T_middle;
   gamma_idealgas = (R_idealgas / Cv_idealgas) + 1;
-}
\ No newline at end of file
+}
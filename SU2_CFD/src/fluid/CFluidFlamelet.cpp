@@ -73,7 +73,7 @@ CFluidFlamelet::CFluidFlamelet(CConfig* config, su2double value_pressure_operati
         cout << "*****************************************" << endl;
       }
       look_up_table = new CLookUpTable(config->GetDataDriven_FileNames()[0], table_scalar_names[I_PROGVAR],
-                                       table_scalar_names[I_ENTH]);
+                                       table_scalar_names[I_ENTH], config->GetLUT_BinaryCache());
       break;
     default:
       if (rank == MASTER_NODE) {
@@ -187,6 +187,13 @@ void CFluidFlamelet::PreprocessLookUp(CConfig* config) {
   val_vars_LookUp.resize(n_lookups);
   for (auto iLookup = 0u; iLookup < n_lookups; iLookup++) varnames_LookUp[iLookup] = config->GetLookupName(iLookup);
 
+  /*--- Resolve the variable names once, lookups are then done with the table column indices. ---*/
+  if (Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::LUT) {
+    idx_vars_TD = look_up_table->GetVarIndices(varnames_TD);
+    idx_vars_Sources = look_up_table->GetVarIndices(varnames_Sources);
+    idx_vars_LookUp = look_up_table->GetVarIndices(varnames_LookUp);
+  }
+
   if (Kind_DataDriven_Method == ENUM_DATADRIVEN_METHOD::MLP) {
 #ifdef USE_MLPCPP
     iomap_TD = new MLPToolbox::CIOMap(controlling_variable_names, varnames_TD);
@@ -199,46 +206,58 @@ void CFluidFlamelet::PreprocessLookUp(CConfig* config) {
   }
 }
 
-unsigned long CFluidFlamelet::EvaluateDataSet(const vector<su2double>& input_scalar, unsigned short lookup_type,
-                                              vector<su2double>& output_refs) {
-  su2double val_enth = input_scalar[I_ENTH];
-  su2double val_prog = input_scalar[I_PROGVAR];
-  su2double val_mixfrac = include_mixture_fraction ? input_scalar[I_MIXFRAC] : 0.0;
-  vector<string> varnames;
-  vector<su2double> val_vars;
-  vector<su2double*> refs_vars;
+void CFluidFlamelet::GetLookUpVariables(unsigned short lookup_type, const vector<string>*& varnames,
+                                        const vector<unsigned long>*& idx_vars) {
   switch (lookup_type) {
     case FLAMELET_LOOKUP_OPS::TD:
-      varnames = varnames_TD;
+      varnames = &varnames_TD;
+      idx_vars = &idx_vars_TD;
 #ifdef USE_MLPCPP
       iomap_Current = iomap_TD;
 #endif
       break;
     case FLAMELET_LOOKUP_OPS::SOURCES:
-      varnames = varnames_Sources;
+      varnames = &varnames_Sources;
+      idx_vars = &idx_vars_Sources;
 #ifdef USE_MLPCPP
       iomap_Current = iomap_Sources;
 #endif
       break;
     case FLAMELET_LOOKUP_OPS::LOOKUP:
-      varnames = varnames_LookUp;
+      varnames = &varnames_LookUp;
+      idx_vars = &idx_vars_LookUp;
 #ifdef USE_MLPCPP
       iomap_Current = iomap_LookUp;
 #endif
       break;
     default:
+      SU2_MPI::Error(string("Unknown manifold lookup operation."), CURRENT_FUNCTION);
       break;
   }
-  if (output_refs.size() != varnames.size())
+}
+
+unsigned long CFluidFlamelet::EvaluateDataSet(const vector<su2double>& input_scalar, unsigned short lookup_type,
+                                              vector<su2double>& output_refs) {
+  su2double val_enth = input_scalar[I_ENTH];
+  su2double val_prog = input_scalar[I_PROGVAR];
+  su2double val_mixfrac = include_mixture_fraction ? input_scalar[I_MIXFRAC] : 0.0;
+  const vector<string>* varnames = nullptr;
+  const vector<unsigned long>* idx_vars = nullptr;
+  vector<su2double*> refs_vars;
+
+  GetLookUpVariables(lookup_type, varnames, idx_vars);
+
+  if (output_refs.size() != varnames->size())
     SU2_MPI::Error(string("Output vector size incompatible with manifold lookup operation."), CURRENT_FUNCTION);
 
   /*--- Add all quantities and their names to the look up vectors. ---*/
   switch (Kind_DataDriven_Method) {
     case ENUM_DATADRIVEN_METHOD::LUT:
       if (include_mixture_fraction) {
-        extrapolation = look_up_table->LookUp_XYZ(varnames, output_refs, val_prog, val_enth, val_mixfrac);
+        extrapolation =
+            look_up_table->LookUp_XYZ(*idx_vars, output_refs.data(), val_prog, val_enth, val_mixfrac, triangle_hint);
       } else {
-        extrapolation = look_up_table->LookUp_XY(varnames, output_refs, val_prog, val_enth);
+        extrapolation = look_up_table->LookUp_XY(*idx_vars, output_refs.data(), val_prog, val_enth, 0, triangle_hint);
       }
       break;
     case ENUM_DATADRIVEN_METHOD::MLP:
@@ -254,3 +273,35 @@ unsigned long CFluidFlamelet::EvaluateDataSet(const vector<su2double>& input_sca
 
   return extrapolation;
 }
+
+unsigned long CFluidFlamelet::EvaluateDataSetBatch(unsigned long n_points, const su2double* input_scalars,
+                                                   unsigned short n_inputs, unsigned short lookup_type,
+                                                   su2double* output_refs, unsigned short n_outputs,
+                                                   unsigned long* misses) {
+  if (Kind_DataDriven_Method != ENUM_DATADRIVEN_METHOD::LUT)
+    return CFluidModel::EvaluateDataSetBatch(n_points, input_scalars, n_inputs, lookup_type, output_refs, n_outputs,
+                                             misses);
+
+  const vector<string>* varnames = nullptr;
+  const vector<unsigned long>* idx_vars = nullptr;
+  GetLookUpVariables(lookup_type, varnames, idx_vars);
+
+  if (n_outputs != varnames->size())
+    SU2_MPI::Error(string("Output size incompatible with manifold lookup operation."), CURRENT_FUNCTION);
+
+  /*--- Gather the controlling variables into contiguous arrays. ---*/
+  vector<su2double> val_prog(n_points), val_enth(n_points), val_mixfrac(include_mixture_fraction ? n_points : 0);
+  for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+    val_prog[iPoint] = input_scalars[iPoint * n_inputs + I_PROGVAR];
+    val_enth[iPoint] = input_scalars[iPoint * n_inputs + I_ENTH];
+    if (include_mixture_fraction) val_mixfrac[iPoint] = input_scalars[iPoint * n_inputs + I_MIXFRAC];
+  }
+
+  const unsigned long n_misses =
+      look_up_table->LookUp_Batch(*idx_vars, n_points, val_prog.data(), val_enth.data(),
+                                  include_mixture_fraction ? val_mixfrac.data() : nullptr, output_refs, misses);
+
+  if (n_points > 0) extrapolation = misses[n_points - 1];
+
+  return n_misses;
+}
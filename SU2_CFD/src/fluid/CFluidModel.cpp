@@ -46,6 +46,56 @@
 #include "../../include/fluid/CConstantLewisDiffusivity.hpp"
 #include "../../include/fluid/CCoolPropConductivity.hpp"
 
+constexpr unsigned long CFluidStateBatch::MAXSIZE;
+
+void CFluidModel::SetTDState_rhoe_Batch(CFluidStateBatch& states) {
+  for (auto i = 0ul; i < states.size; i++) {
+    SetTDState_rhoe(states.Density[i], states.StaticEnergy[i]);
+    states.Pressure[i] = Pressure;
+    states.Temperature[i] = Temperature;
+    states.SoundSpeed2[i] = SoundSpeed2;
+    states.Entropy[i] = Entropy;
+    states.dPdrho_e[i] = dPdrho_e;
+    states.dPde_rho[i] = dPde_rho;
+    states.dTdrho_e[i] = dTdrho_e;
+    states.dTde_rho[i] = dTde_rho;
+    states.Extrapolation[i] = GetExtrapolation();
+  }
+}
+
+void CFluidModel::SetTDState_PT_Batch(CFluidStateBatch& states) {
+  for (auto i = 0ul; i < states.size; i++) {
+    SetTDState_PT(states.Pressure[i], states.Temperature[i]);
+    states.Density[i] = Density;
+    states.StaticEnergy[i] = StaticEnergy;
+    states.Pressure[i] = Pressure;
+    states.Temperature[i] = Temperature;
+    states.SoundSpeed2[i] = SoundSpeed2;
+    states.Entropy[i] = Entropy;
+    states.dPdrho_e[i] = dPdrho_e;
+    states.dPde_rho[i] = dPde_rho;
+    states.dTdrho_e[i] = dTdrho_e;
+    states.dTde_rho[i] = dTde_rho;
+    states.Extrapolation[i] = GetExtrapolation();
+  }
+}
+
+unsigned long CFluidModel::EvaluateDataSetBatch(unsigned long n_points, const su2double* input_scalars,
+                                                unsigned short n_inputs, unsigned short lookup_type,
+                                                su2double* output_refs, unsigned short n_outputs,
+                                                unsigned long* misses) {
+  vector<su2double> input(n_inputs), output(n_outputs);
+  unsigned long n_misses = 0;
+
+  for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+    for (auto iVar = 0u; iVar < n_inputs; iVar++) input[iVar] = input_scalars[iPoint * n_inputs + iVar];
+    misses[iPoint] = EvaluateDataSet(input, lookup_type, output);
+    for (auto iVar = 0u; iVar < n_outputs; iVar++) output_refs[iPoint * n_outputs + iVar] = output[iVar];
+    n_misses += misses[iPoint];
+  }
+  return n_misses;
+}
+
 unique_ptr<CViscosityModel> CFluidModel::MakeLaminarViscosityModel(const CConfig* config, unsigned short iSpecies) {
   switch (config->GetKind_ViscosityModel()) {
     case VISCOSITYMODEL::CONSTANT:
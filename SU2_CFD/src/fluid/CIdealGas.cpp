@@ -57,6 +57,44 @@ void CIdealGas::SetTDState_PT(su2double P, su2double T) {
   SetTDState_rhoe(rho, e);
 }
 
+void CIdealGas::SetTDState_rhoe_Batch(CFluidStateBatch& states) {
+  /*--- Local copies of the constants, such that they are not reloaded through "this" in the loop. ---*/
+  const su2double gamma = Gamma, gm1 = Gamma_Minus_One, R = Gas_Constant;
+  const su2double entropy = Entropy;
+  const bool compute_entropy = ComputeEntropy;
+  const auto n = states.size;
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (auto i = 0ul; i < n; i++) {
+    const su2double rho = states.Density[i];
+    const su2double e = states.StaticEnergy[i];
+    const su2double P = gm1 * rho * e;
+    const su2double T = gm1 * e / R;
+    states.Pressure[i] = P;
+    states.Temperature[i] = T;
+    states.SoundSpeed2[i] = gamma * P / rho;
+    states.dPdrho_e[i] = gm1 * e;
+    states.dPde_rho[i] = gm1 * rho;
+    states.dTdrho_e[i] = 0.0;
+    states.dTde_rho[i] = gm1 / R;
+    states.Entropy[i] = compute_entropy ? (1.0 / gm1 * log(T) + log(1.0 / rho)) * R : entropy;
+    states.Extrapolation[i] = 0;
+  }
+}
+
+void CIdealGas::SetTDState_PT_Batch(CFluidStateBatch& states) {
+  const su2double gm1 = Gamma_Minus_One, R = Gas_Constant;
+  const auto n = states.size;
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (auto i = 0ul; i < n; i++) {
+    const su2double T = states.Temperature[i];
+    states.StaticEnergy[i] = T * R / gm1;
+    states.Density[i] = states.Pressure[i] / (T * R);
+  }
+  SetTDState_rhoe_Batch(states);
+}
+
 void CIdealGas::SetTDState_Prho(su2double P, su2double rho) {
   su2double e = P / (Gamma_Minus_One * rho);
   SetTDState_rhoe(rho, e);
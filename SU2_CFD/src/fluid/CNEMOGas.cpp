@@ -28,6 +28,8 @@
 #include "../../include/fluid/CNEMOGas.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
+constexpr unsigned long CNEMOGas::BATCH_SIZE;
+
 CNEMOGas::CNEMOGas(const CConfig* config, unsigned short val_nDim): CFluidModel(){
 
   nSpecies = config->GetnSpecies();
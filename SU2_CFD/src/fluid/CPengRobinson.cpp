@@ -143,6 +143,60 @@ void CPengRobinson::SetTDState_rhoe(su2double rho, su2double e) {
   AD::EndPreacc();
 }
 
+void CPengRobinson::SetTDState_rhoe_Batch(CFluidStateBatch& states) {
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  CFluidModel::SetTDState_rhoe_Batch(states);
+#else
+  /*--- Local copies of the model parameters, such that they are not reloaded through "this" in the loop. ---*/
+  const su2double R = Gas_Constant, gm1 = Gamma_Minus_One, Tc = TstarCrit;
+  const su2double pr_a = a, pr_b = b, pr_k = k, dTdrho = dTdrho_e;
+  const su2double sqrt2 = sqrt(2.0);
+  const auto n = states.size;
+
+  SU2_OMP_SIMD
+  for (auto i = 0ul; i < n; i++) {
+    const su2double rho = states.Density[i];
+    const su2double e = states.StaticEnergy[i];
+    const su2double rho2 = rho * rho;
+
+    const su2double fv =
+        (log(1.0 + (rho * pr_b * sqrt2 / (1 + rho * pr_b))) - log(1.0 - (rho * pr_b * sqrt2 / (1 + rho * pr_b)))) / 2.0;
+
+    su2double A = R / gm1;
+    su2double B = pr_a * pr_k * (pr_k + 1) * fv / (pr_b * sqrt2 * sqrt(Tc));
+    const su2double C = pr_a * (pr_k + 1) * (pr_k + 1) * fv / (pr_b * sqrt2) + e;
+
+    su2double T = (-B + sqrt(B * B + 4 * A * C)) / (2 * A);
+    T *= T;
+
+    const su2double sqrt_a2T = 1 + pr_k * (1 - sqrt(T / Tc));
+    const su2double a2T = sqrt_a2T * sqrt_a2T;
+
+    A = (1 / rho2 + 2 * pr_b / rho - pr_b * pr_b);
+    B = 1 / rho - pr_b;
+
+    const su2double P = T * R / B - pr_a * a2T / A;
+
+    const su2double DpDd_T = (T * R / (B * B) - 2 * pr_a * a2T * (1 / rho + pr_b) / (A * A)) / rho2;
+    const su2double DpDT_d = R / B + pr_a * pr_k / A * sqrt(a2T / (T * Tc));
+    const su2double Cv = R / gm1 + (pr_a * pr_k * (pr_k + 1) * fv) / (2 * pr_b * sqrt(2 * T * Tc));
+    const su2double DeDd_T = -pr_a * (1 + pr_k) * sqrt(a2T) / A / rho2;
+    const su2double dPde = DpDT_d / Cv;
+    const su2double dPdrho = DpDd_T - dPde * DeDd_T;
+
+    states.Temperature[i] = T;
+    states.Pressure[i] = P;
+    states.Entropy[i] = R / gm1 * log(T) + R * log(B) - pr_a * sqrt(a2T) * pr_k * fv / (pr_b * sqrt2 * sqrt(T * Tc));
+    states.dPde_rho[i] = dPde;
+    states.dPdrho_e[i] = dPdrho;
+    states.SoundSpeed2[i] = dPdrho + P / rho2 * dPde;
+    states.dTde_rho[i] = 1 / Cv;
+    states.dTdrho_e[i] = dTdrho;
+    states.Extrapolation[i] = 0;
+  }
+#endif
+}
+
 void CPengRobinson::SetTDState_PT(su2double P, su2double T) {
   su2double toll = 1e-6;
   su2double A, B, Z, DZ = 1.0, F, F1, atanh;
@@ -1158,6 +1158,29 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  /*--- Tabulate the equilibrium constants of each reaction, to avoid setting them for every point. ---*/
+  RxnEquilConstants.resize(nReactions,6,5,0.0);
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+    GetChemistryEquilConstants(iReaction);
+    for (unsigned short iRow = 0; iRow < 6; iRow++)
+      for (unsigned short ii = 0; ii < 5; ii++)
+        RxnEquilConstants(iReaction,iRow,ii) = RxnConstantTable(iRow,ii);
+  }
+
+  /*--- Millikan & White coefficients of each species pair, they only depend on the molar masses. ---*/
+  MillikanWhite_A.resize(nSpecies,nSpecies);
+  MillikanWhite_B.resize(nSpecies,nSpecies);
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
+      const su2double mu = MolarMass[iSpecies]*MolarMass[jSpecies] / (MolarMass[iSpecies] + MolarMass[jSpecies]);
+      MillikanWhite_A(iSpecies,jSpecies) = 1.16 * 1E-3 * sqrt(mu) * pow(CharVibTemp[iSpecies], 4.0/3.0);
+      MillikanWhite_B(iSpecies,jSpecies) = 0.015 * pow(mu, 0.25);
+    }
+  }
+
+  /*--- The trans.-rot. specific heats are constant, ComputeTemperatures needs them before any other call. ---*/
+  GetSpeciesCvTraRot();
 }
 
 CSU2TCLib::~CSU2TCLib()= default;
@@ -1188,55 +1211,58 @@ vector<su2double>& CSU2TCLib::GetSpeciesCvTraRot(){
 
 vector<su2double>& CSU2TCLib::ComputeSpeciesCvVibEle(su2double val_T){
 
+  /*--- Loop through species ---*/
+  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    Cvves[iSpecies] = SpeciesCvVibEle(iSpecies, val_T);
+
+  return Cvves;
+
+}
+
+su2double CSU2TCLib::SpeciesCvVibEle(unsigned short val_Species, su2double val_T) const {
+
   su2double thoTve, exptv, num, num2, num3, denom, Cvvs, Cves;
-  unsigned short iElectron = 0;
+  const unsigned short iElectron = 0;
 
-  /*--- Loop through species ---*/
-  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++){
+  /*--- If requesting electron specific heat ---*/
+  if (ionization && val_Species == iElectron) {
+    Cvvs = 0.0;
+    Cves = 3.0/2.0 * Ru/MolarMass[val_Species];
+  }
 
-    /*--- If requesting electron specific heat ---*/
-    if (ionization && iSpecies == iElectron) {
+  /*--- Heavy particle specific heat ---*/
+  else {
+
+    /*--- Vibrational energy ---*/
+    if (CharVibTemp[val_Species] != 0.0) {
+      thoTve = CharVibTemp[val_Species]/val_T;
+      exptv = exp(CharVibTemp[val_Species]/val_T);
+      Cvvs  = Ru/MolarMass[val_Species] * thoTve*thoTve * exptv / ((exptv-1.0)*(exptv-1.0));
+    } else {
       Cvvs = 0.0;
-      Cves = 3.0/2.0 * Ru/MolarMass[iSpecies];
     }
 
-    /*--- Heavy particle specific heat ---*/
-    else {
-
-      /*--- Vibrational energy ---*/
-      if (CharVibTemp[iSpecies] != 0.0) {
-        thoTve = CharVibTemp[iSpecies]/val_T;
-        exptv = exp(CharVibTemp[iSpecies]/val_T);
-        Cvvs  = Ru/MolarMass[iSpecies] * thoTve*thoTve * exptv / ((exptv-1.0)*(exptv-1.0));
-      } else {
-        Cvvs = 0.0;
-      }
-
-      /*--- Electronic energy ---*/
-      if (nElStates[iSpecies] != 0) {
-        num = 0.0; num2 = 0.0;
-        denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
-        num3  = ElDegeneracy[iSpecies][0] * (CharElTemp[iSpecies][0]/(val_T*val_T))*exp(-CharElTemp[iSpecies][0]/val_T);
-        for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-          thoTve = CharElTemp[iSpecies][iEl]/val_T;
-          exptv = exp(-CharElTemp[iSpecies][iEl]/val_T);
-
-          num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exptv;
-          denom += ElDegeneracy[iSpecies][iEl] * exptv;
-          num2  += ElDegeneracy[iSpecies][iEl] * (thoTve*thoTve) * exptv;
-          num3  += ElDegeneracy[iSpecies][iEl] * thoTve/val_T * exptv;
-        }
-        Cves = Ru/MolarMass[iSpecies] * (num2/denom - num*num3/(denom*denom));
-      } else {
-        Cves = 0.0;
+    /*--- Electronic energy ---*/
+    if (nElStates[val_Species] != 0) {
+      num = 0.0; num2 = 0.0;
+      denom = ElDegeneracy[val_Species][0] * exp(-CharElTemp[val_Species][0]/val_T);
+      num3  = ElDegeneracy[val_Species][0] * (CharElTemp[val_Species][0]/(val_T*val_T))*exp(-CharElTemp[val_Species][0]/val_T);
+      for (unsigned short iEl = 1; iEl < nElStates[val_Species]; iEl++) {
+        thoTve = CharElTemp[val_Species][iEl]/val_T;
+        exptv = exp(-CharElTemp[val_Species][iEl]/val_T);
+
+        num   += ElDegeneracy[val_Species][iEl] * CharElTemp[val_Species][iEl] * exptv;
+        denom += ElDegeneracy[val_Species][iEl] * exptv;
+        num2  += ElDegeneracy[val_Species][iEl] * (thoTve*thoTve) * exptv;
+        num3  += ElDegeneracy[val_Species][iEl] * thoTve/val_T * exptv;
       }
+      Cves = Ru/MolarMass[val_Species] * (num2/denom - num*num3/(denom*denom));
+    } else {
+      Cves = 0.0;
     }
-
-    Cvves[iSpecies] = Cvvs + Cves;
   }
 
-  return Cvves;
-
+  return Cvvs + Cves;
 }
 
 vector<su2double>& CSU2TCLib::ComputeMixtureEnergies(){
@@ -1555,21 +1581,7 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
   } // ii
 }
 
-void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
-
-  unsigned short ii;
-
-  /*--- Acquire database constants from CConfig ---*/
-  GetChemistryEquilConstants(val_Reaction);
-
-  /*--- Calculate mixture number density ---*/
-  su2double N = 0.0;
-  for (iSpecies =0 ; iSpecies < nSpecies; iSpecies++) {
-    N += rhos[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
-  }
-
-  /*--- Convert number density from 1/m^3 to 1/cm^3 for table look-up ---*/
-  N = N*(1E-6);
+void CSU2TCLib::KeqInterpolation(su2double N, unsigned short& iRow, su2double& weight) {
 
   /*--- Determine table index based on mixture N ---*/
   unsigned short tbl_offset = 14;
@@ -1577,30 +1589,50 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
 
   /*--- Bound the interpolation to table limit values ---*/
   unsigned short iIndex = int(pwr) - tbl_offset;
+  weight = 0.0;
   if (iIndex <= 0) {
-    for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(0,ii);
+    iRow = 0;
     return;
   } if (iIndex >= 5) {
-    for (ii = 0; ii < 5; ii++)
-      A[ii] = RxnConstantTable(5,ii);
+    iRow = 5;
     return;
   }
+  iRow = iIndex;
 
   /*--- Calculate interpolation denominator terms avoiding pow() ---*/
   su2double tmp1 = 1.0;
   su2double tmp2 = 1.0;
-  for (ii = 0; ii < pwr; ii++) {
+  for (unsigned short ii = 0; ii < pwr; ii++) {
     tmp1 *= 10.0;
     tmp2 *= 10.0;
   }
   tmp2 *= 10.0;
 
-  /*--- Interpolate ---*/
+  weight = (N - tmp1) / (tmp2 - tmp1);
+}
+
+void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
+
+  unsigned short ii;
+
+  /*--- Calculate mixture number density ---*/
+  su2double N = 0.0;
+  for (iSpecies =0 ; iSpecies < nSpecies; iSpecies++) {
+    N += rhos[iSpecies]/MolarMass[iSpecies]*AVOGAD_CONSTANT;
+  }
+
+  /*--- Convert number density from 1/m^3 to 1/cm^3 for table look-up ---*/
+  N = N*(1E-6);
+
+  unsigned short iRow;
+  su2double weight;
+  KeqInterpolation(N, iRow, weight);
+
+  /*--- Interpolate the constants tabulated at construction ---*/
   for (ii = 0; ii < 5; ii++) {
-    A[ii] =  (RxnConstantTable(iIndex+1,ii) - RxnConstantTable(iIndex,ii))
-        / (tmp2 - tmp1) * (N - tmp1)
-        + RxnConstantTable(iIndex,ii);
+    A[ii] = RxnEquilConstants(val_Reaction,iRow,ii);
+    if (weight != 0.0)
+      A[ii] += (RxnEquilConstants(val_Reaction,iRow+1,ii) - A[ii]) * weight;
   }
 }
 
@@ -1614,12 +1646,6 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
   // Note: Millikan & White relaxation time (requires P in Atm.)
   // Note: Park limiting cross section
 
-  su2activematrix mu;
-  vector<su2double> MolarFrac;
-
-  MolarFrac.resize(nSpecies,0.0);
-  mu.resize(nSpecies,nSpecies)=su2double(0.0);
-
   su2double omegaVT = 0.0;
   su2double omegaCV = 0.0;
 
@@ -1631,9 +1657,6 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
     N    += rhos[iSpecies] / MolarMass[iSpecies] * AVOGAD_CONSTANT;
   }
 
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
-    MolarFrac[iSpecies] = (rhos[iSpecies] / MolarMass[iSpecies]) / conc;
-
   /*--- Compute Eve and Eve* ---*/
   eve_eq = ComputeSpeciesEve(T, true);
   eve    = ComputeSpeciesEve(Tve, true);
@@ -1645,13 +1668,13 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
     su2double num   = 0.0;
     su2double denom = 0.0;
     for (jSpecies = 0; jSpecies < nSpecies; jSpecies++) {
-      mu(iSpecies,jSpecies) = MolarMass[iSpecies]*MolarMass[jSpecies] / (MolarMass[iSpecies] + MolarMass[jSpecies]);
-      const su2double A_sr   = 1.16 * 1E-3 * sqrt(mu(iSpecies,jSpecies)) * pow(CharVibTemp[iSpecies], 4.0/3.0);
-      const su2double B_sr   = 0.015 * pow(mu(iSpecies,jSpecies), 0.25);
+      const su2double MolarFrac = (rhos[jSpecies] / MolarMass[jSpecies]) / conc;
+      const su2double A_sr   = MillikanWhite_A(iSpecies,jSpecies);
+      const su2double B_sr   = MillikanWhite_B(iSpecies,jSpecies);
       const su2double tau_sr = 101325.0/Pressure * exp(A_sr*(pow(T,-1.0/3.0) - B_sr) - 18.42);
 
-      num   += MolarFrac[jSpecies];
-      denom += MolarFrac[jSpecies] / tau_sr;
+      num   += MolarFrac;
+      denom += MolarFrac / tau_sr;
     }
 
     const su2double tauMW = num / denom;
@@ -1682,6 +1705,335 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
 
 }
 
+void CSU2TCLib::ComputeSourceTerms_Batch(unsigned long nPoints, const su2double* val_rhos, const su2double* val_T,
+                                         const su2double* val_Tve, su2double* val_ws, su2double* val_omega,
+                                         const SourceJacobians* val_jacobians) const {
+
+  for (auto iPoint = 0ul; iPoint < nPoints; iPoint += BATCH_SIZE) {
+    const auto nChunk = min(BATCH_SIZE, nPoints - iPoint);
+    const auto offset = iPoint * nSpecies;
+
+    /*--- Per point arrays of the Jacobians, shifted to the chunk. ---*/
+    SourceJacobians jacobians;
+    if (val_jacobians) {
+      jacobians.eve = val_jacobians->eve + iPoint;
+      jacobians.cvve = val_jacobians->cvve + iPoint;
+      jacobians.dTdU = val_jacobians->dTdU + iPoint;
+      jacobians.dTvedU = val_jacobians->dTvedU + iPoint;
+      jacobians.chemistry = val_jacobians->chemistry + iPoint;
+      jacobians.relaxation = val_jacobians->relaxation + iPoint;
+    }
+    const auto jac = val_jacobians ? &jacobians : nullptr;
+
+    switch (nSpecies) {
+      case 1:
+        ComputeSourceTerms_Chunk<1>(nChunk, val_rhos+offset, val_T+iPoint, val_Tve+iPoint, val_ws+offset, val_omega+iPoint, jac);
+        break;
+      case 2:
+        ComputeSourceTerms_Chunk<2>(nChunk, val_rhos+offset, val_T+iPoint, val_Tve+iPoint, val_ws+offset, val_omega+iPoint, jac);
+        break;
+      case 5:
+        ComputeSourceTerms_Chunk<5>(nChunk, val_rhos+offset, val_T+iPoint, val_Tve+iPoint, val_ws+offset, val_omega+iPoint, jac);
+        break;
+      case 7:
+        ComputeSourceTerms_Chunk<7>(nChunk, val_rhos+offset, val_T+iPoint, val_Tve+iPoint, val_ws+offset, val_omega+iPoint, jac);
+        break;
+      default:
+        SU2_MPI::Error("The batched source terms are not available for this number of species.", CURRENT_FUNCTION);
+        break;
+    }
+  }
+}
+
+template <unsigned short NSPECIES>
+void CSU2TCLib::ComputeSourceTerms_Chunk(unsigned long nPoints, const su2double* val_rhos, const su2double* val_T,
+                                         const su2double* val_Tve, su2double* val_ws, su2double* val_omega,
+                                         const SourceJacobians* jac) const {
+
+  /*--- Same formulation as ComputeNetProductionRates and ComputeEveSourceTerm, but the work arrays are indexed
+   * by species and then point, such that each operation (including the exponentials) is applied to a contiguous
+   * range of points. The fixed size avoids heap allocations. The Jacobians (same as ChemistryJacobian and
+   * GetEveSourceTermJacobian) are assembled point by point, from the rate coefficients and relaxation times
+   * of the batch, i.e. without transcendental functions other than the equilibrium V-E specific heats. ---*/
+
+  constexpr unsigned long N = BATCH_SIZE;
+  const unsigned short nEve = nSpecies+nDim+1;
+  const unsigned short nVar = nSpecies+nDim+2;
+
+  /*--- x^n for the (small) stoichiometric coefficients. ---*/
+  auto intPow = [](su2double x, int n) {
+    su2double y = 1.0;
+    for (int i = 0; i < n; i++) y *= x;
+    return y;
+  };
+
+  const su2double T_min   = 800.0;
+  const su2double epsilon = 80;
+
+  su2double rhos[NSPECIES][N], conc[NSPECIES][N], ws[NSPECIES][N];
+  su2double T[N], lnT[N], Tve[N], lnTve[N], Pressure[N], conc_tot[N], omega[N];
+
+  for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+    T[iPoint] = val_T[iPoint];
+    Tve[iPoint] = val_Tve[iPoint];
+    for (auto iSpecies = 0u; iSpecies < NSPECIES; iSpecies++)
+      rhos[iSpecies][iPoint] = val_rhos[iPoint*NSPECIES + iSpecies];
+  }
+
+  SU2_OMP_SIMD_IF_NOT_AD
+  for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+    lnT[iPoint] = log(T[iPoint]);
+    lnTve[iPoint] = log(Tve[iPoint]);
+    Pressure[iPoint] = 0.0;
+    conc_tot[iPoint] = 0.0;
+    omega[iPoint] = 0.0;
+  }
+
+  /*--- Concentrations and mixture pressure (electrons at Tve). ---*/
+  for (auto iSpecies = 0u; iSpecies < NSPECIES; iSpecies++) {
+    const su2double Ms = MolarMass[iSpecies];
+    const bool electron = iSpecies < nEl;
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+      conc[iSpecies][iPoint] = rhos[iSpecies][iPoint] / Ms;
+      conc_tot[iPoint] += conc[iSpecies][iPoint];
+      Pressure[iPoint] += conc[iSpecies][iPoint] * Ru * (electron ? Tve[iPoint] : T[iPoint]);
+      ws[iSpecies][iPoint] = 0.0;
+    }
+  }
+
+  if (jac) {
+    for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+      for (auto iVar = 0u; iVar < nVar; iVar++) {
+        for (auto jVar = 0u; jVar < nVar; jVar++) {
+          jac->chemistry[iPoint][iVar][jVar] = 0.0;
+          jac->relaxation[iPoint][iVar][jVar] = 0.0;
+        }
+      }
+    }
+  }
+
+  /*--- Nonequilibrium chemistry. ---*/
+  if (!frozen) {
+
+    /*--- The table rows of the equilibrium constants depend on the mixture number density [1/cm^3]. ---*/
+    unsigned short keqRow[N];
+    su2double keqWeight[N];
+    for (auto iPoint = 0ul; iPoint < nPoints; iPoint++)
+      KeqInterpolation(conc_tot[iPoint]*AVOGAD_CONSTANT*1E-6, keqRow[iPoint], keqWeight[iPoint]);
+
+    for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+
+      su2double A[5][N], fwdRxn[N], bkwRxn[N], netRxn[N];
+      su2double kf[N], kb[N], dkfdT[N], dkfdTve[N], dkbdT[N], dkbdTve[N];
+
+      for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+        const auto iRow = keqRow[iPoint];
+        for (auto ii = 0u; ii < 5; ii++) {
+          A[ii][iPoint] = RxnEquilConstants(iReaction,iRow,ii);
+          if (keqWeight[iPoint] != 0.0)
+            A[ii][iPoint] += (RxnEquilConstants(iReaction,iRow+1,ii) - A[ii][iPoint]) * keqWeight[iPoint];
+        }
+        fwdRxn[iPoint] = 1.0;
+        bkwRxn[iPoint] = 1.0;
+      }
+
+      /*--- Law of mass action. ---*/
+      for (auto ii = 0u; ii < 3; ii++) {
+        const auto iSpecies = Reactions(iReaction,0,ii);
+        if (iSpecies != nSpecies) {
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (auto iPoint = 0ul; iPoint < nPoints; iPoint++)
+            fwdRxn[iPoint] *= 0.001*conc[iSpecies][iPoint];
+        }
+        const auto jSpecies = Reactions(iReaction,1,ii);
+        if (jSpecies != nSpecies) {
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (auto iPoint = 0ul; iPoint < nPoints; iPoint++)
+            bkwRxn[iPoint] *= 0.001*conc[jSpecies][iPoint];
+        }
+      }
+
+      const su2double af = Tcf_a[iReaction], bf = Tcf_b[iReaction];
+      const su2double ab = Tcb_a[iReaction], bb = Tcb_b[iReaction];
+      const su2double Cf = ArrheniusCoefficient[iReaction];
+      const su2double eta = ArrheniusEta[iReaction];
+      const su2double theta = ArrheniusTheta[iReaction];
+
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+
+        /*--- Rate-controlling and modified temperatures. ---*/
+        const su2double Trxnf = exp(af*lnT[iPoint] + bf*lnTve[iPoint]);
+        const su2double Trxnb = exp(ab*lnT[iPoint] + bb*lnTve[iPoint]);
+        const su2double Thf = 0.5 * (Trxnf+T_min + sqrt((Trxnf-T_min)*(Trxnf-T_min)+epsilon*epsilon));
+        const su2double Thb = 0.5 * (Trxnb+T_min + sqrt((Trxnb-T_min)*(Trxnb-T_min)+epsilon*epsilon));
+
+        const su2double Keq = exp(A[0][iPoint]*(Thb/1E4) + A[1][iPoint] + A[2][iPoint]*log(1E4/Thb)
+                                  + A[3][iPoint]*(1E4/Thb) + A[4][iPoint]*(1E4/Thb)*(1E4/Thb));
+
+        kf[iPoint] = Cf * exp(eta*log(Thf) - theta/Thf);
+        kb[iPoint] = Cf * exp(eta*log(Thb) - theta/Thb) / Keq;
+
+        netRxn[iPoint] = 1000.0 * (kf[iPoint] * fwdRxn[iPoint] - kb[iPoint] * bkwRxn[iPoint]);
+
+        /*--- Derivatives of the rate coefficients w.r.t. T and Tve. ---*/
+        const su2double dThf = 0.5 * (1.0 + (Trxnf-T_min)/sqrt((Trxnf-T_min)*(Trxnf-T_min)+epsilon*epsilon));
+        const su2double dThb = 0.5 * (1.0 + (Trxnb-T_min)/sqrt((Trxnb-T_min)*(Trxnb-T_min)+epsilon*epsilon));
+        const su2double coeff_f = kf[iPoint] * (eta/Thf+theta/(Thf*Thf)) * dThf;
+        const su2double coeff_b = kb[iPoint] * (eta/Thb+theta/(Thb*Thb)) * dThb
+                                - kb[iPoint] * ((A[0][iPoint]*Thb/1E4 - A[2][iPoint] - A[3][iPoint]*1E4/Thb
+                                - 2*A[4][iPoint]*(1E4/Thb)*(1E4/Thb))/Thb) * dThb;
+
+        dkfdT[iPoint] = coeff_f * af*Trxnf/T[iPoint];
+        dkfdTve[iPoint] = coeff_f * bf*Trxnf/Tve[iPoint];
+        dkbdT[iPoint] = coeff_b * ab*Trxnb/T[iPoint];
+        dkbdTve[iPoint] = coeff_b * bb*Trxnb/Tve[iPoint];
+      }
+
+      for (auto ii = 0u; ii < 3; ii++) {
+        const auto iSpecies = Reactions(iReaction,1,ii);
+        if (iSpecies != nSpecies) {
+          const su2double Ms = MolarMass[iSpecies];
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (auto iPoint = 0ul; iPoint < nPoints; iPoint++)
+            ws[iSpecies][iPoint] += Ms * netRxn[iPoint];
+        }
+        const auto jSpecies = Reactions(iReaction,0,ii);
+        if (jSpecies != nSpecies) {
+          const su2double Ms = MolarMass[jSpecies];
+          SU2_OMP_SIMD_IF_NOT_AD
+          for (auto iPoint = 0ul; iPoint < nPoints; iPoint++)
+            ws[jSpecies][iPoint] -= Ms * netRxn[iPoint];
+        }
+      }
+
+      if (!jac) continue;
+
+      /*--- Stoichiometric coefficients of the reactants (alpha) and of the products (beta). ---*/
+      int alpha[NSPECIES] = {0}, beta[NSPECIES] = {0};
+      for (auto ii = 0u; ii < 3; ii++) {
+        if (Reactions(iReaction,0,ii) != nSpecies) alpha[Reactions(iReaction,0,ii)]++;
+        if (Reactions(iReaction,1,ii) != nSpecies) beta[Reactions(iReaction,1,ii)]++;
+      }
+
+      for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+        const su2double* eve = jac->eve[iPoint];
+        const su2double* cvve = jac->cvve[iPoint];
+        const su2double* dTdU = jac->dTdU[iPoint];
+        const su2double* dTvedU = jac->dTvedU[iPoint];
+        su2double** jacobian = jac->chemistry[iPoint];
+
+        /*--- Derivative of the net rate w.r.t. the conservative variables. ---*/
+        su2double dRxn[NSPECIES+5] = {0.0};
+        for (auto iSpecies = 0u; iSpecies < NSPECIES; iSpecies++) {
+          su2double dRfok = 0.0, dRbok = 0.0;
+          if (alpha[iSpecies] > 0) {
+            dRfok = alpha[iSpecies]/MolarMass[iSpecies] * intPow(0.001*conc[iSpecies][iPoint], alpha[iSpecies]-1);
+            for (auto jSpecies = 0u; jSpecies < NSPECIES; jSpecies++)
+              if (jSpecies != iSpecies) dRfok *= intPow(0.001*conc[jSpecies][iPoint], alpha[jSpecies]);
+          }
+          if (beta[iSpecies] > 0) {
+            dRbok = beta[iSpecies]/MolarMass[iSpecies] * intPow(0.001*conc[iSpecies][iPoint], beta[iSpecies]-1);
+            for (auto jSpecies = 0u; jSpecies < NSPECIES; jSpecies++)
+              if (jSpecies != iSpecies) dRbok *= intPow(0.001*conc[jSpecies][iPoint], beta[jSpecies]);
+          }
+          dRxn[iSpecies] = kf[iPoint]*dRfok - kb[iPoint]*dRbok;
+        }
+        for (auto iVar = 0u; iVar < nVar; iVar++) {
+          dRxn[iVar] += 1000.0 * ((dkfdT[iPoint]*dTdU[iVar] + dkfdTve[iPoint]*dTvedU[iVar]) * fwdRxn[iPoint] -
+                                  (dkbdT[iPoint]*dTdU[iVar] + dkbdTve[iPoint]*dTvedU[iVar]) * bkwRxn[iPoint]);
+        }
+
+        for (auto ii = 0u; ii < 3; ii++) {
+          for (auto iSide = 0u; iSide < 2; iSide++) {
+            /*--- Products are produced, reactants destroyed. ---*/
+            const auto iSpecies = Reactions(iReaction,1-iSide,ii);
+            if (iSpecies == nSpecies) continue;
+            const su2double Ms = (iSide == 0 ? 1 : -1) * MolarMass[iSpecies];
+
+            for (auto iVar = 0u; iVar < nVar; iVar++) {
+              jacobian[iSpecies][iVar] += Ms * dRxn[iVar];
+              jacobian[nEve][iVar] += Ms * (dRxn[iVar] * eve[iSpecies] + netRxn[iPoint] * cvve[iSpecies] * dTvedU[iVar]);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /*--- Landau-Teller VT exchange with Millikan & White and Park relaxation times, plus the vibrational energy
+   * change due to the reactions. Only species with vibrational modes contribute (the electron has none), but
+   * the relaxation times of all species are part of the Jacobian. ---*/
+  for (auto iSpecies = 0u; iSpecies < NSPECIES; iSpecies++) {
+    const bool vibrating = CharVibTemp[iSpecies] != 0.0 && iSpecies >= nEl;
+    if (!vibrating && !jac) continue;
+
+    const su2double Ms = MolarMass[iSpecies];
+    const su2double thetaV = CharVibTemp[iSpecies];
+    su2double denom[N], taus[N], eve_eq[N], eve[N];
+
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) denom[iPoint] = 0.0;
+
+    for (auto jSpecies = 0u; jSpecies < NSPECIES; jSpecies++) {
+      const su2double A_sr = MillikanWhite_A(iSpecies,jSpecies);
+      const su2double B_sr = MillikanWhite_B(iSpecies,jSpecies);
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+        const su2double tau_sr = 101325.0/Pressure[iPoint] * exp(A_sr*(exp(-lnT[iPoint]/3.0) - B_sr) - 18.42);
+        denom[iPoint] += conc[jSpecies][iPoint] / (conc_tot[iPoint] * tau_sr);
+      }
+    }
+
+    SU2_OMP_SIMD_IF_NOT_AD
+    for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+      const su2double tauMW = 1.0 / denom[iPoint];
+
+      const su2double Cs    = sqrt((8.0*Ru*T[iPoint])/(PI_NUMBER*Ms));
+      const su2double sig_s = 3E-21*(2.5E9)/(T[iPoint]*T[iPoint]);
+      const su2double tauP  = 1/(sig_s*Cs*conc_tot[iPoint]*AVOGAD_CONSTANT);
+
+      taus[iPoint] = tauMW + tauP;
+      eve_eq[iPoint] = 0.0;
+      eve[iPoint] = 0.0;
+    }
+
+    if (vibrating) {
+      SU2_OMP_SIMD_IF_NOT_AD
+      for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+        eve_eq[iPoint] = Ru/Ms * thetaV / (exp(thetaV/T[iPoint])-1.0);
+        eve[iPoint]    = Ru/Ms * thetaV / (exp(thetaV/Tve[iPoint])-1.0);
+
+        omega[iPoint] += rhos[iSpecies][iPoint] * (eve_eq[iPoint] - eve[iPoint]) / taus[iPoint] +
+                         ws[iSpecies][iPoint] * eve[iPoint];
+      }
+    }
+
+    if (!jac) continue;
+
+    for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+      const su2double* cvve = jac->cvve[iPoint];
+      const su2double* dTdU = jac->dTdU[iPoint];
+      const su2double* dTvedU = jac->dTvedU[iPoint];
+      su2double* jacobian = jac->relaxation[iPoint][nEve];
+
+      const su2double cvve_eq = SpeciesCvVibEle(iSpecies, T[iPoint]);
+      const su2double rhoOtau = rhos[iSpecies][iPoint] / taus[iPoint];
+
+      for (auto iVar = 0u; iVar < nVar; iVar++)
+        jacobian[iVar] += rhoOtau * (cvve_eq*dTdU[iVar] - cvve[iSpecies]*dTvedU[iVar]);
+      jacobian[iSpecies] += (eve_eq[iPoint] - jac->eve[iPoint][iSpecies]) / taus[iPoint];
+    }
+  }
+
+  for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+    val_omega[iPoint] = omega[iPoint];
+    for (auto iSpecies = 0u; iSpecies < NSPECIES; iSpecies++)
+      val_ws[iPoint*NSPECIES + iSpecies] = ws[iSpecies][iPoint];
+  }
+}
+
 void CSU2TCLib::GetEveSourceTermJacobian(const su2double *V, const su2double *eve, const su2double *cvve, const su2double *dTdU, const su2double* dTvedU, su2double **val_jacobian){
 
   unsigned short iVar;
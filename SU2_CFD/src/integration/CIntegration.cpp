@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 
 CIntegration::CIntegration() {
@@ -40,6 +41,8 @@ void CIntegration::Space_Integration(CGeometry *geometry,
                                      CConfig *config, unsigned short iMesh,
                                      unsigned short iRKStep,
                                      unsigned short RunTime_EqSystem) {
+  SU2_PROFILE_REGION("Space_Integration");
+
   unsigned short iMarker, KindBC;
 
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
@@ -48,20 +51,29 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
   /*--- Compute inviscid residuals ---*/
 
-  switch (config->GetKind_ConvNumScheme()) {
-    case SPACE_CENTERED:
-      solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
-      break;
-    case SPACE_UPWIND:
-      solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
-      break;
+  {
+    SU2_PROFILE_REGION("Convective_Residual");
+    switch (config->GetKind_ConvNumScheme()) {
+      case SPACE_CENTERED:
+        solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+        break;
+      case SPACE_UPWIND:
+        solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics, config, iMesh);
+        break;
+    }
   }
 
   /*--- Compute viscous residuals ---*/
-  solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  {
+    SU2_PROFILE_REGION("Viscous_Residual");
+    solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics, config, iMesh, iRKStep);
+  }
 
   /*--- Compute source term residuals ---*/
-  solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  {
+    SU2_PROFILE_REGION("Source_Residual");
+    solver_container[MainSolver]->Source_Residual(geometry, solver_container, numerics, config, iMesh);
+  }
 
   /*--- Add viscous and convective residuals, and compute the Dual Time Source term ---*/
 
@@ -77,6 +89,10 @@ void CIntegration::Space_Integration(CGeometry *geometry,
   /// TODO: Check if this is really needed.
   //const auto pausePreacc = (omp_get_num_threads() > 1) && AD::PausePreaccumulation();
 
+  /*--- The boundary conditions are the remainder of the space integration. ---*/
+
+  SU2_PROFILE_REGION("Boundary_Conditions");
+
   /*--- Boundary conditions that depend on other boundaries (they require MPI sincronization)---*/
 
   solver_container[MainSolver]->BC_Fluid_Interface(geometry, solver_container, conv_bound_numerics, visc_bound_numerics, config);
@@ -193,6 +209,7 @@ void CIntegration::Space_Integration(CGeometry *geometry,
 
 void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                     unsigned short iRKStep, unsigned short RunTime_EqSystem) {
+  SU2_PROFILE_REGION("Time_Integration");
 
   unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
 
@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CMultiGridIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 
 CMultiGridIntegration::CMultiGridIntegration() : CIntegration() { }
@@ -176,7 +177,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       /*--- Send-Receive boundary conditions, and preprocessing ---*/
 
-      solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
+      {
+        SU2_PROFILE_REGION("Preprocessing");
+        solver_fine->Preprocessing(geometry_fine, solver_container_fine, config, iMesh, iRKStep, RunTime_EqSystem, false);
+      }
 
 
       if (iRKStep == 0) {
@@ -207,7 +211,10 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
 
       /*--- Send-Receive boundary conditions, and postprocessing ---*/
 
-      solver_fine->Postprocessing(geometry_fine, solver_container_fine, config, iMesh);
+      {
+        SU2_PROFILE_REGION("Postprocessing");
+        solver_fine->Postprocessing(geometry_fine, solver_container_fine, config, iMesh);
+      }
 
     }
 
@@ -59,7 +59,12 @@ public:
 };
 }
 
-CNewtonIntegration::~CNewtonIntegration() { delete preconditioner; }
+CNewtonIntegration::~CNewtonIntegration() {
+  delete preconditioner;
+#ifndef CODI_FORWARD_TYPE
+  delete lowPrecPreconditioner;
+#endif
+}
 
 void CNewtonIntegration::Setup() {
 
@@ -74,6 +79,11 @@ void CNewtonIntegration::Setup() {
   fullTolResidual = dparam[2];
   finDiffStepND = SU2_TYPE::GetValue(dparam[3]);
 
+  refreshPolicy.lag = config->GetNewtonKrylovPrecondLag();
+  refreshPolicy.itersFactor = config->GetNewtonKrylovPrecondRefresh()[0];
+  refreshPolicy.residualOrders = config->GetNewtonKrylovPrecondRefresh()[1];
+  firstOrderPrecond = config->GetNewtonKrylovPrecondFirstOrder();
+
   const auto nVar = solvers[FLOW_SOL]->GetnVar();
   const auto nPoint = geometry->GetnPoint();
   const auto nPointDomain = geometry->GetnPointDomain();
@@ -100,6 +110,18 @@ void CNewtonIntegration::Setup() {
     precondOut.Initialize(nPoint, nPointDomain, nVar, nullptr);
   }
 
+#ifndef CODI_FORWARD_TYPE
+  /*--- Runtime mixed precision, unless the Jacobian is already single precision (-Denable-mixedprec). ---*/
+  lowPrecision = config->GetLinear_Solver_Mixed_Precision(MIXED_PRECISION_SOLVER::FLOW) &&
+                 !std::is_same<MixedScalar,LowScalar>::value;
+  if (lowPrecision) {
+    lowPrecJacobian.Initialize(solvers[FLOW_SOL]->Jacobian, geometry, config);
+    lowPrecPreconditioner = CPreconditioner<LowScalar>::Create(kindPrec, lowPrecJacobian, geometry, config);
+    lowPrecIn.Initialize(nPoint, nPointDomain, nVar, nullptr);
+    lowPrecOut.Initialize(nPoint, nPointDomain, nVar, nullptr);
+  }
+#endif
+
   /*--- Only possible with a preconditioner. ---*/
   startupPeriod = (startupIters > 0) || (startupResidual < 0.0);
 
@@ -120,20 +142,27 @@ void CNewtonIntegration::ComputeResiduals(ResEvalType type) {
 
   /*--- Save the default integration scheme, and force to explicit if required. ---*/
   auto TimeIntScheme = config->GetKind_TimeIntScheme();
-  if (type == ResEvalType::EXPLICIT) {
+  if (type != ResEvalType::DEFAULT) {
     SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
   }
 
   solvers[FLOW_SOL]->Preprocessing(geometry, solvers, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
 
-  if (type == ResEvalType::DEFAULT) {
+  if (type != ResEvalType::EXPLICIT) {
+    /*--- The time step does not depend on the Jacobian but it is limited differently for explicit schemes. ---*/
+    if (type == ResEvalType::NO_JACOBIAN) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(TimeIntScheme);)
+    }
     solvers[FLOW_SOL]->SetTime_Step(geometry, solvers, config, MESH_0, config->GetTimeIter());
+    if (type == ResEvalType::NO_JACOBIAN) {
+      SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
+    }
   }
 
   Space_Integration(geometry, solvers, numerics[FLOW_SOL], config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS);
 
   /*--- Restore default. ---*/
-  if (type == ResEvalType::EXPLICIT) {
+  if (type != ResEvalType::DEFAULT) {
     SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(TimeIntScheme);)
   }
 
@@ -165,6 +194,55 @@ void CNewtonIntegration::ComputeFinDiffStep() {
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
+void CNewtonIntegration::PrepareIteration() {
+
+  if (preconditioner && !refreshPolicy.refresh) {
+    /*--- Reuse the preconditioner, the Jacobian is neither assembled nor modified (explicit mode)
+     * but the right hand side of the linear system is prepared as usual. ---*/
+    ComputeResiduals(ResEvalType::NO_JACOBIAN);
+
+    const auto TimeIntScheme = config->GetKind_TimeIntScheme();
+    SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(EULER_EXPLICIT);)
+    solvers[FLOW_SOL]->PrepareImplicitIteration(geometry, solvers, config);
+    SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetKind_TimeIntScheme(TimeIntScheme);)
+    return;
+  }
+
+  if (preconditioner && firstOrderPrecond && config->GetMUSCL_Flow()) {
+    /*--- Assemble the Jacobian without reconstruction, then evaluate the true residual. ---*/
+    SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetMUSCL_Flow(false);)
+    ComputeResiduals(ResEvalType::DEFAULT);
+    SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetMUSCL_Flow(true);)
+    ComputeResiduals(ResEvalType::EXPLICIT);
+  }
+  else {
+    ComputeResiduals(ResEvalType::DEFAULT);
+  }
+
+  /*--- Compute the approximate Jacobian for preconditioning. ---*/
+
+  solvers[FLOW_SOL]->PrepareImplicitIteration(geometry, solvers, config);
+
+  if (!preconditioner) return;
+
+#ifndef CODI_FORWARD_TYPE
+  if (lowPrecision) {
+    lowPrecJacobian.PassiveCopy(solvers[FLOW_SOL]->Jacobian);
+    lowPrecPreconditioner->Build();
+    return;
+  }
+#endif
+  preconditioner->Build();
+}
+
+void CNewtonIntegration::UpdateRefreshPolicy(unsigned long linIters, su2double residual) {
+
+  /*--- During the startup period the preconditioner is the (quasi-Newton) solver, it is always refreshed. ---*/
+  if (!preconditioner || startupPeriod) return;
+
+  SU2_OMP_SAFE_GLOBAL_ACCESS(refreshPolicy.Update(linIters, config->GetLinear_Solver_Iter(), residual);)
+}
+
 void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver *****solvers_, CNumerics ******numerics_,
                                              CConfig **config_, unsigned short EqSystem, unsigned short iZone,
                                              unsigned short iInst) {
@@ -181,15 +259,9 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
 
   solvers[FLOW_SOL]->Set_OldSolution();
 
-  /*--- Current residual. ---*/
-
-  ComputeResiduals(ResEvalType::DEFAULT);
-
-  /*--- Compute the approximate Jacobian for preconditioning. ---*/
-
-  solvers[FLOW_SOL]->PrepareImplicitIteration(geometry, solvers, config);
+  /*--- Current residual, and the approximate Jacobian for preconditioning if it is refreshed. ---*/
 
-  if (preconditioner) preconditioner->Build();
+  PrepareIteration();
 
   SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto i = 0ul; i < LinSysRes.GetNElmDomain(); ++i)
@@ -231,7 +303,7 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   auto& linSysSol = GetSolutionVec(solvers[FLOW_SOL]->LinSysSol);
 
   if (startupPeriod) {
-    iter = Preconditioner_impl(LinSysRes, linSysSol, iter, eps);
+    iter = ApplyPreconditioner(LinSysRes, linSysSol, iter, eps);
   }
   else {
     ComputeFinDiffStep();
@@ -250,6 +322,8 @@ void CNewtonIntegration::MultiGrid_Iteration(CGeometry ****geometry_, CSolver **
   }
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
+  UpdateRefreshPolicy(iter, residual);
+
   /// TODO: Clever back-tracking and CFL adaptation based on residual reduction.
 
   /*--- Update solution. ---*/
@@ -323,7 +397,7 @@ void CNewtonIntegration::Preconditioner(const CSysVector<Scalar>& u, CSysVector<
 
   if (preconditioner) {
     Scalar eps = SU2_TYPE::GetValue(precondTol);
-    Preconditioner_impl(u, v, precondIters, eps);
+    ApplyPreconditioner(u, v, precondIters, eps);
   }
   else {
     /*--- Approximate diagonal preconditioner. ---*/
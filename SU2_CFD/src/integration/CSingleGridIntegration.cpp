@@ -27,6 +27,7 @@
 
 #include "../../include/integration/CSingleGridIntegration.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 
 CSingleGridIntegration::CSingleGridIntegration() : CIntegration() { }
@@ -50,8 +51,11 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 
   /*--- Preprocessing ---*/
 
-  solvers_fine[Solver_Position]->Preprocessing(geometry_fine, solvers_fine, config[iZone],
-                                               FinestMesh, 0, RunTime_EqSystem, false);
+  {
+    SU2_PROFILE_REGION("Preprocessing");
+    solvers_fine[Solver_Position]->Preprocessing(geometry_fine, solvers_fine, config[iZone],
+                                                 FinestMesh, 0, RunTime_EqSystem, false);
+  }
 
   /*--- Set the old solution ---*/
 
@@ -74,7 +78,10 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 
   /*--- Postprocessing ---*/
 
-  solvers_fine[Solver_Position]->Postprocessing(geometry_fine, solvers_fine, config[iZone], FinestMesh);
+  {
+    SU2_PROFILE_REGION("Postprocessing");
+    solvers_fine[Solver_Position]->Postprocessing(geometry_fine, solvers_fine, config[iZone], FinestMesh);
+  }
 
   if (RunTime_EqSystem == RUNTIME_HEAT_SYS) {
     SU2_OMP_SAFE_GLOBAL_ACCESS(solvers_fine[HEAT_SOL]->Heat_Fluxes(geometry_fine, solvers_fine, config[iZone]);)
@@ -27,11 +27,14 @@
 
 #include "../../include/iteration/CFluidIteration.hpp"
 #include "../../include/output/COutput.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 void CFluidIteration::Preprocess(COutput* output, CIntegration**** integration, CGeometry**** geometry,
                                  CSolver***** solver, CNumerics****** numerics, CConfig** config,
                                  CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
                                  CFreeFormDefBox*** FFDBox, unsigned short val_iZone, unsigned short val_iInst) {
+  SU2_PROFILE_REGION("Fluid_Preprocess");
+
   unsigned long TimeIter = config[val_iZone]->GetTimeIter();
 
   bool fsi = config[val_iZone]->GetFSI_Simulation();
@@ -56,6 +59,7 @@ void CFluidIteration::Iterate(COutput* output, CIntegration**** integration, CGe
                               CSolver***** solver, CNumerics****** numerics, CConfig** config,
                               CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
                               CFreeFormDefBox*** FFDBox, unsigned short val_iZone, unsigned short val_iInst) {
+  SU2_PROFILE_REGION("Fluid_Iterate");
 
   const bool unsteady = (config[val_iZone]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
                         (config[val_iZone]->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
@@ -155,6 +159,8 @@ void CFluidIteration::Update(COutput* output, CIntegration**** integration, CGeo
                              CNumerics****** numerics, CConfig** config, CSurfaceMovement** surface_movement,
                              CVolumetricMovement*** grid_movement, CFreeFormDefBox*** FFDBox, unsigned short val_iZone,
                              unsigned short val_iInst) {
+  SU2_PROFILE_REGION("Fluid_Update");
+
   unsigned short iMesh;
 
   /*--- Dual time stepping strategy ---*/
@@ -207,6 +213,8 @@ bool CFluidIteration::Monitor(COutput* output, CIntegration**** integration, CGe
                               CSolver***** solver, CNumerics****** numerics, CConfig** config,
                               CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
                               CFreeFormDefBox*** FFDBox, unsigned short val_iZone, unsigned short val_iInst) {
+  SU2_PROFILE_REGION("Fluid_Monitor");
+
   bool StopCalc = false;
 
   StopTime = SU2_MPI::Wtime();
@@ -217,8 +225,8 @@ bool CFluidIteration::Monitor(COutput* output, CIntegration**** integration, CGe
                            config[val_iZone], config[val_iZone]->GetTimeIter(), config[val_iZone]->GetOuterIter(),
                            config[val_iZone]->GetInnerIter());
 
-  /*--- If convergence was reached --*/
-  StopCalc = output->GetConvergence();
+  /*--- If convergence was reached (in benchmark mode all iterations are run) --*/
+  StopCalc = output->GetConvergence() && config[val_iZone]->GetBenchmark_Iter() == 0;
 
   /* --- Checking convergence of Fixed CL mode to target CL, and perform finite differencing if needed  --*/
 
@@ -234,6 +242,7 @@ void CFluidIteration::Postprocess(COutput* output, CIntegration**** integration,
                                   CSolver***** solver, CNumerics****** numerics, CConfig** config,
                                   CSurfaceMovement** surface_movement, CVolumetricMovement*** grid_movement,
                                   CFreeFormDefBox*** FFDBox, unsigned short val_iZone, unsigned short val_iInst) {
+  SU2_PROFILE_REGION("Fluid_Postprocess");
 
   /*--- Temporary: enable only for single-zone driver. This should be removed eventually when generalized. ---*/
   if (!config[val_iZone]->GetMultizone_Problem()) {
@@ -266,7 +275,7 @@ void CFluidIteration::Solve(COutput* output, CIntegration**** integration, CGeom
   /*--- For steady-state flow simulations, we need to loop over ExtIter for the number of time steps ---*/
   /*--- However, ExtIter is the number of FSI iterations, so nIntIter is used in this case ---*/
 
-  for (Inner_Iter = 0; Inner_Iter < nInner_Iter; Inner_Iter++) {
+  for (Inner_Iter = firstInnerIter; Inner_Iter < min(nInner_Iter, endInnerIter); Inner_Iter++) {
     config[val_iZone]->SetInnerIter(Inner_Iter);
 
     /*--- Run a single iteration of the solver ---*/
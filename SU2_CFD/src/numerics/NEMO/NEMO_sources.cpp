@@ -47,6 +47,8 @@ CSource_NEMO::CSource_NEMO(unsigned short val_nDim,
   jacobian = new su2double* [nVar];
   for(auto iVar = 0ul; iVar < nVar; ++iVar)
     jacobian[iVar] = new su2double [nVar]();
+
+  rhos.resize(nSpecies,0.0);
 }
 
 CSource_NEMO::~CSource_NEMO() {
@@ -69,9 +71,6 @@ CSource_NEMO::~CSource_NEMO() {
 CNumerics::ResidualType<> CSource_NEMO::ComputeChemistry(const CConfig *config) {
 
   /*--- Nonequilibrium chemistry ---*/
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
-
   /*--- Initialize residual and Jacobian arrays ---*/
   for (auto iVar = 0ul; iVar < nVar; iVar++)
     residual[iVar] = 0.0;
@@ -119,9 +118,6 @@ CNumerics::ResidualType<> CSource_NEMO::ComputeVibRelaxation(const CConfig *conf
   const su2double res_min = -1E6;
   const su2double res_max = 1E6;
 
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
-
   /*--- Initialize residual and Jacobian arrays ---*/
   for (auto iVar = 0ul; iVar < nVar; iVar++) {
     residual[iVar] = 0.0;
@@ -34,6 +34,7 @@
 #include "../../include/output/filewriter/CCGNSFileWriter.hpp"
 #include "../../include/output/filewriter/CSurfaceFVMDataSorter.hpp"
 #include "../../include/output/filewriter/CSurfaceFEMDataSorter.hpp"
+#include "../../include/output/filewriter/CDataSorterSnapshot.hpp"
 #include "../../include/output/filewriter/CParaviewFileWriter.hpp"
 #include "../../include/output/filewriter/CSTLFileWriter.hpp"
 #include "../../include/output/filewriter/CParaviewBinaryFileWriter.hpp"
@@ -45,6 +46,7 @@
 #include "../../include/output/filewriter/CSU2FileWriter.hpp"
 #include "../../include/output/filewriter/CSU2BinaryFileWriter.hpp"
 #include "../../include/output/filewriter/CSU2MeshFileWriter.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 
 COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
   rank(SU2_MPI::GetRank()),
@@ -170,10 +172,37 @@ COutput::COutput(const CConfig *config, unsigned short ndim, bool fem_output):
 
   headerNeeded = false;
 
+  /*--- Asynchronous output writes from a separate thread on a duplicate communicator, which requires
+   * full thread support from MPI. The AD MPI wrappers are not thread safe. ---*/
+
+  asyncOutput = config->GetAsync_Output();
+  asyncComm = SU2_MPI::GetComm();
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+  asyncOutput = false;
+#elif defined HAVE_MPI
+  if (asyncOutput) {
+    int provided = 0;
+    MPI_Query_thread(&provided);
+    if (provided < MPI_THREAD_MULTIPLE) {
+      if (rank == MASTER_NODE)
+        cout << "WARNING: ASYNC_OUTPUT requires MPI_THREAD_MULTIPLE (--thread_multiple), "
+                "the files are written synchronously." << endl;
+      asyncOutput = false;
+    } else {
+      MPI_Comm_dup(SU2_MPI::GetComm(), &asyncComm);
+    }
+  }
+#endif
+
 }
 
 COutput::~COutput() {
 
+  WaitForAsyncOutput();
+#if defined HAVE_MPI && !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+  if (asyncOutput) MPI_Comm_free(&asyncComm);
+#endif
+
   delete convergenceTable;
   delete multiZoneHeaderTable;
   delete fileWritingTable;
@@ -190,6 +219,8 @@ void COutput::SetHistoryOutput(CGeometry *geometry,
                                   unsigned long OuterIter,
                                   unsigned long InnerIter) {
 
+  SU2_PROFILE_REGION("History_Output");
+
   curTimeIter  = TimeIter;
   curAbsTimeIter = TimeIter - config->GetRestart_Iter();
   curOuterIter = OuterIter;
@@ -290,6 +321,18 @@ void COutput::SetCustomAndComboObjectives(int idxSol, const CConfig *config, CSo
   SetHistoryOutputValue("COMBO", solver[idxSol]->GetTotal_ComboObj());
 }
 
+void COutput::DeallocateDataSorters() {
+
+  WaitForAsyncOutput();
+
+  delete surfaceDataSorter;
+  surfaceDataSorter = nullptr;
+
+  delete volumeDataSorter;
+  volumeDataSorter = nullptr;
+
+}
+
 void COutput::AllocateDataSorters(CConfig *config, CGeometry *geometry){
 
   /*---- Construct a data sorter object to partition and distribute
@@ -426,6 +469,25 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
       break;
 
+    case OUTPUT_TYPE::MESH_BINARY:
+
+      extension = CSU2MeshFileWriter::fileExtBinary;
+
+      if (fileName.empty())
+        fileName = volumeFilename;
+
+      if (!config->GetWrt_Volume_Overwrite())
+        filename_iter = config->GetFilename_Iter(fileName, curInnerIter, curOuterIter);
+
+      /*--- Load and sort the output data and connectivity. ---*/
+
+      volumeDataSorter->SortConnectivity(config, geometry, true);
+
+      LogOutputFiles("SU2 binary mesh");
+      fileWriter = new CSU2MeshFileWriter(volumeDataSorter, config->GetiZone(), config->GetnZone(), true);
+
+      break;
+
     case OUTPUT_TYPE::TECPLOT_BINARY:
 
       extension = CTecplotBinaryFileWriter::fileExt;
@@ -479,7 +541,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       volumeDataSorter->SortConnectivity(config, geometry, true);
 
       LogOutputFiles("Paraview");
-      fileWriter = new CParaviewXMLFileWriter(volumeDataSorter);
+      fileWriter = new CParaviewXMLFileWriter(volumeDataSorter, config->GetOutput_Compression(false));
 
       break;
 
@@ -606,7 +668,7 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       surfaceDataSorter->SortOutputData();
 
       LogOutputFiles("Paraview surface");
-      fileWriter = new CParaviewXMLFileWriter(surfaceDataSorter);
+      fileWriter = new CParaviewXMLFileWriter(surfaceDataSorter, config->GetOutput_Compression(true));
 
       break;
 
@@ -710,6 +772,43 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
       break;
   }
 
+  if (fileWriter != nullptr && asyncOutput && fileWriter->GetDataSorter() != nullptr) {
+
+    /*--- Hand a snapshot of the sorted data to a background thread, such that the sorters can be
+     * reloaded by the solver while the files are written. Only one file is written at a time, if
+     * writing takes longer than the output interval, the solver waits here for the previous file. ---*/
+
+    auto* snapshot = new CDataSorterSnapshot(*fileWriter->GetDataSorter());
+    fileWriter->SetDataSorter(snapshot);
+    fileWriter->SetCommunicator(asyncComm);
+
+    const bool previousWrite = asyncWriter.joinable();
+    WaitForAsyncOutput(config);
+
+    /*--- The bandwidth of a background write is only known when it completes, it is reported
+     * with the next output. ---*/
+
+    if (previousWrite && config->GetWrt_Performance() && (rank == MASTER_NODE)) {
+      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+      (*fileWritingTable) << " " << "(previous: " + PrintingToolbox::to_string(asyncBandwidth) + " MB/s)";
+      fileWritingTable->SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+    }
+
+    asyncRestart = (format == OUTPUT_TYPE::RESTART_BINARY);
+    asyncWriter = std::thread([this, fileWriter, snapshot, fileName, filename_iter]() {
+      fileWriter->WriteData(fileName);
+      passivedouble BandWidth = SU2_TYPE::GetValue(fileWriter->GetBandwidth());
+      if (!filename_iter.empty()) {
+        fileWriter->WriteData(filename_iter);
+        BandWidth = (BandWidth + SU2_TYPE::GetValue(fileWriter->GetBandwidth())) / 2;
+      }
+      asyncBandwidth = BandWidth;
+      delete fileWriter;
+      delete snapshot;
+    });
+    return;
+  }
+
   if (fileWriter != nullptr) {
 
     /*--- Write data to file ---*/
@@ -745,6 +844,16 @@ void COutput::WriteToFile(CConfig *config, CGeometry *geometry, OUTPUT_TYPE form
 
 }
 
+void COutput::WaitForAsyncOutput(CConfig *config) {
+  if (!asyncWriter.joinable()) return;
+  asyncWriter.join();
+
+  if (config != nullptr && asyncRestart) {
+    config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg() + asyncBandwidth);
+  }
+  asyncRestart = false;
+}
+
 bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
   if(!cauchyTimeConverged && TimeConvergence && config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND){
     // Change flags for 2nd order Time stepping: In case of convergence, this iter and next iter gets written out. then solver stops
@@ -760,6 +869,8 @@ bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
 bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing) {
 
+  SU2_PROFILE_REGION("Result_Files");
+
   bool isFileWrite = false, dataIsLoaded = false;
   const auto nVolumeFiles = config->GetnVolumeOutputFiles();
   const auto* VolumeFiles = config->GetVolumeOutputFiles();
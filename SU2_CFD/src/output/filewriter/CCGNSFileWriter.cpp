@@ -125,7 +125,7 @@ void CCGNSFileWriter::WriteField(int iField, const string& FieldName) {
 
   if (rank != MASTER_NODE) {
     SU2_MPI::Send(sendBufferField.data(), nLocalPoints * sizeof(dataPrecision), MPI_CHAR, MASTER_NODE, 0,
-                  SU2_MPI::GetComm());
+                  comm);
     return;
   }
 
@@ -152,7 +152,7 @@ void CCGNSFileWriter::WriteField(int iField, const string& FieldName) {
     const auto recvSize = static_cast<int>(nodeEnd - nodeBegin + 1);
     recvBufferField.resize(recvSize);
 
-    SU2_MPI::Recv(recvBufferField.data(), recvSize * sizeof(dataPrecision), MPI_CHAR, i, 0, SU2_MPI::GetComm(),
+    SU2_MPI::Recv(recvBufferField.data(), recvSize * sizeof(dataPrecision), MPI_CHAR, i, 0, comm,
                   MPI_STATUS_IGNORE);
     if (recvSize <= 0) continue;
     if (isCoord) {
@@ -187,7 +187,7 @@ void CCGNSFileWriter::WriteConnectivity(GEO_TYPE type, const string& SectionName
 
   vector<unsigned long> distElem(size);
 
-  SU2_MPI::Allgather(&nLocalElem, 1, MPI_UNSIGNED_LONG, distElem.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  SU2_MPI::Allgather(&nLocalElem, 1, MPI_UNSIGNED_LONG, distElem.data(), 1, MPI_UNSIGNED_LONG, comm);
 
   firstElem = cumulative + 1;
   endElem = cumulative + static_cast<cgsize_t>(distElem[rank]);
@@ -205,7 +205,7 @@ void CCGNSFileWriter::WriteConnectivity(GEO_TYPE type, const string& SectionName
 
   const auto bufferSize = static_cast<int>(nLocalElem * nPointsElem * sizeof(cgsize_t));
   if (rank != MASTER_NODE) {
-    SU2_MPI::Send(sendBufferConnectivity.data(), bufferSize, MPI_CHAR, MASTER_NODE, 1, SU2_MPI::GetComm());
+    SU2_MPI::Send(sendBufferConnectivity.data(), bufferSize, MPI_CHAR, MASTER_NODE, 1, comm);
     return;
   }
 
@@ -223,7 +223,7 @@ void CCGNSFileWriter::WriteConnectivity(GEO_TYPE type, const string& SectionName
     recvBufferConnectivity.resize(recvSize);
 
     const auto recvByte = static_cast<int>(recvBufferConnectivity.size() * sizeof(cgsize_t));
-    SU2_MPI::Recv(recvBufferConnectivity.data(), recvByte, MPI_CHAR, i, 1, SU2_MPI::GetComm(), MPI_STATUS_IGNORE);
+    SU2_MPI::Recv(recvBufferConnectivity.data(), recvByte, MPI_CHAR, i, 1, comm, MPI_STATUS_IGNORE);
 
     if (!recvBufferConnectivity.empty())
       CallCGNS(cg_elements_partial_write(cgnsFileID, cgnsBase, cgnsZone, cgnsSection, firstElem, endElem,
@@ -0,0 +1,53 @@
+/*!
+ * \file CDataSorterSnapshot.cpp
+ * \brief Snapshot of a data sorter for asynchronous output.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../../include/output/filewriter/CDataSorterSnapshot.hpp"
+#include <algorithm>
+
+CDataSorterSnapshot::CDataSorterSnapshot(const CParallelDataSorter& sorter) : CParallelDataSorter(sorter) {
+
+  globalIndex.resize(nPoints);
+  for (unsigned long iPoint = 0; iPoint < nPoints; iPoint++) {
+    globalIndex[iPoint] = sorter.GetGlobalIndex(iPoint);
+  }
+
+  nodeBegin.resize(size);
+  nPointCumulative.resize(size+1);
+  for (int iRank = 0; iRank < size; iRank++) {
+    nodeBegin[iRank] = sorter.GetNodeBegin(iRank);
+    nPointCumulative[iRank] = sorter.GetnPointCumulative(iRank);
+  }
+  nPointCumulative[size] = sorter.GetnPointCumulative(size);
+
+}
+
+unsigned short CDataSorterSnapshot::FindProcessor(unsigned long iPoint) const {
+
+  /*--- The last rank whose partition begins at or before the point. ---*/
+
+  const auto it = upper_bound(nodeBegin.begin() + 1, nodeBegin.end(), iPoint);
+  return static_cast<unsigned short>(it - nodeBegin.begin() - 1);
+}
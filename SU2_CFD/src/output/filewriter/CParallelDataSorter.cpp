@@ -28,6 +28,7 @@
 #include "../../../include/output/filewriter/CParallelDataSorter.hpp"
 #include <cassert>
 #include <numeric>
+#include <algorithm>
 
 CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &valFieldNames) :
   rank(SU2_MPI::GetRank()),
@@ -66,6 +67,70 @@ CParallelDataSorter::CParallelDataSorter(CConfig *config, const vector<string> &
 
 }
 
+CParallelDataSorter::CParallelDataSorter(const CParallelDataSorter& other) :
+  rank(other.rank),
+  size(other.size),
+  nGlobalPointBeforeSort(other.nGlobalPointBeforeSort),
+  nLocalPointsBeforeSort(other.nLocalPointsBeforeSort),
+  nElemPerTypeGlobal(other.nElemPerTypeGlobal),
+  nElemPerType(other.nElemPerType),
+  nPointsGlobal(other.nPointsGlobal),
+  nElemGlobal(other.nElemGlobal),
+  nConnGlobal(other.nConnGlobal),
+  nPoints(other.nPoints),
+  nElem(other.nElem),
+  nConn(other.nConn),
+  linearPartitioner(other.linearPartitioner),
+  GlobalField_Counter(other.GlobalField_Counter),
+  connectivitySorted(other.connectivitySorted),
+  fieldNames(other.fieldNames),
+  nDim(other.nDim) {
+
+  auto copyArray = [](const int* src, unsigned long n) -> int* {
+    if (src == nullptr) return nullptr;
+    auto* dst = new int[n];
+    std::copy(src, src + n, dst);
+    return dst;
+  };
+
+  nPoint_Send = copyArray(other.nPoint_Send, size+1);
+  nPoint_Recv = copyArray(other.nPoint_Recv, size+1);
+  nElem_Send = copyArray(other.nElem_Send, size+1);
+  nElem_Cum = copyArray(other.nElem_Cum, size+1);
+  nElemConn_Send = copyArray(other.nElemConn_Send, size+1);
+  nElemConn_Cum = copyArray(other.nElemConn_Cum, size+1);
+
+  /*--- The connectivity arrays hold nElemPerType elements of each type. ---*/
+
+  auto copyConn = [&](const int* src, unsigned short type, unsigned short nNodes) {
+    return copyArray(src, nElemPerType[TypeMap.at(type)] * nNodes);
+  };
+
+  Conn_Line_Par = copyConn(other.Conn_Line_Par, LINE, N_POINTS_LINE);
+  Conn_Tria_Par = copyConn(other.Conn_Tria_Par, TRIANGLE, N_POINTS_TRIANGLE);
+  Conn_Quad_Par = copyConn(other.Conn_Quad_Par, QUADRILATERAL, N_POINTS_QUADRILATERAL);
+  Conn_Tetr_Par = copyConn(other.Conn_Tetr_Par, TETRAHEDRON, N_POINTS_TETRAHEDRON);
+  Conn_Hexa_Par = copyConn(other.Conn_Hexa_Par, HEXAHEDRON, N_POINTS_HEXAHEDRON);
+  Conn_Pris_Par = copyConn(other.Conn_Pris_Par, PRISM, N_POINTS_PRISM);
+  Conn_Pyra_Par = copyConn(other.Conn_Pyra_Par, PYRAMID, N_POINTS_PYRAMID);
+
+  dataBuffer = nullptr;
+  if (other.dataBuffer != nullptr) {
+    const auto nData = nPoints * GlobalField_Counter;
+    dataBuffer = new passivedouble[nData];
+    std::copy(other.dataBuffer, other.dataBuffer + nData, dataBuffer);
+  }
+
+  /*--- A copy can only be written, it cannot sort new data. ---*/
+
+  Index    = nullptr;
+  connSend = nullptr;
+  idSend   = nullptr;
+  nSends = 0;
+  nRecvs = 0;
+
+}
+
 CParallelDataSorter::~CParallelDataSorter(){
 
   delete [] nPoint_Send;
@@ -31,7 +31,8 @@
 
 CFileWriter::CFileWriter(CParallelDataSorter *valDataSorter, string valFileExt):
   fileExt(std::move(valFileExt)),
-  dataSorter(valDataSorter){
+  dataSorter(valDataSorter),
+  comm(SU2_MPI::GetComm()){
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
@@ -42,7 +43,9 @@ CFileWriter::CFileWriter(CParallelDataSorter *valDataSorter, string valFileExt):
 }
 
 CFileWriter::CFileWriter(string valFileExt):
-  fileExt(std::move(valFileExt)){
+  fileExt(std::move(valFileExt)),
+  dataSorter(nullptr),
+  comm(SU2_MPI::GetComm()){
 
   rank = SU2_MPI::GetRank();
   size = SU2_MPI::GetSize();
@@ -212,14 +215,14 @@ bool CFileWriter::OpenMPIFile(string val_filename){
    to write a fresh output file, so we delete any existing files and create
    a new one. ---*/
 
-  ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(),
+  ierr = MPI_File_open(comm, val_filename.c_str(),
                        MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                        MPI_INFO_NULL, &fhw);
   if (ierr != MPI_SUCCESS)  {
     MPI_File_close(&fhw);
     if (rank == 0)
       MPI_File_delete(val_filename.c_str(), MPI_INFO_NULL);
-    ierr = MPI_File_open(SU2_MPI::GetComm(), val_filename.c_str(),
+    ierr = MPI_File_open(comm, val_filename.c_str(),
                          MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
                          MPI_INFO_NULL, &fhw);
   }
@@ -260,7 +263,7 @@ bool CFileWriter::CloseMPIFile(){
 
   su2double my_fileSize = fileSize;
   SU2_MPI::Allreduce(&my_fileSize, &fileSize, 1,
-                     MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+                     MPI_DOUBLE, MPI_SUM, comm);
 
   /*--- Compute and store the bandwidth ---*/
 
@@ -79,7 +79,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
   Paraview_File.close();
 
 #ifdef HAVE_MPI
-  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  SU2_MPI::Barrier(comm);
 #endif
 
   /*--- Each processor opens the file. ---*/
@@ -103,7 +103,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
 
     Paraview_File.flush();
 #ifdef HAVE_MPI
-    SU2_MPI::Barrier(SU2_MPI::GetComm());
+    SU2_MPI::Barrier(comm);
 #endif
   }
 
@@ -128,7 +128,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
 
   Paraview_File.flush();
 #ifdef HAVE_MPI
-  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  SU2_MPI::Barrier(comm);
 #endif
 
   /*--- Write connectivity data. ---*/
@@ -200,7 +200,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
 
     }    Paraview_File.flush();
 #ifdef HAVE_MPI
-    SU2_MPI::Barrier(SU2_MPI::GetComm());
+    SU2_MPI::Barrier(comm);
 #endif
   }
 
@@ -213,7 +213,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
 
   Paraview_File.flush();
 #ifdef HAVE_MPI
-  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  SU2_MPI::Barrier(comm);
 #endif
 
   for (iProcessor = 0; iProcessor < size; iProcessor++) {
@@ -228,7 +228,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
     }
     Paraview_File.flush();
 #ifdef HAVE_MPI
-    SU2_MPI::Barrier(SU2_MPI::GetComm());
+    SU2_MPI::Barrier(comm);
 #endif
   }
 
@@ -240,7 +240,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
 
   Paraview_File.flush();
 #ifdef HAVE_MPI
-  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  SU2_MPI::Barrier(comm);
 #endif
 
   unsigned short varStart = 2;
@@ -267,7 +267,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
       //skip
       Paraview_File.flush();
 #ifdef HAVE_MPI
-      SU2_MPI::Barrier(SU2_MPI::GetComm());
+      SU2_MPI::Barrier(comm);
 #endif
       VarCounter++;
     }
@@ -277,7 +277,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
       //skip
       Paraview_File.flush();
 #ifdef HAVE_MPI
-      SU2_MPI::Barrier(SU2_MPI::GetComm());
+      SU2_MPI::Barrier(comm);
 #endif
       VarCounter++;
     }
@@ -292,7 +292,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
 
       Paraview_File.flush();
 #ifdef HAVE_MPI
-      SU2_MPI::Barrier(SU2_MPI::GetComm());
+      SU2_MPI::Barrier(comm);
 #endif
 
       /*--- Write surface and volumetric point coordinates. ---*/
@@ -311,7 +311,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
 
         Paraview_File.flush();
 #ifdef HAVE_MPI
-        SU2_MPI::Barrier(SU2_MPI::GetComm());
+        SU2_MPI::Barrier(comm);
 #endif
       }
 
@@ -327,7 +327,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
 
       Paraview_File.flush();
 #ifdef HAVE_MPI
-      SU2_MPI::Barrier(SU2_MPI::GetComm());
+      SU2_MPI::Barrier(comm);
 #endif
 
       /*--- Write surface and volumetric point coordinates. ---*/
@@ -344,7 +344,7 @@ void CParaviewFileWriter::WriteData(string val_filename){
         }
         Paraview_File.flush();
 #ifdef HAVE_MPI
-        SU2_MPI::Barrier(SU2_MPI::GetComm());
+        SU2_MPI::Barrier(comm);
 #endif
       }
 
@@ -27,11 +27,19 @@
 
 #include "../../../include/output/filewriter/CParaviewXMLFileWriter.hpp"
 #include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../../Common/include/parallelization/omp_structure.hpp"
+#include <algorithm>
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HAVE_LZ4
+#include <lz4.h>
+#endif
 
 const string CParaviewXMLFileWriter::fileExt = ".vtu";
 
-CParaviewXMLFileWriter::CParaviewXMLFileWriter(CParallelDataSorter *valDataSorter) :
-  CFileWriter(valDataSorter, fileExt){
+CParaviewXMLFileWriter::CParaviewXMLFileWriter(CParallelDataSorter *valDataSorter, VTU_COMPRESSION valCompression) :
+  CFileWriter(valDataSorter, fileExt), compression(valCompression){
 
   /* Check for big endian. We have to swap bytes otherwise.
    * Since size of character is 1 byte when the character pointer
@@ -56,19 +64,23 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
 
   const int NCOORDS = 3;
   const unsigned short nDim = dataSorter->GetnDim();
-  unsigned short iDim = 0;
 
   /*--- Array containing the field names we want to output ---*/
 
   const vector<string>& fieldNames = dataSorter->GetFieldNames();
 
-  unsigned long iPoint, iElem;
-
   char str_buf[255];
 
   OpenMPIFile(val_filename);
 
   dataOffset = 0;
+  nDataArrays = 0;
+
+  /*--- The size of compressed arrays, and therefore their offset in the appended data, is only known
+   after compression. The arrays are compressed before writing the header and written afterwards. ---*/
+
+  compressedArrays.clear();
+  if (compression != VTU_COMPRESSION::NONE) LoadDataArrays();
 
   /*--- Communicate the number of total points that will be
    written by each rank. After this communication, each proc knows how
@@ -85,14 +97,6 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
 
   unsigned long myElem, myElemStorage, GlobalElem, GlobalElemStorage;
 
-  unsigned long nParallel_Line = dataSorter->GetnElem(LINE),
-                nParallel_Tria = dataSorter->GetnElem(TRIANGLE),
-                nParallel_Quad = dataSorter->GetnElem(QUADRILATERAL),
-                nParallel_Tetr = dataSorter->GetnElem(TETRAHEDRON),
-                nParallel_Hexa = dataSorter->GetnElem(HEXAHEDRON),
-                nParallel_Pris = dataSorter->GetnElem(PRISM),
-                nParallel_Pyra = dataSorter->GetnElem(PYRAMID);
-
   myElem            = dataSorter->GetnElem();
   myElemStorage     = dataSorter->GetnConn();
   GlobalElem        = dataSorter->GetnElemGlobal();
@@ -102,10 +106,14 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
   * which means that all data is appended at the end of the file in one binary blob.
   */
 
+  string compressor;
+  if (compression == VTU_COMPRESSION::ZLIB) compressor = " compressor=\"vtkZLibDataCompressor\"";
+  if (compression == VTU_COMPRESSION::LZ4) compressor = " compressor=\"vtkLZ4DataCompressor\"";
+
   if (!bigEndian){
-    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\">\n", MASTER_NODE);
+    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"LittleEndian\" header_type=\"UInt64\"" + compressor + ">\n", MASTER_NODE);
   } else {
-    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"BigEndian\" header_type=\"UInt64\">\n", MASTER_NODE);
+    WriteMPIString("<VTKFile type=\"UnstructuredGrid\" version=\"1.0\" byte_order=\"BigEndian\" header_type=\"UInt64\"" + compressor + ">\n", MASTER_NODE);
   }
 
   WriteMPIString("<UnstructuredGrid>\n", MASTER_NODE);
@@ -185,6 +193,62 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
 
   WriteMPIString("<AppendedData encoding=\"raw\">\n_", MASTER_NODE);
 
+  if (compression == VTU_COMPRESSION::NONE) {
+    LoadDataArrays();
+  } else {
+    for (const auto& array : compressedArrays) {
+      if (!WriteMPIBinaryData(array.header.data(), array.headerBytes, MASTER_NODE)){
+        SU2_MPI::Error("Writing array header failed", CURRENT_FUNCTION);
+      }
+      if (!WriteMPIBinaryDataAll(array.payload.data(), array.payload.size(), array.totalBytes, array.offset)){
+        SU2_MPI::Error("Writing data array failed", CURRENT_FUNCTION);
+      }
+    }
+    compressedArrays.clear();
+  }
+
+  WriteMPIString("</AppendedData>\n", MASTER_NODE);
+  WriteMPIString("</VTKFile>\n", MASTER_NODE);
+
+  CloseMPIFile();
+
+}
+
+void CParaviewXMLFileWriter::LoadDataArrays(){
+
+  /*--- We always have 3 coords, independent of the actual value of nDim ---*/
+
+  const int NCOORDS = 3;
+  const unsigned short nDim = dataSorter->GetnDim();
+  unsigned short iDim = 0;
+
+  const vector<string>& fieldNames = dataSorter->GetFieldNames();
+
+  unsigned long iPoint, iElem;
+
+  const unsigned long GlobalPoint = dataSorter->GetnPointsGlobal();
+  const unsigned long myPoint     = dataSorter->GetnPoints();
+
+  const unsigned long nParallel_Line = dataSorter->GetnElem(LINE),
+                      nParallel_Tria = dataSorter->GetnElem(TRIANGLE),
+                      nParallel_Quad = dataSorter->GetnElem(QUADRILATERAL),
+                      nParallel_Tetr = dataSorter->GetnElem(TETRAHEDRON),
+                      nParallel_Hexa = dataSorter->GetnElem(HEXAHEDRON),
+                      nParallel_Pris = dataSorter->GetnElem(PRISM),
+                      nParallel_Pyra = dataSorter->GetnElem(PYRAMID);
+
+  const unsigned long myElem            = dataSorter->GetnElem();
+  const unsigned long myElemStorage     = dataSorter->GetnConn();
+  const unsigned long GlobalElem        = dataSorter->GetnElemGlobal();
+  const unsigned long GlobalElemStorage = dataSorter->GetnConnGlobal();
+
+  /*--- Adjust container start location to avoid point coords. ---*/
+
+  unsigned short varStart = 2;
+  if (nDim == 3) varStart++;
+
+  unsigned short iField, VarCounter = varStart;
+
   /*--- Load/write the 1D buffer of point coordinates. Note that we
    always have 3 coordinate dimensions, even for 2D problems. ---*/
 
@@ -249,7 +313,6 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
 
   /*--- Loop over all variables that have been registered in the output. ---*/
 
-  VarCounter = varStart;
   for (iField = varStart; iField < fieldNames.size(); iField++) {
 
     /*--- Check whether this field is a vector or scalar. ---*/
@@ -315,11 +378,6 @@ void CParaviewXMLFileWriter::WriteData(string val_filename){
 
   }
 
-  WriteMPIString("</AppendedData>\n", MASTER_NODE);
-  WriteMPIString("</VTKFile>\n", MASTER_NODE);
-
-  CloseMPIFile();
-
 }
 
 void CParaviewXMLFileWriter::WriteDataArray(void* data, VTKDatatype type, unsigned long arraySize,
@@ -337,6 +395,11 @@ void CParaviewXMLFileWriter::WriteDataArray(void* data, VTKDatatype type, unsign
   /*--- The total data size ---*/
   size_t totalByteSize = globalSize*typeSize;
 
+  if (compression != VTU_COMPRESSION::NONE) {
+    compressedArrays.push_back(CompressDataArray(data, byteSize, totalByteSize, offset*typeSize));
+    return;
+  }
+
   /*--- Only the master node writes the total size in bytes as unsigned long in front of the array data ---*/
 
   if (!WriteMPIBinaryData(&totalByteSize, sizeof(size_t), MASTER_NODE)){
@@ -383,6 +446,150 @@ void CParaviewXMLFileWriter::AddDataArray(VTKDatatype type, string name,
                  string(" offset=") + offsetStr +
                  string(" format=\"appended\"/>\n"), MASTER_NODE);
 
-  dataOffset += totalByteSize + sizeof(size_t);
+  if (compression == VTU_COMPRESSION::NONE) {
+    dataOffset += totalByteSize + sizeof(size_t);
+  } else {
+    const auto& array = compressedArrays[nDataArrays];
+    dataOffset += array.headerBytes + array.totalBytes;
+  }
+  nDataArrays++;
+
+}
+
+CParaviewXMLFileWriter::CompressedArray CParaviewXMLFileWriter::CompressDataArray(const void* data,
+                                                                                  unsigned long byteSize,
+                                                                                  unsigned long totalByteSize,
+                                                                                  unsigned long byteOffset) const {
+  const unsigned long blockSize = compressionBlockSize;
+  const auto* bytes = static_cast<const char*>(data);
+
+  /*--- Displacement of the part of each rank in the global array. ---*/
+
+  vector<unsigned long> rankBegin(size+1);
+  SU2_MPI::Allgather(&byteOffset, 1, MPI_UNSIGNED_LONG, rankBegin.data(), 1, MPI_UNSIGNED_LONG, comm);
+  rankBegin[size] = totalByteSize;
+
+  /*--- The block starting at a byte is compressed by the last rank whose part begins at or before it,
+   ranks without data share the displacement of the next rank and are thereby skipped. ---*/
+
+  auto blockOwner = [&](unsigned long pos) {
+    return static_cast<int>(upper_bound(rankBegin.begin(), rankBegin.end()-1, pos) - rankBegin.begin()) - 1;
+  };
+
+  /*--- Bytes before the first block boundary of this rank complete a block started on a previous rank. ---*/
+
+  const unsigned long headBytes = min(nextMultiple(byteOffset, blockSize), byteOffset + byteSize) - byteOffset;
+  const unsigned long ownBytes = byteSize - headBytes;
+
+  vector<int> sendCounts(size, 0), sendDispl(size, 0), recvCounts(size, 0), recvDispl(size, 0);
+  if (headBytes > 0) sendCounts[blockOwner(byteOffset - byteOffset % blockSize)] = static_cast<int>(headBytes);
+
+  SU2_MPI::Alltoall(sendCounts.data(), 1, MPI_INT, recvCounts.data(), 1, MPI_INT, comm);
+
+  /*--- Fragments from the next ranks are appended in rank order, after which the local buffer
+   is a contiguous part of the global array that begins and ends on block boundaries. ---*/
+
+  unsigned long nRecv = 0;
+  for (int iRank = 0; iRank < size; iRank++) {
+    recvDispl[iRank] = static_cast<int>(ownBytes + nRecv);
+    nRecv += recvCounts[iRank];
+  }
+
+  vector<char> localBytes(ownBytes + nRecv);
+  if (ownBytes > 0) copy(bytes + headBytes, bytes + byteSize, localBytes.begin());
 
+  SU2_MPI::Alltoallv(bytes, sendCounts.data(), sendDispl.data(), MPI_CHAR,
+                     localBytes.data(), recvCounts.data(), recvDispl.data(), MPI_CHAR, comm);
+
+  /*--- Compress the blocks owned by this rank. ---*/
+
+  const unsigned long nBlocks = roundUpDiv(localBytes.size(), blockSize);
+  vector<vector<char> > blocks(nBlocks);
+
+  SU2_OMP_PARALLEL_(for schedule(dynamic,1))
+  for (unsigned long iBlock = 0; iBlock < nBlocks; iBlock++) {
+    const unsigned long begin = iBlock * blockSize;
+    CompressBlock(localBytes.data() + begin, min(blockSize, localBytes.size() - begin), blocks[iBlock]);
+  }
+  END_SU2_OMP_PARALLEL
+
+  CompressedArray array;
+  vector<unsigned long> blockBytes(nBlocks);
+  for (unsigned long iBlock = 0; iBlock < nBlocks; iBlock++) {
+    blockBytes[iBlock] = blocks[iBlock].size();
+    array.payload.insert(array.payload.end(), blocks[iBlock].begin(), blocks[iBlock].end());
+  }
+
+  /*--- Displacement of the compressed blocks of this rank and total compressed size. ---*/
+
+  unsigned long myBytes = array.payload.size();
+  vector<unsigned long> rankBytes(size);
+  SU2_MPI::Allgather(&myBytes, 1, MPI_UNSIGNED_LONG, rankBytes.data(), 1, MPI_UNSIGNED_LONG, comm);
+
+  array.offset = 0;
+  for (int iRank = 0; iRank < rank; iRank++) array.offset += rankBytes[iRank];
+  array.totalBytes = array.offset;
+  for (int iRank = rank; iRank < size; iRank++) array.totalBytes += rankBytes[iRank];
+
+  /*--- The header of a compressed array contains the number of blocks, the uncompressed size of the
+   blocks, the size of the last partial block (0 if the last block is complete), and the compressed
+   size of each block. The master node receives the sizes of the blocks owned by the other ranks. ---*/
+
+  const unsigned long nBlocksGlobal = roundUpDiv(totalByteSize, blockSize);
+  array.headerBytes = (3 + nBlocksGlobal) * sizeof(unsigned long);
+
+  if (rank != MASTER_NODE) {
+    if (nBlocks > 0)
+      SU2_MPI::Send(blockBytes.data(), static_cast<int>(nBlocks), MPI_UNSIGNED_LONG, MASTER_NODE, 0, comm);
+    return array;
+  }
+
+  array.header.resize(3 + nBlocksGlobal);
+  array.header[0] = nBlocksGlobal;
+  array.header[1] = blockSize;
+  array.header[2] = totalByteSize % blockSize;
+  copy(blockBytes.begin(), blockBytes.end(), array.header.begin() + 3);
+
+  unsigned long iBlockGlobal = nBlocks;
+  for (int iRank = 0; iRank < size; iRank++) {
+    if (iRank == MASTER_NODE) continue;
+    const auto nRankBlocks = roundUpDiv(rankBegin[iRank+1], blockSize) - roundUpDiv(rankBegin[iRank], blockSize);
+    if (nRankBlocks == 0) continue;
+    SU2_MPI::Recv(array.header.data() + 3 + iBlockGlobal, static_cast<int>(nRankBlocks), MPI_UNSIGNED_LONG,
+                  iRank, 0, comm, MPI_STATUS_IGNORE);
+    iBlockGlobal += nRankBlocks;
+  }
+
+  return array;
+}
+
+void CParaviewXMLFileWriter::CompressBlock(const char* data, unsigned long byteSize, vector<char>& compressed) const {
+
+  switch (compression) {
+    case VTU_COMPRESSION::ZLIB: {
+#ifdef HAVE_ZLIB
+      /*--- The fastest level, the aim is to reduce the time spent writing the file. ---*/
+      uLongf compressedSize = compressBound(byteSize);
+      compressed.resize(compressedSize);
+      const int ierr = compress2(reinterpret_cast<Bytef*>(compressed.data()), &compressedSize,
+                                 reinterpret_cast<const Bytef*>(data), byteSize, Z_BEST_SPEED);
+      if (ierr != Z_OK) SU2_MPI::Error("zlib compression of a data block failed.", CURRENT_FUNCTION);
+      compressed.resize(compressedSize);
+#endif
+      break;
+    }
+    case VTU_COMPRESSION::LZ4: {
+#ifdef HAVE_LZ4
+      compressed.resize(LZ4_compressBound(static_cast<int>(byteSize)));
+      const int compressedSize = LZ4_compress_default(data, compressed.data(), static_cast<int>(byteSize),
+                                                      static_cast<int>(compressed.size()));
+      if (compressedSize <= 0) SU2_MPI::Error("LZ4 compression of a data block failed.", CURRENT_FUNCTION);
+      compressed.resize(compressedSize);
+#endif
+      break;
+    }
+    default:
+      compressed.assign(data, data + byteSize);
+      break;
+  }
 }
@@ -78,7 +78,7 @@ void CSU2FileWriter::WriteData(string val_filename){
 
     /*--- Wait for iProcessor to finish and close the file. ---*/
 
-    SU2_MPI::Barrier(SU2_MPI::GetComm());
+    SU2_MPI::Barrier(comm);
   }
 
   /*--- Compute and store the write time. ---*/
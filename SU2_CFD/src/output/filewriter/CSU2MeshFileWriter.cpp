@@ -27,15 +27,23 @@
 
 #include "../../../include/output/filewriter/CSU2MeshFileWriter.hpp"
 #include "../../../../Common/include/toolboxes/printing_toolbox.hpp"
+#include "../../../../Common/include/geometry/meshreader/CSU2BinaryMeshReaderFVM.hpp"
 
 const string CSU2MeshFileWriter::fileExt = ".su2";
+const string CSU2MeshFileWriter::fileExtBinary = ".su2b";
 
 CSU2MeshFileWriter::CSU2MeshFileWriter(CParallelDataSorter *valDataSorter,
-                                       unsigned short valiZone, unsigned short valnZone) :
-   CFileWriter(valDataSorter, fileExt), iZone(valiZone), nZone(valnZone) {}
+                                       unsigned short valiZone, unsigned short valnZone, bool valBinary) :
+   CFileWriter(valDataSorter, valBinary ? fileExtBinary : fileExt), iZone(valiZone), nZone(valnZone),
+   binary(valBinary) {}
 
 void CSU2MeshFileWriter::WriteData(string val_filename) {
 
+  if (binary) {
+    WriteDataBinary(val_filename);
+    return;
+  }
+
   ofstream output_file;
 
   /*--- We append the pre-defined suffix (extension) to the filename (prefix) ---*/
@@ -117,7 +125,7 @@ void CSU2MeshFileWriter::WriteData(string val_filename) {
     }
 
     /*--- Communicate offset, implies a barrier. ---*/
-    SU2_MPI::Allreduce(&nElem, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    SU2_MPI::Allreduce(&nElem, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
   }
 
   /*--- Write the node coordinates. ---*/
@@ -153,7 +161,7 @@ void CSU2MeshFileWriter::WriteData(string val_filename) {
     }
 
     /*--- Communicate offset, implies a barrier. ---*/
-    SU2_MPI::Allreduce(&myPoint, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    SU2_MPI::Allreduce(&myPoint, &offset, 1, MPI_UNSIGNED_LONG, MPI_SUM, comm);
   }
 
   if (rank == MASTER_NODE) {
@@ -251,5 +259,147 @@ void CSU2MeshFileWriter::WriteData(string val_filename) {
     output_file.close();
   }
 
-  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  SU2_MPI::Barrier(comm);
+}
+
+void CSU2MeshFileWriter::WriteDataBinary(const string& val_filename) {
+
+  if (nZone > 1) {
+    SU2_MPI::Error("The SU2 binary mesh format contains a single zone, use the ASCII format for multizone meshes.",
+                   CURRENT_FUNCTION);
+  }
+
+  constexpr auto VolumeElemSize = CSU2BinaryMeshReaderFVM::VolumeElemSize;
+  constexpr auto SurfaceElemSize = CSU2BinaryMeshReaderFVM::SurfaceElemSize;
+
+  const unsigned long nDim = dataSorter->GetnDim();
+  const unsigned long nPoint = dataSorter->GetnPoints();
+  const unsigned long nElem = dataSorter->GetnElem();
+
+  /*--- The master reads the markers, they are the last blocks of the file. ---*/
+
+  vector<char> names;
+  vector<unsigned long> nElemMarker, connMarkers;
+
+  if (rank == MASTER_NODE) ReadBoundaryFile(names, nElemMarker, connMarkers);
+
+  /*--- Header, see CSU2BinaryMeshReaderFVM for the layout of the file. ---*/
+
+  const unsigned long header[CSU2BinaryMeshReaderFVM::HeaderSize] = {
+    static_cast<unsigned long>(SU2_MESH_BINARY_MAGIC), nDim, dataSorter->GetnPointsGlobal(),
+    dataSorter->GetnElemGlobal(), nElemMarker.size(), connMarkers.size() / SurfaceElemSize};
+
+  OpenMPIFile(val_filename);
+
+  WriteMPIBinaryData(header, sizeof(header), MASTER_NODE);
+
+  /*--- Node coordinates, which are the first fields of the sorted data. ---*/
+
+  vector<passivedouble> coords(nPoint * nDim);
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++)
+    for (auto iDim = 0ul; iDim < nDim; iDim++)
+      coords[iPoint * nDim + iDim] = dataSorter->GetData(iDim, iPoint);
+
+  const unsigned long bytesPerPoint = nDim * sizeof(passivedouble);
+
+  WriteMPIBinaryDataAll(coords.data(), nPoint * bytesPerPoint, dataSorter->GetnPointsGlobal() * bytesPerPoint,
+                        dataSorter->GetnPointCumulative(rank) * bytesPerPoint);
+
+  vector<passivedouble>().swap(coords);
+
+  /*--- Volume elements, numbered in the same order as in the ASCII format. ---*/
+
+  vector<unsigned long> conn(nElem * VolumeElemSize, 0);
+  auto* elemConn = conn.data();
+
+  for (auto type : {TRIANGLE, QUADRILATERAL, TETRAHEDRON, HEXAHEDRON, PRISM, PYRAMID}) {
+    const auto nNodes = nPointsOfElementType(type);
+    for (auto iElem = 0ul; iElem < dataSorter->GetnElem(type); iElem++) {
+      elemConn[0] = type;
+      for (auto iNode = 0u; iNode < nNodes; ++iNode)
+        elemConn[1 + iNode] = dataSorter->GetElemConnectivity(type, iElem, iNode) - 1;
+      elemConn += VolumeElemSize;
+    }
+  }
+
+  const unsigned long bytesPerElem = VolumeElemSize * sizeof(unsigned long);
+
+  WriteMPIBinaryDataAll(conn.data(), nElem * bytesPerElem, dataSorter->GetnElemGlobal() * bytesPerElem,
+                        dataSorter->GetnElemCumulative(rank) * bytesPerElem);
+
+  /*--- Markers. ---*/
+
+  WriteMPIBinaryData(names.data(), names.size(), MASTER_NODE);
+  WriteMPIBinaryData(nElemMarker.data(), nElemMarker.size() * sizeof(unsigned long), MASTER_NODE);
+  WriteMPIBinaryData(connMarkers.data(), connMarkers.size() * sizeof(unsigned long), MASTER_NODE);
+
+  CloseMPIFile();
+}
+
+void CSU2MeshFileWriter::ReadBoundaryFile(vector<char>& names, vector<unsigned long>& nElemMarker,
+                                          vector<unsigned long>& conn) const {
+
+  string str = "boundary";
+  if (nZone > 1) str += "_" + PrintingToolbox::to_string(iZone);
+  str += ".dat";
+
+  ifstream input_file(str);
+
+  if (!input_file.is_open()) {
+    SU2_MPI::Error(string("Cannot find ") + str, CURRENT_FUNCTION);
+  }
+
+  string text_line;
+  while (getline(input_file, text_line)) {
+
+    if (text_line.find("NMARK=",0) == string::npos) continue;
+
+    text_line.erase(0,6);
+    const unsigned long nMarker = atoi(text_line.c_str());
+
+    names.assign(nMarker * CGNS_STRING_SIZE, '\0');
+    nElemMarker.assign(nMarker, 0);
+
+    for (auto iMarker = 0ul; iMarker < nMarker; iMarker++) {
+
+      /*--- Tag, number of elements, and the SEND_TO line which is not used. ---*/
+
+      string keyword, Marker_Tag;
+      getline(input_file, text_line);
+      istringstream(text_line) >> keyword >> Marker_Tag;
+
+      if (Marker_Tag.size() >= static_cast<size_t>(CGNS_STRING_SIZE)) {
+        SU2_MPI::Error("Marker " + Marker_Tag + " has too many characters for the SU2 binary mesh format.",
+                       CURRENT_FUNCTION);
+      }
+      copy(Marker_Tag.begin(), Marker_Tag.end(), &names[iMarker * CGNS_STRING_SIZE]);
+
+      getline(input_file, text_line);
+      text_line.erase(0,13);
+      nElemMarker[iMarker] = atol(text_line.c_str());
+
+      getline(input_file, text_line);
+
+      for (auto iElem = 0ul; iElem < nElemMarker[iMarker]; iElem++) {
+
+        getline(input_file, text_line);
+        istringstream bound_line(text_line);
+
+        unsigned short VTK_Type;
+        bound_line >> VTK_Type;
+
+        if (VTK_Type != LINE && VTK_Type != TRIANGLE && VTK_Type != QUADRILATERAL) {
+          SU2_MPI::Error("Marker " + Marker_Tag + " has elements not supported by the SU2 binary mesh format.",
+                         CURRENT_FUNCTION);
+        }
+
+        unsigned long vnodes[N_POINTS_QUADRILATERAL] = {0};
+        for (auto iNode = 0u; iNode < nPointsOfElementType(VTK_Type); ++iNode) bound_line >> vnodes[iNode];
+
+        conn.push_back(VTK_Type);
+        conn.insert(conn.end(), vnodes, vnodes + N_POINTS_QUADRILATERAL);
+      }
+    }
+    break;
+  }
 }
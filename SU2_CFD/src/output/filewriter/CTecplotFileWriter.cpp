@@ -121,7 +121,7 @@ void CTecplotFileWriter::WriteData(string val_filename){
   }
 
 #ifdef HAVE_MPI
-  SU2_MPI::Barrier(SU2_MPI::GetComm());
+  SU2_MPI::Barrier(comm);
 #endif
 
   /*--- Each processor opens the file. ---*/
@@ -145,7 +145,7 @@ void CTecplotFileWriter::WriteData(string val_filename){
 
     Tecplot_File.flush();
 #ifdef HAVE_MPI
-    SU2_MPI::Barrier(SU2_MPI::GetComm());
+    SU2_MPI::Barrier(comm);
 #endif
   }
 
@@ -207,7 +207,7 @@ void CTecplotFileWriter::WriteData(string val_filename){
     }
     Tecplot_File.flush();
 #ifdef HAVE_MPI
-    SU2_MPI::Barrier(SU2_MPI::GetComm());
+    SU2_MPI::Barrier(comm);
 #endif
   }
 
@@ -162,6 +162,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config,
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    System.SetMixedPrecision(config->GetLinear_Solver_Mixed_Precision(MIXED_PRECISION_SOLVER::FLOW));
   }
   else {
     if (rank == MASTER_NODE)
@@ -861,7 +862,7 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
       break;
     case COOLPROP:
 
-      auxFluidModel = new CCoolProp(config->GetFluid_Name());
+      auxFluidModel = new CCoolProp(config->GetFluid_Name(), config);
       break;
 
     default:
@@ -1096,7 +1097,7 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
         break;
 
       case COOLPROP:
-        FluidModel[thread] = new CCoolProp(config->GetFluid_Name());
+        FluidModel[thread] = new CCoolProp(config->GetFluid_Name(), config);
         break;
     }
 
@@ -1637,8 +1638,16 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
   if (!Output && muscl && !center) {
 
+    /*--- The last halo exchange (limiters or gradients) is completed by the upwind
+     *    residual, after computing the fluxes on edges that do not touch halo points. ---*/
+
+    const bool compute_limiter = limiter && !van_albada;
+    const bool overlap = OverlapHaloComms(*config);
+
     /*--- Gradient computation for MUSCL reconstruction. ---*/
 
+    if (overlap && !compute_limiter) DeferCompleteComms();
+
     switch (config->GetKind_Gradient_Method_Recon()) {
       case GREEN_GAUSS:
         SetPrimitive_Gradient_GG(geometry, config, true); break;
@@ -1650,7 +1659,10 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
 
     /*--- Limiter computation ---*/
 
-    if (limiter && !van_albada) SetPrimitive_Limiter(geometry, config);
+    if (compute_limiter) {
+      if (overlap) DeferCompleteComms();
+      SetPrimitive_Limiter(geometry, config);
+    }
   }
 }
 
@@ -1662,17 +1674,21 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, c
 
   AD::StartNoSharedReading();
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (unsigned long iPoint = 0; iPoint < nPoint; iPoint ++) {
+  /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp).
+   *    The fluid model is evaluated for blocks of contiguous points through its batched interface. ---*/
 
-    /*--- Compressible flow, primitive variables nDim+9, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+  constexpr auto blockSize = CFluidStateBatch::MAXSIZE;
+  const auto nBlock = roundUpDiv(nPoint, blockSize);
 
-    bool physical = nodes->SetPrimVar(iPoint, GetFluidModel());
-    nodes->SetSecondaryVar(iPoint, GetFluidModel());
+  SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, blockSize))
+  for (unsigned long iBlock = 0; iBlock < nBlock; iBlock++) {
 
-    /* Check for non-realizable states for reporting. */
+    const auto iPointBegin = iBlock * blockSize;
+    const auto nPointBlock = min(blockSize, nPoint - iPointBegin);
 
-    if (!physical) nonPhysicalPoints++;
+    /* Count non-realizable states for reporting. */
+
+    nonPhysicalPoints += nodes->SetPrimVar_Batch(iPointBegin, nPointBlock, GetFluidModel());
   }
   END_SU2_OMP_FOR
 
@@ -1779,13 +1795,7 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   else AD::StartNoSharedReading();
 
   /*--- Loop over edge colors. ---*/
-  for (auto color : EdgeColoring)
-  {
-  /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-  SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-  for(auto k = 0ul; k < color.size; ++k) {
-
-    auto iEdge = color.indices[k];
+  auto computeFlux = [&](unsigned long iEdge) {
 
     unsigned short iDim, iVar;
 
@@ -1950,9 +1960,8 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
     Viscous_Residual(iEdge, geometry, solver_container,
                      numerics_container[VISC_TERM + omp_get_thread_num()*MAX_TERMS], config);
-  }
-  END_SU2_OMP_FOR
-  } // end color loop
+  };
+  EdgeLoop(geometry, config, computeFlux);
 
   FinalizeResidualComputation(geometry, pausePreacc, counter_local, config);
 }
@@ -7708,6 +7717,8 @@ void CEulerSolver::BC_ActDisk(CGeometry *geometry, CSolver **solver_container, C
     if ((geometry->nodes->GetDomain(iPoint)) &&
         (GlobalIndex != GlobalIndex_donor)) {
 
+      const CPointCostTimer costTimer(geometry, iPoint);
+
       /*--- Normal vector for this vertex (negative for outward convention) ---*/
 
       geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
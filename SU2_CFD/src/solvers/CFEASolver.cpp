@@ -149,6 +149,7 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CFEASolverBase(ge
   if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Non-Linear Elasticity)." << endl;
 
   Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  System.SetMixedPrecision(config->GetLinear_Solver_Mixed_Precision(MIXED_PRECISION_SOLVER::FEA));
 
   if (dynamic) {
     MassMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
@@ -885,7 +885,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
 
     case COOLPROP:
 
-      FluidModel = new CCoolProp(config->GetFluid_Name());
+      FluidModel = new CCoolProp(config->GetFluid_Name(), config);
       if (free_stream_temp) {
         FluidModel->SetTDState_PT(Pressure_FreeStream, Temperature_FreeStream);
         Density_FreeStream = FluidModel->GetDensity();
@@ -1097,7 +1097,7 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
       break;
 
     case COOLPROP:
-      FluidModel = new CCoolProp(config->GetFluid_Name());
+      FluidModel = new CCoolProp(config->GetFluid_Name(), config);
       FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
       break;
 
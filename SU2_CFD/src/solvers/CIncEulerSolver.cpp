@@ -162,6 +162,7 @@ CIncEulerSolver::CIncEulerSolver(CGeometry *geometry, CConfig *config, unsigned
       cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
 
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, ReducerStrategy);
+    System.SetMixedPrecision(config->GetLinear_Solver_Mixed_Precision(MIXED_PRECISION_SOLVER::FLOW));
   }
   else {
     if (rank == MASTER_NODE)
@@ -655,6 +655,8 @@ void CIncNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_containe
       /*--- On the finest mesh compute also on halo nodes to avoid communication of tau wall. ---*/
       if ((!geometry->nodes->GetDomain(iPoint)) && !(MGLevel==MESH_0)) continue;
 
+      const CPointCostTimer costTimer(geometry, iPoint);
+
       /*--- Get coordinates of the current vertex and nearest normal point ---*/
 
       const auto Coord = geometry->nodes->GetCoord(iPoint);
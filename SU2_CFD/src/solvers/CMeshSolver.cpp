@@ -102,6 +102,7 @@ CMeshSolver::CMeshSolver(CGeometry *geometry, CConfig *config) : CFEASolver(LINE
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
   Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  System.SetMixedPrecision(config->GetLinear_Solver_Mixed_Precision(MIXED_PRECISION_SOLVER::MESH_DEFORM));
 
   /*--- Initialize structures for hybrid-parallel mode. ---*/
 
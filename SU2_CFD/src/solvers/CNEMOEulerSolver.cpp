@@ -134,11 +134,24 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
     /*--- Jacobians and vector  structures for implicit computations ---*/
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (" << description << "). MG level: " << iMesh <<"." << endl;
     Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    System.SetMixedPrecision(config->GetLinear_Solver_Mixed_Precision(MIXED_PRECISION_SOLVER::FLOW));
   }
   else {
     if (rank == MASTER_NODE)  cout<< "Explicit Scheme. No Jacobian structure (" << description << "). MG level: " << iMesh <<"."<<endl;
   }
 
+  /*--- Chemistry and VT sources of the last residual (and of the RK stages), for the point-implicit (balanced)
+   *    splitting. Each thread integrates with its own fluid model, the models store the thermodynamic state. ---*/
+  if (config->GetPointImplicitChemistry()) {
+    SplitSource.resize(nPointDomain, nSpecies+1) = su2double(0.0);
+    if (config->GetKind_TimeIntScheme_Flow() == RUNGE_KUTTA_EXPLICIT ||
+        config->GetKind_TimeIntScheme_Flow() == CLASSICAL_RK4_EXPLICIT)
+      SplitSourceRK.resize(nPointDomain, nSpecies+1) = su2double(0.0);
+
+    ThreadFluidModels.resize(omp_get_max_threads());
+    for (auto& model : ThreadFluidModels) model.reset(CreateFluidModel(config, nDim));
+  }
+
   /*--- Read farfield conditions from the config file ---*/
   Mach_Inf            = config->GetMach();
   Density_Inf         = config->GetDensity_FreeStreamND();
@@ -753,6 +766,9 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   const bool axisymm    = config->GetAxisymmetric();
   const bool viscous    = config->GetViscous();
   const bool rans       = (config->GetKind_Turb_Model() != TURB_MODEL::NONE);
+  /*--- Chemistry and VT relaxation are corrected point-implicitly after the flow update, here they are
+   *    explicit (not in the Jacobian) and stored for that correction. ---*/
+  const bool split_sources = config->GetPointImplicitChemistry();
 
   CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM];
 
@@ -771,10 +787,110 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
 
   AD::StartNoSharedReading();
 
+  /*--- The chemistry and relaxation terms are computed for batches of points, the Jacobians are then assembled
+   *    per point from the rates of the batch. ---*/
+  const bool batch_sources = !monoatomic && FluidModel->SupportsBatchSourceTerms();
+  const bool batch_jacobians = implicit && !split_sources;
+
+  if (batch_sources) {
+    constexpr unsigned long blockSize = CNEMOGas::BATCH_SIZE;
+    const auto RHOS_INDEX = nodes->GetRhosIndex();
+    const auto T_INDEX = nodes->GetTIndex();
+    const auto TVE_INDEX = nodes->GetTveIndex();
+    const su2double res_min = -1E6;
+    const su2double res_max = 1E6;
+
+    /*--- Per-thread work arrays. ---*/
+    vector<su2double> rhos(blockSize*nSpecies), ws(blockSize*nSpecies), residual(nVar, 0.0);
+    su2double T[blockSize], Tve[blockSize], omega[blockSize];
+
+    /*--- Jacobians of the chemistry and of the relaxation, for each point of the block. ---*/
+    vector<su2double> jacData(batch_jacobians ? 2*blockSize*nVar*nVar : 0);
+    vector<su2double*> jacRows(batch_jacobians ? 2*blockSize*nVar : 0);
+    const su2double *eve[blockSize], *cvve[blockSize], *dTdU[blockSize], *dTvedU[blockSize];
+    su2double **chemJac[blockSize] = {}, **relaxJac[blockSize] = {};
+    for (auto iRow = 0ul; iRow < jacRows.size(); iRow++) jacRows[iRow] = &jacData[iRow*nVar];
+    for (auto k = 0ul; batch_jacobians && k < blockSize; k++) {
+      chemJac[k] = &jacRows[k*nVar];
+      relaxJac[k] = &jacRows[(blockSize+k)*nVar];
+    }
+    CNEMOGas::SourceJacobians jacobians;
+    jacobians.eve = eve;
+    jacobians.cvve = cvve;
+    jacobians.dTdU = dTdU;
+    jacobians.dTvedU = dTvedU;
+    jacobians.chemistry = chemJac;
+    jacobians.relaxation = relaxJac;
+
+    SU2_OMP_FOR_STAT(roundUpDiv(omp_chunk_size, blockSize))
+    for (auto iBlock = 0ul; iBlock < roundUpDiv(nPointDomain, blockSize); iBlock++) {
+      const auto iPointBegin = iBlock * blockSize;
+      const auto nPoints = min(blockSize, nPointDomain - iPointBegin);
+      const CPointCostTimer costTimer(geometry, iPointBegin, nPoints);
+
+      for (auto k = 0ul; k < nPoints; k++) {
+        const auto V = nodes->GetPrimitive(iPointBegin + k);
+        for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++)
+          rhos[k*nSpecies + iSpecies] = V[RHOS_INDEX + iSpecies];
+        T[k] = V[T_INDEX];
+        Tve[k] = V[TVE_INDEX];
+        if (batch_jacobians) {
+          eve[k] = nodes->GetEve(iPointBegin + k);
+          cvve[k] = nodes->GetCvve(iPointBegin + k);
+          dTdU[k] = nodes->GetdTdU(iPointBegin + k);
+          dTvedU[k] = nodes->GetdTvedU(iPointBegin + k);
+        }
+      }
+
+      FluidModel->ComputeSourceTerms_Batch(nPoints, rhos.data(), T, Tve, ws.data(), omega,
+                                           batch_jacobians ? &jacobians : nullptr);
+
+      for (auto k = 0ul; k < nPoints; k++) {
+        const auto iPoint = iPointBegin + k;
+        const su2double Volume = geometry->nodes->GetVolume(iPoint);
+
+        if (!frozen) {
+          for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++)
+            residual[iSpecies] = ws[k*nSpecies + iSpecies] * Volume;
+          residual[nSpecies+nDim+1] = 0.0;
+
+          if (split_sources) {
+            for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++)
+              SplitSource(iPoint, iSpecies) = ws[k*nSpecies + iSpecies];
+          }
+
+          if (!CNumerics::CheckResidualNaNs(batch_jacobians, nVar,
+                                            CNumerics::ResidualType<>(residual.data(), chemJac[k], nullptr))) {
+            LinSysRes.SubtractBlock(iPoint, residual.data());
+            if (batch_jacobians) Jacobian.AddBlock2Diag(iPoint, chemJac[k], -Volume);
+          } else
+            eChm_local++;
+
+          for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++) residual[iSpecies] = 0.0;
+        }
+
+        residual[nSpecies+nDim+1] = omega[k] * Volume;
+        if (config->GetVTTransferResidualLimiting())
+          residual[nSpecies+nDim+1] = min(res_max, max(res_min, residual[nSpecies+nDim+1]));
+        if (split_sources) SplitSource(iPoint, nSpecies) = residual[nSpecies+nDim+1] / Volume;
+
+        if (!CNumerics::CheckResidualNaNs(batch_jacobians, nVar,
+                                          CNumerics::ResidualType<>(residual.data(), relaxJac[k], nullptr))) {
+          LinSysRes.SubtractBlock(iPoint, residual.data());
+          if (batch_jacobians) Jacobian.AddBlock2Diag(iPoint, relaxJac[k], -Volume);
+        } else
+          eVib_local++;
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
   /*--- loop over interior points ---*/
   SU2_OMP_FOR_DYN(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
+    const CPointCostTimer costTimer(geometry, iPoint);
+
     /*--- Set conserved & primitive variables  ---*/
     numerics->SetConservative(nodes->GetSolution(iPoint),  nullptr);
     numerics->SetPrimitive   (nodes->GetPrimitive(iPoint), nullptr);
@@ -792,7 +908,7 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
 
     /*--- Compute finite rate chemistry ---*/
 
-    if(!monoatomic){
+    if(!monoatomic && !batch_sources){
       if(!frozen){
         /*--- Compute the non-equilibrium chemistry ---*/
         auto residual = numerics->ComputeChemistry(config);
@@ -803,17 +919,22 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
         /*--- Apply the chemical sources to the linear system ---*/
         if (!err) {
           LinSysRes.SubtractBlock(iPoint, residual);
-          if (implicit)
+          if (implicit && !split_sources)
             Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
         } else
           eChm_local++;
+
+        if (split_sources) {
+          for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++)
+            SplitSource(iPoint, iSpecies) = residual[iSpecies] / geometry->nodes->GetVolume(iPoint);
+        }
       }
     }
 
     /*--- Compute vibrational energy relaxation ---*/
     /// NOTE: Jacobians don't account for relaxation time derivatives
 
-    if (!monoatomic){
+    if (!monoatomic && !batch_sources){
       auto residual = numerics->ComputeVibRelaxation(config);
 
       /*--- Check for errors before applying source to the linear system ---*/
@@ -822,10 +943,13 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
       /*--- Apply the vibrational relaxation terms to the linear system ---*/
       if (!err) {
         LinSysRes.SubtractBlock(iPoint, residual);
-        if (implicit)
+        if (implicit && !split_sources)
           Jacobian.SubtractBlock2Diag(iPoint, residual.jacobian_i);
       } else
         eVib_local++;
+
+      if (split_sources)
+        SplitSource(iPoint, nSpecies) = residual[nSpecies+nDim+1] / geometry->nodes->GetVolume(iPoint);
     }
 
     /*--- Compute axisymmetric source terms (if needed) ---*/
@@ -896,21 +1020,182 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
   }
 }
 
+CNEMOEulerSolver::PointImplicitWorkspace::PointImplicitWorkspace(unsigned short nspecies, unsigned short nvar,
+                                                                 unsigned short nprimvar) :
+  nSpecies(nspecies), nVar(nvar), U_flow(nvar), forcing(nvar), V(nprimvar), dPdU(nvar), dTdU(nvar), dTvedU(nvar),
+  eves(nspecies), cvves(nspecies), rhs(nspecies+1), jacobian(nvar,nvar), sysMatrix(nspecies+1,nspecies+1),
+  jacobianRows(nvar), sysRows(nspecies+1) {
+  for (auto iVar = 0u; iVar < nVar; iVar++) jacobianRows[iVar] = jacobian[iVar];
+  for (auto iSys = 0u; iSys <= nSpecies; iSys++) sysRows[iSys] = sysMatrix[iSys];
+}
+
+bool CNEMOEulerSolver::IntegrateSplitSources(CNEMOEulerVariable* variable, CNEMOGas* fluidmodel, bool frozen,
+                                             unsigned short nSubsteps, su2double dt, const su2double* U_start,
+                                             const su2double* V_guess, const su2double* explicitSource, su2double* U,
+                                             PointImplicitWorkspace& work) {
+
+  /*--- Integrated variables: species densities and vib.-el. energy (the last conservative variable). ---*/
+  const unsigned short nSpecies = work.nSpecies;
+  const unsigned short nSys = nSpecies + 1;
+  const unsigned short iEve = work.nVar - 1;
+  const auto Index = [&](unsigned short iSys) { return (iSys < nSpecies)? iSys : iEve; };
+
+  auto& jacobian = work.jacobian;
+  auto& rhs = work.rhs;
+  const su2double subDt = dt / nSubsteps;
+
+  /*--- The flow update without the explicit sources is a constant forcing, the integration
+   *    restarts from the initial state, which unlike the flow update is known to be physical. ---*/
+  for (auto iVar = 0u; iVar < work.nVar; iVar++) {
+    work.U_flow[iVar] = U[iVar];
+    work.forcing[iVar] = (U[iVar] - U_start[iVar]) / dt;
+    U[iVar] = U_start[iVar];
+  }
+  for (auto iSys = 0u; iSys < nSys; iSys++) work.forcing[Index(iSys)] -= explicitSource[iSys];
+
+  for (auto iPrim = 0u; iPrim < work.V.size(); iPrim++) work.V[iPrim] = V_guess[iPrim];
+
+  /*--- A non-physical state reverts to the flow update. ---*/
+  const auto Revert = [&]() {
+    for (auto iVar = 0u; iVar < work.nVar; iVar++) U[iVar] = work.U_flow[iVar];
+    return false;
+  };
+
+  for (auto iStep = 0u; ; iStep++) {
+
+    if (variable->Cons2PrimVar(fluidmodel, U, work.V.data(), work.dPdU.data(), work.dTdU.data(), work.dTvedU.data(),
+                               work.eves.data(), work.cvves.data())) return Revert();
+    if (iStep == nSubsteps) return true;
+
+    /*--- Source terms and their Jacobians at the current state. ---*/
+    jacobian = su2double(0.0);
+    for (auto iSys = 0u; iSys < nSys; iSys++) rhs[iSys] = work.forcing[Index(iSys)];
+
+    if (!frozen) {
+      const auto& ws = fluidmodel->ComputeNetProductionRates(true, work.V.data(), work.eves.data(),
+                                                             work.cvves.data(), work.dTdU.data(),
+                                                             work.dTvedU.data(), work.jacobianRows.data());
+      for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) rhs[iSpecies] += ws[iSpecies];
+    }
+    rhs[nSpecies] += fluidmodel->ComputeEveSourceTerm();
+    fluidmodel->GetEveSourceTermJacobian(work.V.data(), work.eves.data(), work.cvves.data(), work.dTdU.data(),
+                                         work.dTvedU.data(), work.jacobianRows.data());
+
+    /*--- Linearized backward Euler: (I/dt - dS/dU) dU = S + forcing. ---*/
+    for (auto iSys = 0u; iSys < nSys; iSys++) {
+      for (auto jSys = 0u; jSys < nSys; jSys++)
+        work.sysMatrix(iSys,jSys) = -jacobian(Index(iSys), Index(jSys));
+      work.sysMatrix(iSys,iSys) += 1.0 / subDt;
+    }
+    Gauss_Elimination(work.sysRows.data(), rhs.data(), nSys);
+
+    bool finite = true;
+    for (auto iSys = 0u; iSys < nSys; iSys++) finite &= std::isfinite(SU2_TYPE::GetValue(rhs[iSys]));
+    if (!finite) return Revert();
+
+    for (auto iSys = 0u; iSys < nSys; iSys++) U[Index(iSys)] += rhs[iSys];
+    for (auto iVar = nSpecies; iVar < iEve; iVar++) U[iVar] += subDt * work.forcing[iVar];
+  }
+}
+
+void CNEMOEulerSolver::PointImplicit_Chemistry(CGeometry *geometry, const CConfig *config,
+                                               const su2activematrix& explicitSource) {
+
+  if (config->GetMonoatomic()) return;
+
+  const bool frozen = config->GetFrozen();
+  const auto nSubsteps = config->GetnPointImplicit_Substeps();
+
+  /*--- Dual time integrates the sources over the physical time step, not the pseudo time step. ---*/
+  const bool dual_time = (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_1ST) ||
+                         (config->GetTime_Marching() == TIME_MARCHING::DT_STEPPING_2ND);
+
+  /*--- Per-thread work arrays and fluid model. ---*/
+  PointImplicitWorkspace work(nSpecies, nVar, nPrimVar);
+  vector<su2double> U(nVar);
+  CNEMOGas* fluidmodel = ThreadFluidModels[omp_get_thread_num()].get();
+
+  ompMasterAssignBarrier(ErrorCounter, 0);
+  unsigned long nonPhysicalPoints = 0;
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+
+    const CPointCostTimer costTimer(geometry, iPoint);
+
+    const su2double dt = dual_time? config->GetDelta_UnstTimeND() : nodes->GetDelta_Time(iPoint);
+    if (dt <= 0.0) continue;
+
+    for (auto iVar = 0u; iVar < nVar; iVar++) U[iVar] = nodes->GetSolution(iPoint, iVar);
+
+    if (!IntegrateSplitSources(nodes, fluidmodel, frozen, nSubsteps, dt, nodes->GetSolution_Old(iPoint),
+                               nodes->GetPrimitive(iPoint), explicitSource[iPoint], U.data(), work))
+      nonPhysicalPoints++;
+
+    /*--- Store the new state, the primitives are updated with the rest of the domain. ---*/
+    for (auto iVar = 0u; iVar < nVar; iVar++) nodes->SetSolution(iPoint, iVar, U[iVar]);
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_ATOMIC
+  ErrorCounter += nonPhysicalPoints;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    unsigned long tmp = ErrorCounter;
+    SU2_MPI::Allreduce(&tmp, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    if ((rank == MASTER_NODE) && (ErrorCounter != 0))
+      cout << "Warning!! Point-implicit chemistry stopped early at " << ErrorCounter << " points." << endl;
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  InitiateComms(geometry, config, SOLUTION);
+  CompleteComms(geometry, config, SOLUTION);
+}
+
+void CNEMOEulerSolver::AccumulateSplitSource(unsigned short iRKStep, su2double weight) {
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    for (auto iSys = 0u; iSys <= nSpecies; iSys++) {
+      if (iRKStep == 0) SplitSourceRK(iPoint, iSys) = 0.0;
+      SplitSourceRK(iPoint, iSys) += weight * SplitSource(iPoint, iSys);
+    }
+  }
+  END_SU2_OMP_FOR
+}
+
 void CNEMOEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_container,
                                             CConfig *config, unsigned short iRKStep) {
 
   Explicit_Iteration<RUNGE_KUTTA_EXPLICIT>(geometry, solver_container, config, iRKStep);
+
+  /*--- The stages add their residuals to the solution, the sources of all stages are in the update. ---*/
+  if (config->GetPointImplicitChemistry()) {
+    AccumulateSplitSource(iRKStep, config->Get_Alpha_RKStep(iRKStep));
+    if (iRKStep == config->GetnRKStep()-1) PointImplicit_Chemistry(geometry, config, SplitSourceRK);
+  }
 }
 
 void CNEMOEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container,
                                               CConfig *config, unsigned short iRKStep) {
 
   Explicit_Iteration<CLASSICAL_RK4_EXPLICIT>(geometry, solver_container, config, iRKStep);
+
+  /*--- The update combines the stage residuals with the weights of the classical RK4 scheme. ---*/
+  if (config->GetPointImplicitChemistry()) {
+    const su2double RK_FuncCoeff[] = {1.0/6.0, 1.0/3.0, 1.0/3.0, 1.0/6.0};
+    AccumulateSplitSource(iRKStep, RK_FuncCoeff[iRKStep]);
+    if (iRKStep == 3) PointImplicit_Chemistry(geometry, config, SplitSourceRK);
+  }
 }
 
 void CNEMOEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   Explicit_Iteration<EULER_EXPLICIT>(geometry, solver_container, config, 0);
+
+  if (config->GetPointImplicitChemistry())
+    PointImplicit_Chemistry(geometry, config, SplitSource);
 }
 
 void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
@@ -926,6 +1211,9 @@ void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**,
 void CNEMOEulerSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
 
   CompleteImplicitIteration_impl<true>(geometry, config);
+
+  if (config->GetPointImplicitChemistry())
+    PointImplicit_Chemistry(geometry, config, SplitSource);
 }
 
 void CNEMOEulerSolver::ComputeUnderRelaxationFactor(const CConfig *config) {
@@ -982,6 +1270,23 @@ void CNEMOEulerSolver::ComputeUnderRelaxationFactor(const CConfig *config) {
   END_SU2_OMP_FOR
 }
 
+CNEMOGas* CNEMOEulerSolver::CreateFluidModel(const CConfig* config, unsigned short nDim) {
+
+  switch (config->GetKind_FluidModel()) {
+  case MUTATIONPP:
+   #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+     return new CMutationTCLib(config, nDim);
+   #else
+     SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
+     CURRENT_FUNCTION);
+   #endif
+   break;
+  case SU2_NONEQ:
+   return new CSU2TCLib(config, nDim, config->GetViscous());
+  }
+  return nullptr;
+}
+
 void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMesh) {
 
   su2double
@@ -1023,19 +1328,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   config->SetConductivity_Ref(1.0);
 
   /*--- Instatiate the fluid model ---*/
-  switch (config->GetKind_FluidModel()) {
-  case MUTATIONPP:
-   #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
-     FluidModel = new CMutationTCLib(config, nDim);
-   #else
-     SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
-     CURRENT_FUNCTION);
-   #endif
-   break;
-  case SU2_NONEQ:
-   FluidModel = new CSU2TCLib(config, nDim, viscous);
-   break;
-  }
+  FluidModel = CreateFluidModel(config, nDim);
 
   /*--- Compute the Free Stream Pressure, Temperatrue, and Density ---*/
   Pressure_FreeStream        = config->GetPressure_FreeStream();
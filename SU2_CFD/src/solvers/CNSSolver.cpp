@@ -113,6 +113,8 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   /*--- Compute the limiters ---*/
 
   if (muscl && !center && limiter && !van_albada && !Output) {
+    /*--- Only the limiters are not needed before the upwind residual, which completes their exchange. ---*/
+    if (OverlapHaloComms(*config)) DeferCompleteComms();
     SetPrimitive_Limiter(geometry, config);
   }
 
@@ -835,6 +837,8 @@ void CNSSolver::SetTau_Wall_WF(CGeometry *geometry, CSolver **solver_container,
 
       if (!geometry->nodes->GetDomain(iPoint)) continue;
 
+      const CPointCostTimer costTimer(geometry, iPoint);
+
       /*--- Get coordinates of the current vertex and nearest normal point ---*/
 
       const auto Coord = geometry->nodes->GetCoord(iPoint);
@@ -46,6 +46,7 @@
 #include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../../Common/include/toolboxes/CLinearPartitioner.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
 #include "../../../Common/include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/CMarkerProfileReaderFVM.hpp"
 
@@ -1404,10 +1405,36 @@ namespace CommHelpers {
   }
 }
 
+void CSolver::DeferCompleteComms() {
+  SU2_OMP_MASTER
+  deferCompleteComms = true;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+}
+
+void CSolver::CompleteDeferredComms(CGeometry *geometry, const CConfig *config) {
+  if (pendingComms < 0) return;
+
+  const auto commType = pendingComms;
+  SU2_OMP_BARRIER
+  SU2_OMP_MASTER
+  pendingComms = -1;
+  END_SU2_OMP_MASTER
+  SU2_OMP_BARRIER
+
+  CompleteComms(geometry, config, commType);
+}
+
 void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  SU2_PROFILE_REGION("Initiate_Comms");
+
+  /*--- The communication buffers are shared, finish any exchange left in flight. ---*/
+
+  CompleteDeferredComms(geometry, config);
+
   /*--- Local variables ---*/
 
   unsigned short iVar, iDim;
@@ -1550,6 +1577,8 @@ void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             unsigned short commType) {
 
+  SU2_PROFILE_REGION("Complete_Comms");
+
   /*--- Local variables ---*/
 
   unsigned short iDim, iVar;
@@ -1562,6 +1591,19 @@ void CSolver::CompleteComms(CGeometry *geometry,
   /*--- Global status so all threads can see the result of Waitany. ---*/
   static SU2_MPI::Status status;
 
+  /*--- Leave the exchange in flight if requested, the data is unpacked by CompleteDeferredComms. ---*/
+
+  if (deferCompleteComms) {
+    SU2_OMP_BARRIER
+    SU2_OMP_MASTER {
+      deferCompleteComms = false;
+      pendingComms = commType;
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    return;
+  }
+
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
   GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
@@ -3055,40 +3097,37 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
    that will be placed in the restart. Here, we are collecting each one of the
    points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
 
-  int nBlock;
-  int *blocklen = nullptr;
-  MPI_Aint *displace = nullptr;
+  vector<int> blocklen;
+  vector<MPI_Aint> displace;
 
   if (nPointFile == geometry->GetGlobal_nPointDomain() ||
       config->GetKind_SU2() == SU2_COMPONENT::SU2_SOL) {
-    /*--- No interpolation, each rank reads the indices it needs. ---*/
-    nBlock = geometry->GetnPointDomain();
-
-    blocklen = new int[nBlock];
-    displace = new MPI_Aint[nBlock];
-    int counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
-      if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-        blocklen[counter] = nFields;
-        displace[counter] = iPoint_Global*nFields*sizeof(passivedouble);
-        counter++;
-      }
+    /*--- No interpolation, each rank reads the rows of the points it owns, which are
+     at fixed offsets in the file (rows are in global index order). Consecutive rows
+     are merged into one block to keep the file view small. ---*/
+
+    const auto globalPoints = geometry->GetGlobal_Domain_Points();
+
+    for (auto iPoint = 0ul; iPoint < globalPoints.size();) {
+      auto jPoint = iPoint + 1;
+      while (jPoint < globalPoints.size() && globalPoints[jPoint] == globalPoints[jPoint-1] + 1) ++jPoint;
+      blocklen.push_back(nFields*(jPoint-iPoint));
+      displace.push_back(globalPoints[iPoint]*nFields*sizeof(passivedouble));
+      iPoint = jPoint;
     }
   }
   else {
     /*--- Interpolation required, read large blocks of data. ---*/
-    nBlock = 1;
-
-    blocklen = new int[nBlock];
-    displace = new MPI_Aint[nBlock];
 
     const auto partitioner = CLinearPartitioner(nPointFile,0);
 
-    blocklen[0] = nFields*partitioner.GetSizeOnRank(rank);
-    displace[0] = nFields*partitioner.GetFirstIndexOnRank(rank)*sizeof(passivedouble);;
+    blocklen.push_back(nFields*partitioner.GetSizeOnRank(rank));
+    displace.push_back(nFields*partitioner.GetFirstIndexOnRank(rank)*sizeof(passivedouble));
   }
 
-  MPI_Type_create_hindexed(nBlock, blocklen, displace, MPI_DOUBLE, &filetype);
+  const int nBlock = blocklen.size();
+
+  MPI_Type_create_hindexed(nBlock, blocklen.data(), displace.data(), MPI_DOUBLE, &filetype);
   MPI_Type_commit(&filetype);
 
   /*--- Set the view for the MPI file write, i.e., describe the location in
@@ -3098,7 +3137,7 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-  const int bufSize = nBlock*blocklen[0];
+  const int bufSize = accumulate(blocklen.begin(), blocklen.end(), 0);
   Restart_Data = new passivedouble[bufSize];
 
   /*--- Collective call for all ranks to read from their view simultaneously. ---*/
@@ -3113,9 +3152,6 @@ void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, const CConfig *config
 
   MPI_Type_free(&filetype);
 
-  delete [] blocklen;
-  delete [] displace;
-
 #endif
 
   if (nPointFile != geometry->GetGlobal_nPointDomain() &&
@@ -3306,7 +3342,7 @@ void CSolver::InterpolateRestartData(const CGeometry *geometry, const CConfig *c
   Restart_Vars[2] = nPointDomain;
 
   int counter = 0;
-  for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); ++iPoint_Global) {
+  for (const auto iPoint_Global : geometry->GetGlobal_Domain_Points()) {
     const auto iPoint = geometry->GetGlobal_to_Local_Point(iPoint_Global);
     if (iPoint >= 0) {
       for (auto iVar = 0ul; iVar < nFields; ++iVar)
@@ -4189,7 +4225,7 @@ void CSolver::BasicLoadRestart(CGeometry *geometry, const CConfig *config, const
 
   unsigned long iPoint_Global_Local = 0;
 
-  for (auto iPoint_Global = 0ul; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  for (const auto iPoint_Global : geometry->GetGlobal_Domain_Points()) {
 
     /*--- Retrieve local index. If this node from the restart file lives
      on the current processor, we will load and instantiate the vars. ---*/
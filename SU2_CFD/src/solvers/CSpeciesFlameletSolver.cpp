@@ -67,34 +67,63 @@ void CSpeciesFlameletSolver::Preprocessing(CGeometry* geometry, CSolver** solver
                                            unsigned short iMesh, unsigned short iRKStep,
                                            unsigned short RunTime_EqSystem, bool Output) {
   unsigned long n_not_in_domain_local = 0, n_not_in_domain_global = 0;
-  vector<su2double> scalars_vector(nVar);
+  const unsigned short n_sources = config->GetNControlVars() + 2 * config->GetNUserScalars();
+  const unsigned short n_lookups = config->GetNLookups();
+
+  /*--- Manifold evaluations are done for blocks of contiguous points, neighboring points
+   *    tend to be close in the manifold too, which makes the table searches cheaper. ---*/
+  const unsigned long n_blocks = roundUpDiv(nPoint, omp_chunk_size);
+  vector<su2double> block_scalars, block_sources, block_lookups;
+  vector<unsigned long> block_misses, block_lookup_misses;
 
   auto* flowNodes = su2staticcast_p<CFlowVariable*>(solver_container[FLOW_SOL]->GetNodes());
 
   SU2_OMP_SAFE_GLOBAL_ACCESS(config->SetGlobalParam(config->GetKind_Solver(), RunTime_EqSystem);)
 
-  SU2_OMP_FOR_STAT(omp_chunk_size)
-  for (auto i_point = 0u; i_point < nPoint; i_point++) {
+  SU2_OMP_FOR_STAT(1)
+  for (auto i_block = 0ul; i_block < n_blocks; i_block++) {
+    const unsigned long begin = i_block * omp_chunk_size;
+    const unsigned long n_block_points = min(nPoint, begin + omp_chunk_size) - begin;
+    const CPointCostTimer cost_timer(geometry, begin, n_block_points);
     CFluidModel* fluid_model_local = solver_container[FLOW_SOL]->GetFluidModel();
-    su2double* scalars = nodes->GetSolution(i_point);
-    for (auto iVar = 0u; iVar < nVar; iVar++) scalars_vector[iVar] = scalars[iVar];
+
+    block_scalars.resize(n_block_points * nVar);
+    for (auto i = 0ul; i < n_block_points; i++) {
+      const su2double* scalars = nodes->GetSolution(begin + i);
+      for (auto iVar = 0u; iVar < nVar; iVar++) block_scalars[i * nVar + iVar] = scalars[iVar];
+    }
 
     /*--- Compute total source terms from the production and consumption. ---*/
-    unsigned long misses = SetScalarSources(config, fluid_model_local, i_point, scalars_vector);
-    nodes->SetTableMisses(i_point, misses);
-    n_not_in_domain_local += misses;
+    block_sources.resize(n_block_points * n_sources);
+    block_misses.resize(n_block_points);
+    n_not_in_domain_local +=
+        fluid_model_local->EvaluateDataSetBatch(n_block_points, block_scalars.data(), nVar, FLAMELET_LOOKUP_OPS::SOURCES,
+                                                block_sources.data(), n_sources, block_misses.data());
+
     /*--- Obtain passive look-up scalars. ---*/
-    SetScalarLookUps(config, fluid_model_local, i_point, scalars_vector);
-
-    /*--- Set mass diffusivity based on thermodynamic state. ---*/
-    su2double T = flowNodes->GetTemperature(i_point);
-    fluid_model_local->SetTDState_T(T, scalars);
-    /*--- set the diffusivity in the fluid model to the diffusivity obtained from the lookup table ---*/
-    for (auto i_scalar = 0u; i_scalar < nVar; ++i_scalar) {
-      nodes->SetDiffusivity(i_point, fluid_model_local->GetMassDiffusivity(i_scalar), i_scalar);
-    }
+    block_lookups.resize(n_block_points * n_lookups);
+    block_lookup_misses.resize(n_block_points);
+    fluid_model_local->EvaluateDataSetBatch(n_block_points, block_scalars.data(), nVar, FLAMELET_LOOKUP_OPS::LOOKUP,
+                                            block_lookups.data(), n_lookups, block_lookup_misses.data());
+
+    for (auto i = 0ul; i < n_block_points; i++) {
+      const unsigned long i_point = begin + i;
+      su2double* scalars = nodes->GetSolution(i_point);
+
+      SetScalarSources(config, i_point, scalars, &block_sources[i * n_sources]);
+      nodes->SetTableMisses(i_point, block_misses[i]);
+      SetScalarLookUps(config, i_point, &block_lookups[i * n_lookups]);
+
+      /*--- Set mass diffusivity based on thermodynamic state. ---*/
+      su2double T = flowNodes->GetTemperature(i_point);
+      fluid_model_local->SetTDState_T(T, scalars);
+      /*--- set the diffusivity in the fluid model to the diffusivity obtained from the lookup table ---*/
+      for (auto i_scalar = 0u; i_scalar < nVar; ++i_scalar) {
+        nodes->SetDiffusivity(i_point, fluid_model_local->GetMassDiffusivity(i_scalar), i_scalar);
+      }
 
-    if (!Output) LinSysRes.SetBlock_Zero(i_point);
+      if (!Output) LinSysRes.SetBlock_Zero(i_point);
+    }
   }
   END_SU2_OMP_FOR
   /* --- Sum up some global counters over processes. --- */
@@ -436,14 +465,10 @@ void CSpeciesFlameletSolver::BC_ConjugateHeat_Interface(CGeometry* geometry, CSo
   BC_Isothermal_Wall_Generic(geometry, solver_container, conv_numerics, nullptr, config, val_marker, true);
 }
 
-unsigned long CSpeciesFlameletSolver::SetScalarSources(const CConfig* config, CFluidModel* fluid_model_local,
-                                                       unsigned long iPoint, const vector<su2double>& scalars) {
+void CSpeciesFlameletSolver::SetScalarSources(const CConfig* config, unsigned long iPoint, const su2double* scalars,
+                                              const su2double* table_sources) {
   /*--- Compute total source terms from the production and consumption. ---*/
 
-  vector<su2double> table_sources(config->GetNControlVars() + 2 * config->GetNUserScalars());
-  unsigned long misses = fluid_model_local->EvaluateDataSet(scalars, FLAMELET_LOOKUP_OPS::SOURCES, table_sources);
-  nodes->SetTableMisses(iPoint, misses);
-
   /*--- The source term for progress variable is always positive, we clip from below to makes sure. --- */
 
   vector<su2double> source_scalar(config->GetNScalars());
@@ -461,20 +486,13 @@ unsigned long CSpeciesFlameletSolver::SetScalarSources(const CConfig* config, CF
   }
   for (auto i_scalar = 0u; i_scalar < nVar; i_scalar++)
     nodes->SetScalarSource(iPoint, i_scalar, source_scalar[i_scalar]);
-  return misses;
 }
 
-unsigned long CSpeciesFlameletSolver::SetScalarLookUps(const CConfig* config, CFluidModel* fluid_model_local,
-                                                       unsigned long iPoint, const vector<su2double>& scalars) {
-  /*--- Compute total source terms from the production and consumption. ---*/
-
-  vector<su2double> lookup_scalar(config->GetNLookups());
-  unsigned long misses = fluid_model_local->EvaluateDataSet(scalars, FLAMELET_LOOKUP_OPS::LOOKUP, lookup_scalar);
-
+void CSpeciesFlameletSolver::SetScalarLookUps(const CConfig* config, unsigned long iPoint,
+                                              const su2double* lookup_scalar) {
   for (auto i_lookup = 0u; i_lookup < config->GetNLookups(); i_lookup++) {
     nodes->SetLookupScalar(iPoint, lookup_scalar[i_lookup], i_lookup);
   }
-  return misses;
 }
 
 unsigned long CSpeciesFlameletSolver::GetEnthFromTemp(CFluidModel* fluid_model, su2double const val_temp,
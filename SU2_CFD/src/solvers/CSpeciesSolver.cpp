@@ -30,6 +30,7 @@
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CScalarSolver.inl"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 
 /*--- Explicit instantiation of the parent class of CSpeciesSolver. ---*/
 template class CScalarSolver<CSpeciesVariable>;
@@ -216,7 +217,7 @@ void CSpeciesSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfi
     /*--- Load data from the restart into correct containers. ---*/
 
     unsigned long counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+    for (const auto iPoint_Global : geometry[MESH_0]->GetGlobal_Domain_Points()) {
       /*--- Retrieve local index. If this node from the restart file lives
        on the current processor, we will load and instantiate the vars. ---*/
 
@@ -330,6 +331,10 @@ void CSpeciesSolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry,
   Viscous_Residual_impl(SolverSpecificNumerics, iEdge, geometry, solver_container, numerics, config);
 }
 
+CNumericsSIMD* CSpeciesSolver::CreateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) const {
+  return CNumericsSIMD::CreateSpeciesNumerics(*config, nDim, nVar, MGLevel, solvers[FLOW_SOL]->GetNodes(), prim_idx);
+}
+
 void CSpeciesSolver::BC_Inlet(CGeometry* geometry, CSolver** solver_container, CNumerics* conv_numerics,
                               CNumerics* visc_numerics, CConfig* config, unsigned short val_marker) {
 
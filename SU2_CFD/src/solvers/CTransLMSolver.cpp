@@ -29,6 +29,7 @@
 #include "../../include/variables/CTransLMVariable.hpp"
 #include "../../include/variables/CFlowVariable.hpp"
 #include "../../include/variables/CTurbSAVariable.hpp"
+#include "../../include/numerics_simd/CNumericsSIMD.hpp"
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
@@ -275,6 +276,10 @@ void CTransLMSolver::Viscous_Residual(unsigned long iEdge, CGeometry* geometry,
   Viscous_Residual_impl(SolverSpecificNumerics, iEdge, geometry, solver_container, numerics, config);
 }
 
+CNumericsSIMD* CTransLMSolver::CreateEdgeNumerics(const CSolver* const* solvers, const CConfig* config) const {
+  return CNumericsSIMD::CreateTransNumerics(*config, nDim, MGLevel, solvers[FLOW_SOL]->GetNodes(), prim_idx);
+}
+
 
 void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container,
                                      CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
@@ -528,7 +533,7 @@ void CTransLMSolver::LoadRestart(CGeometry** geometry, CSolver*** solver, CConfi
     /*--- Load data from the restart into correct containers. ---*/
 
     unsigned long counter = 0;
-    for (auto iPoint_Global = 0ul; iPoint_Global < geometry[MESH_0]->GetGlobal_nPointDomain(); iPoint_Global++) {
+    for (const auto iPoint_Global : geometry[MESH_0]->GetGlobal_Domain_Points()) {
       /*--- Retrieve local index. If this node from the restart file lives
        on the current processor, we will load and instantiate the vars. ---*/
 
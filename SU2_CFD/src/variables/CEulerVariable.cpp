@@ -148,3 +148,53 @@ void CEulerVariable::SetSecondaryVar(unsigned long iPoint, CFluidModel *FluidMod
    SetdPde_rho(iPoint, FluidModel->GetdPde_rho());
 
 }
+
+unsigned long CEulerVariable::SetPrimVar_Batch(unsigned long iPointBegin, unsigned long nPoints,
+                                               CFluidModel *FluidModel) {
+
+  CFluidStateBatch states;
+  states.size = nPoints;
+
+  for (unsigned long i = 0; i < nPoints; i++) {
+    const auto iPoint = iPointBegin + i;
+    SetVelocity(iPoint);   // Computes velocity and velocity^2
+    states.Density[i] = GetDensity(iPoint);
+    states.StaticEnergy[i] = GetEnergy(iPoint)-0.5*Velocity2(iPoint);
+  }
+
+  FluidModel->SetTDState_rhoe_Batch(states);
+
+  unsigned long nonPhysicalPoints = 0;
+
+  for (unsigned long i = 0; i < nPoints; i++) {
+    const auto iPoint = iPointBegin + i;
+
+    bool check_dens  = SetDensity(iPoint);
+    bool check_press = SetPressure(iPoint, states.Pressure[i]);
+    bool check_sos   = SetSoundSpeed(iPoint, states.SoundSpeed2[i]);
+    bool check_temp  = SetTemperature(iPoint, states.Temperature[i]);
+
+    /*--- Non-physical states are rare, they are recomputed from the old solution by the scalar version. ---*/
+
+    if (check_dens || check_press || check_sos || check_temp) {
+      for (unsigned long iVar = 0; iVar < nVar; iVar++)
+        Solution(iPoint, iVar) = Solution_Old(iPoint, iVar);
+      SetPrimVar(iPoint, FluidModel);
+      SetSecondaryVar(iPoint, FluidModel);
+      nonPhysicalPoints++;
+      continue;
+    }
+
+    SetEnthalpy(iPoint); // Requires pressure computation.
+
+    if (DataDrivenFluid) {
+      SetDataExtrapolation(iPoint, states.Extrapolation[i]);
+      SetEntropy(iPoint, states.Entropy[i]);
+    }
+
+    SetdPdrho_e(iPoint, states.dPdrho_e[i]);
+    SetdPde_rho(iPoint, states.dPde_rho[i]);
+  }
+
+  return nonPhysicalPoints;
+}
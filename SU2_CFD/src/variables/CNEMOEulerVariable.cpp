@@ -165,10 +165,10 @@ bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidMode
   return nonPhys;
 }
 
-bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
+bool CNEMOEulerVariable::Cons2PrimVar(CNEMOGas *val_fluidmodel, su2double *U, su2double *V,
                                       su2double *val_dPdU, su2double *val_dTdU,
                                       su2double *val_dTvedU, su2double *val_eves,
-                                      su2double *val_Cvves) {
+                                      su2double *val_Cvves) const {
 
   unsigned short iDim, iSpecies;
   su2double Tmin, Tmax, Tvemin, Tvemax;
@@ -220,7 +220,7 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
 
   /*--- Assign temperatures ---*/
   const su2double Tve_old = V[TVE_INDEX];
-  const auto& T = fluidmodel->ComputeTemperatures(rhos, rhoE, rhoEve, 0.5*rho*sqvel, Tve_old);
+  const auto& T = val_fluidmodel->ComputeTemperatures(rhos, rhoE, rhoEve, 0.5*rho*sqvel, Tve_old);
 
   /*--- Temperatures ---*/
   V[T_INDEX]   = T[0];
@@ -239,21 +239,21 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
   else {V[TVE_INDEX] = Tve_Freestream;}
 
   // Determine other properties of the mixture at the current state
-  fluidmodel->SetTDStateRhosTTv(rhos, V[T_INDEX], V[TVE_INDEX]);
+  val_fluidmodel->SetTDStateRhosTTv(rhos, V[T_INDEX], V[TVE_INDEX]);
 
-  const auto& cvves = fluidmodel->ComputeSpeciesCvVibEle(V[TVE_INDEX]);
-  vector<su2double> eves  = fluidmodel->ComputeSpeciesEve(V[TVE_INDEX]);
+  const auto& cvves = val_fluidmodel->ComputeSpeciesCvVibEle(V[TVE_INDEX]);
+  vector<su2double> eves  = val_fluidmodel->ComputeSpeciesEve(V[TVE_INDEX]);
 
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
     val_eves[iSpecies]  = eves[iSpecies];
     val_Cvves[iSpecies] = cvves[iSpecies];
   }
 
-  V[RHOCVTR_INDEX] = fluidmodel->ComputerhoCvtr();
-  V[RHOCVVE_INDEX] = fluidmodel->ComputerhoCvve();
+  V[RHOCVTR_INDEX] = val_fluidmodel->ComputerhoCvtr();
+  V[RHOCVVE_INDEX] = val_fluidmodel->ComputerhoCvve();
 
   /*--- Pressure ---*/
-  V[P_INDEX] = fluidmodel->ComputePressure();
+  V[P_INDEX] = val_fluidmodel->ComputePressure();
 
   if (V[P_INDEX] < 0.0) {
     V[P_INDEX] = 1E-20;
@@ -262,13 +262,13 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
 
   /*--- Partial derivatives of pressure and temperature ---*/
   if(implicit){
-    fluidmodel->ComputedPdU  (V, eves, val_dPdU  );
-    fluidmodel->ComputedTdU  (V, val_dTdU );
-    fluidmodel->ComputedTvedU(V, eves, val_dTvedU);
+    val_fluidmodel->ComputedPdU  (V, eves, val_dPdU  );
+    val_fluidmodel->ComputedTdU  (V, val_dTdU );
+    val_fluidmodel->ComputedTvedU(V, eves, val_dTvedU);
   }
 
   /*--- Sound speed ---*/
-  V[A_INDEX] = fluidmodel->ComputeSoundSpeed();
+  V[A_INDEX] = val_fluidmodel->ComputeSoundSpeed();
 
   /*--- Enthalpy ---*/
   V[H_INDEX] = (U[nSpecies+nDim] + V[P_INDEX])/V[RHO_INDEX];
@@ -25,11 +25,9 @@
 # You should have received a copy of the GNU Lesser General Public
 # License along with SU2. If not, see <http://www.gnu.org/licenses/>.
 
+import csv
 from optparse import OptionParser
-from pylab import *
-from numpy import *
 from matplotlib import pyplot as plt
-from matplotlib import mlab
 
 parser = OptionParser()
 parser.add_option(
@@ -37,49 +35,57 @@ parser.add_option(
 )
 (options, args) = parser.parse_args()
 
-# Store the file name
-filename = options.file
-
-# Load the csv file with the profiling data
-profile = mlab.csv2rec(filename, comments="#", skiprows=0, checkrows=0)
-
-# Get total number of groups
-maxID = 0
-for val in range(len(profile.function_name)):
-    if profile.function_id[val] > maxID:
-        maxID = profile.function_id[val]
+# Load the csv file with the profiling data, one row per region, where the
+# region name is the path of enclosing regions separated by "/"
+with open(options.file) as csvfile:
+    regions = list(csv.DictReader(csvfile))
+
+time = {row["Region"]: float(row["Avg_Time"]) for row in regions}
+
+# Group the regions by parent (top level regions have an empty parent)
+children = {}
+for row in regions:
+    name = row["Region"]
+    parent = name.rsplit("/", 1)[0] if "/" in name else ""
+    children.setdefault(parent, []).append(row)
+
+# Print the regions with the largest load imbalance over ranks and threads
+print("%-60s %12s %10s %10s" % ("Region", "Avg_Time", "Ranks", "Threads"))
+for row in sorted(
+    regions, key=lambda row: float(row["Rank_Imbalance"]), reverse=True
+):
+    print(
+        "%-60s %12.4e %10.3f %10.3f"
+        % (
+            row["Region"],
+            time[row["Region"]],
+            float(row["Rank_Imbalance"]),
+            float(row["Thread_Imbalance"]),
+        )
+    )
 
-# Get some arrays for sorting out the groups
-labels = [[] for i in range(maxID)]
-fracs = [[] for i in range(maxID)]
-explode = [[] for i in range(maxID)]
-calls = [[] for i in range(maxID)]
+# Make one figure per parent region, with the breakdown of its time
+for group, (parent, rows) in enumerate(sorted(children.items())):
 
-# Process the profiling data into group IDs
-for val in range(len(profile.function_name)):
-    labels[profile.function_id[val] - 1].append(profile.function_name[val])
-    fracs[profile.function_id[val] - 1].append(profile.avg_total_time[val])
-    explode[profile.function_id[val] - 1].append(0)
-    calls[profile.function_id[val] - 1].append(profile.n_calls[val])
+    rows = sorted(rows, key=lambda row: time[row["Region"]])
+    labels = [row["Region"].rsplit("/", 1)[-1] for row in rows]
+    fracs = [time[row["Region"]] for row in rows]
+    imbalance = [float(row["Rank_Imbalance"]) for row in rows]
 
-# Loop over each of the group IDs and make figures
-for val in range(maxID):
+    # The time of the parent that is not covered by its sub-regions
+    if parent:
+        other = time[parent] - sum(fracs)
+        if other > 0:
+            labels.append("(other)")
+            fracs.append(other)
+            imbalance.append(1.0)
 
-    # Create a Pie chart to see the time spent in each subroutine
     fig = plt.figure(figsize=[18, 8])
     ax = fig.add_subplot(121)
-    ax.set_title("Total Time Spent in Each Function")
-
-    # Sort the pieces to make it pretty
-    fracs[val], labels[val], calls[val] = (
-        list(x) for x in zip(*sorted(zip(fracs[val], labels[val], calls[val])))
-    )
-
-    # Call to make the pie chart
+    ax.set_title("Time Spent in Each Region of " + (parent if parent else "SU2"))
     pie_wedge_collection = ax.pie(
-        fracs[val],
-        explode=explode[val],
-        labels=labels[val],
+        fracs,
+        labels=labels,
         labeldistance=1.05,
         autopct="%1.1f%%",
         shadow=False,
@@ -88,26 +94,19 @@ for val in range(maxID):
     for pie_wedge in pie_wedge_collection[0]:
         pie_wedge.set_edgecolor("white")
 
-    # Sort the number of calls again for the bar chart
-    calls[val], labels[val] = (
-        list(x) for x in zip(*sorted(zip(calls[val], labels[val])))
-    )
-
-    # Create a bar chart for the number of function calls
+    # Bar chart of the load imbalance (max/avg over ranks)
     ax = fig.add_subplot(122)
-    ax.set_title("Number of Function Calls")
-    width = 0.35
-    ax.bar(range(len(calls[val])), calls[val], width=width)
-    ax.set_xticks(np.arange(len(calls[val])) + width / 2)
-    ax.set_xticklabels(labels[val])
-    ax.set_xlabel("Function")
-    ax.set_ylabel("Calls")
+    ax.set_title("Load Imbalance Over Ranks")
+    ax.bar(range(len(imbalance)), imbalance, width=0.35)
+    ax.set_xticks(range(len(imbalance)))
+    ax.set_xticklabels(labels)
+    ax.set_xlabel("Region")
+    ax.set_ylabel("Max / Avg Time")
     fig.autofmt_xdate()
     fig.subplots_adjust(wspace=0.5)
 
     # Save a figure for this group
-    filename = "profile_group_" + str(val) + ".png"
-    fig.savefig(filename, format="png")
+    fig.savefig("profile_group_" + str(group) + ".png", format="png")
 
-    # Uncomment the next line to open the plots on the screen
-    show()
+# Uncomment the next line to open the plots on the screen
+# plt.show()
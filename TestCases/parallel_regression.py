@@ -222,6 +222,14 @@ def main():
     naca0012.test_vals = [-4.014140, -3.537888, 0.333403, 0.021227]
     test_list.append(naca0012)
 
+    # NACA0012 with persistent MPI requests for the halo exchanges, same residuals as above
+    naca0012_persistent           = TestCase('naca0012_persistent')
+    naca0012_persistent.cfg_dir   = "euler/naca0012"
+    naca0012_persistent.cfg_file  = "inv_NACA0012_Roe_persistent.cfg"
+    naca0012_persistent.test_iter = 20
+    naca0012_persistent.test_vals = [-4.014140, -3.537888, 0.333403, 0.021227]
+    test_list.append(naca0012_persistent)
+
     # Supersonic wedge
     wedge           = TestCase('wedge')
     wedge.cfg_dir   = "euler/wedge"
@@ -477,6 +485,16 @@ def main():
     turb_naca0012_sst_expliciteuler.timeout   = 3200
     test_list.append(turb_naca0012_sst_expliciteuler)
 
+    # NACA0012 (SST, explicit Euler), repartitioned after 5 iterations, the migrated solution gives the same residuals
+    turb_naca0012_sst_rebalance           = TestCase('turb_naca0012_sst_rebalance')
+    turb_naca0012_sst_rebalance.cfg_dir   = "rans/naca0012"
+    turb_naca0012_sst_rebalance.cfg_file  = "turb_NACA0012_sst_expliciteuler_rebalance.cfg"
+    turb_naca0012_sst_rebalance.test_iter = 10
+    turb_naca0012_sst_rebalance.test_vals = [-3.532289, -3.157766, 3.364024, 1.122901, 0.500798, -float("inf")]
+    turb_naca0012_sst_rebalance.timeout   = 3200
+    turb_naca0012_sst_rebalance.tol       = 0.00001
+    test_list.append(turb_naca0012_sst_rebalance)
+
     # PROPELLER
     propeller           = TestCase('propeller')
     propeller.cfg_dir   = "rans/propeller"
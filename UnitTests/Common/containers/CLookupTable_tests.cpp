@@ -130,3 +130,60 @@ TEST_CASE("LUTreader_3D", "[tabulated chemistry]") {
   look_up_table.LookUp_XYZ(look_up_tag, &look_up_dat, prog, enth, mfrac);
   CHECK(look_up_dat == Approx(1.1738796125));
 }
+
+TEST_CASE("LUTreader_batch", "[tabulated chemistry]") {
+  CLookUpTable look_up_table("src/SU2/UnitTests/Common/containers/lookuptable_3D.drg", "ProgressVariable",
+                             "EnthalpyTot");
+
+  /*--- resolve the variable names once ---*/
+
+  const auto idx_vars = look_up_table.GetVarIndices({"Density", "NULL", "Viscosity"});
+  CHECK(idx_vars[1] == CLookUpTable::NO_VARIABLE);
+
+  /*--- the batched lookup must match the single point lookups, including points outside the table ---*/
+
+  const su2double prog[] = {0.55, 0.56, 0.6, 1.10};
+  const su2double enth[] = {-0.5, -0.49, 0.9, 1.1};
+  const su2double mfrac[] = {0.5, 0.5, 0.8, 2.0};
+  su2double look_up_dat[4 * 3];
+  unsigned long exit_codes[4];
+
+  const auto n_misses = look_up_table.LookUp_Batch(idx_vars, 4, prog, enth, mfrac, look_up_dat, exit_codes);
+  CHECK(n_misses == 1);
+  CHECK(exit_codes[3] == 1);
+
+  for (auto i = 0u; i < 4; i++) {
+    su2double density, viscosity;
+    look_up_table.LookUp_XYZ("Density", &density, prog[i], enth[i], mfrac[i]);
+    look_up_table.LookUp_XYZ("Viscosity", &viscosity, prog[i], enth[i], mfrac[i]);
+    CHECK(look_up_dat[3 * i] == Approx(density));
+    CHECK(look_up_dat[3 * i + 1] == 0.0);
+    CHECK(look_up_dat[3 * i + 2] == Approx(viscosity));
+  }
+  CHECK(look_up_dat[0] == Approx(1.02));
+  CHECK(look_up_dat[9] == Approx(1.1738796125));
+}
+
+TEST_CASE("LUTreader_binary", "[tabulated chemistry]") {
+  const string file_name = "src/SU2/UnitTests/Common/containers/lookuptable_3D.drg";
+  remove((file_name + ".bin").c_str());
+
+  /*--- the first table is read from the ASCII file and writes the binary version, the second maps it ---*/
+
+  CLookUpTable ascii_table(file_name, "ProgressVariable", "EnthalpyTot", true);
+  CLookUpTable binary_table(file_name, "ProgressVariable", "EnthalpyTot", true);
+
+  const su2double prog[] = {0.55, 0.6, 1.10};
+  const su2double enth[] = {-0.5, 0.9, 1.1};
+  const su2double mfrac[] = {0.5, 0.8, 2.0};
+
+  for (auto i = 0u; i < 3; i++) {
+    su2double ascii_val, binary_val;
+    ascii_table.LookUp_XYZ("Density", &ascii_val, prog[i], enth[i], mfrac[i]);
+    binary_table.LookUp_XYZ("Density", &binary_val, prog[i], enth[i], mfrac[i]);
+    CHECK(binary_val == Approx(ascii_val));
+  }
+  CHECK(SU2_TYPE::GetValue(*binary_table.GetTableLimitsX().second) == Approx(1.0));
+
+  remove((file_name + ".bin").c_str());
+}
@@ -25,8 +25,14 @@
  * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+
 #include "catch.hpp"
 #include "../../UnitQuadTestCase.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 
 std::unique_ptr<UnitQuadTestCase> TestCase;
 
@@ -140,3 +146,228 @@ TEST_CASE("Set bound control volume", "[Geometry]") {
   CHECK(TestCase->geometry->vertex[3][2]->GetNormal()[1] == -0.0625);
   CHECK(TestCase->geometry->vertex[5][3]->GetNormal()[2] == 0.03125);
 }
+
+TEST_CASE("Generated box meshes", "[Geometry]") {
+  /*--- Splitting the cells, clustering, and perturbing the points give valid conforming grids of the same volume. ---*/
+  const std::string kinds[] = {"PRISMS", "TETRAHEDRA", "MIXED"};
+  const unsigned long nElem[] = {128, 384, 256};
+  const unsigned long nElemBound[] = {16, 32, 24};
+
+  for (int iKind = 0; iKind < 3; ++iKind) {
+    UnitQuadTestCase testCase;
+    testCase.AddOption("MESH_BOX_ELEMENTS= " + kinds[iKind]);
+    testCase.AddOption("MESH_BOX_STRETCHING= 2.0, 0.0, 1.0");
+    testCase.AddOption("MESH_BOX_PERTURBATION= 0.2");
+    testCase.InitConfig();
+    testCase.InitGeometry();
+    const auto geometry = testCase.geometry.get();
+
+    CHECK(geometry->GetnPoint() == 125);
+    CHECK(geometry->GetnElem() == nElem[iKind]);
+    /*--- The order of the markers depends on the element types, find them by name. ---*/
+    for (unsigned short iMarker = 0; iMarker < geometry->GetnMarker(); ++iMarker) {
+      const auto& tag = testCase.config->GetMarker_All_TagBound(iMarker);
+      if (tag == "x_minus") CHECK(geometry->GetnElem_Bound(iMarker) == nElemBound[iKind]);
+      if (tag == "z_minus") CHECK(geometry->GetnElem_Bound(iMarker) == 32);
+    }
+    CHECK(testCase.config->GetDomainVolume() == Approx(1.0));
+
+    su2double minVolume = 1.0;
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+      minVolume = min(minVolume, geometry->nodes->GetVolume(iPoint));
+    CHECK(minVolume > 0.0);
+  }
+}
+
+TEST_CASE("Space-filling curves", "[Geometry]") {
+  /*--- Both curves visit each cell of the integer grid once, consecutive cells of the Hilbert curve are neighbors. ---*/
+  for (unsigned short nDim = 2; nDim <= 3; ++nDim) {
+    const int nBits = 3;
+    const uint32_t n = 1u << nBits;
+    const uint64_t nCell = (nDim == 2) ? n * n : n * n * n;
+
+    std::vector<std::array<uint32_t, 3> > hilbertCells(nCell);
+    std::vector<bool> mortonVisited(nCell, false);
+    for (uint64_t iCell = 0; iCell < nCell; ++iCell) {
+      const uint32_t x[3] = {uint32_t(iCell % n), uint32_t(iCell / n % n), uint32_t(iCell / (n * n))};
+      const auto hilbert = GeometryToolbox::HilbertIndex(nDim, nBits, x);
+      const auto morton = GeometryToolbox::MortonIndex(nDim, nBits, x);
+      REQUIRE(hilbert < nCell);
+      REQUIRE(morton < nCell);
+      hilbertCells[hilbert] = {x[0], x[1], x[2]};
+      mortonVisited[morton] = true;
+    }
+    CHECK(std::count(mortonVisited.begin(), mortonVisited.end(), true) == long(nCell));
+
+    for (uint64_t iCell = 1; iCell < nCell; ++iCell) {
+      uint32_t distance = 0;
+      for (unsigned short iDim = 0; iDim < 3; ++iDim) {
+        const auto a = hilbertCells[iCell][iDim], b = hilbertCells[iCell - 1][iDim];
+        distance += (a > b) ? a - b : b - a;
+      }
+      CHECK(distance == 1);
+    }
+  }
+  const uint32_t x[] = {1, 0};
+  CHECK(GeometryToolbox::MortonIndex(2, 2, x) == 2);
+}
+
+TEST_CASE("Point and edge ordering", "[Geometry]") {
+  /*--- The ordering changes the numbering but not the grid, and the edges of the points stay consistent. ---*/
+  const std::string orderings[] = {"NONE", "RCM", "HILBERT", "MORTON"};
+  unsigned long naturalBandwidth = 0;
+
+  for (const auto& ordering : orderings) {
+    UnitQuadTestCase testCase;
+    testCase.AddOption("POINT_ORDERING= " + ordering);
+    testCase.AddOption("EDGE_ORDERING= BLOCKED");
+    testCase.InitConfig();
+    const auto config = testCase.config.get();
+
+    cout.rdbuf(nullptr);
+    std::unique_ptr<CGeometry> geometry;
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config, 0, 1));
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config));
+    }
+    geometry->SetSendReceive(config);
+    geometry->SetBoundaries(config);
+    geometry->SetPoint_Connectivity();
+    geometry->SetPoint_Ordering(config);
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->SetEdges();
+    geometry->SetEdge_Ordering(config->GetKind_EdgeOrdering());
+    geometry->SetVertex(config);
+    geometry->SetControlVolume(config, ALLOCATE);
+    cout.rdbuf(testCase.orig_buf);
+
+    CHECK(geometry->GetnEdge() == 300);
+    CHECK(config->GetDomainVolume() == Approx(1.0));
+
+    std::vector<bool> globalIndexUsed(geometry->GetnPoint(), false);
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      globalIndexUsed[geometry->nodes->GetGlobalIndex(iPoint)] = true;
+      for (auto iNode = 0u; iNode < geometry->nodes->GetnPoint(iPoint); ++iNode) {
+        const auto iEdge = geometry->nodes->GetEdge(iPoint, iNode);
+        const auto jPoint = geometry->nodes->GetPoint(iPoint, iNode);
+        CHECK(min(iPoint, jPoint) == geometry->edges->GetNode(iEdge, 0));
+        CHECK(max(iPoint, jPoint) == geometry->edges->GetNode(iEdge, 1));
+      }
+    }
+    CHECK(std::count(globalIndexUsed.begin(), globalIndexUsed.end(), true) == long(geometry->GetnPoint()));
+
+    unsigned long bandwidth = 0;
+    passivedouble edgeGap = 0.0;
+    geometry->GetOrdering_Metrics(bandwidth, edgeGap);
+    if (ordering == "NONE") naturalBandwidth = bandwidth;
+    if (ordering == "RCM") CHECK(bandwidth <= naturalBandwidth);
+    CHECK(bandwidth > 0);
+    CHECK(edgeGap > 0.0);
+  }
+}
+
+TEST_CASE("Partition cache round trip", "[Geometry]") {
+  /*--- The grid loaded from the cache is identical to the distributed one, including the mesh file AoA offset. ---*/
+  const std::string meshFileName = "partition_cache_test.su2";
+  const unsigned long n = 4;
+  {
+    std::ofstream mesh(meshFileName);
+    mesh << "NDIME= 2\nAOA_OFFSET= 1.5\nNELEM= " << (n - 1) * (n - 1) << "\n";
+    for (auto j = 0ul; j < n - 1; ++j)
+      for (auto i = 0ul; i < n - 1; ++i)
+        mesh << "9 " << j * n + i << " " << j * n + i + 1 << " " << (j + 1) * n + i + 1 << " " << (j + 1) * n + i << "\n";
+    mesh << "NPOIN= " << n * n << "\n";
+    for (auto iPoint = 0ul; iPoint < n * n; ++iPoint)
+      mesh << (iPoint % n) / (n - 1.0) << " " << (iPoint / n) / (n - 1.0) << " " << iPoint << "\n";
+    mesh << "NMARK= 2\nMARKER_TAG= lower\nMARKER_ELEMS= " << n - 1 << "\n";
+    for (auto i = 0ul; i < n - 1; ++i) mesh << "3 " << i << " " << i + 1 << "\n";
+    mesh << "MARKER_TAG= upper\nMARKER_ELEMS= " << n - 1 << "\n";
+    for (auto i = 0ul; i < n - 1; ++i) mesh << "3 " << n * (n - 1) + i << " " << n * (n - 1) + i + 1 << "\n";
+  }
+  const std::string options =
+      "SOLVER= EULER\n"
+      "MESH_FORMAT= SU2\n"
+      "MESH_FILENAME= " + meshFileName + "\n"
+      "MARKER_EULER= ( lower )\n"
+      "MARKER_FAR= ( upper )\n"
+      "AOA= 2.0\n"
+      "PARTITION_CACHE= YES\n"
+      "PARTITION_CACHE_FILENAME= partition_cache_test\n";
+
+  UnitQuadTestCase distributed, cached;
+  distributed.config_options = options;
+  cached.config_options = options;
+  distributed.InitConfig();
+  cached.InitConfig();
+
+  cout.rdbuf(nullptr);
+  {
+    auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(distributed.config.get(), 0, 1));
+    distributed.geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), distributed.config.get()));
+  }
+  const auto cacheFileName = CPhysicalGeometry::GetPartitionCacheFileName(cached.config.get());
+  REQUIRE(CPhysicalGeometry::CheckPartitionCache(cacheFileName));
+  cached.geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(cached.config.get(), cacheFileName));
+  cout.rdbuf(distributed.orig_buf);
+
+  const auto a = distributed.geometry.get();
+  const auto b = cached.geometry.get();
+
+  CHECK(cached.config->GetAoA() == Approx(3.5));
+  CHECK(cached.config->GetAoA_Offset() == distributed.config->GetAoA_Offset());
+
+  REQUIRE(b->GetnPoint() == a->GetnPoint());
+  CHECK(b->GetnPointDomain() == a->GetnPointDomain());
+  for (auto iPoint = 0ul; iPoint < a->GetnPoint(); ++iPoint) {
+    CHECK(b->nodes->GetGlobalIndex(iPoint) == a->nodes->GetGlobalIndex(iPoint));
+    for (unsigned short iDim = 0; iDim < a->GetnDim(); ++iDim)
+      CHECK(b->nodes->GetCoord(iPoint, iDim) == a->nodes->GetCoord(iPoint, iDim));
+  }
+
+  REQUIRE(b->GetnElem() == a->GetnElem());
+  for (auto iElem = 0ul; iElem < a->GetnElem(); ++iElem) {
+    REQUIRE(b->elem[iElem]->GetnNodes() == a->elem[iElem]->GetnNodes());
+    for (unsigned short iNode = 0; iNode < a->elem[iElem]->GetnNodes(); ++iNode)
+      CHECK(b->elem[iElem]->GetNode(iNode) == a->elem[iElem]->GetNode(iNode));
+  }
+
+  REQUIRE(b->GetnMarker() == a->GetnMarker());
+  for (unsigned short iMarker = 0; iMarker < a->GetnMarker(); ++iMarker) {
+    CHECK(cached.config->GetMarker_All_TagBound(iMarker) == distributed.config->GetMarker_All_TagBound(iMarker));
+    REQUIRE(b->GetnElem_Bound(iMarker) == a->GetnElem_Bound(iMarker));
+    for (auto iElem = 0ul; iElem < a->GetnElem_Bound(iMarker); ++iElem)
+      for (unsigned short iNode = 0; iNode < a->bound[iMarker][iElem]->GetnNodes(); ++iNode)
+        CHECK(b->bound[iMarker][iElem]->GetNode(iNode) == a->bound[iMarker][iElem]->GetNode(iNode));
+  }
+
+  std::remove(cacheFileName.c_str());
+  std::remove(meshFileName.c_str());
+}
+
+TEST_CASE("Distributed wall distance", "[Geometry]") {
+  /*--- The wall distance computed with the local wall ADTs matches the one of the global ADT. ---*/
+  UnitQuadTestCase testCase;
+  testCase.AddOption("MESH_BOX_PERTURBATION= 0.2");
+  testCase.InitConfig();
+  testCase.InitGeometry();
+  const auto config = testCase.config.get();
+  const auto geometry = testCase.geometry.get();
+
+  geometry->SetWallDistance(numeric_limits<su2double>::max());
+  const auto globalADT = geometry->ComputeViscousWallADT(config, true);
+  REQUIRE(!globalADT->IsEmpty());
+  geometry->SetWallDistance(globalADT.get(), config, 0);
+
+  std::vector<su2double> reference(geometry->GetnPoint());
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+    reference[iPoint] = geometry->nodes->GetWall_Distance(iPoint);
+
+  geometry->SetWallDistance(numeric_limits<su2double>::max());
+  const auto localADT = geometry->ComputeViscousWallADT(config, false);
+  geometry->SetWallDistanceDistributed(localADT.get(), config, 0);
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint)
+    CHECK(geometry->nodes->GetWall_Distance(iPoint) == Approx(reference[iPoint]));
+}
@@ -0,0 +1,129 @@
+/*!
+ * \file CAlgebraicMultigrid_tests.cpp
+ * \brief Unit tests for the aggregation-based algebraic multigrid preconditioner.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/linear_algebra/CAlgebraicMultigrid.hpp"
+
+namespace {
+/*!
+ * \brief 5-point Laplacian of a n x n grid (Dirichlet boundaries) in block CSR format, with nVar = 1. The first row
+ *        is also coupled to a few halo columns (index >= n * n), which the preconditioner must ignore.
+ */
+struct CLaplacian {
+  unsigned long nRow, nHalo = 3;
+  std::vector<unsigned long> rowPtr, colIdx, diaPtr;
+  std::vector<su2mixedfloat> values;
+
+  explicit CLaplacian(unsigned long n) : nRow(n * n) {
+    rowPtr.push_back(0);
+    for (auto i = 0ul; i < n; ++i) {
+      for (auto j = 0ul; j < n; ++j) {
+        const auto row = i * n + j;
+        auto add = [&](unsigned long col, su2mixedfloat val) {
+          if (col == row) diaPtr.push_back(colIdx.size());
+          colIdx.push_back(col);
+          values.push_back(val);
+        };
+        if (i > 0) add(row - n, -1);
+        if (j > 0) add(row - 1, -1);
+        add(row, 4);
+        if (j + 1 < n) add(row + 1, -1);
+        if (i + 1 < n) add(row + n, -1);
+        if (row == 0) {
+          for (auto h = 0ul; h < nHalo; ++h) add(nRow + h, -1);
+        }
+        rowPtr.push_back(colIdx.size());
+      }
+    }
+  }
+
+  /*! \brief y = A x, restricted to the domain rows and columns. */
+  void Product(const std::vector<su2mixedfloat>& x, std::vector<su2mixedfloat>& y) const {
+    for (auto i = 0ul; i < nRow; ++i) {
+      y[i] = 0;
+      for (auto k = rowPtr[i]; k < rowPtr[i + 1]; ++k)
+        if (colIdx[k] < nRow) y[i] += values[k] * x[colIdx[k]];
+    }
+  }
+};
+}  // namespace
+
+TEST_CASE("AMG hierarchy and V-cycle", "[AMG]") {
+  std::stringstream options;
+  options << "SOLVER= EULER\n"
+          << "LINEAR_SOLVER_PREC= AMG\n"
+          << "LINEAR_SOLVER_AMG_LEVELS= 5\n"
+          << "LINEAR_SOLVER_AMG_COARSE_SIZE= 16\n";
+  const CConfig config(options, SU2_COMPONENT::SU2_CFD, false);
+
+  const CLaplacian A(32);
+  CAlgebraicMultigrid<su2mixedfloat> amg;
+  amg.Build(1, A.nRow, A.rowPtr.data(), A.colIdx.data(), A.diaPtr.data(), A.values.data(), 4, &config);
+
+  REQUIRE(amg.GetNumLevels() > 1);
+
+  /*--- The aggregates of each level partition its rows, every row of the next level is a non-empty aggregate. ---*/
+  for (auto iLevel = 0ul; iLevel + 1 < amg.GetNumLevels(); ++iLevel) {
+    const auto& aggregates = amg.GetAggregates(iLevel);
+    const auto nCoarse = amg.GetNumRows(iLevel + 1);
+    REQUIRE(aggregates.size() == amg.GetNumRows(iLevel));
+    CHECK(nCoarse < amg.GetNumRows(iLevel));
+
+    std::vector<unsigned long> aggregateSize(nCoarse, 0);
+    for (const auto iAgg : aggregates) {
+      REQUIRE(iAgg < nCoarse);
+      ++aggregateSize[iAgg];
+    }
+    CHECK(std::count(aggregateSize.begin(), aggregateSize.end(), 0ul) == 0);
+  }
+
+  /*--- Richardson iterations preconditioned by the V-cycle converge. The piecewise constant prolongation
+   *    over-corrects the smooth error on the first cycle, after that the residual decreases monotonically. ---*/
+  std::vector<su2mixedfloat> b(A.nRow, 1), x(A.nRow, 0), r(b), Ax(A.nRow), dx(A.nRow);
+  auto norm = [](const std::vector<su2mixedfloat>& v) {
+    passivedouble sum = 0;
+    for (const auto vi : v) sum += pow(SU2_TYPE::GetValue(vi), 2);
+    return sqrt(sum);
+  };
+  const auto initialNorm = norm(r);
+  auto lastNorm = initialNorm;
+
+  for (int iter = 0; iter < 40; ++iter) {
+    amg.Apply(r.data(), dx.data());
+    for (auto i = 0ul; i < A.nRow; ++i) x[i] += dx[i];
+    A.Product(x, Ax);
+    for (auto i = 0ul; i < A.nRow; ++i) r[i] = b[i] - Ax[i];
+    const auto newNorm = norm(r);
+    if (iter > 0) CHECK(newNorm < lastNorm);
+    lastNorm = newNorm;
+  }
+  CHECK(lastNorm < 0.05 * initialNorm);
+}
@@ -0,0 +1,98 @@
+/*!
+ * \file CProfiler_tests.cpp
+ * \brief Unit tests for the hierarchical profiler of code regions.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../Common/include/toolboxes/CProfiler.hpp"
+#include "../../../Common/include/parallelization/omp_structure.hpp"
+#include "../../../Common/include/option_structure.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+TEST_CASE("Profiler regions", "[Profiler]") {
+  CProfiler::Enable(true);
+
+  for (int iter = 0; iter < 3; ++iter) {
+    SU2_PROFILE_REGION("Outer");
+    {
+      SU2_PROFILE_REGION("Inner");
+    }
+    /*--- Regions opened by all threads nest in the innermost serial region. ---*/
+    SU2_OMP_PARALLEL
+    {
+      SU2_PROFILE_REGION("Parallel");
+      SU2_PROFILE_REGION("Inner");
+    }
+    END_SU2_OMP_PARALLEL
+  }
+  {
+    SU2_PROFILE_REGION("Inner");
+  }
+
+  CHECK(CProfiler::GetLocalTiming("Outer").second == 3);
+  CHECK(CProfiler::GetLocalTiming("Outer/Inner").second == 3);
+  CHECK(CProfiler::GetLocalTiming("Outer/Parallel").second == 3);
+  CHECK(CProfiler::GetLocalTiming("Outer/Parallel/Inner").second == 3);
+  CHECK(CProfiler::GetLocalTiming("Inner").second == 1);
+  CHECK(CProfiler::GetLocalTiming("Parallel").second == 0);
+  CHECK(CProfiler::GetLocalTiming("Outer").first >= CProfiler::GetLocalTiming("Outer/Parallel").first);
+
+  const auto summary = CProfiler::GetSummary();
+  REQUIRE(summary.size() == 5);
+  CHECK(summary[1].path == "Outer");
+  CHECK(summary[1].calls == 3);
+  CHECK(summary[1].minTime <= summary[1].avgTime);
+  CHECK(summary[1].avgTime <= summary[1].maxTime);
+
+  /*--- One line per region, sub-regions after their parent. ---*/
+  const std::string fileName = "profiler_test.csv";
+  CProfiler::WriteReport(fileName);
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) {
+    std::vector<std::string> regions;
+    {
+      std::ifstream file(fileName);
+      std::string line;
+      std::getline(file, line);
+      while (std::getline(file, line)) regions.push_back(line.substr(0, line.find(',')));
+    }
+    std::remove(fileName.c_str());
+
+    REQUIRE(regions.size() == 5);
+    CHECK(regions[0] == "\"Inner\"");
+    CHECK(regions[1] == "\"Outer\"");
+    CHECK(regions[2] == "\"Outer/Inner\"");
+    CHECK(regions[3] == "\"Outer/Parallel\"");
+    CHECK(regions[4] == "\"Outer/Parallel/Inner\"");
+  }
+
+  CProfiler::Enable(false);
+  {
+    SU2_PROFILE_REGION("Outer");
+  }
+  CHECK(CProfiler::GetLocalTiming("Outer").second == 0);
+}
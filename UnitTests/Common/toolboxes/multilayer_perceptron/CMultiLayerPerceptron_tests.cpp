@@ -0,0 +1,78 @@
+/*!
+ * \file CMultiLayerPerceptron_tests.cpp
+ * \brief Unit tests for the batched in-tree MLP evaluator.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../../Common/include/toolboxes/multilayer_perceptron/CMultiLayerPerceptron.hpp"
+#include <vector>
+
+TEST_CASE("Batched MLP evaluation", "[LookUpANN]") {
+  CMultiLayerPerceptron mlp("src/SU2/UnitTests/Common/toolboxes/multilayer_perceptron/simple_mlp.mlp");
+
+  REQUIRE(mlp.GetnInputs() == 2);
+  REQUIRE(mlp.GetnOutputs() == 1);
+  CHECK(mlp.GetInputIndex("y") == 1);
+  CHECK(mlp.GetOutputIndex("z") == 0);
+  CHECK(mlp.GetOutputIndex("w") == -1);
+
+  /*--- Same reference values as the MLPCpp test, inside and outside the training data range. ---*/
+  su2double inputs[] = {1.0, -0.5, 3.0, -10.0}, z[2];
+  CHECK(mlp.Predict(2, inputs, 0, z) == 1);
+  CHECK(z[0] == Approx(0.344829));
+  CHECK(z[1] == Approx(0.012737));
+
+  /*--- A large batch spanning several blocks gives the same values as single evaluations, and the analytic
+   * derivatives match finite differences. ---*/
+  const unsigned long n_points = 100;
+  std::vector<su2double> x(2 * n_points), values(n_points), d_values(2 * n_points), d2_values(3 * n_points);
+  for (auto iPoint = 0ul; iPoint < n_points; iPoint++) {
+    x[2 * iPoint] = 2.0 * iPoint / (n_points - 1);
+    x[2 * iPoint + 1] = -1.0 + 0.7 * iPoint / (n_points - 1);
+  }
+  mlp.Predict(n_points, x.data(), 2, values.data(), d_values.data(), d2_values.data());
+
+  const su2double h = 1e-4;
+  for (auto iPoint = 0ul; iPoint < n_points; iPoint += 9) {
+    su2double value, d_single[2], d2_single[3];
+    mlp.Predict(1, &x[2 * iPoint], 1, &value, d_single);
+    CHECK(value == Approx(values[iPoint]));
+
+    for (auto iInput = 0u; iInput < 2; iInput++) {
+      su2double x_p[2] = {x[2 * iPoint], x[2 * iPoint + 1]}, x_m[2] = {x_p[0], x_p[1]};
+      x_p[iInput] += h;
+      x_m[iInput] -= h;
+      su2double z_p, z_m, dz_p[2], dz_m[2];
+      mlp.Predict(1, x_p, 2, &z_p, dz_p, d2_single);
+      mlp.Predict(1, x_m, 2, &z_m, dz_m, d2_single);
+
+      CHECK(d_values[2 * iPoint + iInput] == Approx(d_single[iInput]));
+      CHECK(d_values[2 * iPoint + iInput] == Approx((z_p - z_m) / (2 * h)).margin(1e-6));
+      for (auto jInput = 0u; jInput < 2; jInput++) {
+        const auto iHessian = mlp.GetHessianIndex(iInput, jInput);
+        CHECK(d2_values[3 * iPoint + iHessian] == Approx((dz_p[jInput] - dz_m[jInput]) / (2 * h)).margin(1e-5));
+      }
+    }
+  }
+}
@@ -0,0 +1,157 @@
+/*!
+ * \file CSU2TCLib_tests.cpp
+ * \brief Unit tests for the batched NEMO source terms.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <algorithm>
+#include <sstream>
+#include <vector>
+#include "../../../SU2_CFD/include/fluid/CSU2TCLib.hpp"
+
+TEST_CASE("Batched NEMO source terms match the scalar ones", "[NEMO]") {
+  std::stringstream config_options;
+
+  config_options << "SOLVER= NEMO_EULER" << std::endl;
+  config_options << "FLUID_MODEL= SU2_NONEQ" << std::endl;
+  config_options << "GAS_MODEL= AIR-5" << std::endl;
+  config_options << "GAS_COMPOSITION= (0.77, 0.23, 0.0, 0.0, 0.0)" << std::endl;
+
+  CConfig config(config_options, SU2_COMPONENT::SU2_CFD, false);
+  CSU2TCLib fluid(&config, 2, false);
+
+  REQUIRE(fluid.SupportsBatchSourceTerms());
+
+  /*--- More points than one batch, from near-equilibrium to strongly dissociated states. ---*/
+  const unsigned long nSpecies = 5, nPoints = 37;
+  std::vector<su2double> rhos(nPoints * nSpecies), T(nPoints), Tve(nPoints), ws(nPoints * nSpecies), omega(nPoints);
+  for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+    T[iPoint] = 1000.0 + 250.0 * iPoint;
+    Tve[iPoint] = 800.0 + 180.0 * ((7 * iPoint) % nPoints);
+    const su2double rho = pow(10.0, -3.0 + 3.0 * iPoint / (nPoints - 1));
+    const su2double dissociation = su2double(iPoint) / nPoints;
+    const su2double Y[] = {0.75 * (1 - dissociation), 0.23 * (1 - dissociation), 0.02, 0.5 * dissociation,
+                           0.5 * dissociation};
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++) rhos[iPoint * nSpecies + iSpecies] = rho * Y[iSpecies];
+  }
+
+  fluid.ComputeSourceTerms_Batch(nPoints, rhos.data(), T.data(), Tve.data(), ws.data(), omega.data());
+
+  for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+    std::vector<su2double> rhos_i(&rhos[iPoint * nSpecies], &rhos[(iPoint + 1) * nSpecies]);
+    fluid.SetTDStateRhosTTv(rhos_i, T[iPoint], Tve[iPoint]);
+
+    const auto& ws_i = fluid.ComputeNetProductionRates(false, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+    su2double ws_max = 0.0;
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++) ws_max = fmax(ws_max, fabs(ws_i[iSpecies]));
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++)
+      CHECK(ws[iPoint * nSpecies + iSpecies] == Approx(ws_i[iSpecies]).margin(1e-12 * ws_max));
+
+    CHECK(omega[iPoint] == Approx(fluid.ComputeEveSourceTerm()));
+  }
+}
+
+TEST_CASE("Batched NEMO source Jacobians match the scalar ones", "[NEMO]") {
+  std::stringstream config_options;
+
+  config_options << "SOLVER= NEMO_EULER" << std::endl;
+  config_options << "FLUID_MODEL= SU2_NONEQ" << std::endl;
+  config_options << "GAS_MODEL= AIR-5" << std::endl;
+  config_options << "GAS_COMPOSITION= (0.77, 0.23, 0.0, 0.0, 0.0)" << std::endl;
+
+  CConfig config(config_options, SU2_COMPONENT::SU2_CFD, false);
+  const unsigned long nDim = 2, nSpecies = 5, nVar = nSpecies + nDim + 2, nPoints = 21;
+  CSU2TCLib fluid(&config, nDim, false);
+
+  /*--- Arbitrary (but smooth) per point inputs of the Jacobians. ---*/
+  std::vector<su2double> rhos(nPoints * nSpecies), T(nPoints), Tve(nPoints), ws(nPoints * nSpecies), omega(nPoints);
+  std::vector<su2double> eve(nPoints * nSpecies), cvve(nPoints * nSpecies), dTdU(nPoints * nVar), dTvedU(nPoints * nVar);
+  std::vector<su2double> jacData(2 * nPoints * nVar * nVar), jacData_i(nVar * nVar);
+  std::vector<su2double*> jacRows(2 * nPoints * nVar), jacRows_i(nVar);
+  std::vector<const su2double*> eve_p(nPoints), cvve_p(nPoints), dTdU_p(nPoints), dTvedU_p(nPoints);
+  std::vector<su2double**> chemistry(nPoints), relaxation(nPoints);
+
+  for (auto iRow = 0ul; iRow < jacRows.size(); iRow++) jacRows[iRow] = &jacData[iRow * nVar];
+  for (auto iVar = 0ul; iVar < nVar; iVar++) jacRows_i[iVar] = &jacData_i[iVar * nVar];
+
+  for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+    T[iPoint] = 2000.0 + 400.0 * iPoint;
+    Tve[iPoint] = 1500.0 + 300.0 * ((5 * iPoint) % nPoints);
+    const su2double rho = pow(10.0, -3.0 + 2.0 * iPoint / (nPoints - 1));
+    const su2double dissociation = su2double(iPoint) / nPoints;
+    const su2double Y[] = {0.75 * (1 - dissociation), 0.23 * (1 - dissociation), 0.02, 0.5 * dissociation,
+                           0.5 * dissociation};
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++) {
+      rhos[iPoint * nSpecies + iSpecies] = rho * Y[iSpecies];
+      eve[iPoint * nSpecies + iSpecies] = 1e5 * (1 + iSpecies + 0.1 * iPoint);
+      cvve[iPoint * nSpecies + iSpecies] = 100.0 * (1 + iSpecies) + iPoint;
+    }
+    for (auto iVar = 0ul; iVar < nVar; iVar++) {
+      dTdU[iPoint * nVar + iVar] = 1e-3 * (1 + iVar) - 1e-5 * iPoint;
+      dTvedU[iPoint * nVar + iVar] = 2e-3 * (nVar - iVar) + 1e-5 * iPoint;
+    }
+    eve_p[iPoint] = &eve[iPoint * nSpecies];
+    cvve_p[iPoint] = &cvve[iPoint * nSpecies];
+    dTdU_p[iPoint] = &dTdU[iPoint * nVar];
+    dTvedU_p[iPoint] = &dTvedU[iPoint * nVar];
+    chemistry[iPoint] = &jacRows[iPoint * nVar];
+    relaxation[iPoint] = &jacRows[(nPoints + iPoint) * nVar];
+  }
+
+  CNEMOGas::SourceJacobians jacobians;
+  jacobians.eve = eve_p.data();
+  jacobians.cvve = cvve_p.data();
+  jacobians.dTdU = dTdU_p.data();
+  jacobians.dTvedU = dTvedU_p.data();
+  jacobians.chemistry = chemistry.data();
+  jacobians.relaxation = relaxation.data();
+
+  fluid.ComputeSourceTerms_Batch(nPoints, rhos.data(), T.data(), Tve.data(), ws.data(), omega.data(), &jacobians);
+
+  auto checkJacobian = [&](su2double** batch) {
+    su2double jac_max = 0.0;
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      for (auto jVar = 0ul; jVar < nVar; jVar++) jac_max = fmax(jac_max, fabs(jacRows_i[iVar][jVar]));
+    REQUIRE(jac_max > 0.0);
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      for (auto jVar = 0ul; jVar < nVar; jVar++)
+        CHECK(batch[iVar][jVar] == Approx(jacRows_i[iVar][jVar]).margin(1e-10 * jac_max));
+  };
+
+  for (auto iPoint = 0ul; iPoint < nPoints; iPoint++) {
+    std::vector<su2double> rhos_i(&rhos[iPoint * nSpecies], &rhos[(iPoint + 1) * nSpecies]);
+    fluid.SetTDStateRhosTTv(rhos_i, T[iPoint], Tve[iPoint]);
+
+    std::fill(jacData_i.begin(), jacData_i.end(), 0.0);
+    fluid.ComputeNetProductionRates(true, nullptr, eve_p[iPoint], cvve_p[iPoint], dTdU_p[iPoint], dTvedU_p[iPoint],
+                                    jacRows_i.data());
+    checkJacobian(chemistry[iPoint]);
+
+    std::fill(jacData_i.begin(), jacData_i.end(), 0.0);
+    fluid.ComputeEveSourceTerm();
+    fluid.GetEveSourceTermJacobian(nullptr, eve_p[iPoint], cvve_p[iPoint], dTdU_p[iPoint], dTvedU_p[iPoint],
+                                   jacRows_i.data());
+    checkJacobian(relaxation[iPoint]);
+  }
+}
@@ -0,0 +1,86 @@
+/*!
+ * \file CNewtonIntegration_tests.cpp
+ * \brief Unit tests for the preconditioner refresh policy of the Newton-Krylov integration.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/integration/CNewtonIntegration.hpp"
+
+using Policy = CNewtonIntegration::PrecondRefreshPolicy;
+
+namespace {
+Policy MakePolicy(unsigned short lag) {
+  Policy policy;
+  policy.lag = lag;
+  policy.itersFactor = 1.5;
+  policy.residualOrders = 1.0;
+  return policy;
+}
+}  // namespace
+
+TEST_CASE("NK preconditioner without lag is always refreshed", "[NewtonKrylov]") {
+  auto policy = MakePolicy(0);
+  for (int i = 0; i < 5; ++i) {
+    policy.Update(100, 10, -1.0 * i);
+    CHECK(policy.refresh);
+  }
+}
+
+TEST_CASE("NK preconditioner is reused for at most lag iterations", "[NewtonKrylov]") {
+  auto policy = MakePolicy(3);
+
+  /*--- Solve after a refresh, then three reuses, then a refresh is due. ---*/
+  const bool expected[] = {false, false, false, true, false, false, false, true};
+  for (auto refresh : expected) {
+    policy.Update(10, 100, -2.0);
+    CHECK(policy.refresh == refresh);
+  }
+}
+
+TEST_CASE("NK preconditioner is refreshed early", "[NewtonKrylov]") {
+  SECTION("Linear iterations grow") {
+    auto policy = MakePolicy(10);
+    policy.Update(10, 100, -2.0);
+    policy.Update(15, 100, -2.0);
+    CHECK_FALSE(policy.refresh);
+    policy.Update(16, 100, -2.0);
+    CHECK(policy.refresh);
+    /*--- The reference is reset by the next solve. ---*/
+    policy.Update(16, 100, -2.0);
+    CHECK_FALSE(policy.refresh);
+  }
+  SECTION("Linear solver does not converge") {
+    auto policy = MakePolicy(10);
+    policy.Update(100, 100, -2.0);
+    CHECK(policy.refresh);
+  }
+  SECTION("Residual changes") {
+    auto policy = MakePolicy(10);
+    policy.Update(10, 100, -2.0);
+    policy.Update(10, 100, -2.9);
+    CHECK_FALSE(policy.refresh);
+    policy.Update(10, 100, -3.1);
+    CHECK(policy.refresh);
+  }
+}
@@ -0,0 +1,159 @@
+/*!
+ * \file CNEMOEulerSolver_tests.cpp
+ * \brief Unit tests for the point-implicit (split) integration of the NEMO sources.
+ * \version 8.0.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2023, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <memory>
+#include <sstream>
+#include <vector>
+#include "../../../SU2_CFD/include/fluid/CSU2TCLib.hpp"
+#include "../../../SU2_CFD/include/solvers/CNEMOEulerSolver.hpp"
+
+TEST_CASE("Point-implicit NEMO sources converge to the unsplit steady state", "[NEMO]") {
+  std::stringstream config_options;
+
+  config_options << "SOLVER= NEMO_EULER" << std::endl;
+  config_options << "FLUID_MODEL= SU2_NONEQ" << std::endl;
+  config_options << "GAS_MODEL= AIR-5" << std::endl;
+  config_options << "GAS_COMPOSITION= (0.77, 0.23, 0.0, 0.0, 0.0)" << std::endl;
+
+  CConfig config(config_options, SU2_COMPONENT::SU2_CFD, false);
+  CSU2TCLib fluid(&config, 2, false);
+
+  const unsigned short nSpecies = 5, nDim = 2, nVar = nSpecies + nDim + 2, nPrimVar = nSpecies + nDim + 8;
+  const unsigned short iEve = nVar - 1;
+  const su2double MassFrac[] = {0.6, 0.15, 0.05, 0.1, 0.1}, Mach[] = {0.0, 0.0};
+
+  CNEMOEulerVariable nodes(1e4, MassFrac, Mach, 6000.0, 5000.0, 1, nDim, nVar, nPrimVar, nPrimVar, &config, &fluid);
+  nodes.SetPrimVar(0, &fluid);
+
+  CNEMOEulerSolver::PointImplicitWorkspace work(nSpecies, nVar, nPrimVar);
+
+  /*--- Chemistry and VT sources per unit volume at a state. ---*/
+  auto Sources = [&](su2double* U, su2double* S) {
+    REQUIRE_FALSE(nodes.Cons2PrimVar(U, work.V.data(), work.dPdU.data(), work.dTdU.data(), work.dTvedU.data(),
+                                     work.eves.data(), work.cvves.data()));
+    const auto& ws = fluid.ComputeNetProductionRates(false, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+    for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) S[iSpecies] = ws[iSpecies];
+    S[nSpecies] = fluid.ComputeEveSourceTerm();
+  };
+
+  /*--- A constant "flow residual" balanced by the sources at the reference state,
+   *    which is therefore the steady state of the unsplit problem. ---*/
+  std::vector<su2double> U_ref(nodes.GetSolution(0), nodes.GetSolution(0) + nVar), R(nSpecies + 1);
+  Sources(U_ref.data(), R.data());
+
+  /*--- The split iteration must converge to it for any time step (CFL). ---*/
+  for (const su2double dt : {1e-6, 1e-3}) {
+    /*--- Start with some N2 dissociated and a higher vib.-el. energy (same elements, mass, and energy). ---*/
+    auto U = U_ref;
+    U[0] -= 0.05 * U_ref[0];
+    U[3] += 0.05 * U_ref[0];
+    U[iEve] *= 1.05;
+
+    std::vector<su2double> S(nSpecies + 1);
+    for (auto iIter = 0; iIter < 500; iIter++) {
+      /*--- Explicit flow update, then the point-implicit correction of the sources. ---*/
+      const auto U_start = U;
+      Sources(U.data(), S.data());
+      for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++) U[iSpecies] += dt * (S[iSpecies] - R[iSpecies]);
+      U[iEve] += dt * (S[nSpecies] - R[nSpecies]);
+
+      REQUIRE(CNEMOEulerSolver::IntegrateSplitSources(&nodes, &fluid, false, 2, dt, U_start.data(),
+                                                      nodes.GetPrimitive(0), S.data(), U.data(), work));
+    }
+
+    for (auto iVar = 0u; iVar < nVar; iVar++) CHECK(U[iVar] == Approx(U_ref[iVar]).epsilon(1e-6).margin(1e-12));
+  }
+}
+
+TEST_CASE("Point-implicit NEMO sources with several threads match the serial integration", "[NEMO]") {
+  std::stringstream config_options;
+
+  config_options << "SOLVER= NEMO_EULER" << std::endl;
+  config_options << "FLUID_MODEL= SU2_NONEQ" << std::endl;
+  config_options << "GAS_MODEL= AIR-5" << std::endl;
+  config_options << "GAS_COMPOSITION= (0.77, 0.23, 0.0, 0.0, 0.0)" << std::endl;
+
+  CConfig config(config_options, SU2_COMPONENT::SU2_CFD, false);
+  CSU2TCLib fluid(&config, 2, false);
+
+  const unsigned short nSpecies = 5, nDim = 2, nVar = nSpecies + nDim + 2, nPrimVar = nSpecies + nDim + 8;
+  const unsigned short iEve = nVar - 1;
+  const su2double MassFrac[] = {0.6, 0.15, 0.05, 0.1, 0.1}, Mach[] = {0.0, 0.0};
+
+  CNEMOEulerVariable nodes(1e4, MassFrac, Mach, 6000.0, 5000.0, 1, nDim, nVar, nPrimVar, nPrimVar, &config, &fluid);
+  nodes.SetPrimVar(0, &fluid);
+
+  /*--- Flow updates of different "points" from the same initial state, the explicit sources are zero. ---*/
+  const int nThreads = 4, nPoints = 64;
+  const std::vector<su2double> U_start(nodes.GetSolution(0), nodes.GetSolution(0) + nVar), S(nSpecies + 1, 0.0);
+  const su2double* V_start = nodes.GetPrimitive(0);
+  const su2double dt = 1e-6;
+
+  auto FlowUpdate = [&](int iPoint) {
+    auto U = U_start;
+    const su2double f = 0.1 * (iPoint + 1) / nPoints;
+    U[0] -= f * U_start[0];
+    U[3] += f * U_start[0];
+    U[iEve] *= 1.0 + f;
+    return U;
+  };
+
+  std::vector<std::vector<su2double> > serial(nPoints), threaded(nPoints);
+  std::vector<int> serialOk(nPoints), threadedOk(nPoints);
+  {
+    CNEMOEulerSolver::PointImplicitWorkspace work(nSpecies, nVar, nPrimVar);
+    for (int iPoint = 0; iPoint < nPoints; iPoint++) {
+      serial[iPoint] = FlowUpdate(iPoint);
+      serialOk[iPoint] = CNEMOEulerSolver::IntegrateSplitSources(&nodes, &fluid, false, 3, dt, U_start.data(),
+                                                                 V_start, S.data(), serial[iPoint].data(), work);
+    }
+  }
+
+  /*--- One fluid model and workspace per thread, as in CNEMOEulerSolver::PointImplicit_Chemistry. ---*/
+  std::vector<std::unique_ptr<CSU2TCLib> > models(nThreads);
+  for (auto& model : models) model.reset(new CSU2TCLib(&config, nDim, false));
+
+  SU2_OMP_PARALLEL_ON(nThreads) {
+    CNEMOEulerSolver::PointImplicitWorkspace work(nSpecies, nVar, nPrimVar);
+    auto* model = models[omp_get_thread_num()].get();
+
+    SU2_OMP_FOR_DYN(1)
+    for (int iPoint = 0; iPoint < nPoints; iPoint++) {
+      threaded[iPoint] = FlowUpdate(iPoint);
+      threadedOk[iPoint] = CNEMOEulerSolver::IntegrateSplitSources(&nodes, model, false, 3, dt, U_start.data(),
+                                                                   V_start, S.data(), threaded[iPoint].data(), work);
+    }
+    END_SU2_OMP_FOR
+  }
+  END_SU2_OMP_PARALLEL
+
+  for (int iPoint = 0; iPoint < nPoints; iPoint++) {
+    REQUIRE(serialOk[iPoint]);
+    CHECK(threadedOk[iPoint] == serialOk[iPoint]);
+    for (auto iVar = 0u; iVar < nVar; iVar++) CHECK(threaded[iPoint][iVar] == serial[iPoint][iVar]);
+  }
+}